@@ -17,12 +17,18 @@ writer = generator.writer
 toolchain = generator.toolchain
 
 vector_lib = generator.lib(module = 'vector', sources = [
-  'euler.c', 'vector.c', 'version.c'])
+  'arena.c', 'blob.c', 'dispatch.c', 'dispatch_avx2.c', 'dispatch_avx512.c', 'dispatch_sse4.c', 'euler.c',
+  'hierarchy.c', 'parallel.c', 'vector.c', 'version.c', 'view.c'])
 
 if not target.is_ios() and not target.is_android() and not target.is_tizen():
   configs = [config for config in toolchain.configs if config not in ['profile', 'deploy']]
   if not configs == []:
     generator.bin('maskgen', ['main.c'], 'maskgen', basepath = 'tools', libs = dependlibs, dependlibs = dependlibs, configs = configs)
+    generator.bin('bench', ['main.c'], 'bench-vector', basepath = 'tools', implicit_deps = [vector_lib], libs = dependlibs, dependlibs = dependlibs, configs = configs)
+    generator.bin('accuracy', [
+      'main.c', 'backend_fallback.c', 'backend_neon.c', 'backend_sse2.c', 'backend_sse3.c', 'backend_sse4.c'],
+      'accuracy-vector', basepath = 'tools', implicit_deps = [vector_lib], libs = dependlibs, dependlibs = dependlibs,
+      configs = configs)
 
 if generator.skip_tests():
   sys.exit()
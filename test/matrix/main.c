@@ -29,6 +29,7 @@
 //#define FOUNDATION_ARCH_NEON 0
 
 #include <vector/vector.h>
+#include <vector/vector4d.h>
 
 #include "../test/vector.h"
 
@@ -212,6 +213,73 @@ DECLARE_TEST(matrix, ops) {
 	return 0;
 }
 
+DECLARE_TEST(matrix, inverse) {
+	matrix_t mat;
+	matrix_t inv;
+	matrix_t ident;
+
+	VECTOR_ALIGN float32_t aligned[] = {2, 1, 0, 3, 1, 1, 0, 1, 0, 3, 1, 2, 1, 0, 2, 4};
+
+	mat = matrix_inverse(matrix_identity());
+	EXPECT_VECTORALMOSTEQ(mat.row[0], vector(1, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(mat.row[1], vector(0, 1, 0, 0));
+	EXPECT_VECTORALMOSTEQ(mat.row[2], vector(0, 0, 1, 0));
+	EXPECT_VECTORALMOSTEQ(mat.row[3], vector(0, 0, 0, 1));
+
+	mat = matrix_inverse(matrix_aligned(aligned));
+	EXPECT_VECTORALMOSTEQ(mat.row[0], vector(-0.75f, 2.25f, -0.5f, 0.25f));
+	EXPECT_VECTORALMOSTEQ(mat.row[1], vector(-0.125f, 0.375f, 0.25f, -0.125f));
+	EXPECT_VECTORALMOSTEQ(mat.row[2], vector(-1.375f, 2.125f, -0.25f, 0.625f));
+	EXPECT_VECTORALMOSTEQ(mat.row[3], vector(0.875f, -1.625f, 0.25f, -0.125f));
+
+	ident = matrix_mul(matrix_aligned(aligned), mat);
+	EXPECT_VECTORALMOSTEQ(ident.row[0], vector(1, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[1], vector(0, 1, 0, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[2], vector(0, 0, 1, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[3], vector(0, 0, 0, 1));
+
+	mat = matrix_inverse(matrix_inverse(matrix_aligned(aligned)));
+	EXPECT_VECTORALMOSTEQ(mat.row[0], vector(2, 1, 0, 3));
+	EXPECT_VECTORALMOSTEQ(mat.row[1], vector(1, 1, 0, 1));
+	EXPECT_VECTORALMOSTEQ(mat.row[2], vector(0, 3, 1, 2));
+	EXPECT_VECTORALMOSTEQ(mat.row[3], vector(1, 0, 2, 4));
+
+	mat = matrix_from_quaternion(quaternion_scalar(0.48f, 0.6f, 0, 0.64f));
+	mat.row[3] = vector(3, -4, 5, 1);
+	inv = matrix_inverse_orthonormal(mat);
+	ident = matrix_inverse(mat);
+	EXPECT_VECTORALMOSTEQ(inv.row[0], ident.row[0]);
+	EXPECT_VECTORALMOSTEQ(inv.row[1], ident.row[1]);
+	EXPECT_VECTORALMOSTEQ(inv.row[2], ident.row[2]);
+	EXPECT_VECTORALMOSTEQ(inv.row[3], ident.row[3]);
+	EXPECT_REALEQ(vector_w(inv.row[3]), 1);
+
+	ident = matrix_mul(mat, inv);
+	EXPECT_VECTORALMOSTEQ(ident.row[0], vector(1, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[1], vector(0, 1, 0, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[2], vector(0, 0, 1, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[3], vector(0, 0, 0, 1));
+
+	mat.row[0] = vector_scale(mat.row[0], 2);
+	mat.row[1] = vector_scale(mat.row[1], 0.5f);
+	mat.row[2] = vector_scale(mat.row[2], 4);
+	inv = matrix_inverse_affine(mat);
+	ident = matrix_inverse(mat);
+	EXPECT_VECTORALMOSTEQ(inv.row[0], ident.row[0]);
+	EXPECT_VECTORALMOSTEQ(inv.row[1], ident.row[1]);
+	EXPECT_VECTORALMOSTEQ(inv.row[2], ident.row[2]);
+	EXPECT_VECTORALMOSTEQ(inv.row[3], ident.row[3]);
+	EXPECT_REALEQ(vector_w(inv.row[3]), 1);
+
+	ident = matrix_mul(inv, mat);
+	EXPECT_VECTORALMOSTEQ(ident.row[0], vector(1, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[1], vector(0, 1, 0, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[2], vector(0, 0, 1, 0));
+	EXPECT_VECTORALMOSTEQ(ident.row[3], vector(0, 0, 0, 1));
+
+	return 0;
+}
+
 DECLARE_TEST(matrix, vec) {
 	vector_t vec;
 
@@ -258,6 +326,604 @@ DECLARE_TEST(matrix, vec) {
 	return 0;
 }
 
+DECLARE_TEST(matrix, vec_array) {
+	vector_t in[7];
+	vector_t out[7];
+	float32_t unaligned_in[7 * 4 + 1];
+	float32_t unaligned_out[7 * 4 + 1];
+
+	VECTOR_ALIGN float32_t aligned_rotm[] = {0, 2, 0, 11, 0, 0, 3, 12, 1, 0, 0, 13, 7, 8, 9, 10};
+
+	VECTOR_ALIGN float32_t aligned_tformm[] = {0, 2, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, -1, 2, 5, 1};
+
+	const matrix_t rotm = matrix_aligned(aligned_rotm);
+	const matrix_t tformm = matrix_aligned(aligned_tformm);
+
+	for (int i = 0; i < 7; ++i) {
+		in[i] = vector((real)i, (real)(i * 2 - 3), (real)(5 - i), (real)(i % 3));
+		unaligned_in[1 + i * 4 + 0] = vector_x(in[i]);
+		unaligned_in[1 + i * 4 + 1] = vector_y(in[i]);
+		unaligned_in[1 + i * 4 + 2] = vector_z(in[i]);
+		unaligned_in[1 + i * 4 + 3] = vector_w(in[i]);
+	}
+
+	vector_rotate_array(out, in, 7, rotm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_rotate(in[i], rotm));
+
+	vector_transform_array(out, in, 7, tformm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_transform(in[i], tformm));
+
+	vector_rotate_array_unaligned(unaligned_out + 1, unaligned_in + 1, 7, rotm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(vector_unaligned(unaligned_out + 1 + i * 4), vector_rotate(in[i], rotm));
+
+	vector_transform_array_unaligned(unaligned_out + 1, unaligned_in + 1, 7, tformm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(vector_unaligned(unaligned_out + 1 + i * 4), vector_transform(in[i], tformm));
+
+	vector_rotate_array_stream(out, in, 7, rotm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_rotate(in[i], rotm));
+
+	vector_transform_array_stream(out, in, 7, tformm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_transform(in[i], tformm));
+
+	// In-place transformation
+	vector_transform_array(in, in, 7, tformm);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(in[i], out[i]);
+
+	return 0;
+}
+
+DECLARE_TEST(matrix, vec_array_wide) {
+	// Enough vectors for the 8 and 16 wide AVX2 and AVX-512 loops plus a tail
+	vector_t in[23];
+	vector_t out[23];
+	float32_t unaligned_in[23 * 4 + 1];
+	float32_t unaligned_out[23 * 4 + 1];
+
+	VECTOR_ALIGN float32_t aligned_rotm[] = {0, 2, 0, 11, 0, 0, 3, 12, 1, 0, 0, 13, 7, 8, 9, 10};
+
+	VECTOR_ALIGN float32_t aligned_tformm[] = {0, 2, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, -1, 2, 5, 1};
+
+	const matrix_t rotm = matrix_aligned(aligned_rotm);
+	const matrix_t tformm = matrix_aligned(aligned_tformm);
+
+	for (int i = 0; i < 23; ++i) {
+		in[i] = vector((real)i, (real)(i * 2 - 3), (real)(5 - i), (real)(i % 3));
+		unaligned_in[1 + i * 4 + 0] = vector_x(in[i]);
+		unaligned_in[1 + i * 4 + 1] = vector_y(in[i]);
+		unaligned_in[1 + i * 4 + 2] = vector_z(in[i]);
+		unaligned_in[1 + i * 4 + 3] = vector_w(in[i]);
+	}
+
+	vector_rotate_array(out, in, 23, rotm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(out[i], vector_rotate(in[i], rotm));
+
+	vector_transform_array(out, in, 23, tformm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(out[i], vector_transform(in[i], tformm));
+
+	vector_rotate_array_unaligned(unaligned_out + 1, unaligned_in + 1, 23, rotm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(vector_unaligned(unaligned_out + 1 + i * 4), vector_rotate(in[i], rotm));
+
+	vector_transform_array_unaligned(unaligned_out + 1, unaligned_in + 1, 23, tformm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(vector_unaligned(unaligned_out + 1 + i * 4), vector_transform(in[i], tformm));
+
+	vector_rotate_array_stream(out, in, 23, rotm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(out[i], vector_rotate(in[i], rotm));
+
+	vector_transform_array_stream(out, in, 23, tformm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(out[i], vector_transform(in[i], tformm));
+
+	// In-place transformation
+	vector_transform_array(in, in, 23, tformm);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_VECTOREQ(in[i], out[i]);
+
+	return 0;
+}
+
+DECLARE_TEST(matrix, vec_batch) {
+	vector_t in[23];
+	vector_t out[23];
+	float32_t unaligned_in[23 * 4 + 1];
+	float32_t unaligned_out[23 * 4 + 1];
+	vector_config_t config;
+
+	VECTOR_ALIGN float32_t aligned_tformm[] = {0, 2, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, -1, 2, 5, 1};
+	const matrix_t tformm = matrix_aligned(aligned_tformm);
+
+	for (int i = 0; i < 23; ++i) {
+		in[i] = vector((real)i, (real)(i * 2 - 3), (real)(5 - i), (real)(i % 3));
+		unaligned_in[1 + i * 4 + 0] = vector_x(in[i]);
+		unaligned_in[1 + i * 4 + 1] = vector_y(in[i]);
+		unaligned_in[1 + i * 4 + 2] = vector_z(in[i]);
+		unaligned_in[1 + i * 4 + 3] = vector_w(in[i]);
+	}
+
+	// Run batch functions with every tier up to the best one supported by this CPU
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		vector_batch_rotate(out, in, 23, tformm);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_VECTOREQ(out[i], vector_rotate(in[i], tformm));
+
+		vector_batch_rotate_unaligned(unaligned_out + 1, unaligned_in + 1, 23, tformm);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_VECTOREQ(vector_unaligned(unaligned_out + 1 + i * 4), vector_rotate(in[i], tformm));
+
+		vector_batch_transform_unaligned(unaligned_out + 1, unaligned_in + 1, 23, tformm);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_VECTOREQ(vector_unaligned(unaligned_out + 1 + i * 4), vector_transform(in[i], tformm));
+
+		vector_batch_transform(out, in, 23, tformm);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_VECTOREQ(out[i], vector_transform(in[i], tformm));
+
+		vector_batch_rotate_stream(out, in, 23, tformm);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_VECTOREQ(out[i], vector_rotate(in[i], tformm));
+
+		vector_batch_transform_stream(out, in, 23, tformm);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_VECTOREQ(out[i], vector_transform(in[i], tformm));
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(matrix, mul_array) {
+	matrix_t m0[11];
+	matrix_t m1[11];
+	matrix_t out[11];
+	matrix_t world[11];
+	int32_t parent[11] = {-1, 0, 1, 1, -1, 4, 2, 6, 0, 5, 9};
+	vector_config_t config;
+
+	for (int i = 0; i < 11; ++i) {
+		for (int j = 0; j < 16; ++j) {
+			m0[i].arr[j] = (real)((i * 7 + j * 3) % 11) - 5;
+			m1[i].arr[j] = (real)((i * 5 + j * 13) % 7) - 3;
+		}
+	}
+
+	matrix_mul_array(out, m0, m1, 11);
+	for (int i = 0; i < 11; ++i) {
+		const matrix_t ref = matrix_mul(m0[i], m1[i]);
+		EXPECT_VECTOREQ(out[i].row[0], ref.row[0]);
+		EXPECT_VECTOREQ(out[i].row[1], ref.row[1]);
+		EXPECT_VECTOREQ(out[i].row[2], ref.row[2]);
+		EXPECT_VECTOREQ(out[i].row[3], ref.row[3]);
+	}
+
+	memset(out, 0, sizeof(out));
+	matrix_mul_array_stream(out, m0, m1, 11);
+	for (int i = 0; i < 11; ++i) {
+		const matrix_t ref = matrix_mul(m0[i], m1[i]);
+		EXPECT_VECTOREQ(out[i].row[0], ref.row[0]);
+		EXPECT_VECTOREQ(out[i].row[1], ref.row[1]);
+		EXPECT_VECTOREQ(out[i].row[2], ref.row[2]);
+		EXPECT_VECTOREQ(out[i].row[3], ref.row[3]);
+	}
+
+	// Small integer scale and translation keep the products along the chain exact
+	for (int i = 0; i < 11; ++i) {
+		m0[i] = matrix_scaling_scalar(1, -1, 2);
+		m0[i].row[3] = vector((real)i, (real)(2 - i), 1, 1);
+	}
+	for (int i = 0; i < 11; ++i)
+		world[i] = (parent[i] >= 0) ? matrix_mul(m0[i], world[parent[i]]) : m0[i];
+
+	matrix_mul_chain(out, m0, parent, 11);
+	for (int i = 0; i < 11; ++i) {
+		EXPECT_VECTOREQ(out[i].row[0], world[i].row[0]);
+		EXPECT_VECTOREQ(out[i].row[1], world[i].row[1]);
+		EXPECT_VECTOREQ(out[i].row[2], world[i].row[2]);
+		EXPECT_VECTOREQ(out[i].row[3], world[i].row[3]);
+	}
+
+	memcpy(out, m0, sizeof(out));
+	matrix_mul_chain(out, out, parent, 11);
+	for (int i = 0; i < 11; ++i) {
+		EXPECT_VECTOREQ(out[i].row[0], world[i].row[0]);
+		EXPECT_VECTOREQ(out[i].row[3], world[i].row[3]);
+	}
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		matrix_batch_mul(out, m0, m1, 11);
+		for (int i = 0; i < 11; ++i) {
+			const matrix_t ref = matrix_mul(m0[i], m1[i]);
+			EXPECT_VECTOREQ(out[i].row[0], ref.row[0]);
+			EXPECT_VECTOREQ(out[i].row[1], ref.row[1]);
+			EXPECT_VECTOREQ(out[i].row[2], ref.row[2]);
+			EXPECT_VECTOREQ(out[i].row[3], ref.row[3]);
+		}
+
+		memset(out, 0, sizeof(out));
+		matrix_batch_mul_stream(out, m0, m1, 11);
+		for (int i = 0; i < 11; ++i) {
+			const matrix_t ref = matrix_mul(m0[i], m1[i]);
+			EXPECT_VECTOREQ(out[i].row[0], ref.row[0]);
+			EXPECT_VECTOREQ(out[i].row[1], ref.row[1]);
+			EXPECT_VECTOREQ(out[i].row[2], ref.row[2]);
+			EXPECT_VECTOREQ(out[i].row[3], ref.row[3]);
+		}
+
+		matrix_batch_mul_chain(out, m0, parent, 11);
+		for (int i = 0; i < 11; ++i) {
+			EXPECT_VECTOREQ(out[i].row[0], world[i].row[0]);
+			EXPECT_VECTOREQ(out[i].row[1], world[i].row[1]);
+			EXPECT_VECTOREQ(out[i].row[2], world[i].row[2]);
+			EXPECT_VECTOREQ(out[i].row[3], world[i].row[3]);
+		}
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+static void
+test_parallel_count(void* context, size_t begin, size_t end) {
+	uint8_t* visited = context;
+	for (size_t i = begin; i < end; ++i)
+		++visited[i];
+}
+
+static void
+test_parallel_nested(void* context, size_t begin, size_t end) {
+	// Runs on the calling thread while the outer loop is in progress
+	vector_parallel_for(end - begin, 1, test_parallel_count, (uint8_t*)context + begin);
+}
+
+DECLARE_TEST(matrix, parallel) {
+	matrix_t local[203];
+	matrix_t world[203];
+	matrix_t out[203];
+	matrix_t m1[203];
+	int32_t parent[203];
+	vector_t in[1001];
+	vector_t vout[1001];
+	uint8_t visited[1001];
+	vector_config_t config;
+	int i;
+
+	VECTOR_ALIGN float32_t aligned_tformm[] = {0, 2, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, -1, 2, 5, 1};
+	const matrix_t tformm = matrix_aligned(aligned_tformm);
+
+	// Many small hierarchies of seven nodes, crossing chunk boundaries
+	for (i = 0; i < 203; ++i) {
+		local[i] = matrix_scaling_scalar(1, -1, 2);
+		local[i].row[3] = vector((real)(i % 5), (real)(2 - i % 3), 1, 1);
+		parent[i] = (i % 7) ? i - 1 - ((i % 7) > 2 ? (i % 2) : 0) : -1;
+		for (int j = 0; j < 16; ++j)
+			m1[i].arr[j] = (real)((i * 5 + j * 13) % 7) - 3;
+		world[i] = (parent[i] >= 0) ? matrix_mul(local[i], world[parent[i]]) : local[i];
+	}
+	for (i = 0; i < 1001; ++i)
+		in[i] = vector((real)i, (real)(i * 2 - 3), (real)(5 - i), (real)(i % 3));
+
+	memset(&config, 0, sizeof(config));
+	config.parallel_workers = 3;
+	config.parallel_chunk_size = sizeof(matrix_t) * 16;
+	vector_module_finalize();
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	memset(visited, 0, sizeof(visited));
+	vector_parallel_for(1001, 10, test_parallel_count, visited);
+	vector_parallel_for(1001, 64, test_parallel_nested, visited);
+	for (i = 0; i < 1001; ++i)
+		EXPECT_INTEQ(visited[i], 2);
+
+	vector_parallel_transform_array(vout, in, 1001, tformm);
+	for (i = 0; i < 1001; ++i)
+		EXPECT_VECTOREQ(vout[i], vector_transform(in[i], tformm));
+	vector_parallel_rotate_array(vout, in, 1001, tformm);
+	for (i = 0; i < 1001; ++i)
+		EXPECT_VECTOREQ(vout[i], vector_rotate(in[i], tformm));
+
+	matrix_parallel_mul_array(out, local, m1, 203);
+	for (i = 0; i < 203; ++i) {
+		const matrix_t ref = matrix_mul(local[i], m1[i]);
+		EXPECT_VECTOREQ(out[i].row[0], ref.row[0]);
+		EXPECT_VECTOREQ(out[i].row[3], ref.row[3]);
+	}
+
+	for (int round = 0; round < 2; ++round) {
+		// Second round propagates in place
+		if (round)
+			memcpy(out, local, sizeof(out));
+		matrix_parallel_mul_chain(out, round ? out : local, parent, 203);
+		for (i = 0; i < 203; ++i) {
+			EXPECT_VECTOREQ(out[i].row[0], world[i].row[0]);
+			EXPECT_VECTOREQ(out[i].row[1], world[i].row[1]);
+			EXPECT_VECTOREQ(out[i].row[2], world[i].row[2]);
+			EXPECT_VECTOREQ(out[i].row[3], world[i].row[3]);
+		}
+	}
+
+	vector_module_finalize();
+	memset(&config, 0, sizeof(config));
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+static vector_t
+test_project(const vector_t point, const matrix_t m) {
+	const vector_t clip = vector_transform(point, m);
+	return vector_div(clip, vector_shuffle(clip, VECTOR_MASK_WWWW));
+}
+
+DECLARE_TEST(matrix, projection) {
+	const vector_t eye = vector(5, -3, 2, 1);
+	const vector_t target = vector(0, 1, -4, 1);
+	const vector_t up = vector(0, 1, 0, 0);
+	const matrix_t view = matrix_look_at(eye, target, up);
+	const real distance = vector_x(vector_length3(vector_sub(target, eye)));
+	EXPECT_VECTORALMOSTEQ(vector_transform(eye, view), vector(0, 0, 0, 1));
+	EXPECT_VECTORALMOSTEQ(vector_transform(target, view), vector(0, 0, distance, 1));
+	const matrix_t view_z = matrix_look_at(vector(1, 2, 3, 1), vector(1, 2, 13, 1), up);
+	EXPECT_VECTORALMOSTEQ(view_z.row[3], vector(-1, -2, -3, 1));
+	EXPECT_VECTORALMOSTEQ(vector_transform(vector(1, 2, 13, 1), view_z), vector(0, 0, 10, 1));
+	// Up in world space maps to positive y in view space
+	EXPECT_REALGT(vector_y(vector_rotate(up, view)), 0);
+
+	const quaternion_t rotation =
+	    quaternion_normalize(quaternion_scalar(REAL_C(0.3), REAL_C(-0.4), REAL_C(0.1), REAL_C(0.8)));
+	const matrix_t rotation_matrix = matrix_from_quaternion(rotation);
+	const vector_t forward = vector_rotate(vector(0, 0, 1, 0), rotation_matrix);
+	const matrix_t view_quaternion = matrix_look_at_quaternion(eye, rotation);
+	const matrix_t view_axes =
+	    matrix_look_at(eye, vector_add(eye, forward), vector_rotate(vector(0, 1, 0, 0), rotation_matrix));
+	for (int row = 0; row < 4; ++row)
+		EXPECT_VECTORALMOSTEQ(view_quaternion.row[row], view_axes.row[row]);
+
+	const real fov = REAL_PI * REAL_C(0.5);
+	matrix_t projection = matrix_perspective(fov, 2, 1, 100);
+	EXPECT_VECTORALMOSTEQ(test_project(vector(2, 1, 1, 1), projection), vector(1, 1, 0, 1));
+	EXPECT_VECTORALMOSTEQ(test_project(vector(-200, -100, 100, 1), projection), vector(-1, -1, 1, 1));
+	EXPECT_VECTORALMOSTEQ(test_project(vector(0, 0, 10, 1), projection),
+	                      vector(0, 0, REAL_C(100.0) / REAL_C(110.0), 1));
+
+	projection = matrix_perspective_reversed(fov, 2, 1, 100);
+	EXPECT_VECTORALMOSTEQ(test_project(vector(2, 1, 1, 1), projection), vector(1, 1, 1, 1));
+	EXPECT_VECTORALMOSTEQ(test_project(vector(-200, -100, 100, 1), projection), vector(-1, -1, 0, 1));
+
+	projection = matrix_perspective_infinite(fov, 2, 1);
+	EXPECT_VECTORALMOSTEQ(test_project(vector(2, 1, 1, 1), projection), vector(1, 1, 0, 1));
+	EXPECT_VECTORALMOSTEQ(test_project(vector(0, 0, 1000000, 1), projection), vector(0, 0, 1, 1));
+
+	projection = matrix_perspective_infinite_reversed(fov, 2, 1);
+	EXPECT_VECTORALMOSTEQ(test_project(vector(2, 1, 1, 1), projection), vector(1, 1, 1, 1));
+	EXPECT_VECTORALMOSTEQ(test_project(vector(0, 0, 1000000, 1), projection), vector(0, 0, 0, 1));
+	EXPECT_REALGT(vector_z(test_project(vector(0, 0, 1000000, 1), projection)), 0);
+
+	const matrix_t ortho = matrix_orthographic(-2, 6, -1, 3, 1, 11);
+	EXPECT_VECTORALMOSTEQ(vector_transform(vector(6, 3, 11, 1), ortho), vector(1, 1, 1, 1));
+	EXPECT_VECTORALMOSTEQ(vector_transform(vector(-2, -1, 1, 1), ortho), vector(-1, -1, 0, 1));
+	EXPECT_VECTORALMOSTEQ(vector_transform(vector(2, 1, 6, 1), ortho), vector(0, 0, REAL_C(0.5), 1));
+
+	const matrix_t projections[3] = {matrix_perspective(fov, 2, 1, 100),
+	                                 matrix_perspective_infinite_reversed(fov, 2, 1), ortho};
+	for (int i = 0; i < 3; ++i) {
+		const matrix_t combined = matrix_view_projection(view, projections[i]);
+		const matrix_t reference = matrix_mul(view, projections[i]);
+		for (int row = 0; row < 4; ++row)
+			EXPECT_VECTORALMOSTEQ(combined.row[row], reference.row[row]);
+	}
+
+	const vector_t position = vector(1, 2, 3, 1);
+	const vector_t face_direction[6] = {vector(1, 0, 0, 0), vector(-1, 0, 0, 0), vector(0, 1, 0, 0),
+	                                    vector(0, -1, 0, 0), vector(0, 0, 1, 0),  vector(0, 0, -1, 0)};
+	const vector_t face_up[6] = {vector(0, 1, 0, 0),  vector(0, 1, 0, 0), vector(0, 0, -1, 0),
+	                             vector(0, 0, 1, 0), vector(0, 1, 0, 0), vector(0, 1, 0, 0)};
+	matrix_t face[6];
+	projection = matrix_perspective(fov, 1, REAL_C(0.1), 100);
+	matrix_cube_faces(face, position, projection);
+	for (int i = 0; i < 6; ++i) {
+		const matrix_t reference =
+		    matrix_mul(matrix_look_at(position, vector_add(position, face_direction[i]), face_up[i]), projection);
+		for (int row = 0; row < 4; ++row)
+			EXPECT_VECTORALMOSTEQ(face[i].row[row], reference.row[row]);
+		const vector_t center = test_project(vector_muladd(face_direction[i], vector_uniform(5), position), face[i]);
+		EXPECT_VECTORALMOSTEQ(center, vector(0, 0, vector_z(center), 1));
+		EXPECT_REALGT(vector_z(center), 0);
+		EXPECT_REALLT(vector_z(center), 1);
+	}
+	// Right edge of the +z face is positive x, top edge of the +x face is positive y
+	EXPECT_REALEQ(vector_x(test_project(vector(6, 2, 8, 1), face[4])), 1);
+	EXPECT_REALEQ(vector_y(test_project(vector(6, 7, 3, 1), face[0])), 1);
+
+	return 0;
+}
+
+DECLARE_TEST(matrix, matrix4d) {
+	const quaternion_t q = quaternion_normalize(quaternion_scalar(REAL_C(0.1), REAL_C(0.3), REAL_C(-0.2), REAL_C(0.9)));
+	const matrix_t rotation = matrix_from_quaternion(q);
+	const matrix4d_t rotation4d = matrix4d_from_matrix(rotation);
+	const vector_t v = vector(REAL_C(1.5), REAL_C(-2.0), REAL_C(0.25), REAL_C(1.0));
+	const vector4d_t v4d = vector4d_from_vector(v);
+
+	EXPECT_VECTORALMOSTEQ(vector_from_vector4d(vector4d_rotate(v4d, rotation4d)), vector_rotate(v, rotation));
+	EXPECT_VECTORALMOSTEQ(vector_from_vector4d(vector4d_transform(v4d, rotation4d)), vector_transform(v, rotation));
+	EXPECT_TRUE(vector4d_w(vector4d_rotate(vector4d(1, 2, 3, 5), rotation4d)) == 5.0);
+
+	const matrix_t translation = matrix_translation(vector(10, -20, 30, 1));
+	const matrix_t combined = matrix_mul(rotation, translation);
+	const matrix4d_t combined4d = matrix4d_mul(rotation4d, matrix4d_translation(vector4d(10, -20, 30, 0)));
+	const matrix_t result = matrix_from_matrix4d(combined4d);
+	for (int i = 0; i < 16; ++i)
+		EXPECT_REALEQ(result.arr[i], combined.arr[i]);
+	EXPECT_VECTOREQ(vector_from_vector4d(matrix4d_get_translation(combined4d)), vector(10, -20, 30, 1));
+
+	const matrix4d_t transposed = matrix4d_transpose(combined4d);
+	for (int row = 0; row < 4; ++row) {
+		for (int col = 0; col < 4; ++col)
+			EXPECT_TRUE(transposed.frow[row][col] == combined4d.frow[col][row]);
+	}
+
+	const matrix4d_t identity = matrix4d_identity();
+	const float64_t identity_arr[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+	const matrix4d_t loaded = matrix4d_unaligned(identity_arr);
+	for (int i = 0; i < 16; ++i)
+		EXPECT_TRUE(identity.arr[i] == loaded.arr[i]);
+
+	// Object far from the world origin, translation is rebased relative to a camera close to it
+	const vector4d_t camera = vector4d(149597870700.0, 0.5, -384400000.0, 1);
+	matrix4d_t object[3];
+	object[0] = matrix4d_mul(rotation4d, matrix4d_translation(vector4d(149597870712.0, 0.5, -384400001.5, 0)));
+	object[1] = matrix4d_translation(camera);
+	object[2] = matrix4d_identity();
+
+	const matrix_t rebased = matrix4d_rebase(object[0], camera);
+	for (int i = 0; i < 12; ++i)
+		EXPECT_REALEQ(rebased.arr[i], rotation.arr[i]);
+	EXPECT_VECTOREQ(rebased.row[3], vector(12, 0, REAL_C(-1.5), 1));
+
+	matrix_t rebased_array[3];
+	matrix4d_rebase_array(rebased_array, object, 3, camera);
+	for (int i = 0; i < 16; ++i)
+		EXPECT_REALEQ(rebased_array[0].arr[i], rebased.arr[i]);
+	EXPECT_VECTOREQ(rebased_array[1].row[3], vector(0, 0, 0, 1));
+	EXPECT_VECTOREQ(rebased_array[2].row[3], vector(-149597870700.0f, -0.5f, 384400000.0f, 1));
+	EXPECT_VECTOREQ(rebased_array[2].row[0], vector(1, 0, 0, 0));
+
+	return 0;
+}
+
+static matrix_t
+test_hierarchy_world(const vector_hierarchy_t* hierarchy, uint32_t node) {
+	const int32_t parent = vector_hierarchy_parent(hierarchy, node);
+	const matrix_t local = *vector_hierarchy_local(hierarchy, node);
+	return (parent >= 0) ? matrix_mul(local, test_hierarchy_world(hierarchy, (uint32_t)parent)) : local;
+}
+
+static bool
+test_hierarchy_valid(const vector_hierarchy_t* hierarchy) {
+	for (uint32_t node = 0; node < hierarchy->count; ++node) {
+		const matrix_t ref = test_hierarchy_world(hierarchy, node);
+		if (memcmp(vector_hierarchy_world(hierarchy, node), &ref, sizeof(matrix_t)))
+			return false;
+		// Depth-first order, parents precede children and subtrees are nested ranges
+		const uint32_t slot = hierarchy->slot[node];
+		const int32_t parent = hierarchy->parent[slot];
+		const int32_t parent_node = vector_hierarchy_parent(hierarchy, node);
+		if (parent != ((parent_node >= 0) ? (int32_t)hierarchy->slot[parent_node] : -1))
+			return false;
+		if ((parent >= 0) &&
+		    (((uint32_t)parent >= slot) || (hierarchy->subtree_end[slot] > hierarchy->subtree_end[parent])))
+			return false;
+	}
+	return true;
+}
+
+DECLARE_TEST(matrix, hierarchy) {
+	vector_hierarchy_t hierarchy;
+	matrix_t local;
+
+	// Small integer scale and translation keep the products along the chains exact
+	EXPECT_INTEQ(vector_hierarchy_initialize(&hierarchy, 40), 0);
+	for (int i = 0; i < 37; ++i) {
+		local = matrix_scaling_scalar(1, (i % 2) ? -1 : 1, (i % 3) ? 1 : 2);
+		local.row[3] = vector((real)i, (real)(3 - i), 1, 1);
+		const int32_t parent = (i % 9) ? (i * 13 + 5) % i : -1;
+		EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, parent, local), i);
+	}
+	EXPECT_TRUE(hierarchy.reorder);
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_FALSE(hierarchy.reorder);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+
+	// Only dirty subtrees are recomputed, stale world matrices elsewhere are left untouched
+	const uint32_t untouched = 36;
+	EXPECT_INTEQ(vector_hierarchy_parent(&hierarchy, untouched), -1);
+	hierarchy.world[hierarchy.slot[untouched]] = matrix_zero();
+	local = matrix_scaling_scalar(2, 1, -1);
+	vector_hierarchy_set_local(&hierarchy, 1, local);
+	vector_hierarchy_set_local(&hierarchy, 4, local);
+	vector_hierarchy_set_local(&hierarchy, 30, local);
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_VECTOREQ(vector_hierarchy_world(&hierarchy, untouched)->row[3], vector_zero());
+	vector_hierarchy_set_local(&hierarchy, untouched, *vector_hierarchy_local(&hierarchy, untouched));
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+
+	// Reparenting into its own subtree is rejected
+	EXPECT_INTEQ(vector_hierarchy_set_parent(&hierarchy, 0, 1), -1);
+	EXPECT_INTEQ(vector_hierarchy_set_parent(&hierarchy, 5, 5), -1);
+	EXPECT_INTEQ(vector_hierarchy_set_parent(&hierarchy, 27, 9), 0);
+	EXPECT_INTEQ(vector_hierarchy_set_parent(&hierarchy, 1, -1), 0);
+	EXPECT_INTEQ(vector_hierarchy_parent(&hierarchy, 27), 9);
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+
+	vector_hierarchy_set_local_transform(
+	    &hierarchy, 27, transform(quaternion_scalar(0, 0, REAL_SQRT2 * REAL_C(0.5), REAL_SQRT2 * REAL_C(0.5)),
+	                              vector(1, 2, 3, 0), 2));
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 40, matrix_identity()), -1);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 3, matrix_identity()), 37);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 37, matrix_identity()), 38);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, -1, matrix_identity()), 39);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, -1, matrix_identity()), -1);
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+	vector_hierarchy_finalize(&hierarchy);
+
+	// Depth-first construction keeps the order without reordering
+	EXPECT_INTEQ(vector_hierarchy_initialize(&hierarchy, 8), 0);
+	local = matrix_translation(vector(1, 2, 3, 1));
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, -1, local), 0);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 0, local), 1);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 1, local), 2);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 0, local), 3);
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, -1, local), 4);
+	EXPECT_FALSE(hierarchy.reorder);
+	EXPECT_INTEQ(hierarchy.subtree_end[0], 4);
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+	EXPECT_VECTOREQ(vector_hierarchy_world(&hierarchy, 2)->row[3], vector(3, 6, 9, 1));
+	EXPECT_INTEQ(vector_hierarchy_add(&hierarchy, 1, local), 5);
+	EXPECT_TRUE(hierarchy.reorder);
+	EXPECT_INTEQ(vector_hierarchy_update(&hierarchy), 0);
+	EXPECT_TRUE(test_hierarchy_valid(&hierarchy));
+	vector_hierarchy_finalize(&hierarchy);
+
+	return 0;
+}
+
 static void
 test_matrix_declare(void) {
 #if FOUNDATION_ARCH_SSE4
@@ -274,7 +940,16 @@ test_matrix_declare(void) {
 
 	ADD_TEST(matrix, construct);
 	ADD_TEST(matrix, ops);
+	ADD_TEST(matrix, inverse);
 	ADD_TEST(matrix, vec);
+	ADD_TEST(matrix, vec_array);
+	ADD_TEST(matrix, vec_array_wide);
+	ADD_TEST(matrix, vec_batch);
+	ADD_TEST(matrix, mul_array);
+	ADD_TEST(matrix, parallel);
+	ADD_TEST(matrix, hierarchy);
+	ADD_TEST(matrix, matrix4d);
+	ADD_TEST(matrix, projection);
 }
 
 static test_suite_t test_matrix_suite = {test_matrix_application,
@@ -134,6 +134,12 @@ DECLARE_TEST(quaternion, ops) {
 	r = quaternion_mul(q, quaternion_identity());
 	EXPECT_VECTOREQ(r, q);
 
+	// Non-commuting operands, reference is the component expansion of q1 * q0 in quaternion_base.h
+	q = vector(1, 2, 3, 4);
+	r = vector(5, -6, 7, 8);
+	EXPECT_VECTOREQ(quaternion_mul(q, r), vector(-4, -16, 68, 18));
+	EXPECT_VECTOREQ(quaternion_mul(r, q), vector(60, 0, 36, 18));
+
 	q = quaternion_identity();
 	r = quaternion_identity();
 	EXPECT_VECTOREQ(quaternion_add(q, r), vector(0, 0, 0, 2.0f));
@@ -174,6 +180,435 @@ DECLARE_TEST(quaternion, vec) {
 	v1 = vector(2, 1, -3, 0);
 	EXPECT_VECTORALMOSTEQ(quaternion_rotate(quaternion_rotating_vector(v0, v1), v0), v1);
 
+	// 90 degrees around z axis
+	q = quaternion_scalar(0, 0, REAL_SQRT2 * REAL_C(0.5), REAL_SQRT2 * REAL_C(0.5));
+	EXPECT_VECTORALMOSTEQ(quaternion_rotate(q, vector(1, -2, 3, 0)), vector(2, 1, 3, 0));
+	EXPECT_VECTORALMOSTEQ(quaternion_rotate(q, vector(0, 0, 1, 0)), vector(0, 0, 1, 0));
+
+	q = quaternion_normalize(quaternion_scalar(REAL_C(0.3), REAL_C(-0.5), REAL_C(0.1), REAL_C(0.8)));
+	EXPECT_VECTORALMOSTEQ(quaternion_rotate(q, v0), vector_rotate(v0, matrix_from_quaternion(q)));
+	EXPECT_REALEQ(vector_x(vector_length3(quaternion_rotate(q, v0))), vector_x(vector_length3(v0)));
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, rotate_array) {
+	quaternion_t q[23];
+	vector_t in[23];
+	vector_t out[23];
+	vector_t batch[23];
+	vector_config_t config;
+
+	for (int i = 0; i < 23; ++i) {
+		const real f = (real)i / REAL_C(22.0);
+		q[i] = quaternion_normalize(quaternion_scalar(f - REAL_C(0.4), REAL_C(0.7) * f, REAL_C(0.2), REAL_C(1.0) - f));
+		in[i] = vector(REAL_C(3.0) * f - 1, REAL_C(2.0) - f * f, REAL_C(-0.5) + f, (real)(i % 2));
+	}
+
+	quaternion_rotate_array(out, in, 23, q[5]);
+	for (int i = 0; i < 23; ++i) {
+		EXPECT_REALLT(vector_test_difference(out[i], quaternion_rotate(q[5], in[i])), REAL_C(1e-5));
+		EXPECT_REALEQ(vector_w(out[i]), vector_w(in[i]));
+	}
+
+	quaternion_rotate_pairs_array(out, q, in, 23);
+	for (int i = 0; i < 23; ++i) {
+		EXPECT_REALLT(vector_test_difference(out[i], quaternion_rotate(q[i], in[i])), REAL_C(1e-5));
+		EXPECT_REALEQ(vector_w(out[i]), vector_w(in[i]));
+	}
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		quaternion_batch_rotate_pairs(batch, q, in, 23);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_REALLT(vector_test_difference(batch[i], out[i]), REAL_C(1e-5));
+
+		// Partial block and in-place rotation
+		for (int i = 0; i < 23; ++i)
+			batch[i] = in[i];
+		quaternion_batch_rotate_pairs(batch, q, batch, 6);
+		for (int i = 0; i < 6; ++i)
+			EXPECT_REALLT(vector_test_difference(batch[i], out[i]), REAL_C(1e-5));
+		EXPECT_VECTOREQ(batch[6], in[6]);
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, transform) {
+	transform_t t0, t1, t;
+	matrix_t m;
+	vector_t p;
+	const vector_t point = vector(2, -3, 5, 7);
+
+	t = transform_identity();
+	EXPECT_VECTOREQ(transform_apply_point(t, point), vector(2, -3, 5, 1));
+	EXPECT_VECTOREQ(transform_apply_vector(t, point), vector(2, -3, 5, 0));
+
+	// 90 degrees around z axis, scale 2
+	t0 = transform(quaternion_scalar(0, 0, REAL_SQRT2 * REAL_C(0.5), REAL_SQRT2 * REAL_C(0.5)), vector(1, 2, 3, 0), 2);
+	EXPECT_REALEQ(vector_w(t0.translation), 2);
+	EXPECT_VECTORALMOSTEQ(transform_apply_point(t0, vector(1, 0, 0, 5)), vector(1, 4, 3, 1));
+	EXPECT_VECTORALMOSTEQ(transform_apply_vector(t0, vector(1, 0, 0, 5)), vector(0, 2, 0, 0));
+	EXPECT_VECTORALMOSTEQ(transform_apply_point(t0, point), vector(7, 6, 13, 1));
+
+	m = transform_to_matrix(t0);
+	EXPECT_VECTORALMOSTEQ(vector_transform(vector(2, -3, 5, 1), m), transform_apply_point(t0, point));
+	EXPECT_VECTORALMOSTEQ(vector_rotate(vector(2, -3, 5, 0), m), transform_apply_vector(t0, point));
+
+	// 60 degrees around normalized (1, 2, 2) axis, scale 0.5
+	t1 = transform(quaternion_scalar(REAL_C(0.5) / 3, REAL_C(1.0) / 3, REAL_C(1.0) / 3, REAL_SQRT3 * REAL_C(0.5)),
+	               vector(-4, 0, 2, 0), REAL_C(0.5));
+	t = transform_mul(t0, t1);
+	p = transform_apply_point(t1, transform_apply_point(t0, point));
+	EXPECT_VECTORALMOSTEQ(transform_apply_point(t, point), p);
+	EXPECT_REALEQ(vector_w(t.translation), 1);
+	m = matrix_mul(transform_to_matrix(t0), transform_to_matrix(t1));
+	EXPECT_VECTORALMOSTEQ(vector_transform(vector(2, -3, 5, 1), m), p);
+
+	t = transform_inverse(t);
+	EXPECT_VECTORALMOSTEQ(transform_apply_point(t, p), vector(2, -3, 5, 1));
+	t = transform_mul(t0, transform_inverse(t0));
+	EXPECT_VECTORALMOSTEQ(t.rotation, quaternion_identity());
+	EXPECT_VECTORALMOSTEQ(t.translation, vector(0, 0, 0, 1));
+
+	t = transform_lerp(t0, t1, 0);
+	EXPECT_VECTORALMOSTEQ(t.rotation, t0.rotation);
+	EXPECT_VECTORALMOSTEQ(t.translation, t0.translation);
+	t = transform_lerp(t0, t1, 1);
+	EXPECT_VECTORALMOSTEQ(t.rotation, t1.rotation);
+	EXPECT_VECTORALMOSTEQ(t.translation, t1.translation);
+	t = transform_lerp(t0, t1, REAL_C(0.5));
+	EXPECT_VECTORALMOSTEQ(t.translation, vector(REAL_C(-1.5), 1, REAL_C(2.5), REAL_C(1.25)));
+	EXPECT_REALEQ(vector_x(vector_length(t.rotation)), 1);
+
+	// Negated target rotation is the same orientation and must interpolate identically
+	t1.rotation = quaternion_neg(t1.rotation);
+	p = t.rotation;
+	t = transform_lerp(t0, t1, REAL_C(0.5));
+	EXPECT_VECTORALMOSTEQ(t.rotation, p);
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, dual_quaternion) {
+	dual_quaternion_t d0, d1, d;
+	transform_t t0, t1;
+	vector_t p;
+	const vector_t point = vector(2, -3, 5, 7);
+
+	d = dual_quaternion_identity();
+	EXPECT_VECTOREQ(dual_quaternion_transform_point(d, point), vector(2, -3, 5, 1));
+	EXPECT_VECTOREQ(dual_quaternion_transform_vector(d, point), vector(2, -3, 5, 0));
+
+	// 90 degrees around z axis, scale is ignored
+	t0 = transform(quaternion_scalar(0, 0, REAL_SQRT2 * REAL_C(0.5), REAL_SQRT2 * REAL_C(0.5)), vector(1, 2, 3, 0), 2);
+	d0 = dual_quaternion_from_transform(t0);
+	t0.translation = vector(1, 2, 3, 1);
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_translation(d0), vector(1, 2, 3, 0));
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_transform_point(d0, vector(1, 0, 0, 5)), vector(1, 3, 3, 1));
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_transform_point(d0, point), transform_apply_point(t0, point));
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_transform_vector(d0, point), transform_apply_vector(t0, point));
+
+	// 60 degrees around normalized (1, 2, 2) axis
+	t1 = transform(quaternion_scalar(REAL_C(0.5) / 3, REAL_C(1.0) / 3, REAL_C(1.0) / 3, REAL_SQRT3 * REAL_C(0.5)),
+	               vector(-4, 0, 2, 0), 1);
+	d1 = dual_quaternion(t1.rotation, t1.translation);
+	d = dual_quaternion_mul(d0, d1);
+	p = transform_apply_point(transform_mul(t0, t1), point);
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_transform_point(d, point), p);
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_transform_point(d1, dual_quaternion_transform_point(d0, point)), p);
+
+	d.q[0] = vector_mul(d0.q[0], vector_uniform(3));
+	d.q[1] = vector_add(vector_mul(d0.q[1], vector_uniform(3)), d0.q[0]);
+	d = dual_quaternion_normalize(d);
+	EXPECT_VECTORALMOSTEQ(d.q[0], d0.q[0]);
+	EXPECT_VECTORALMOSTEQ(d.q[1], d0.q[1]);
+
+	d = dual_quaternion_blend(d0, d1, d1, d1, vector(1, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(d.q[0], d0.q[0]);
+	EXPECT_VECTORALMOSTEQ(d.q[1], d0.q[1]);
+	d = dual_quaternion_blend(d1, d1, d1, d1, vector(REAL_C(0.25), REAL_C(0.25), REAL_C(0.25), REAL_C(0.25)));
+	EXPECT_VECTORALMOSTEQ(d.q[0], d1.q[0]);
+	EXPECT_VECTORALMOSTEQ(d.q[1], d1.q[1]);
+	d = dual_quaternion_blend(d0, d1, d0, d0, vector(REAL_C(0.5), REAL_C(0.5), 0, 0));
+	EXPECT_REALLT(math_abs(vector_x(vector_dot(d.q[0], d.q[1]))), REAL_C(1e-6));
+
+	// Negated influence is the same transform and must blend identically
+	p = dual_quaternion_transform_point(d, point);
+	d1.q[0] = vector_neg(d1.q[0]);
+	d1.q[1] = vector_neg(d1.q[1]);
+	d = dual_quaternion_blend(d0, d1, d0, d0, vector(REAL_C(0.5), REAL_C(0.5), 0, 0));
+	EXPECT_VECTORALMOSTEQ(dual_quaternion_transform_point(d, point), p);
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, dual_quaternion_skin) {
+	dual_quaternion_t bone[5];
+	vector_t in[13];
+	vector_t out[13];
+	vector_t weight[13];
+	uint16_t bone_index[13 * 4];
+	vector_config_t config;
+
+	for (int i = 0; i < 5; ++i) {
+		const real angle = REAL_C(0.7) * (real)i;
+		const quaternion_t rotation = quaternion_scalar(0, math_sin(angle), 0, math_cos(angle));
+		bone[i] = dual_quaternion(rotation, vector((real)i, (real)(-2 * i), 1, 0));
+	}
+	// Antipodal bone representation must not change the result
+	bone[3].q[0] = vector_neg(bone[3].q[0]);
+	bone[3].q[1] = vector_neg(bone[3].q[1]);
+
+	for (int i = 0; i < 13; ++i) {
+		const real w0 = REAL_C(0.1) + REAL_C(0.05) * (real)i;
+		in[i] = vector((real)i, REAL_C(0.5) * (real)i, (real)(3 - i), 1);
+		weight[i] = vector(w0, REAL_C(0.8) - w0, REAL_C(0.2), 0);
+		bone_index[i * 4 + 0] = (uint16_t)(i % 5);
+		bone_index[i * 4 + 1] = (uint16_t)((i + 1) % 5);
+		bone_index[i * 4 + 2] = (uint16_t)((i + 3) % 5);
+		bone_index[i * 4 + 3] = (uint16_t)((i + 4) % 5);
+	}
+
+	dual_quaternion_skin_array(out, in, 13, bone, bone_index, weight);
+	for (int i = 0; i < 13; ++i) {
+		const uint16_t* index = bone_index + i * 4;
+		const dual_quaternion_t d =
+		    dual_quaternion_blend(bone[index[0]], bone[index[1]], bone[index[2]], bone[index[3]], weight[i]);
+		EXPECT_VECTORALMOSTEQ(out[i], dual_quaternion_transform_point(d, in[i]));
+	}
+
+	vector_t stream[13];
+	dual_quaternion_skin_array_stream(stream, in, 13, bone, bone_index, weight);
+	for (int i = 0; i < 13; ++i)
+		EXPECT_VECTOREQ(stream[i], out[i]);
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		vector_t batch[13];
+		dual_quaternion_batch_skin(batch, in, 13, bone, bone_index, weight);
+		for (int i = 0; i < 13; ++i)
+			EXPECT_VECTORALMOSTEQ(batch[i], out[i]);
+
+		dual_quaternion_batch_skin_stream(batch, in, 13, bone, bone_index, weight);
+		for (int i = 0; i < 13; ++i)
+			EXPECT_VECTORALMOSTEQ(batch[i], out[i]);
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, interpolate_array) {
+	quaternion_t q0[23];
+	quaternion_t q1[23];
+	quaternion_t out[23];
+	quaternion_t batch[23];
+	real factor[23];
+	vector_config_t config;
+
+	for (int i = 0; i < 23; ++i) {
+		const real f = (real)i / REAL_C(22.0);
+		q0[i] = quaternion_normalize(quaternion_scalar(f, REAL_C(0.5), REAL_C(1.0) - f, REAL_C(0.3) + f));
+		q1[i] = quaternion_normalize(quaternion_scalar(REAL_C(-0.2), f * f, REAL_C(0.7), REAL_C(1.0) - f));
+		// Opposite hemisphere targets must interpolate along the shortest arc
+		if (i % 3 == 1)
+			q1[i] = quaternion_neg(q1[i]);
+		factor[i] = (i % 5) ? math_mod(f * REAL_C(3.7), REAL_C(1.0)) : (real)(i % 2);
+	}
+	// Identical and nearly orthogonal pairs at the ends of the approximation range
+	q1[4] = q0[4];
+	q0[5] = quaternion_identity();
+	q1[5] = quaternion_normalize(quaternion_scalar(1, 0, 0, REAL_C(0.001)));
+
+	EXPECT_VECTORALMOSTEQ(quaternion_nlerp(q0[0], q1[0], 0), q0[0]);
+	EXPECT_VECTORALMOSTEQ(quaternion_nlerp(q0[0], q1[0], 1), q1[0]);
+	EXPECT_VECTORALMOSTEQ(quaternion_nlerp(q0[1], q1[1], 1), quaternion_neg(q1[1]));
+	EXPECT_VECTORALMOSTEQ(quaternion_nlerp(q0[2], q1[2], REAL_C(0.5)), quaternion_slerp(q0[2], q1[2], REAL_C(0.5)));
+
+	quaternion_slerp_array(out, q0, q1, factor, 23);
+	for (int i = 0; i < 23; ++i) {
+		EXPECT_REALLT(vector_test_difference(out[i], quaternion_slerp(q0[i], q1[i], factor[i])), REAL_C(1e-5));
+		EXPECT_REALEQ(vector_x(vector_length(out[i])), 1);
+	}
+	quaternion_nlerp_array(out, q0, q1, factor, 23);
+	for (int i = 0; i < 23; ++i)
+		EXPECT_REALLT(vector_test_difference(out[i], quaternion_nlerp(q0[i], q1[i], factor[i])), REAL_C(1e-5));
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		quaternion_slerp_array(out, q0, q1, factor, 23);
+		quaternion_batch_slerp(batch, q0, q1, factor, 23);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_REALLT(vector_test_difference(batch[i], out[i]), REAL_C(1e-5));
+
+		// Partial block and in-place interpolation
+		for (int i = 0; i < 23; ++i)
+			batch[i] = q0[i];
+		quaternion_nlerp_array(out, q0, q1, factor, 7);
+		quaternion_batch_nlerp(batch, batch, q1, factor, 7);
+		for (int i = 0; i < 7; ++i)
+			EXPECT_REALLT(vector_test_difference(batch[i], out[i]), REAL_C(1e-5));
+		EXPECT_VECTOREQ(batch[7], q0[7]);
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, decompose) {
+	quaternion_t q[23];
+	quaternion_t single[23];
+	quaternion_t batch[23];
+	matrix_t m[23];
+	transform_t t[23];
+	transform_t tbatch[23];
+	vector_config_t config;
+
+	for (int i = 0; i < 23; ++i) {
+		const real f = (real)i / REAL_C(22.0);
+		q[i] = quaternion_normalize(
+		    quaternion_scalar(REAL_C(0.9) - f, REAL_C(0.4) * f, f * f - REAL_C(0.3), REAL_C(0.6) - REAL_C(0.5) * f));
+		// Half turns with zero w and pairs of equal diagonal terms
+		if (i % 4 == 3)
+			q[i] = quaternion_normalize(vector_set_component(q[i], 3, 0));
+		m[i] = matrix_from_quaternion(q[i]);
+	}
+	q[0] = quaternion_identity();
+	q[1] = quaternion_scalar(1, 0, 0, 0);
+	q[2] = quaternion_scalar(0, REAL_SQRT2 * REAL_C(0.5), REAL_SQRT2 * REAL_C(0.5), 0);
+	q[5] = quaternion_scalar(0, 0, REAL_SQRT2 * REAL_C(0.5), REAL_SQRT2 * REAL_C(-0.5));
+	for (int i = 0; i < 6; ++i)
+		m[i] = matrix_from_quaternion(q[i]);
+
+	// Equal up to sign of the quaternion
+	for (int i = 0; i < 23; ++i) {
+		single[i] = quaternion_from_matrix(m[i]);
+		EXPECT_REALEQ(vector_x(vector_length(single[i])), 1);
+		if (vector_x(vector_dot(single[i], q[i])) < 0)
+			EXPECT_REALLT(vector_test_difference(quaternion_neg(single[i]), q[i]), REAL_C(1e-5));
+		else
+			EXPECT_REALLT(vector_test_difference(single[i], q[i]), REAL_C(1e-5));
+	}
+	EXPECT_VECTORALMOSTEQ(quaternion_from_matrix(m[0]), quaternion_identity());
+	EXPECT_VECTORALMOSTEQ(quaternion_from_matrix(m[5]), quaternion_neg(q[5]));
+
+	batch[22] = quaternion_identity();
+	quaternion_from_matrix_array(batch, m, 22);
+	for (int i = 0; i < 22; ++i)
+		EXPECT_VECTORALMOSTEQ(batch[i], single[i]);
+	EXPECT_VECTOREQ(batch[22], quaternion_identity());
+
+	// Scaled, translated and reflected matrices
+	for (int i = 0; i < 23; ++i) {
+		const real scale = (REAL_C(0.25) + (real)i * REAL_C(0.5)) * ((i % 3 == 2) ? -1 : 1);
+		const transform_t ref = transform(q[i], vector((real)i, REAL_C(-2.0), REAL_C(0.5) * (real)i, 0), scale);
+		m[i] = transform_to_matrix(ref);
+		t[i] = matrix_decompose(m[i]);
+		EXPECT_REALLT(vector_test_difference(t[i].translation, ref.translation), REAL_C(1e-5) * (real)(i + 1));
+		EXPECT_REALLT(vector_test_difference(vector_transform(vector(2, -3, 5, 1), transform_to_matrix(t[i])),
+		                                     vector_transform(vector(2, -3, 5, 1), m[i])),
+		              REAL_C(1e-4) * (real)(i + 1));
+	}
+	tbatch[0] = matrix_decompose(matrix_scaling(vector(2, 2, 2, 1)));
+	EXPECT_VECTORALMOSTEQ(tbatch[0].rotation, quaternion_identity());
+	EXPECT_VECTORALMOSTEQ(tbatch[0].translation, vector(0, 0, 0, 2));
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		quaternion_batch_from_matrix(batch, m, 23);
+		for (int i = 0; i < 23; ++i)
+			EXPECT_REALLT(vector_test_difference(batch[i], quaternion_from_matrix(m[i])), REAL_C(1e-5));
+
+		tbatch[9] = transform_identity();
+		matrix_batch_decompose(tbatch, m, 9);
+		for (int i = 0; i < 9; ++i) {
+			EXPECT_REALLT(vector_test_difference(tbatch[i].rotation, t[i].rotation), REAL_C(1e-5));
+			EXPECT_REALLT(vector_test_difference(tbatch[i].translation, t[i].translation),
+			              REAL_C(1e-5) * (real)(i + 1));
+		}
+		EXPECT_VECTOREQ(tbatch[9].translation, vector_origo());
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(quaternion, euler) {
+	euler_angles_t angles[23];
+	quaternion_t single[23];
+	quaternion_t batch[23];
+
+	for (unsigned int order = 0; order < 24; ++order) {
+		// Round trip through euler angles, equal up to sign of the quaternion
+		for (int i = 0; i < 23; ++i) {
+			const real f = (real)i / REAL_C(22.0);
+			quaternion_t q = quaternion_normalize(
+			    quaternion_scalar(f - REAL_C(0.5), REAL_C(0.3) * f, REAL_C(0.8) - f, REAL_C(0.2) + f * f));
+			euler_angles_t e = euler_angles_from_quaternion(q, (euler_angles_order_t)order);
+			quaternion_t back = euler_angles_to_quaternion(e);
+			if (vector_x(vector_dot(q, back)) < 0)
+				back = quaternion_neg(back);
+			EXPECT_REALLT(vector_test_difference(back, q), REAL_C(1e-4));
+		}
+
+		for (int i = 0; i < 23; ++i) {
+			const real f = (real)i / REAL_C(22.0);
+			angles[i] = euler_angles(REAL_C(7.0) * f - REAL_C(3.0), REAL_C(-2.5) + f, REAL_C(12.0) * f * f,
+			                         (euler_angles_order_t)order);
+			single[i] = euler_angles_to_quaternion(angles[i]);
+		}
+		batch[22] = quaternion_identity();
+		euler_angles_to_quaternion_array(batch, angles, 22, (euler_angles_order_t)order);
+		for (int i = 0; i < 22; ++i)
+			EXPECT_REALLT(vector_test_difference(batch[i], single[i]), REAL_C(1e-5));
+		EXPECT_VECTOREQ(batch[22], quaternion_identity());
+	}
+
+	// Reference values for the default order, rotation by plain axis angles
+	EXPECT_VECTORALMOSTEQ(euler_angles_to_quaternion(euler_angles(REAL_PI, 0, 0, EULER_XYZs)),
+	                      quaternion_scalar(1, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(euler_angles_to_quaternion(euler_angles(0, REAL_HALFPI, 0, EULER_XYZs)),
+	                      quaternion_scalar(0, REAL_C(0.70710678), 0, REAL_C(0.70710678)));
+
 	return 0;
 }
 
@@ -194,6 +629,13 @@ test_quaternion_declare(void) {
 	ADD_TEST(quaternion, construct);
 	ADD_TEST(quaternion, ops);
 	ADD_TEST(quaternion, vec);
+	ADD_TEST(quaternion, rotate_array);
+	ADD_TEST(quaternion, transform);
+	ADD_TEST(quaternion, dual_quaternion);
+	ADD_TEST(quaternion, dual_quaternion_skin);
+	ADD_TEST(quaternion, interpolate_array);
+	ADD_TEST(quaternion, decompose);
+	ADD_TEST(quaternion, euler);
 }
 
 static test_suite_t test_quaternion_suite = {test_quaternion_application,
@@ -226,3 +668,4 @@ test_suite_define(void) {
 }
 
 #endif
+
@@ -33,8 +33,7 @@ vector_test_difference(const vector_t v0, const vector_t v1) {
 #define EXPECT_VECTOREQ(var, expect)                                                      \
 	do {                                                                                  \
 		vectori_t eqvec = vector_equal((var), (expect));                                  \
-		if (!vectori_x(eqvec) || !vectori_y(eqvec) ||                                     \
-		    !vectori_z(eqvec) || !vectori_w(eqvec)) {                                     \
+		if (!vectori_all(eqvec)) {                                                        \
 			char buffer[2][64];                                                           \
 			string_t vstr[2];                                                             \
 			vstr[0] = string_from_vector(buffer[0], sizeof(buffer[0]), (var));            \
@@ -51,8 +50,7 @@ vector_test_difference(const vector_t v0, const vector_t v1) {
 #define EXPECT_VECTORNOTEQ(var, expect)                                                   \
 	do {                                                                                  \
 		vectori_t eqvec = vector_equal((var), (expect));                                  \
-		if (vectori_x(eqvec) && vectori_y(eqvec) &&                                       \
-		    vectori_z(eqvec) && vectori_w(eqvec)) {                                       \
+		if (vectori_all(eqvec)) {                                                         \
 			char buffer[2][64];                                                           \
 			string_t vstr[2];                                                             \
 			vstr[0] = string_from_vector(buffer[0], sizeof(buffer[0]), (var));            \
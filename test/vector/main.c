@@ -29,6 +29,9 @@
 //#define FOUNDATION_ARCH_NEON 0
 
 #include <vector/vector.h>
+#include <vector/bounds.h>
+#include <vector/spline.h>
+#include <vector/vector4d.h>
 
 #include "../test/vector.h"
 
@@ -69,6 +72,15 @@ test_vector_finalize(void) {
 	vector_module_finalize();
 }
 
+// Bit pattern of a value, comparisons with infinity and NaN are not reliable under the fast math build flags
+static uint32_t
+test_vector_bits(real value) {
+	const float32_t fvalue = (float32_t)value;
+	uint32_t bits;
+	memcpy(&bits, &fvalue, sizeof(bits));
+	return bits;
+}
+
 DECLARE_TEST(vector, construct) {
 	vector_t vec;
 	float32_t unaligned[4] = {3, 2, 1, 0};
@@ -149,6 +161,38 @@ DECLARE_TEST(vector, construct) {
 	return 0;
 }
 
+DECLARE_TEST(vector, load3) {
+	vector_t vec[11];
+	float32_t packed[34];
+	float32_t stored[34];
+	int i;
+
+	for (i = 0; i < 33; ++i) {
+		packed[i] = (float32_t)i - REAL_C(0.5);
+		stored[i] = 0;
+	}
+	packed[33] = stored[33] = -7;
+
+	vec[0] = vector_load3(packed + 30);
+	EXPECT_VECTOREQ(vec[0], vector(REAL_C(29.5), REAL_C(30.5), REAL_C(31.5), 1));
+	vector_store3(stored + 30, vector(1, 2, 3, 4));
+	EXPECT_REALEQ(stored[30], 1);
+	EXPECT_REALEQ(stored[31], 2);
+	EXPECT_REALEQ(stored[32], 3);
+	EXPECT_REALEQ(stored[33], -7);
+
+	// Two blocks of four and a tail of three vectors
+	vector_load3_array(vec, packed, 11);
+	for (i = 0; i < 11; ++i)
+		EXPECT_VECTOREQ(vec[i], vector(packed[i * 3], packed[i * 3 + 1], packed[i * 3 + 2], 1));
+	vec[4] = vector_set_component(vec[4], 3, 8);
+	vector_store3_array(stored, vec, 11);
+	for (i = 0; i < 34; ++i)
+		EXPECT_REALEQ(stored[i], packed[i]);
+
+	return 0;
+}
+
 DECLARE_TEST(vector, normalize) {
 	vector_t vec;
 	real ref;
@@ -575,6 +619,23 @@ DECLARE_TEST(vector, shuffle) {
 	EXPECT_REALEQ(vector_z(vec), REAL_C(6.0));
 	EXPECT_REALEQ(vector_w(vec), REAL_C(7.0));
 
+	// Specialized shuffles, one per class of generated sequence
+	EXPECT_VECTOREQ(vector_shuffle_XXXX(in), vector_shuffle(in, VECTOR_MASK_XXXX));
+	EXPECT_VECTOREQ(vector_shuffle_WWWW(in), vector_shuffle(in, VECTOR_MASK_WWWW));
+	EXPECT_VECTOREQ(vector_shuffle_XYZW(in), in);
+	EXPECT_VECTOREQ(vector_shuffle_YXWZ(in), vector(2, 1, 4, 3));
+	EXPECT_VECTOREQ(vector_shuffle_YZWX(in), vector(2, 3, 4, 1));
+	EXPECT_VECTOREQ(vector_shuffle_ZWXY(in), vector(3, 4, 1, 2));
+	EXPECT_VECTOREQ(vector_shuffle_WXYZ(in), vector(4, 1, 2, 3));
+	EXPECT_VECTOREQ(vector_shuffle_XXYY(in), vector(1, 1, 2, 2));
+	EXPECT_VECTOREQ(vector_shuffle_XZXZ(in), vector(1, 3, 1, 3));
+	EXPECT_VECTOREQ(vector_shuffle_YYWW(in), vector(2, 2, 4, 4));
+	EXPECT_VECTOREQ(vector_shuffle_YZXW(in), vector(2, 3, 1, 4));
+	EXPECT_VECTOREQ(vector_shuffle_ZXYW(in), vector(3, 1, 2, 4));
+	EXPECT_VECTOREQ(vector_shuffle_WZYX(in), vector(4, 3, 2, 1));
+	EXPECT_VECTOREQ(vector_shuffle_ZYXW(in), vector(3, 2, 1, 4));
+	EXPECT_VECTOREQ(vector_shuffle_XWYZ(in), vector(1, 4, 2, 3));
+
 	return 0;
 }
 
@@ -729,13 +790,20 @@ DECLARE_TEST(vector, length) {
 	EXPECT_VECTOREQ(vec, vector_zero());
 
 	vec = vector_length_fast(vector_one());
-	EXPECT_VECTOREQ(vec, vector_two());
+	EXPECT_VECTORALMOSTEQ(vec, vector_two());
 
 	vec = vector_length_fast(vector_two());
-	EXPECT_VECTOREQ(vec, vector_uniform(4));
+	EXPECT_VECTORALMOSTEQ(vec, vector_uniform(4));
 
 	vec = vector_length_fast(vector(1, -2, 3, -4));
-	EXPECT_VECTOREQ(vec, vector_uniform(math_sqrt(30)));
+	EXPECT_VECTORALMOSTEQ(vec, vector_uniform(math_sqrt(30)));
+
+	// Denormal squared length gives zero, and overflow to infinity is passed through
+	vec = vector_length_fast(vector(1e-20f, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(vec, vector_zero());
+
+	vec = vector_length_fast(vector(1e20f, 1e20f, 0, 0));
+	EXPECT_UINTEQ(test_vector_bits(vector_x(vec)), 0x7F800000);
 
 	vec = vector_length3(vector_zero());
 	EXPECT_VECTOREQ(vec, vector_zero());
@@ -753,13 +821,20 @@ DECLARE_TEST(vector, length) {
 	EXPECT_VECTOREQ(vec, vector_zero());
 
 	vec = vector_length3_fast(vector_one());
-	EXPECT_VECTOREQ(vec, vector_uniform(REAL_SQRT3));
+	EXPECT_VECTORALMOSTEQ(vec, vector_uniform(REAL_SQRT3));
 
 	vec = vector_length3_fast(vector_two());
-	EXPECT_VECTOREQ(vec, vector_uniform(math_sqrt(12)));
+	EXPECT_VECTORALMOSTEQ(vec, vector_uniform(math_sqrt(12)));
 
 	vec = vector_length3_fast(vector(1, -2, 3, -4));
-	EXPECT_VECTOREQ(vec, vector_uniform(math_sqrt(14)));
+	EXPECT_VECTORALMOSTEQ(vec, vector_uniform(math_sqrt(14)));
+
+	// Denormal squared length gives zero, and overflow to infinity is passed through
+	vec = vector_length3_fast(vector(1e-20f, 0, 0, 0));
+	EXPECT_VECTORALMOSTEQ(vec, vector_zero());
+
+	vec = vector_length3_fast(vector(1e20f, 1e20f, 0, 0));
+	EXPECT_UINTEQ(test_vector_bits(vector_x(vec)), 0x7F800000);
 
 	vec = vector_length_sqr(vector_zero());
 	EXPECT_VECTOREQ(vec, vector_zero());
@@ -782,6 +857,221 @@ DECLARE_TEST(vector, length) {
 	return 0;
 }
 
+DECLARE_TEST(vector, fast) {
+	vector_t vec;
+
+	vec = vector_normalize3_fast(vector(0, -3, 7, -10));
+	EXPECT_REALEQ(vector_w(vec), REAL_C(-10.0));
+	EXPECT_VECTORALMOSTEQ(vec, vector_normalize3(vector(0, -3, 7, -10)));
+	EXPECT_VECTORALMOSTEQ(vector_normalize_fast(vector(0, -3, 7, -10)), vector_normalize(vector(0, -3, 7, -10)));
+
+	// Relative error bound documented in vector.h, checked over several binades
+	for (int i = 0; i < 1024; ++i) {
+		const real x = REAL_C(0.001) + (real)i * REAL_C(3.71);
+		const vector_t v = vector(x, x * REAL_C(0.5), x * REAL_C(1.7), REAL_C(1.0) / x);
+		const real bound = REAL_C(5e-7);
+		const vector_t rsqrt = vector_mul(vector_rsqrt_fast(v), vector_sqrt(v));
+		const vector_t rcp = vector_mul(vector_reciprocal_fast(v), v);
+		const vector_t length = vector_div(vector_length_fast(v), vector_length(v));
+		const vector_t length3 = vector_div(vector_length3_fast(v), vector_length3(v));
+		const vector_t norm = vector_normalize_fast(v);
+		const vector_t norm3 = vector_normalize3_fast(v);
+		EXPECT_REALLE(vector_test_difference(rsqrt, vector_one()), bound * 4);
+		EXPECT_REALLE(vector_test_difference(rcp, vector_one()), bound * 4);
+		EXPECT_REALLE(math_abs(vector_x(length) - REAL_C(1.0)), bound);
+		EXPECT_REALLE(math_abs(vector_x(length3) - REAL_C(1.0)), bound);
+		EXPECT_REALLE(math_abs(vector_x(vector_length(norm)) - REAL_C(1.0)), bound);
+		EXPECT_REALLE(math_abs(vector_x(vector_length3(norm3)) - REAL_C(1.0)), bound);
+		EXPECT_REALEQ(vector_w(norm3), vector_w(v));
+	}
+
+	return 0;
+}
+
+DECLARE_TEST(vector, transcendental) {
+	vector_t sinval, cosval;
+
+	// Error bounds documented in transcendental.h, compared against scalar functions
+	for (int i = 0; i < 1024; ++i) {
+		const real f = (real)i / REAL_C(1023.0);
+		const vector_t angle = vector(REAL_C(200.0) * f - REAL_C(100.0), REAL_C(6.4) * f - REAL_C(3.2),
+		                              REAL_C(-1.0) + f, REAL_C(25.0) * f * f);
+		vector_sincos(angle, &sinval, &cosval);
+		EXPECT_VECTOREQ(sinval, vector_sin(angle));
+		EXPECT_VECTOREQ(cosval, vector_cos(angle));
+		vector_sincos_fast(angle, &sinval, &cosval);
+		EXPECT_VECTOREQ(sinval, vector_sin_fast(angle));
+		EXPECT_VECTOREQ(cosval, vector_cos_fast(angle));
+		for (int c = 0; c < 4; ++c) {
+			const real a = vector_component(angle, c);
+			EXPECT_REALLE(math_abs(vector_component(vector_sin(angle), c) - math_sin(a)), REAL_C(1e-6));
+			EXPECT_REALLE(math_abs(vector_component(vector_cos(angle), c) - math_cos(a)), REAL_C(1e-6));
+			EXPECT_REALLE(math_abs(vector_component(vector_sin_fast(angle), c) - math_sin(a)), REAL_C(1e-4));
+			EXPECT_REALLE(math_abs(vector_component(vector_cos_fast(angle), c) - math_cos(a)), REAL_C(1e-4));
+		}
+
+		const vector_t v = vector(REAL_C(2.0) * f - REAL_C(1.0), f, -f, REAL_C(0.5) - f * f);
+		const vector_t y = vector(REAL_C(3.0) * f - REAL_C(1.5), REAL_C(-0.1) - f, REAL_C(1.0) - f, REAL_C(-0.25));
+		const vector_t x = vector(REAL_C(0.5), REAL_C(2.0) * f - REAL_C(1.0), -f, REAL_C(4.0) * f - REAL_C(3.0));
+		for (int c = 0; c < 4; ++c) {
+			const real a = vector_component(v, c);
+			const real ref = math_atan2(vector_component(y, c), vector_component(x, c));
+			EXPECT_REALLE(math_abs(vector_component(vector_acos(v), c) - math_acos(a)), REAL_C(1e-6));
+			EXPECT_REALLE(math_abs(vector_component(vector_acos_fast(v), c) - math_acos(a)), REAL_C(1e-4));
+			EXPECT_REALLE(math_abs(vector_component(vector_atan2(y, x), c) - ref), REAL_C(1e-6));
+			EXPECT_REALLE(math_abs(vector_component(vector_atan2_fast(y, x), c) - ref), REAL_C(5e-6));
+		}
+
+		const vector_t e = vector(REAL_C(160.0) * f - REAL_C(80.0), REAL_C(2.0) * f - REAL_C(1.0), REAL_C(10.0) * f,
+		                          REAL_C(-20.0) * f);
+		const vector_t l = vector(REAL_C(1e-30) + f * REAL_C(1e30), REAL_C(0.5) + f, REAL_C(1e-3) + f * REAL_C(10.0),
+		                          math_exp(REAL_C(10.0) * f - REAL_C(5.0)));
+		for (int c = 0; c < 4; ++c) {
+			const real ref = math_exp(vector_component(e, c));
+			const real lref = math_logn(vector_component(l, c));
+			const real lscale = math_abs(lref) > 1 ? math_abs(lref) : 1;
+			EXPECT_REALLE(math_abs(vector_component(vector_exp(e), c) - ref), ref * REAL_C(1e-6));
+			EXPECT_REALLE(math_abs(vector_component(vector_exp_fast(e), c) - ref), ref * REAL_C(1e-4));
+			EXPECT_REALLE(math_abs(vector_component(vector_log(l), c) - lref), lscale * REAL_C(1e-6));
+			EXPECT_REALLE(math_abs(vector_component(vector_log_fast(l), c) - lref), lscale * REAL_C(1e-4));
+		}
+	}
+
+	EXPECT_VECTORALMOSTEQ(vector_sin(vector(0, REAL_HALFPI, REAL_PI, -REAL_HALFPI)), vector(0, 1, 0, -1));
+	EXPECT_VECTORALMOSTEQ(vector_cos(vector(0, REAL_HALFPI, REAL_PI, -REAL_HALFPI)), vector(1, 0, -1, 0));
+	EXPECT_VECTORALMOSTEQ(vector_acos(vector(1, 0, -1, REAL_C(0.5))), vector(0, REAL_HALFPI, REAL_PI, REAL_PI / 3));
+	EXPECT_VECTORALMOSTEQ(vector_atan2(vector(0, 1, 0, -1), vector(0, 0, -1, 0)),
+	                      vector(0, REAL_HALFPI, REAL_PI, -REAL_HALFPI));
+	EXPECT_VECTORALMOSTEQ(vector_exp(vector(0, 1, -1, 2)),
+	                      vector(1, REAL_C(2.7182818), REAL_C(0.36787944), REAL_C(7.3890561)));
+	EXPECT_VECTORALMOSTEQ(vector_log(vector(1, REAL_C(2.7182818), REAL_C(0.5), 8)),
+	                      vector(0, 1, REAL_C(-0.69314718), REAL_C(2.0794415)));
+
+	return 0;
+}
+
+DECLARE_TEST(vector, pack) {
+	uint16_t half[4 * 7];
+	uint8_t unorm8[4 * 7];
+	int8_t snorm8[4 * 7];
+	uint16_t unorm16[4 * 7];
+	int16_t snorm16[4 * 7];
+	uint32_t packed[7];
+	uint16_t smallest3[3 * 7];
+	vector_t in[7];
+	vector_t out[7];
+
+	// Half precision bit patterns, including rounding to nearest even, overflow and subnormals
+	vector_store_half(half, vector(1, -2, REAL_C(0.5), 65504));
+	EXPECT_UINTEQ(half[0], 0x3C00);
+	EXPECT_UINTEQ(half[1], 0xC000);
+	EXPECT_UINTEQ(half[2], 0x3800);
+	EXPECT_UINTEQ(half[3], 0x7BFF);
+	EXPECT_VECTOREQ(vector_load_half(half), vector(1, -2, REAL_C(0.5), 65504));
+	vector_store_half(half, vector(REAL_C(1.0) + REAL_C(0.00048828125), REAL_C(1.0) + REAL_C(0.00146484375), 70000,
+	                               REAL_C(5.9604644775390625e-8)));
+	EXPECT_UINTEQ(half[0], 0x3C00);
+	EXPECT_UINTEQ(half[1], 0x3C02);
+	EXPECT_UINTEQ(half[2], 0x7C00);
+	EXPECT_UINTEQ(half[3], 0x0001);
+	EXPECT_REALEQ(vector_w(vector_load_half(half)), REAL_C(5.9604644775390625e-8));
+	for (int i = 0; i < 1024; ++i) {
+		const real f = REAL_C(2000.0) * (real)i / REAL_C(1023.0) - REAL_C(1000.0);
+		const vector_t v = vector(f, f * REAL_C(0.001), REAL_C(1.0) / (f + REAL_C(1000.5)), -f * REAL_C(0.01));
+		vector_store_half(half, v);
+		const vector_t error = vector_abs(vector_sub(vector_load_half(half), v));
+		EXPECT_TRUE(vectori_x(vector_lequal(error, vector_mul(vector_abs(v), vector_uniform(REAL_C(0.00049))))));
+	}
+
+	vector_store_unorm8(unorm8, vector(0, 1, REAL_C(0.5), 2));
+	EXPECT_UINTEQ(unorm8[0], 0);
+	EXPECT_UINTEQ(unorm8[1], 255);
+	EXPECT_UINTEQ(unorm8[2], 128);
+	EXPECT_UINTEQ(unorm8[3], 255);
+	EXPECT_VECTORALMOSTEQ(vector_load_unorm8(unorm8), vector(0, 1, REAL_C(128.0) / 255, 1));
+
+	vector_store_snorm8(snorm8, vector(-1, 1, -2, REAL_C(0.25)));
+	EXPECT_INTEQ(snorm8[0], -127);
+	EXPECT_INTEQ(snorm8[1], 127);
+	EXPECT_INTEQ(snorm8[2], -127);
+	EXPECT_INTEQ(snorm8[3], 32);
+	snorm8[2] = -128;
+	EXPECT_VECTORALMOSTEQ(vector_load_snorm8(snorm8), vector(-1, 1, -1, REAL_C(32.0) / 127));
+
+	vector_store_unorm16(unorm16, vector(0, 1, REAL_C(0.5), -1));
+	EXPECT_UINTEQ(unorm16[0], 0);
+	EXPECT_UINTEQ(unorm16[1], 65535);
+	EXPECT_UINTEQ(unorm16[2], 32768);
+	EXPECT_UINTEQ(unorm16[3], 0);
+	EXPECT_VECTORALMOSTEQ(vector_load_unorm16(unorm16), vector(0, 1, REAL_C(0.5), 0));
+
+	vector_store_snorm16(snorm16, vector(-1, 1, REAL_C(0.5), 3));
+	EXPECT_INTEQ(snorm16[0], -32767);
+	EXPECT_INTEQ(snorm16[1], 32767);
+	EXPECT_INTEQ(snorm16[2], 16384);
+	EXPECT_INTEQ(snorm16[3], 32767);
+	snorm16[0] = -32768;
+	EXPECT_VECTORALMOSTEQ(vector_load_snorm16(snorm16), vector(-1, 1, REAL_C(0.5), 1));
+
+	EXPECT_UINTEQ(vector_pack_snorm1010102(vector(1, -1, 0, 1)), 0x400805FFU);
+	EXPECT_VECTOREQ(vector_unpack_snorm1010102(0x400805FFU), vector(1, -1, 0, 1));
+	EXPECT_VECTOREQ(vector_unpack_snorm1010102(0xC0000000U), vector(0, 0, 0, -1));
+	EXPECT_VECTOREQ(vector_unpack_snorm1010102(0x80000200U), vector(-1, 0, 0, -1));
+	for (int i = 0; i < 7; ++i) {
+		const real f = (real)i / REAL_C(6.0);
+		in[i] = vector(REAL_C(2.0) * f - REAL_C(1.0), REAL_C(0.3) - f, f * f, (i % 2) ? -1 : 1);
+	}
+	vector_pack_snorm1010102_array(packed, in, 7);
+	vector_unpack_snorm1010102_array(out, packed, 7);
+	for (int i = 0; i < 7; ++i) {
+		EXPECT_UINTEQ(packed[i], vector_pack_snorm1010102(in[i]));
+		EXPECT_REALLT(vector_test_difference(out[i], in[i]), REAL_C(3.0) / 511);
+		EXPECT_REALEQ(vector_w(out[i]), vector_w(in[i]));
+	}
+
+	for (int i = 0; i < 7; ++i) {
+		const real f = (real)i / REAL_C(6.0);
+		in[i] = vector(f - REAL_C(0.5), REAL_C(0.25) * f, REAL_C(1.0) - f, REAL_C(0.5) + f);
+	}
+	vector_store_half_array(half, in, 7);
+	vector_load_half_array(out, half, 7);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_load_half(half + (i * 4)));
+	vector_store_unorm8_array(unorm8, in, 7);
+	vector_load_unorm8_array(out, unorm8, 7);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_load_unorm8(unorm8 + (i * 4)));
+	vector_store_snorm8_array(snorm8, in, 7);
+	vector_load_snorm8_array(out, snorm8, 7);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_load_snorm8(snorm8 + (i * 4)));
+	vector_store_unorm16_array(unorm16, in, 7);
+	vector_load_unorm16_array(out, unorm16, 7);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(out[i], vector_load_unorm16(unorm16 + (i * 4)));
+	vector_store_snorm16_array(snorm16, in, 7);
+	vector_load_snorm16_array(out, snorm16, 7);
+	for (int i = 0; i < 7; ++i)
+		EXPECT_REALLT(vector_test_difference(out[i], vector_min(in[i], vector_one())), REAL_C(4.0) / 32767);
+
+	// Smallest three, equal up to sign with the largest component made positive
+	for (int i = 0; i < 7; ++i) {
+		const real c[4] = {vector_x(in[i]), vector_y(in[i]), vector_z(in[i]), vector_w(in[i])};
+		in[i] = quaternion_normalize(vector(c[i % 4], c[(i + 1) % 4], c[(i + 2) % 4], -c[(i + 3) % 4]));
+	}
+	in[6] = quaternion_scalar(0, 0, -1, 0);
+	quaternion_store_smallest3_array(smallest3, in, 7);
+	quaternion_load_smallest3_array(out, smallest3, 7);
+	for (int i = 0; i < 7; ++i) {
+		const quaternion_t q = (vector_x(vector_dot(out[i], in[i])) < 0) ? quaternion_neg(in[i]) : in[i];
+		EXPECT_REALLT(vector_test_difference(out[i], q), REAL_C(1e-4));
+		EXPECT_VECTOREQ(out[i], quaternion_load_smallest3(smallest3 + (i * 3)));
+	}
+	EXPECT_VECTORALMOSTEQ(out[6], quaternion_scalar(0, 0, 1, 0));
+
+	return 0;
+}
+
 DECLARE_TEST(vector, minmax) {
 	vector_t vec;
 
@@ -844,6 +1134,1121 @@ DECLARE_TEST(vector, equal) {
 	return 0;
 }
 
+DECLARE_TEST(vector, select) {
+	const vector_t v0 = vector(1, -2, 3, -4);
+	const vector_t v1 = vector(-1, 2, 0, 5);
+	const vectori_t less = vector_less(v0, v1);
+	const vectori_t greater = vector_greater(v0, v1);
+
+	EXPECT_VECTOREQ(vector_select(less, v0, v1), vector(-1, -2, 0, -4));
+	EXPECT_VECTOREQ(vector_select(less, v0, v1), vector_min(v0, v1));
+	EXPECT_VECTOREQ(vector_select(greater, v0, v1), vector_max(v0, v1));
+	EXPECT_VECTOREQ(vector_select(vector_equal(v0, v0), v0, v1), v0);
+	EXPECT_VECTOREQ(vector_select(vector_equal(v0, v1), v0, v1), v1);
+
+	EXPECT_UINTEQ(vectori_movemask(less), 0xA);
+	EXPECT_UINTEQ(vectori_movemask(greater), 0x5);
+	EXPECT_UINTEQ(vectori_movemask(vector_equal(v0, v0)), 0xF);
+	EXPECT_UINTEQ(vectori_movemask(vector_equal(v0, v1)), 0);
+	EXPECT_UINTEQ(vectori_movemask(vector_equal(v0, vector(0, -2, 0, 0))), 0x2);
+
+	EXPECT_TRUE(vectori_any(less));
+	EXPECT_FALSE(vectori_all(less));
+	EXPECT_TRUE(vectori_all(vector_equal(v0, v0)));
+	EXPECT_TRUE(vectori_any(vector_equal(v0, v0)));
+	EXPECT_FALSE(vectori_all(vector_equal(v0, v1)));
+	EXPECT_FALSE(vectori_any(vector_equal(v0, v1)));
+	EXPECT_TRUE(vectori_all(vectori_or(less, greater)));
+	EXPECT_FALSE(vectori_any(vectori_and(less, greater)));
+
+	EXPECT_VECTOREQ(vector_clamp(vector(-3, -0.5f, 0.5f, 3), vector_uniform(-1), vector_one()),
+	                vector(-1, -0.5f, 0.5f, 1));
+	EXPECT_VECTOREQ(vector_clamp(v0, vector(0, 0, 0, 0), vector(0.5f, 1, 2, 4)), vector(0.5f, 0, 2, 0));
+	EXPECT_VECTOREQ(vector_saturate(vector(-1, 0.25f, 1, 2)), vector(0, 0.25f, 1, 1));
+	EXPECT_VECTOREQ(vector_saturate(vector_zero()), vector_zero());
+
+	return 0;
+}
+
+DECLARE_TEST(vector, integer) {
+	vector_config_t config;
+	vector_t point[23];
+	uint32_t key[24];
+	uint32_t batch_key[24];
+	const vectori_t a = vectori(7, -3, 100000, -1);
+	const vectori_t b = vectori(-2, 5, 100000, 1);
+	vectori_t c;
+	int i;
+
+	c = vectori_add(a, b);
+	EXPECT_INTEQ(vectori_x(c), 5);
+	EXPECT_INTEQ(vectori_y(c), 2);
+	EXPECT_INTEQ(vectori_z(c), 200000);
+	EXPECT_INTEQ(vectori_w(c), 0);
+
+	c = vectori_sub(a, b);
+	EXPECT_INTEQ(vectori_x(c), 9);
+	EXPECT_INTEQ(vectori_y(c), -8);
+	EXPECT_INTEQ(vectori_z(c), 0);
+	EXPECT_INTEQ(vectori_w(c), -2);
+
+	// Low 32 bits of the product, 100000^2 wraps
+	c = vectori_mul(a, b);
+	EXPECT_INTEQ(vectori_x(c), -14);
+	EXPECT_INTEQ(vectori_y(c), -15);
+	EXPECT_INTEQ(vectori_z(c), (int32_t)(uint32_t)10000000000ULL);
+	EXPECT_INTEQ(vectori_w(c), -1);
+
+	c = vectori_shift_left(a, 3);
+	EXPECT_INTEQ(vectori_x(c), 56);
+	EXPECT_INTEQ(vectori_y(c), -24);
+	c = vectori_shift_right(a, 1);
+	EXPECT_INTEQ(vectori_x(c), 3);
+	EXPECT_INTEQ(vectori_y(c), -2);
+	EXPECT_INTEQ(vectori_z(c), 50000);
+	EXPECT_INTEQ(vectori_w(c), -1);
+
+	c = vectori_min(a, b);
+	EXPECT_INTEQ(vectori_x(c), -2);
+	EXPECT_INTEQ(vectori_y(c), -3);
+	EXPECT_INTEQ(vectori_w(c), -1);
+	c = vectori_max(a, b);
+	EXPECT_INTEQ(vectori_x(c), 7);
+	EXPECT_INTEQ(vectori_y(c), 5);
+	EXPECT_INTEQ(vectori_w(c), 1);
+
+	c = vectori_xor(vectori_uniform(0x0F0F), vectori(0xFFFF, 0, 0x0F0F, -1));
+	EXPECT_INTEQ(vectori_x(c), 0xF0F0);
+	EXPECT_INTEQ(vectori_y(c), 0x0F0F);
+	EXPECT_INTEQ(vectori_z(c), 0);
+	EXPECT_INTEQ(vectori_w(c), ~0x0F0F);
+
+	EXPECT_VECTOREQ(vector_floor(vector(1.5f, -1.5f, -2, 0.25f)), vector(1, -2, -2, 0));
+	EXPECT_VECTOREQ(vector_ceil(vector(1.5f, -1.5f, -2, 0.25f)), vector(2, -1, -2, 1));
+	EXPECT_VECTOREQ(vector_round(vector(1.5f, 2.5f, -2.5f, 0.75f)), vector(2, 2, -2, 1));
+	EXPECT_VECTOREQ(vector_round(vector(-0.25f, 3.49f, -3.51f, 1e-3f)), vector(0, 3, -4, 0));
+	EXPECT_VECTOREQ(vector_floor(vector(3e9f, -3e9f, 16777215.0f, -8388609.0f)),
+	                vector(3e9f, -3e9f, 16777215.0f, -8388609.0f));
+	EXPECT_VECTOREQ(vector_ceil(vector(8388607.5f, -8388607.5f, 1e30f, REAL_MAX)),
+	                vector(8388608.0f, -8388607.0f, 1e30f, REAL_MAX));
+	EXPECT_VECTOREQ(vector_round(vector(3e9f, -3e9f, 8388609.0f, -1e30f)), vector(3e9f, -3e9f, 8388609.0f, -1e30f));
+	EXPECT_UINTEQ(test_vector_bits(vector_x(vector_ceil(vector(-0.25f, 0, 0, 0)))), 0x80000000);
+	EXPECT_UINTEQ(test_vector_bits(vector_x(vector_round(vector(-0.25f, 0, 0, 0)))), 0x80000000);
+
+	c = vector_to_vectori(vector(1.9f, -1.9f, 123456.0f, -0.5f));
+	EXPECT_INTEQ(vectori_x(c), 1);
+	EXPECT_INTEQ(vectori_y(c), -1);
+	EXPECT_INTEQ(vectori_z(c), 123456);
+	EXPECT_INTEQ(vectori_w(c), 0);
+	EXPECT_VECTOREQ(vectori_to_vector(vectori(1, -2, 123456, 0)), vector(1, -2, 123456, 0));
+	EXPECT_VECTOREQ(vectori_to_vector(vector_to_vectori(vector_floor(vector(-0.5f, 2.5f, -7.25f, 0)))),
+	                vector(-1, 2, -8, 0));
+
+	for (i = 0; i < 23; ++i)
+		point[i] = vector((real)(i * 7 % 11) - 5.5f, (real)(i % 5) * 1.25f - 3, (real)(i * 3) - 30.5f, 1);
+	memset(key, 0, sizeof(key));
+	vector_hash_cells_array(key, point, 23, REAL_C(2.0));
+	EXPECT_UINTEQ(key[23], 0);
+	for (i = 0; i < 23; ++i) {
+		const uint32_t cx = (uint32_t)(int32_t)math_floor(vector_x(point[i]) * REAL_C(0.5));
+		const uint32_t cy = (uint32_t)(int32_t)math_floor(vector_y(point[i]) * REAL_C(0.5));
+		const uint32_t cz = (uint32_t)(int32_t)math_floor(vector_z(point[i]) * REAL_C(0.5));
+		EXPECT_UINTEQ(key[i], (cx * 73856093U) ^ (cy * 19349663U) ^ (cz * 83492791U));
+	}
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		for (int count = 23; count >= 20; --count) {
+			memset(batch_key, 0, sizeof(batch_key));
+			vector_batch_hash_cells(batch_key, point, (size_t)count, REAL_C(2.0));
+			for (i = 0; i < count; ++i)
+				EXPECT_UINTEQ(batch_key[i], key[i]);
+			EXPECT_UINTEQ(batch_key[count], 0);
+		}
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, soa) {
+	vector_t vec[7] = {vector(1, 2, 3, 4),  vector(-5, 6, -7, 8),  vector(9, -10, 11, -12), vector(0, 0, 2, 1),
+	                   vector(3, 0, 4, 0),  vector(-1, -2, -3, -4), vector(2, 4, 4, 5)};
+	vector_t res[7];
+	vector_t big[19];
+	vector_t bigres[19];
+	vector_soa_t soa[5];
+	vector_soa_t s0, s1, sr;
+	vector_t v;
+	int i;
+
+	s0 = vector_soa_load(vec);
+	EXPECT_VECTOREQ(s0.x, vector(1, -5, 9, 0));
+	EXPECT_VECTOREQ(s0.y, vector(2, 6, -10, 0));
+	EXPECT_VECTOREQ(s0.z, vector(3, -7, 11, 2));
+	EXPECT_VECTOREQ(s0.w, vector(4, 8, -12, 1));
+	vector_soa_store(res, s0);
+	for (i = 0; i < 4; ++i)
+		EXPECT_VECTOREQ(res[i], vec[i]);
+
+	vector_soa_load_array(soa, vec, 7);
+	EXPECT_VECTOREQ(soa[1].x, vector(3, -1, 2, 0));
+	EXPECT_VECTOREQ(soa[1].w, vector(0, -4, 5, 0));
+	vector_soa_store_array(res, soa, 7);
+	for (i = 0; i < 7; ++i)
+		EXPECT_VECTOREQ(res[i], vec[i]);
+
+	s1 = soa[1];
+	v = vector_soa_dot3(s0, s1);
+	EXPECT_VECTOREQ(v, vector(15, 14, 22, 0));
+	v = vector_soa_dot(s0, s1);
+	EXPECT_VECTOREQ(v, vector(15, -18, -38, 0));
+	v = vector_soa_length3_sqr(s1);
+	EXPECT_VECTOREQ(v, vector(25, 14, 36, 0));
+
+	v = vector_soa_length3(s1);
+	EXPECT_REALEQ(vector_x(v), REAL_C(5.0));
+	EXPECT_REALEQ(vector_z(v), REAL_C(6.0));
+
+	sr = vector_soa_cross3(s0, s1);
+	vector_soa_store(res, sr);
+	for (i = 0; i < 4; ++i) {
+		v = vector_cross3(vec[i], (i < 3) ? vec[i + 4] : vector_zero());
+		EXPECT_REALEQ(vector_x(res[i]), vector_x(v));
+		EXPECT_REALEQ(vector_y(res[i]), vector_y(v));
+		EXPECT_REALEQ(vector_z(res[i]), vector_z(v));
+		EXPECT_REALEQ(vector_w(res[i]), REAL_C(0.0));
+	}
+
+	sr = vector_soa_normalize3(vector_soa_splat(vector(0, 3, 4, 7)));
+	EXPECT_VECTORALMOSTEQ(sr.x, vector_zero());
+	EXPECT_VECTORALMOSTEQ(sr.y, vector_uniform(REAL_C(0.6)));
+	EXPECT_VECTORALMOSTEQ(sr.z, vector_uniform(REAL_C(0.8)));
+	EXPECT_VECTOREQ(sr.w, vector_uniform(7));
+
+	sr = vector_soa_muladd(s0, s1, s0);
+	EXPECT_VECTOREQ(sr.x, vector(4, 0, 27, 0));
+	EXPECT_VECTOREQ(sr.w, vector(4, -24, -72, 1));
+
+	sr = vector_soa_min(s0, s1);
+	EXPECT_VECTOREQ(sr.x, vector(1, -5, 2, 0));
+	sr = vector_soa_max(s0, s1);
+	EXPECT_VECTOREQ(sr.y, vector(2, 6, 4, 0));
+
+	sr = vector_soa_select(vector_less(vector_soa_dot3(s0, s1), vector_uniform(20)), s0, s1);
+	vector_soa_store(res, sr);
+	EXPECT_VECTOREQ(res[0], vec[0]);
+	EXPECT_VECTOREQ(res[1], vec[1]);
+	EXPECT_VECTOREQ(res[2], vec[6]);
+	EXPECT_VECTOREQ(res[3], vec[3]);
+
+	for (i = 0; i < 19; ++i)
+		big[i] = vector_add(vec[i % 7], vector_uniform((real)i));
+	vector_soa_load_array(soa, big, 19);
+	EXPECT_VECTOREQ(soa[2].y, vector(vector_y(big[8]), vector_y(big[9]), vector_y(big[10]), vector_y(big[11])));
+	EXPECT_VECTOREQ(soa[4].z, vector(vector_z(big[16]), vector_z(big[17]), vector_z(big[18]), 0));
+	vector_soa_store_array(bigres, soa, 19);
+	for (i = 0; i < 19; ++i)
+		EXPECT_VECTOREQ(bigres[i], big[i]);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, bounds) {
+	vector_config_t config;
+	aabb_t box[37];
+	aabb_soa_t box_soa[10];
+	vector_t sphere_aos[37];
+	vector_soa_t sphere_soa[10];
+	uint32_t mask[3];
+	uint32_t batch_mask[3];
+	float32_t vertex[37 * 8];
+	float32_t packed[37 * 3];
+	aabb_t bound;
+	matrix_t view;
+	int visible;
+	int i;
+
+	plane_t p = plane(vector(0, 1, 0, 0), vector(0, 2, 0, 1));
+	EXPECT_VECTOREQ(p, vector(0, 1, 0, -2));
+	EXPECT_VECTOREQ(plane_distance(p, vector(3, 5, 1, 0)), vector_uniform(3));
+	p = plane_from_points(vector(1, 0, 2, 1), vector(2, 0, 2, 1), vector(1, 1, 2, 1));
+	EXPECT_VECTORALMOSTEQ(p, vector(0, 0, 1, -2));
+	EXPECT_VECTORALMOSTEQ(plane_normalize(vector(0, 2, 0, 4)), vector(0, 1, 0, 2));
+
+	// Orthographic projection of x and y in [-1, 1] and z in [0, 10], viewed from x = 5
+	view = matrix_mul(matrix_translation(vector(-5, 0, 0, 0)), matrix_scaling(vector(1, 1, REAL_C(0.1), 1)));
+	const frustum_t frustum = frustum_from_matrix(view);
+	EXPECT_VECTORALMOSTEQ(frustum.plane[0], vector(1, 0, 0, -4));
+	EXPECT_VECTORALMOSTEQ(frustum.plane[1], vector(-1, 0, 0, 6));
+	EXPECT_VECTORALMOSTEQ(frustum.plane[3], vector(0, -1, 0, 1));
+	EXPECT_VECTORALMOSTEQ(frustum.plane[4], vector(0, 0, 1, 0));
+	EXPECT_VECTORALMOSTEQ(frustum.plane[5], vector(0, 0, -1, 10));
+
+	EXPECT_TRUE(frustum_test_point(&frustum, vector(5, 0, 5, 1)));
+	EXPECT_TRUE(frustum_test_point(&frustum, vector(6, 1, 9, 1)));
+	EXPECT_FALSE(frustum_test_point(&frustum, vector(7, 0, 5, 1)));
+	EXPECT_FALSE(frustum_test_point(&frustum, vector(5, 0, -1, 1)));
+	EXPECT_FALSE(frustum_test_point(&frustum, vector(5, 0, 11, 1)));
+
+	EXPECT_FALSE(frustum_test_sphere(&frustum, sphere(vector(7, 0, 5, 1), REAL_C(0.5))));
+	EXPECT_TRUE(frustum_test_sphere(&frustum, sphere(vector(7, 0, 5, 1), REAL_C(1.5))));
+	EXPECT_FALSE(frustum_test_sphere(&frustum, sphere(vector(5, -2, 5, 1), REAL_C(0.5))));
+
+	EXPECT_FALSE(frustum_test_aabb(&frustum, aabb(vector(REAL_C(6.5), 0, 0, 0), vector(8, 1, 1, 0))));
+	EXPECT_TRUE(frustum_test_aabb(&frustum, aabb(vector(REAL_C(5.5), 0, 0, 0), vector(8, 1, 1, 0))));
+	EXPECT_TRUE(frustum_test_aabb(&frustum, aabb(vector(-10, -10, -10, 0), vector(10, 10, 20, 0))));
+	EXPECT_FALSE(frustum_test_aabb(&frustum, aabb(vector(5, 0, 11, 0), vector(6, 1, 12, 0))));
+
+	const quaternion_t rotate_z = quaternion_scalar(0, 0, REAL_C(0.70710678), REAL_C(0.70710678));
+	const vector_t obb_center = vector(REAL_C(6.8), 0, 5, 1);
+	const vector_t long_x = vector(1, REAL_C(0.1), REAL_C(0.1), 0);
+	const vector_t long_y = vector(REAL_C(0.1), 1, REAL_C(0.1), 0);
+	EXPECT_TRUE(frustum_test_obb(&frustum, obb(obb_center, long_x, quaternion_identity())));
+	EXPECT_FALSE(frustum_test_obb(&frustum, obb(obb_center, long_x, rotate_z)));
+	EXPECT_TRUE(frustum_test_obb(&frustum, obb(obb_center, long_y, rotate_z)));
+
+	for (i = 0; i < 37; ++i) {
+		const vector_t center = vector(2 + REAL_C(0.137) * (real)i, REAL_C(0.6) * (real)(i % 5 - 2),
+		                               5 + REAL_C(2.1) * (real)(i % 7 - 3), 1);
+		const real extent = REAL_C(0.25) + REAL_C(0.1) * (real)(i % 3);
+		box[i] = aabb(vector_sub(center, vector_uniform(extent)), vector_add(center, vector_uniform(extent)));
+		sphere_aos[i] = sphere(center, extent);
+	}
+	aabb_soa_load_array(box_soa, box, 37);
+	EXPECT_VECTOREQ(box_soa[1].x[0], vector(vector_x(box[4].min), vector_x(box[5].min), vector_x(box[6].min),
+	                                        vector_x(box[7].min)));
+	EXPECT_VECTOREQ(box_soa[9].z[1], vector(vector_z(box[36].max), 0, 0, 0));
+	vector_soa_load_array(sphere_soa, sphere_aos, 37);
+
+	memset(mask, 0xFF, sizeof(mask));
+	frustum_cull_aabbs(mask, &frustum, box_soa, 37);
+	EXPECT_UINTEQ(mask[1] >> 5, 0);
+	EXPECT_UINTEQ(mask[2], 0xFFFFFFFF);
+	for (i = 0, visible = 0; i < 37; ++i) {
+		EXPECT_INTEQ((mask[i / 32] >> (i % 32)) & 1, frustum_test_aabb(&frustum, box[i]) ? 1 : 0);
+		visible += (int)((mask[i / 32] >> (i % 32)) & 1);
+	}
+	EXPECT_INTGT(visible, 0);
+	EXPECT_INTLT(visible, 37);
+
+	// Interleaved position, normal and uv in a 32 byte stride, and tightly packed positions
+	for (i = 0; i < 37; ++i) {
+		const vector_t center = aabb_center(box[i]);
+		for (int j = 0; j < 8; ++j)
+			vertex[i * 8 + j] = (j < 3) ? vector_component(center, j) : REAL_C(-1000.0);
+		for (int j = 0; j < 3; ++j)
+			packed[i * 3 + j] = vector_component(center, j);
+	}
+	for (int count = 1; count <= 37; count += 6) {
+		aabb_t expect = aabb(aabb_center(box[0]), aabb_center(box[0]));
+		for (i = 1; i < count; ++i) {
+			expect.min = vector_min(expect.min, aabb_center(box[i]));
+			expect.max = vector_max(expect.max, aabb_center(box[i]));
+		}
+		expect = aabb(transform_splice_w(expect.min, vector_zero()), transform_splice_w(expect.max, vector_zero()));
+		bound = aabb_from_points(vertex, sizeof(float32_t) * 8, (size_t)count);
+		EXPECT_VECTOREQ(bound.min, expect.min);
+		EXPECT_VECTOREQ(bound.max, expect.max);
+		bound = aabb_from_points(packed, sizeof(float32_t) * 3, (size_t)count);
+		EXPECT_VECTOREQ(bound.min, expect.min);
+		EXPECT_VECTOREQ(bound.max, expect.max);
+	}
+
+	const sphere_t bound_sphere = sphere_from_points(vertex, sizeof(float32_t) * 8, 37);
+	EXPECT_REALGE(vector_w(bound_sphere), REAL_C(6.29));
+	EXPECT_REALLE(vector_w(bound_sphere), vector_x(vector_length3(aabb_extent(bound))) * REAL_C(1.2));
+	for (i = 0; i < 37; ++i) {
+		const real dist = vector_x(vector_length3(vector_sub(aabb_center(box[i]), bound_sphere)));
+		EXPECT_REALLE(dist, vector_w(bound_sphere) * REAL_C(1.00001));
+	}
+	EXPECT_VECTOREQ(sphere_from_points(packed, sizeof(float32_t) * 3, 1),
+	                transform_splice_w(aabb_center(box[0]), vector_zero()));
+
+	memset(mask, 0xFF, sizeof(mask));
+	frustum_cull_spheres(mask, &frustum, sphere_soa, 37);
+	EXPECT_UINTEQ(mask[1] >> 5, 0);
+	EXPECT_UINTEQ(mask[2], 0xFFFFFFFF);
+	for (i = 0; i < 37; ++i)
+		EXPECT_INTEQ((mask[i / 32] >> (i % 32)) & 1, frustum_test_sphere(&frustum, sphere_aos[i]) ? 1 : 0);
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		// Odd and even block counts for the eight wide kernels
+		for (int count = 37; count >= 29; count -= 4) {
+			memset(mask, 0xFF, sizeof(mask));
+			memset(batch_mask, 0xFF, sizeof(batch_mask));
+			frustum_cull_aabbs(mask, &frustum, box_soa, (size_t)count);
+			frustum_batch_cull_aabbs(batch_mask, &frustum, box_soa, (size_t)count);
+			for (i = 0; i < 3; ++i)
+				EXPECT_UINTEQ(batch_mask[i], mask[i]);
+
+			memset(mask, 0xFF, sizeof(mask));
+			memset(batch_mask, 0xFF, sizeof(batch_mask));
+			frustum_cull_spheres(mask, &frustum, sphere_soa, (size_t)count);
+			frustum_batch_cull_spheres(batch_mask, &frustum, sphere_soa, (size_t)count);
+			for (i = 0; i < 3; ++i)
+				EXPECT_UINTEQ(batch_mask[i], mask[i]);
+		}
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, ray) {
+	vector_config_t config;
+	vector_t origin[12];
+	vector_t direction[12];
+	ray_soa_t ray[3];
+	real distance[12];
+	real batch_distance[12];
+	uint32_t mask;
+	uint32_t batch_mask;
+	vector_t dist;
+	unsigned int hit;
+	int i;
+
+	const vector_t v0 = vector(0, 0, 5, 1);
+	const vector_t v1 = vector(2, 0, 5, 1);
+	const vector_t v2 = vector(0, 2, 5, 1);
+	origin[0] = vector(REAL_C(0.5), REAL_C(0.5), 0, 1);
+	origin[1] = vector(REAL_C(1.5), REAL_C(1.5), 0, 1);
+	origin[2] = vector(REAL_C(-0.1), REAL_C(0.5), 0, 1);
+	origin[3] = vector(REAL_C(0.5), REAL_C(0.5), 0, 1);
+	direction[0] = vector(0, 0, 1, 0);
+	direction[1] = vector(0, 0, 1, 0);
+	direction[2] = vector(0, 0, 1, 0);
+	direction[3] = vector(0, 0, -1, 0);
+	ray[0] = ray_soa_load(origin, direction);
+	hit = vector_bounds_mask(ray_soa_intersect_triangle(ray, v0, v1, v2, vector_uniform(100), &dist));
+	EXPECT_UINTEQ(hit, 1);
+	EXPECT_REALEQ(vector_x(dist), 5);
+	hit = vector_bounds_mask(ray_soa_intersect_triangle(ray, v0, v1, v2, vector_uniform(4), &dist));
+	EXPECT_UINTEQ(hit, 0);
+	// Two sided, flipped winding
+	hit = vector_bounds_mask(ray_soa_intersect_triangle(ray, v0, v2, v1, vector_uniform(100), &dist));
+	EXPECT_UINTEQ(hit, 1);
+	EXPECT_REALEQ(vector_x(dist), 5);
+	// Parallel to the triangle plane
+	ray[0] = ray_soa(vector_soa_splat(vector(0, REAL_C(0.5), 5, 1)), vector_soa_splat(vector(1, 0, 0, 0)));
+	hit = vector_bounds_mask(ray_soa_intersect_triangle(ray, v0, v1, v2, vector_uniform(100), &dist));
+	EXPECT_UINTEQ(hit, 0);
+
+	const aabb_t box = aabb(vector(1, 1, 1, 0), vector(3, 3, 3, 0));
+	origin[0] = vector(0, 2, 2, 1);
+	origin[1] = vector(2, 2, 2, 1);
+	origin[2] = vector(0, 0, 0, 1);
+	origin[3] = vector(0, 5, 2, 1);
+	direction[0] = vector(1, 0, 0, 0);
+	direction[1] = vector(0, 1, 0, 0);
+	direction[2] = vector_normalize3(vector(1, 1, 1, 0));
+	direction[3] = vector(1, 0, 0, 0);
+	ray[0] = ray_soa_load(origin, direction);
+	hit = vector_bounds_mask(ray_soa_intersect_aabb(ray, box, vector_uniform(100), &dist));
+	EXPECT_UINTEQ(hit, 7);
+	EXPECT_REALEQ(vector_x(dist), 1);
+	EXPECT_REALEQ(vector_y(dist), 0);
+	EXPECT_REALEQ(vector_z(dist), REAL_SQRT3);
+	hit = vector_bounds_mask(ray_soa_intersect_aabb(ray, box, vector(REAL_C(0.5), REAL_C(0.5), 2, 100), &dist));
+	EXPECT_UINTEQ(hit, 6);
+
+	for (i = 0; i < 12; ++i) {
+		origin[i] = vector(REAL_C(0.23) * (real)i - REAL_C(0.4), REAL_C(0.7) - REAL_C(0.11) * (real)i, 0, 1);
+		direction[i] = vector_normalize3(vector(REAL_C(0.05) * (real)(i % 3), REAL_C(0.02) * (real)i, 1, 0));
+		distance[i] = (i == 4) ? REAL_C(1.0) : REAL_C(100.0);
+	}
+	for (i = 0; i < 3; ++i)
+		ray[i] = ray_soa_load(origin + i * 4, direction + i * 4);
+
+	ray_intersect_triangle_array(&mask, distance, ray, 11, v0, v1, v2);
+	for (i = 0; i < 11; ++i) {
+		ray_soa_t single = ray_soa(vector_soa_splat(origin[i]), vector_soa_splat(direction[i]));
+		hit = vector_bounds_mask(
+		    ray_soa_intersect_triangle(&single, v0, v1, v2, vector_uniform((i == 4) ? 1 : 100), &dist));
+		EXPECT_UINTEQ((mask >> i) & 1, hit & 1);
+		EXPECT_REALEQ(distance[i], (hit & 1) ? vector_x(dist) : ((i == 4) ? 1 : 100));
+	}
+	EXPECT_UINTEQ(mask >> 11, 0);
+	EXPECT_NE(mask, 0);
+	EXPECT_NE(mask, 0x7FF);
+	EXPECT_REALEQ(distance[11], 100);
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		// Partial packet, odd and even packet counts for the eight wide kernels
+		for (int count = 11; count >= 7; count -= 4) {
+			for (i = 0; i < 12; ++i)
+				distance[i] = batch_distance[i] = (i == 4) ? REAL_C(1.0) : REAL_C(100.0);
+			ray_intersect_triangle_array(&mask, distance, ray, (size_t)count, v0, v1, v2);
+			ray_batch_intersect_triangle(&batch_mask, batch_distance, ray, (size_t)count, v0, v1, v2);
+			EXPECT_UINTEQ(batch_mask, mask);
+			for (i = 0; i < 12; ++i)
+				EXPECT_REALEQ(batch_distance[i], distance[i]);
+		}
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, spline) {
+	vector_config_t config;
+	const real time[5] = {0, 1, 2, 4, 5};
+	const real qtime[5] = {0, 1, 2, 3, 4};
+	vector_t value[5];
+	vector_t tangent[5];
+	vector_t handle[10];
+	quaternion_t key[5];
+	quaternion_t inner[5];
+	spline_t spline[9];
+	real eval_time[9];
+	uint32_t cursor[9];
+	uint32_t batch_cursor[9];
+	vector_t out[9];
+	vector_t batch[9];
+	uint32_t segment;
+	int i;
+
+	// Segments interpolate the end points, points on a line at even spacing give the line
+	const vector_t p0 = vector(1, 2, 3, 1);
+	const vector_t p1 = vector(5, -2, 0, 1);
+	const vector_t d = vector_sub(p1, p0);
+	const vector_t c0 = vector_add(p0, vector_scale(d, REAL_C(1.0) / 3));
+	const vector_t c1 = vector_add(p0, vector_scale(d, REAL_C(2.0) / 3));
+	EXPECT_VECTOREQ(vector_hermite(p0, d, p1, d, 0), p0);
+	EXPECT_VECTOREQ(vector_hermite(p0, d, p1, d, 1), p1);
+	EXPECT_VECTOREQ(vector_bezier(p0, c0, c1, p1, 0), p0);
+	EXPECT_VECTOREQ(vector_bezier(p0, c0, c1, p1, 1), p1);
+	EXPECT_VECTOREQ(vector_catmull_rom(vector_sub(p0, d), p0, p1, vector_add(p1, d), 0), p0);
+	EXPECT_VECTOREQ(vector_catmull_rom(vector_sub(p0, d), p0, p1, vector_add(p1, d), 1), p1);
+	for (i = 1; i < 8; ++i) {
+		const real t = (real)i / 8;
+		const vector_t line = vector_lerp(p0, p1, t);
+		EXPECT_REALLT(vector_test_difference(vector_hermite(p0, d, p1, d, t), line), REAL_C(1e-5));
+		EXPECT_REALLT(vector_test_difference(vector_bezier(p0, c0, c1, p1, t), line), REAL_C(1e-5));
+		EXPECT_REALLT(
+		    vector_test_difference(vector_catmull_rom(vector_sub(p0, d), p0, p1, vector_add(p1, d), t), line),
+		    REAL_C(1e-5));
+	}
+
+	// Segment search with cached cursor, clamped at both ends
+	EXPECT_UINTEQ(spline_find_segment(time, 5, -1, 0), 0);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, REAL_C(0.5), 0), 0);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, 1, 0), 1);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, 3, 0), 2);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, 3, 3), 2);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, 3, 100), 2);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, REAL_C(4.5), 2), 3);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, 6, 1), 3);
+	EXPECT_UINTEQ(spline_find_segment(time, 5, 6, 3), 3);
+	EXPECT_UINTEQ(spline_find_segment(time, 2, 6, 0), 0);
+	EXPECT_UINTEQ(spline_find_segment(time, 1, 6, 0), 0);
+
+	// Keys on a line over time with tangents and handles matching the line
+	const vector_t velocity = vector(1, -2, REAL_C(0.5), 0);
+	for (i = 0; i < 5; ++i) {
+		value[i] = vector_add(p0, vector_scale(velocity, time[i]));
+		tangent[i] = velocity;
+		const real before = i ? time[i] - time[i - 1] : 0;
+		const real after = (i < 4) ? time[i + 1] - time[i] : 0;
+		handle[i * 2] = vector_sub(value[i], vector_scale(velocity, before / 3));
+		handle[(i * 2) + 1] = vector_add(value[i], vector_scale(velocity, after / 3));
+	}
+	spline[0].time = time;
+	spline[0].value = value;
+	spline[0].control = tangent;
+	spline[0].count = 5;
+	spline[0].type = SPLINE_HERMITE;
+	spline[1] = spline[0];
+	spline[1].control = handle;
+	spline[1].type = SPLINE_BEZIER;
+	segment = 0;
+	for (i = 0; i < 12; ++i) {
+		const real t = REAL_C(0.5) * (real)i;
+		const vector_t line = vector_add(p0, vector_scale(velocity, (t < 5) ? t : 5));
+		EXPECT_REALLT(vector_test_difference(spline_evaluate(spline, t, &segment), line), REAL_C(1e-5));
+		EXPECT_UINTEQ(segment, spline_find_segment(time, 5, t, 0));
+		EXPECT_REALLT(vector_test_difference(spline_evaluate(spline + 1, t, 0), line), REAL_C(1e-5));
+	}
+	EXPECT_VECTOREQ(spline_evaluate(spline, -1, 0), value[0]);
+
+	// Squad through rotations around one axis at even spacing follows the slerp
+	for (i = 0; i < 5; ++i) {
+		const real angle = REAL_C(0.2) * (real)i;
+		key[i] = vector(0, 0, math_sin(angle), math_cos(angle));
+	}
+	EXPECT_REALLT(vector_test_difference(quaternion_exp(quaternion_log(key[3])), key[3]), REAL_C(1e-5));
+	EXPECT_REALLT(vector_test_difference(quaternion_log(key[3]), vector(0, 0, REAL_C(0.6), 0)), REAL_C(1e-5));
+	EXPECT_VECTOREQ(quaternion_log(quaternion_identity()), vector_zero());
+	EXPECT_VECTOREQ(quaternion_exp(vector_zero()), quaternion_identity());
+	spline_squad_controls(inner, key, 5);
+	for (i = 1; i < 4; ++i)
+		EXPECT_REALLT(vector_test_difference(inner[i], key[i]), REAL_C(1e-5));
+	spline[2].time = qtime;
+	spline[2].value = key;
+	spline[2].control = inner;
+	spline[2].count = 5;
+	spline[2].type = SPLINE_SQUAD;
+	EXPECT_REALLT(vector_test_difference(spline_evaluate(spline + 2, REAL_C(2.25), 0),
+	                                     vector(0, 0, math_sin(REAL_C(0.45)), math_cos(REAL_C(0.45)))),
+	              REAL_C(1e-5));
+	EXPECT_REALLT(vector_test_difference(quaternion_squad(key[1], inner[1], inner[2], key[2], REAL_C(0.5)),
+	                                     quaternion_slerp(key[1], key[2], REAL_C(0.5))),
+	              REAL_C(1e-5));
+
+	// Keys around different axes do not commute, the rotation just before and just after each
+	// inner key must be mirrored (continuous angular velocity)
+	{
+		quaternion_t axiskey[5];
+		quaternion_t axisinner[5];
+		const real h = REAL_C(0.01);
+		axiskey[0] = quaternion_normalize(vector(REAL_C(0.1), REAL_C(0.2), 0, 1));
+		axiskey[1] = quaternion_normalize(vector(REAL_C(0.5), REAL_C(-0.1), REAL_C(0.2), REAL_C(0.8)));
+		axiskey[2] = quaternion_normalize(vector(REAL_C(-0.2), REAL_C(0.6), REAL_C(0.1), REAL_C(0.7)));
+		axiskey[3] = quaternion_normalize(vector(REAL_C(0.1), REAL_C(0.3), REAL_C(-0.6), REAL_C(0.7)));
+		axiskey[4] = quaternion_normalize(vector(REAL_C(0.4), REAL_C(-0.2), REAL_C(0.5), REAL_C(0.6)));
+		spline_squad_controls(axisinner, axiskey, 5);
+		for (i = 1; i < 4; ++i) {
+			const quaternion_t qinv = quaternion_conjugate(axiskey[i]);
+			const quaternion_t before =
+			    quaternion_squad(axiskey[i - 1], axisinner[i - 1], axisinner[i], axiskey[i], REAL_C(1.0) - h);
+			const quaternion_t after = quaternion_squad(axiskey[i], axisinner[i], axisinner[i + 1], axiskey[i + 1], h);
+			EXPECT_REALLT(vector_test_difference(vector_add(quaternion_log(quaternion_mul(before, qinv)),
+			                                                quaternion_log(quaternion_mul(after, qinv))),
+			                                     vector_zero()),
+			              REAL_C(2e-3));
+		}
+	}
+
+	// Uniform, mixed and single lane blocks, the catmull-rom and squad tracks reuse the keys
+	spline[3] = spline[0];
+	spline[4] = spline[0];
+	spline[5] = spline[1];
+	spline[6] = spline[0];
+	spline[6].control = 0;
+	spline[6].type = SPLINE_CATMULL_ROM;
+	spline[7] = spline[2];
+	spline[8] = spline[2];
+
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= VECTOR_ISA_AVX512; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		EXPECT_INTEQ(vector_module_initialize(config), 0);
+		if (vector_module_isa() != (vector_isa_t)isa)
+			break;
+
+		for (int count = 9; count > 0; count -= 4) {
+			memset(cursor, 0, sizeof(cursor));
+			memset(batch_cursor, 0, sizeof(batch_cursor));
+			// Times moving forward over the keys and past both ends, with cursors from the previous step
+			for (int step = 0; step < 8; ++step) {
+				for (i = 0; i < 9; ++i) {
+					eval_time[i] = REAL_C(-0.5) + REAL_C(0.8) * (real)step + REAL_C(0.1) * (real)i;
+					out[i] = spline_evaluate(spline + i, eval_time[i], cursor + i);
+				}
+				spline_batch_evaluate(batch, spline, eval_time, batch_cursor, (size_t)count);
+				for (i = 0; i < count; ++i) {
+					EXPECT_REALLT(vector_test_difference(batch[i], out[i]), REAL_C(1e-5));
+					EXPECT_UINTEQ(batch_cursor[i], cursor[i]);
+				}
+			}
+			spline_evaluate_array(batch, spline, eval_time, 0, (size_t)count);
+			for (i = 0; i < count; ++i)
+				EXPECT_REALLT(vector_test_difference(batch[i], out[i]), REAL_C(1e-5));
+		}
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	EXPECT_INTEQ(vector_module_initialize(config), 0);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, view) {
+	float32_t vertex[13][8];
+	uint16_t half[13][4];
+	int16_t normal[13][3];
+	int16_t expect_normal[4];
+	vector_t expect[13];
+	aabb_t expect_box;
+	aabb_t box;
+	int i, j;
+
+	for (i = 0; i < 13; ++i) {
+		const vector_t n = vector_normalize3(vector(REAL_C(0.3) * (real)i - 2, 1, REAL_C(0.1) * (real)i, 0));
+		vertex[i][0] = REAL_C(0.25) * (real)i - REAL_C(1.5);
+		vertex[i][1] = 2 - REAL_C(0.5) * (real)i;
+		vertex[i][2] = REAL_C(0.125) * (real)i;
+		vertex[i][3] = vector_x(n);
+		vertex[i][4] = vector_y(n);
+		vertex[i][5] = vector_z(n);
+		vertex[i][6] = REAL_C(0.0625) * (real)i;
+		vertex[i][7] = 1 - REAL_C(0.0625) * (real)i;
+	}
+	const vector_view_t position = vector_view(vertex[0], sizeof(vertex[0]), 3, VECTOR_VIEW_FLOAT32);
+	const vector_view_t normals = vector_view(vertex[0] + 3, sizeof(vertex[0]), 3, VECTOR_VIEW_FLOAT32);
+	const vector_view_t uv = vector_view(vertex[0] + 6, sizeof(vertex[0]), 2, VECTOR_VIEW_FLOAT32);
+	const vector_view_t half_position = vector_view(half[0], sizeof(half[0]), 4, VECTOR_VIEW_HALF);
+	const vector_view_t packed_normal = vector_view(normal[0], sizeof(normal[0]), 3, VECTOR_VIEW_SNORM16);
+
+	EXPECT_VECTOREQ(vector_view_load(&position, 2), vector(-1, 1, REAL_C(0.25), 1));
+	EXPECT_VECTOREQ(vector_view_load(&uv, 12), vector(REAL_C(0.75), REAL_C(0.25), 0, 1));
+	vector_view_store(&uv, 12, vector(3, 4, 5, 6));
+	EXPECT_REALEQ(vertex[12][6], 3);
+	EXPECT_REALEQ(vertex[12][7], 4);
+	EXPECT_REALEQ(vertex[12][5], vector_z(vector_view_load(&normals, 12)));
+
+	// Transform positions in place, other attributes are untouched
+	const matrix_t m = matrix_mul(matrix_from_quaternion(quaternion_rotating_vector(vector_xaxis(), vector_yaxis())),
+	                              matrix_translation(vector(1, 2, 3, 1)));
+	for (i = 0; i < 13; ++i)
+		expect[i] = transform_splice_w(vector_transform(vector_view_load(&position, i), m), vector_one());
+	vector_transform_view(&position, &position, 13, m);
+	for (i = 0; i < 13; ++i) {
+		EXPECT_VECTORALMOSTEQ(vector_view_load(&position, i), expect[i]);
+		EXPECT_REALEQ(vertex[i][7], (i < 12) ? 1 - REAL_C(0.0625) * (real)i : REAL_C(4.0));
+	}
+
+	for (i = 0; i < 13; ++i)
+		expect[i] = transform_splice_w(vector_rotate(vector_view_load(&normals, i), m), vector_one());
+	vector_rotate_view(&normals, &normals, 13, m);
+	for (i = 0; i < 13; ++i)
+		EXPECT_VECTORALMOSTEQ(vector_view_load(&normals, i), expect[i]);
+
+	// Pack to half precision with w set to one, and snorm16 with three components
+	vector_convert_view(&half_position, &position, 13);
+	vector_convert_view(&packed_normal, &normals, 13);
+	expect_box = aabb(vector_load_half(half[0]), vector_load_half(half[0]));
+	for (i = 0; i < 13; ++i) {
+		EXPECT_UINTEQ(half[i][3], 0x3C00);
+		EXPECT_VECTOREQ(vector_view_load(&half_position, i), vector_load_half(half[i]));
+		expect_box.min = vector_min(expect_box.min, vector_load_half(half[i]));
+		expect_box.max = vector_max(expect_box.max, vector_load_half(half[i]));
+		vector_store_snorm16(expect_normal, vector_view_load(&normals, i));
+		for (j = 0; j < 3; ++j)
+			EXPECT_INTEQ(normal[i][j], expect_normal[j]);
+	}
+
+	box = aabb_from_view(&half_position, 13);
+	EXPECT_VECTOREQ(box.min, transform_splice_w(expect_box.min, vector_zero()));
+	EXPECT_VECTOREQ(box.max, transform_splice_w(expect_box.max, vector_zero()));
+	box = aabb_from_view(&position, 13);
+	expect_box = aabb_from_points(vertex[0], sizeof(vertex[0]), 13);
+	EXPECT_VECTOREQ(box.min, expect_box.min);
+	EXPECT_VECTOREQ(box.max, expect_box.max);
+	box = aabb_from_view(&packed_normal, 2);
+	expect_box.min = vector_min(vector_view_load(&packed_normal, 0), vector_view_load(&packed_normal, 1));
+	EXPECT_VECTOREQ(box.min, transform_splice_w(expect_box.min, vector_zero()));
+
+	// Zero stride broadcasts one element without reading past it
+	float32_t point[3] = {1, 2, 3};
+	const vector_view_t broadcast = vector_view(point, 0, 3, VECTOR_VIEW_FLOAT32);
+	vector_convert_view(&half_position, &broadcast, 13);
+	for (i = 0; i < 13; ++i)
+		EXPECT_VECTOREQ(vector_view_load(&half_position, i), vector(1, 2, 3, 1));
+	box = aabb_from_view(&broadcast, 13);
+	EXPECT_VECTOREQ(box.min, vector(1, 2, 3, 0));
+	EXPECT_VECTOREQ(box.max, vector(1, 2, 3, 0));
+
+	return 0;
+}
+
+DECLARE_TEST(vector, statistics) {
+	vector_statistics_t statistics;
+	vector_t in[16];
+	vector_t out[16];
+	matrix_t m0[4];
+	matrix_t m1[4];
+	matrix_t mout[4];
+	int i;
+
+	for (i = 0; i < 16; ++i)
+		in[i] = vector((real)i, (real)-i, 1, 1);
+	for (i = 0; i < 4; ++i) {
+		m0[i] = matrix_identity();
+		m1[i] = matrix_scaling(vector_uniform((real)(i + 1)));
+	}
+
+	vector_module_statistics_reset();
+	vector_batch_rotate(out, in, 16, matrix_identity());
+	vector_batch_rotate(out, in, 7, matrix_identity());
+	matrix_batch_mul(mout, m0, m1, 4);
+	vector_module_statistics(&statistics);
+
+#if VECTOR_ENABLE_PROFILING
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_VECTOR_BATCH_ROTATE].calls, 2);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_VECTOR_BATCH_ROTATE].elements, 23);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_MATRIX_BATCH_MUL].calls, 1);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_MATRIX_BATCH_MUL].elements, 4);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM].calls, 0);
+	EXPECT_TRUE(statistics.threads >= 1);
+
+	vector_module_statistics_reset();
+	vector_module_statistics(&statistics);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_VECTOR_BATCH_ROTATE].calls, 0);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_VECTOR_BATCH_ROTATE].elements, 0);
+	EXPECT_UINTEQ(statistics.counter[VECTOR_PROFILE_VECTOR_BATCH_ROTATE].ticks, 0);
+#else
+	for (i = 0; i < VECTOR_PROFILE_COUNT; ++i) {
+		EXPECT_UINTEQ(statistics.counter[i].calls, 0);
+		EXPECT_UINTEQ(statistics.counter[i].elements, 0);
+	}
+#endif
+
+	EXPECT_TRUE(string_equal(STRING_ARGS(vector_profile_name(VECTOR_PROFILE_VECTOR_BATCH_ROTATE)),
+	                         STRING_CONST("vector_batch_rotate")));
+	EXPECT_TRUE(string_equal(STRING_ARGS(vector_profile_name(VECTOR_PROFILE_RAY_BATCH_INTERSECT_TRIANGLE)),
+	                         STRING_CONST("ray_batch_intersect_triangle")));
+	EXPECT_TRUE(string_equal(STRING_ARGS(vector_profile_name(VECTOR_PROFILE_VECTOR_TRANSFORM_VIEW)),
+	                         STRING_CONST("vector_transform_view")));
+	EXPECT_UINTEQ(vector_profile_name(VECTOR_PROFILE_COUNT).length, 0);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, arena) {
+	vector_arena_t arena;
+	int i;
+
+	EXPECT_INTEQ(vector_arena_initialize(&arena, 1000), 0);
+	EXPECT_UINTEQ(arena.capacity, 1024);
+
+	// Blocks are aligned and padded to cache lines
+	vector_t* vec = vector_arena_allocate_vectors(&arena, 3);
+	matrix_t* mat = vector_arena_allocate_matrices(&arena, 2);
+	vector_soa_t* soa = vector_arena_allocate_soa(&arena, 5);
+	void* block = vector_arena_allocate(&arena, 1);
+	EXPECT_UINTEQ((uintptr_t)vec % VECTOR_ARENA_ALIGNMENT, 0);
+	EXPECT_UINTEQ((uintptr_t)mat % VECTOR_ARENA_ALIGNMENT, 0);
+	EXPECT_UINTEQ((uintptr_t)soa % VECTOR_ARENA_ALIGNMENT, 0);
+	EXPECT_UINTEQ((uintptr_t)((char*)mat - (char*)vec), 64);
+	EXPECT_UINTEQ((uintptr_t)((char*)soa - (char*)mat), 128);
+	EXPECT_UINTEQ((uintptr_t)((char*)block - (char*)soa), 128);
+	EXPECT_UINTEQ(arena.used, 384);
+
+	for (i = 0; i < 3; ++i)
+		vec[i] = vector((real)i, 1, 2, 1);
+	vector_transform_array(vec, vec, 3, matrix_translation(vector(1, 2, 3, 1)));
+	EXPECT_VECTOREQ(vec[2], vector(3, 3, 5, 1));
+
+	// Reset is a rewind as long as the buffer is not exhausted
+	vector_arena_reset(&arena);
+	EXPECT_UINTEQ(arena.used, 0);
+	EXPECT_UINTEQ(arena.peak, 384);
+	EXPECT_TRUE(vector_arena_allocate_vectors(&arena, 3) == vec);
+
+	// Exhausting the buffer falls back to the memory system, and the next reset grows the buffer
+	transform_t* tf = vector_arena_allocate_transforms(&arena, 20);
+	transform_t* tf_more = vector_arena_allocate_transforms(&arena, 20);
+	EXPECT_UINTEQ((uintptr_t)tf_more % VECTOR_ARENA_ALIGNMENT, 0);
+	EXPECT_TRUE(arena.overflow != 0);
+	EXPECT_UINTEQ(arena.used, 64 + 640);
+	for (i = 0; i < 20; ++i) {
+		tf[i] = transform_identity();
+		tf_more[i] = transform_identity();
+	}
+	vector_arena_reset(&arena);
+	EXPECT_TRUE(arena.overflow == 0);
+	EXPECT_UINTEQ(arena.peak, 64 + 640 * 2);
+	EXPECT_UINTEQ(arena.capacity, arena.peak);
+	vector_arena_allocate_vectors(&arena, 3);
+	vector_arena_allocate_transforms(&arena, 20);
+	vector_arena_allocate_transforms(&arena, 20);
+	EXPECT_TRUE(arena.overflow == 0);
+	vector_arena_finalize(&arena);
+
+	vector_arena_t* frame = vector_frame_arena();
+	EXPECT_INTGE(frame->capacity, 64);
+	vec = vector_arena_allocate_vectors(frame, 16);
+	EXPECT_UINTEQ((uintptr_t)vec % VECTOR_ARENA_ALIGNMENT, 0);
+	vector_arena_reset(frame);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, blob) {
+	vector_t points[3] = {vector(1, 2, 3, 1), vector(-4, 5, -6, 1), vector(7, -8, 9, 1)};
+	matrix_t bones[2] = {matrix_identity(), matrix_scaling(vector(2, 3, 4, 1))};
+	uint16_t keys[5 * 3];
+	for (unsigned int ikey = 0; ikey < 5; ++ikey)
+		quaternion_store_smallest3(keys + (ikey * 3), quaternion_normalize(vector(1, (real)ikey, 2, 3)));
+	const vector_blob_source_t source[] = {{1, VECTOR_BLOB_VECTOR, points, 3},
+	                                       {2, VECTOR_BLOB_MATRIX, bones, 2},
+	                                       {3, VECTOR_BLOB_SMALLEST3, keys, 5},
+	                                       {4, VECTOR_BLOB_FLOAT32, 0, 0}};
+
+	// Header and directory in three cache lines, then each array padded to whole cache lines
+	const size_t size = vector_blob_write(0, 0, source, 4);
+	EXPECT_UINTEQ(size, 192 + 64 + 128 + 64);
+	vector_blob_source_t invalid = {5, VECTOR_BLOB_TYPE_COUNT, points, 1};
+	EXPECT_UINTEQ(vector_blob_write(0, 0, &invalid, 1), 0);
+
+	char* buffer = memory_allocate(HASH_TEST, size + VECTOR_BLOB_ALIGNMENT, VECTOR_BLOB_ALIGNMENT, MEMORY_PERSISTENT);
+	memset(buffer, 0xAB, size);
+	EXPECT_UINTEQ(vector_blob_write(buffer, size - 1, source, 4), size);
+	EXPECT_UINTEQ((unsigned char)buffer[0], 0xAB);
+	EXPECT_UINTEQ(vector_blob_write(buffer, size, source, 4), size);
+
+	vector_blob_t blob;
+	EXPECT_INTEQ(vector_blob_open(&blob, buffer, size), 0);
+	EXPECT_UINTEQ(blob.array_count, 4);
+	EXPECT_UINTEQ(blob.header->version, VECTOR_BLOB_VERSION);
+
+	size_t count = 0;
+	const vector_t* stored_points = vector_blob_vectors(&blob, 1, &count);
+	EXPECT_UINTEQ(count, 3);
+	EXPECT_UINTEQ((uintptr_t)stored_points % VECTOR_BLOB_ALIGNMENT, 0);
+	const matrix_t* stored_bones = vector_blob_matrices(&blob, 2, &count);
+	EXPECT_UINTEQ(count, 2);
+	EXPECT_UINTEQ((uintptr_t)stored_bones % VECTOR_BLOB_ALIGNMENT, 0);
+
+	// Arrays are used in place by the batch functions
+	vector_t transformed[3];
+	vector_batch_transform(transformed, stored_points, 3, stored_bones[1]);
+	EXPECT_VECTOREQ(transformed[0], vector(2, 6, 12, 1));
+	EXPECT_VECTOREQ(transformed[2], vector(14, -24, 36, 1));
+
+	const uint16_t* stored_keys = vector_blob_array(&blob, 3, VECTOR_BLOB_SMALLEST3, &count);
+	EXPECT_UINTEQ(count, 5);
+	EXPECT_TRUE(memcmp(stored_keys, keys, sizeof(keys)) == 0);
+	EXPECT_TRUE(vector_blob_array(&blob, 4, VECTOR_BLOB_FLOAT32, &count) != 0);
+	EXPECT_UINTEQ(count, 0);
+	EXPECT_TRUE(vector_blob_array(&blob, 3, VECTOR_BLOB_HALF, &count) == 0);
+	EXPECT_TRUE(vector_blob_vectors(&blob, 2, 0) == 0);
+
+	// Truncated, misaligned, corrupt and foreign byte order buffers are rejected
+	EXPECT_INTLT(vector_blob_open(&blob, buffer, size - 1), 0);
+	EXPECT_TRUE(blob.array_count == 0);
+	memmove(buffer + 16, buffer, size);
+	EXPECT_INTLT(vector_blob_open(&blob, buffer + 16, size), 0);
+	memmove(buffer, buffer + 16, size);
+	vector_blob_array_t* array = (vector_blob_array_t*)(buffer + sizeof(vector_blob_header_t));
+	array[1].count = 4;
+	EXPECT_INTLT(vector_blob_open(&blob, buffer, size), 0);
+	array[1].count = 2;
+	array[0].offset = 192 + 16;
+	EXPECT_INTLT(vector_blob_open(&blob, buffer, size), 0);
+	array[0].offset = 128;
+	EXPECT_INTLT(vector_blob_open(&blob, buffer, size), 0);
+	array[0].offset = 192;
+	vector_blob_header_t* header = (vector_blob_header_t*)buffer;
+	header->array_count = 0x10000000;
+	EXPECT_INTLT(vector_blob_open(&blob, buffer, size), 0);
+	header->array_count = 4;
+	header->byte_order = 0x04030201;
+	EXPECT_INTLT(vector_blob_open(&blob, buffer, size), 0);
+	header->byte_order = VECTOR_BLOB_BYTE_ORDER;
+	EXPECT_INTEQ(vector_blob_open(&blob, buffer, size), 0);
+
+	memory_deallocate(buffer);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, string) {
+	char buffer[1024];
+	char expected[1024];
+	string_t str;
+
+	// Same output as printf for rounding ties, sign of zero, large and non-finite values
+	const float32_t special[] = {0.0f,        -0.0f,       1.0f,         -1.5f,      0.0000005f, 0.0000015f,
+	                             -0.0000004f, 0.1234565f,  123456.789f,  8388607.5f, 3.0e12f,    -9.9e17f,
+	                             3.4e38f,     1.0e-30f,    999999.9999f, 0.9999995f, REAL_MAX,   -REAL_MAX,
+	                             REAL_MIN,    1.0f / 3.0f, 16777216.0f,  1234.0f,    -4.9e-7f,   2.0f / 3.0f};
+	uint32_t seed = 1;
+	for (unsigned int iter = 0; iter < 4096; ++iter) {
+		float32_t value[4];
+		for (unsigned int icomp = 0; icomp < 4; ++icomp) {
+			seed = seed * 1664525U + 1013904223U;
+			const unsigned int index = (iter * 4 + icomp);
+			if (index < sizeof(special) / sizeof(special[0])) {
+				value[icomp] = special[index];
+			} else {
+				// Random bit patterns with exponents up to 2^63
+				uint32_t bits = seed & 0xDFFFFFFFU;
+				memcpy(value + icomp, &bits, sizeof(bits));
+			}
+		}
+		const vector_t v = vector_unaligned(value);
+		str = string_from_vector(buffer, sizeof(buffer), v);
+		string_t ref = string_format(expected, sizeof(expected), STRING_CONST("(%.6f, %.6f, %.6f, %.6f)"),
+		                             (double)value[0], (double)value[1], (double)value[2], (double)value[3]);
+		EXPECT_STRINGEQ(str, ref);
+
+		// Parsed back as the six decimal value rounded once to float
+		const vector_t parsed = vector_from_string(STRING_ARGS(str));
+		for (unsigned int icomp = 0; icomp < 4; ++icomp) {
+			if (fabs((double)value[icomp]) < 1e12)
+				value[icomp] = (float32_t)(nearbyint((double)value[icomp] * 1000000.0) / 1000000.0);
+		}
+		EXPECT_VECTOREQ(parsed, vector_unaligned(value));
+	}
+
+	const uint32_t infinity_bits = 0x7F800000;
+	float32_t infinity;
+	memcpy(&infinity, &infinity_bits, sizeof(infinity));
+	str = string_from_vector(buffer, sizeof(buffer), vector(infinity, -infinity, 1, 2));
+	string_t ref = string_format(expected, sizeof(expected), STRING_CONST("(%.6f, %.6f, %.6f, %.6f)"),
+	                             (double)infinity, (double)-infinity, 1.0, 2.0);
+	EXPECT_STRINGEQ(str, ref);
+
+	str = string_from_vector(buffer, 8, vector(1, 2, 3, 4));
+	EXPECT_CONSTSTRINGEQ(string_to_const(str), string_const(STRING_CONST("(1.0000")));
+	str = string_from_vector(buffer, 1, vector(1, 2, 3, 4));
+	EXPECT_UINTEQ(str.length, 0);
+
+	// Arrays, one vector per line and only complete vectors
+	const vector_t points[3] = {vector(1, 2, 3, 4), vector(-0.5f, 0.25f, 0, 1), vector(10, 20, 30, 40)};
+	str = string_from_vector_array(buffer, sizeof(buffer), points, 3);
+	EXPECT_CONSTSTRINGEQ(string_to_const(str),
+	                     string_const(STRING_CONST("(1.000000, 2.000000, 3.000000, 4.000000)\n"
+	                                               "(-0.500000, 0.250000, 0.000000, 1.000000)\n"
+	                                               "(10.000000, 20.000000, 30.000000, 40.000000)")));
+	str = string_from_vector_array(buffer, 83, points, 3);
+	EXPECT_CONSTSTRINGEQ(string_to_const(str),
+	                     string_const(STRING_CONST("(1.000000, 2.000000, 3.000000, 4.000000)\n"
+	                                               "(-0.500000, 0.250000, 0.000000, 1.000000)")));
+	str = string_from_vector_array(buffer, 82, points, 3);
+	EXPECT_CONSTSTRINGEQ(string_to_const(str), string_const(STRING_CONST("(1.000000, 2.000000, 3.000000, 4.000000)")));
+	str = string_from_vector_array(buffer, 0, points, 3);
+	EXPECT_UINTEQ(str.length, 0);
+
+	vector_t parsed[4];
+	str = string_from_vector_array(buffer, sizeof(buffer), points, 3);
+	EXPECT_UINTEQ(vector_array_from_string(parsed, 4, STRING_ARGS(str)), 3);
+	EXPECT_VECTOREQ(parsed[0], points[0]);
+	EXPECT_VECTOREQ(parsed[1], points[1]);
+	EXPECT_VECTOREQ(parsed[2], points[2]);
+	EXPECT_UINTEQ(vector_array_from_string(parsed, 2, STRING_ARGS(str)), 2);
+	EXPECT_UINTEQ(vector_array_from_string(parsed, 4, STRING_CONST("(1 2) (3, 4, 5)")), 2);
+	EXPECT_VECTOREQ(parsed[0], vector(1, 2, 0, 1));
+	EXPECT_VECTOREQ(parsed[1], vector(3, 4, 5, 1));
+
+	matrix_t m = matrix_scaling(vector(2, 3, 4, 1));
+	m.frow[3][0] = -1.25f;
+	str = string_from_matrix(buffer, sizeof(buffer), m);
+	EXPECT_CONSTSTRINGEQ(string_to_const(str), string_const(STRING_CONST(
+	                                               "((2.000000, 0.000000, 0.000000, 0.000000), "
+	                                               "(0.000000, 3.000000, 0.000000, 0.000000), "
+	                                               "(0.000000, 0.000000, 4.000000, 0.000000), "
+	                                               "(-1.250000, 0.000000, 0.000000, 1.000000))")));
+
+	// Parser accepts other number forms, missing components as in [0, 0, 0, 1]
+	EXPECT_VECTOREQ(vector_from_string(STRING_CONST("1e3, -2.5E-1 +7 .5")), vector(1000, -0.25f, 7, 0.5f));
+	EXPECT_VECTOREQ(vector_from_string(STRING_CONST(" ( 3 )")), vector(3, 0, 0, 1));
+	EXPECT_VECTOREQ(vector_from_string(STRING_CONST("")), vector(0, 0, 0, 1));
+	EXPECT_VECTOREQ(vector_from_string(STRING_CONST("123456789012345678901234, 1e-40, 0.1, 1e30")),
+	                vector(1.23456789e23f, 1e-40f, 0.1f, 1e30f));
+	EXPECT_VECTOREQ(vector_from_string("(1, 2, 3, 4)", 6), vector(1, 2, 0, 1));
+	const vector_t nonfinite = vector_from_string(STRING_CONST("(inf, -inf, nan, 1)"));
+	EXPECT_TRUE(vector_x(nonfinite) > REAL_MAX);
+	EXPECT_TRUE(vector_y(nonfinite) < -REAL_MAX);
+	// NaN from the bits, a self comparison is folded away by the fast math build flags
+	EXPECT_TRUE((test_vector_bits(vector_z(nonfinite)) & 0x7FFFFFFF) > 0x7F800000);
+	EXPECT_REALEQ(vector_w(nonfinite), 1);
+
+	return 0;
+}
+
+DECLARE_TEST(vector, vector4d) {
+	float64_t store[4];
+	vector4d_t v = vector4d(1, 2, 3, 4);
+	EXPECT_TRUE(vector4d_x(v) == 1.0);
+	EXPECT_TRUE(vector4d_y(v) == 2.0);
+	EXPECT_TRUE(vector4d_z(v) == 3.0);
+	EXPECT_TRUE(vector4d_w(v) == 4.0);
+
+	const float64_t data[5] = {-1, 5, 7, 9, 11};
+	vector4d_store(store, vector4d_unaligned(data + 1));
+	EXPECT_TRUE((store[0] == 5.0) && (store[1] == 7.0) && (store[2] == 9.0) && (store[3] == 11.0));
+
+	EXPECT_VECTOREQ(vector_from_vector4d(v), vector(1, 2, 3, 4));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_from_vector(vector(-1, 0.5f, 8, 2))), vector(-1, 0.5f, 8, 2));
+
+	const vector4d_t w = vector4d(2, -1, 0.5, 8);
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_add(v, w)), vector(3, 1, 3.5f, 12));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_sub(v, w)), vector(-1, 3, 2.5f, -4));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_mul(v, w)), vector(2, -2, 1.5f, 32));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_div(v, w)), vector(0.5f, -2, 6, 0.5f));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_neg(w)), vector(-2, 1, -0.5f, -8));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_muladd(v, w, v)), vector(3, 0, 4.5f, 36));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_scale(v, 0.5)), vector(0.5f, 1, 1.5f, 2));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_lerp(v, w, 0.5)), vector(1.5f, 0.5f, 1.75f, 6));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_min(v, w)), vector(1, -1, 0.5f, 4));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_max(v, w)), vector(2, 2, 3, 8));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_sqrt(vector4d(4, 9, 16, 0.25))), vector(2, 3, 4, 0.5f));
+
+	EXPECT_TRUE(vector4d_x(vector4d_dot(v, w)) == 33.5);
+	EXPECT_TRUE(vector4d_w(vector4d_dot(v, w)) == 33.5);
+	EXPECT_TRUE(vector4d_y(vector4d_dot3(v, w)) == 1.5);
+	EXPECT_TRUE(vector4d_z(vector4d_length3_sqr(v)) == 14.0);
+	EXPECT_TRUE(vector4d_x(vector4d_length3(vector4d(3, 4, 12, 100))) == 13.0);
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_normalize3(vector4d(0, 0, 4, 2))), vector(0, 0, 1, 2));
+	EXPECT_TRUE(vector4d_w(vector4d_normalize3(vector4d(3, 4, 12, 100))) == 100.0);
+	EXPECT_REALEQ((real)vector4d_y(vector4d_normalize3(vector4d(3, 4, 12, 100))), (real)(4.0 / 13.0));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_cross3(vector4d(1, 0, 0, 3), vector4d(0, 1, 0, 5))),
+	                vector(0, 0, 1, 0));
+	EXPECT_VECTOREQ(vector_from_vector4d(vector4d_cross3(v, w)), vector(4, 5.5f, -5, 0));
+
+	// Large world coordinates lose the offset in single precision, but not when rebased in double
+	const vector4d_t origin = vector4d(6378137.0, -6378137.0, 1000000.0, 7);
+	const vector4d_t position[5] = {vector4d(6378137.125, -6378137.25, 1000000.5, 1),
+	                                vector4d(6378138.0, -6378136.0, 999999.0, 1),
+	                                vector4d(6378137.0, -6378137.0, 1000000.0, 0),
+	                                vector4d(6378127.0, -6378147.0, 1000010.0, 1),
+	                                vector4d(6378137.0625, -6378137.0, 1000000.0, 1)};
+	EXPECT_VECTORNOTEQ(vector_sub(vector_from_vector4d(position[0]), vector_from_vector4d(origin)),
+	                   vector(0.125f, -0.25f, 0.5f, -6));
+	EXPECT_VECTOREQ(vector4d_rebase(position[0], origin), vector(0.125f, -0.25f, 0.5f, 1));
+
+	vector_t rebased[5];
+	vector4d_rebase_array(rebased, position, 5, origin);
+	EXPECT_VECTOREQ(rebased[0], vector(0.125f, -0.25f, 0.5f, 1));
+	EXPECT_VECTOREQ(rebased[1], vector(1, 1, -1, 1));
+	EXPECT_VECTOREQ(rebased[2], vector(0, 0, 0, 0));
+	EXPECT_VECTOREQ(rebased[3], vector(-10, -10, 10, 1));
+	EXPECT_VECTOREQ(rebased[4], vector(0.0625f, 0, 0, 1));
+
+	const float64_t packed[9] = {6378137.125, -6378137.25, 1000000.5, 6378138.0, -6378136.0, 999999.0, 0, 0, 0};
+	memset(rebased, 0, sizeof(rebased));
+	vector4d_rebase_array_packed3(rebased, packed, 3, origin);
+	EXPECT_VECTOREQ(rebased[0], vector(0.125f, -0.25f, 0.5f, 1));
+	EXPECT_VECTOREQ(rebased[1], vector(1, 1, -1, 1));
+	EXPECT_VECTOREQ(rebased[2], vector(-6378137.0f, 6378137.0f, -1000000.0f, 1));
+
+	return 0;
+}
+
 static void
 test_vector_declare(void) {
 #if FOUNDATION_ARCH_SSE4
@@ -859,6 +2264,7 @@ test_vector_declare(void) {
 #endif
 
 	ADD_TEST(vector, construct);
+	ADD_TEST(vector, load3);
 	ADD_TEST(vector, normalize);
 	ADD_TEST(vector, dot);
 	ADD_TEST(vector, cross);
@@ -866,9 +2272,24 @@ test_vector_declare(void) {
 	ADD_TEST(vector, shuffle);
 	ADD_TEST(vector, util);
 	ADD_TEST(vector, length);
+	ADD_TEST(vector, fast);
+	ADD_TEST(vector, transcendental);
+	ADD_TEST(vector, pack);
 	ADD_TEST(vector, minmax);
 	ADD_TEST(vector, component);
 	ADD_TEST(vector, equal);
+	ADD_TEST(vector, select);
+	ADD_TEST(vector, integer);
+	ADD_TEST(vector, soa);
+	ADD_TEST(vector, bounds);
+	ADD_TEST(vector, ray);
+	ADD_TEST(vector, spline);
+	ADD_TEST(vector, view);
+	ADD_TEST(vector, arena);
+	ADD_TEST(vector, blob);
+	ADD_TEST(vector, string);
+	ADD_TEST(vector, statistics);
+	ADD_TEST(vector, vector4d);
 }
 
 static test_suite_t test_vector_suite = {test_vector_application,
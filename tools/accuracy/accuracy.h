@@ -0,0 +1,89 @@
+/* accuracy.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/* Interface between the accuracy tool driver and the kernels, which are compiled once for each
+   implementation in separate translation units (backend_<name>.c). Kernels only exchange plain
+   float arrays since vector_t is a different type in each translation unit */
+
+#include <foundation/platform.h>
+#include <foundation/types.h>
+
+//! Floats of input per element, three vectors a, b and c
+#define ACCURACY_INPUT_LENGTH 12
+
+//! Floats of output per element
+#define ACCURACY_OUTPUT_LENGTH 4
+
+typedef enum accuracy_kernel_id_t {
+	ACCURACY_VECTOR_SQRT = 0,
+	ACCURACY_VECTOR_RSQRT_FAST,
+	ACCURACY_VECTOR_DIV,
+	ACCURACY_VECTOR_RECIPROCAL_FAST,
+	ACCURACY_VECTOR_NORMALIZE,
+	ACCURACY_VECTOR_NORMALIZE3,
+	ACCURACY_VECTOR_NORMALIZE3_FAST,
+	ACCURACY_VECTOR_LENGTH3,
+	ACCURACY_VECTOR_DOT3,
+	ACCURACY_VECTOR_CROSS3,
+	ACCURACY_VECTOR_FLOOR,
+	ACCURACY_VECTOR_ROUND,
+	ACCURACY_VECTOR_SIN,
+	ACCURACY_VECTOR_SIN_FAST,
+	ACCURACY_VECTOR_COS,
+	ACCURACY_VECTOR_COS_FAST,
+	ACCURACY_VECTOR_ACOS,
+	ACCURACY_VECTOR_ACOS_FAST,
+	ACCURACY_VECTOR_ATAN2,
+	ACCURACY_VECTOR_ATAN2_FAST,
+	ACCURACY_VECTOR_EXP,
+	ACCURACY_VECTOR_EXP_FAST,
+	ACCURACY_VECTOR_LOG,
+	ACCURACY_VECTOR_LOG_FAST,
+	ACCURACY_QUATERNION_MUL,
+	ACCURACY_QUATERNION_NORMALIZE,
+	ACCURACY_QUATERNION_ROTATE,
+	ACCURACY_QUATERNION_SLERP,
+	ACCURACY_QUATERNION_NLERP,
+	ACCURACY_KERNEL_COUNT
+} accuracy_kernel_id_t;
+
+//! Instruction set extension a backend is compiled for beyond the architecture baseline
+typedef enum accuracy_isa_t {
+	ACCURACY_ISA_BASELINE = 0,
+	ACCURACY_ISA_SSE3,
+	ACCURACY_ISA_SSE41
+} accuracy_isa_t;
+
+//! Compute count results of ACCURACY_OUTPUT_LENGTH floats from count inputs of
+//! ACCURACY_INPUT_LENGTH floats
+typedef void (*accuracy_kernel_fn)(float32_t* out, const float32_t* in, size_t count);
+
+typedef struct accuracy_backend_t {
+	const char* name;
+	//! Required instruction set, the backend is skipped if the CPU does not support it
+	accuracy_isa_t isa;
+	//! Kernels indexed by accuracy_kernel_id_t, all null if the implementation is not available
+	//! on the target architecture
+	accuracy_kernel_fn kernel[ACCURACY_KERNEL_COUNT];
+} accuracy_backend_t;
+
+extern const accuracy_backend_t accuracy_backend_fallback;
+extern const accuracy_backend_t accuracy_backend_sse2;
+extern const accuracy_backend_t accuracy_backend_sse3;
+extern const accuracy_backend_t accuracy_backend_sse4;
+extern const accuracy_backend_t accuracy_backend_neon;
@@ -0,0 +1,23 @@
+/* backend_fallback.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#define VECTOR_TARGET_FALLBACK 1
+#define ACCURACY_BACKEND accuracy_backend_fallback
+#define ACCURACY_BACKEND_NAME "fallback"
+#define ACCURACY_BACKEND_ISA ACCURACY_ISA_BASELINE
+
+#include "kernels.h"
@@ -0,0 +1,35 @@
+/* backend_neon.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#define ACCURACY_BACKEND accuracy_backend_neon
+#define ACCURACY_BACKEND_NAME "neon"
+#define ACCURACY_BACKEND_ISA ACCURACY_ISA_BASELINE
+
+#include <foundation/platform.h>
+
+// NEON is the default implementation on targets supporting it, no forcing needed
+#if FOUNDATION_ARCH_NEON
+
+#include "kernels.h"
+
+#else
+
+#include "accuracy.h"
+
+const accuracy_backend_t ACCURACY_BACKEND = {ACCURACY_BACKEND_NAME, ACCURACY_BACKEND_ISA, {0}};
+
+#endif
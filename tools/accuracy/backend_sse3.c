@@ -0,0 +1,48 @@
+/* backend_sse3.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#define VECTOR_TARGET_SSE3 1
+#define ACCURACY_BACKEND accuracy_backend_sse3
+#define ACCURACY_BACKEND_NAME "sse3"
+#define ACCURACY_BACKEND_ISA ACCURACY_ISA_SSE3
+
+#include <foundation/platform.h>
+
+#if FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64
+
+#if FOUNDATION_COMPILER_CLANG
+#pragma clang attribute push(__attribute__((target("sse3"))), apply_to = function)
+#elif FOUNDATION_COMPILER_GCC
+#pragma GCC push_options
+#pragma GCC target("sse3")
+#endif
+
+#include "kernels.h"
+
+#if FOUNDATION_COMPILER_CLANG
+#pragma clang attribute pop
+#elif FOUNDATION_COMPILER_GCC
+#pragma GCC pop_options
+#endif
+
+#else
+
+#include "accuracy.h"
+
+const accuracy_backend_t ACCURACY_BACKEND = {ACCURACY_BACKEND_NAME, ACCURACY_BACKEND_ISA, {0}};
+
+#endif
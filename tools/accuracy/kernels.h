@@ -0,0 +1,105 @@
+/* kernels.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+/* Kernels of the accuracy tool, included by each backend_<name>.c translation unit after forcing
+   the implementation with VECTOR_TARGET_<name>. ACCURACY_BACKEND names the backend table defined
+   here, ACCURACY_BACKEND_NAME its display name and ACCURACY_BACKEND_ISA the instruction set the
+   kernels require. No include guard, as each translation unit includes this file exactly once */
+
+#include <foundation/foundation.h>
+#include <vector/vector.h>
+
+#include "accuracy.h"
+
+// Each element is read as three vectors a, b and c, and the result of expr is stored as four floats
+#define ACCURACY_KERNEL(name, expr)                                                         \
+	static void accuracy_kernel_##name(float32_t* out, const float32_t* in, size_t count) { \
+		for (size_t i = 0; i < count; ++i) {                                                \
+			const vector_t a = vector_unaligned(in);                                        \
+			const vector_t b = vector_unaligned(in + 4);                                    \
+			const vector_t c = vector_unaligned(in + 8);                                    \
+			const vector_t result = (expr);                                                 \
+			FOUNDATION_UNUSED(b);                                                           \
+			FOUNDATION_UNUSED(c);                                                           \
+			memcpy(out, &result, sizeof(float32_t) * ACCURACY_OUTPUT_LENGTH);               \
+			in += ACCURACY_INPUT_LENGTH;                                                    \
+			out += ACCURACY_OUTPUT_LENGTH;                                                  \
+		}                                                                                   \
+	}
+
+ACCURACY_KERNEL(vector_sqrt, vector_sqrt(a))
+ACCURACY_KERNEL(vector_rsqrt_fast, vector_rsqrt_fast(a))
+ACCURACY_KERNEL(vector_div, vector_div(a, b))
+ACCURACY_KERNEL(vector_reciprocal_fast, vector_reciprocal_fast(a))
+ACCURACY_KERNEL(vector_normalize, vector_normalize(a))
+ACCURACY_KERNEL(vector_normalize3, vector_normalize3(a))
+ACCURACY_KERNEL(vector_normalize3_fast, vector_normalize3_fast(a))
+ACCURACY_KERNEL(vector_length3, vector_length3(a))
+ACCURACY_KERNEL(vector_dot3, vector_dot3(a, b))
+ACCURACY_KERNEL(vector_cross3, vector_cross3(a, b))
+ACCURACY_KERNEL(vector_floor, vector_floor(a))
+ACCURACY_KERNEL(vector_round, vector_round(a))
+ACCURACY_KERNEL(vector_sin, vector_sin(a))
+ACCURACY_KERNEL(vector_sin_fast, vector_sin_fast(a))
+ACCURACY_KERNEL(vector_cos, vector_cos(a))
+ACCURACY_KERNEL(vector_cos_fast, vector_cos_fast(a))
+ACCURACY_KERNEL(vector_acos, vector_acos(a))
+ACCURACY_KERNEL(vector_acos_fast, vector_acos_fast(a))
+ACCURACY_KERNEL(vector_atan2, vector_atan2(a, b))
+ACCURACY_KERNEL(vector_atan2_fast, vector_atan2_fast(a, b))
+ACCURACY_KERNEL(vector_exp, vector_exp(a))
+ACCURACY_KERNEL(vector_exp_fast, vector_exp_fast(a))
+ACCURACY_KERNEL(vector_log, vector_log(a))
+ACCURACY_KERNEL(vector_log_fast, vector_log_fast(a))
+ACCURACY_KERNEL(quaternion_mul, quaternion_mul(a, b))
+ACCURACY_KERNEL(quaternion_normalize, quaternion_normalize(a))
+ACCURACY_KERNEL(quaternion_rotate, quaternion_rotate(a, b))
+ACCURACY_KERNEL(quaternion_slerp, quaternion_slerp(a, b, vector_x(c)))
+ACCURACY_KERNEL(quaternion_nlerp, quaternion_nlerp(a, b, vector_x(c)))
+
+const accuracy_backend_t ACCURACY_BACKEND = {
+    ACCURACY_BACKEND_NAME,
+    ACCURACY_BACKEND_ISA,
+    {[ACCURACY_VECTOR_SQRT] = accuracy_kernel_vector_sqrt,
+     [ACCURACY_VECTOR_RSQRT_FAST] = accuracy_kernel_vector_rsqrt_fast,
+     [ACCURACY_VECTOR_DIV] = accuracy_kernel_vector_div,
+     [ACCURACY_VECTOR_RECIPROCAL_FAST] = accuracy_kernel_vector_reciprocal_fast,
+     [ACCURACY_VECTOR_NORMALIZE] = accuracy_kernel_vector_normalize,
+     [ACCURACY_VECTOR_NORMALIZE3] = accuracy_kernel_vector_normalize3,
+     [ACCURACY_VECTOR_NORMALIZE3_FAST] = accuracy_kernel_vector_normalize3_fast,
+     [ACCURACY_VECTOR_LENGTH3] = accuracy_kernel_vector_length3,
+     [ACCURACY_VECTOR_DOT3] = accuracy_kernel_vector_dot3,
+     [ACCURACY_VECTOR_CROSS3] = accuracy_kernel_vector_cross3,
+     [ACCURACY_VECTOR_FLOOR] = accuracy_kernel_vector_floor,
+     [ACCURACY_VECTOR_ROUND] = accuracy_kernel_vector_round,
+     [ACCURACY_VECTOR_SIN] = accuracy_kernel_vector_sin,
+     [ACCURACY_VECTOR_SIN_FAST] = accuracy_kernel_vector_sin_fast,
+     [ACCURACY_VECTOR_COS] = accuracy_kernel_vector_cos,
+     [ACCURACY_VECTOR_COS_FAST] = accuracy_kernel_vector_cos_fast,
+     [ACCURACY_VECTOR_ACOS] = accuracy_kernel_vector_acos,
+     [ACCURACY_VECTOR_ACOS_FAST] = accuracy_kernel_vector_acos_fast,
+     [ACCURACY_VECTOR_ATAN2] = accuracy_kernel_vector_atan2,
+     [ACCURACY_VECTOR_ATAN2_FAST] = accuracy_kernel_vector_atan2_fast,
+     [ACCURACY_VECTOR_EXP] = accuracy_kernel_vector_exp,
+     [ACCURACY_VECTOR_EXP_FAST] = accuracy_kernel_vector_exp_fast,
+     [ACCURACY_VECTOR_LOG] = accuracy_kernel_vector_log,
+     [ACCURACY_VECTOR_LOG_FAST] = accuracy_kernel_vector_log_fast,
+     [ACCURACY_QUATERNION_MUL] = accuracy_kernel_quaternion_mul,
+     [ACCURACY_QUATERNION_NORMALIZE] = accuracy_kernel_quaternion_normalize,
+     [ACCURACY_QUATERNION_ROTATE] = accuracy_kernel_quaternion_rotate,
+     [ACCURACY_QUATERNION_SLERP] = accuracy_kernel_quaternion_slerp,
+     [ACCURACY_QUATERNION_NLERP] = accuracy_kernel_quaternion_nlerp}};
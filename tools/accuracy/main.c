@@ -0,0 +1,601 @@
+/* main.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+/* Accuracy and speed comparison of the implementations. The same kernels are compiled for every
+   implementation available on the target (fallback, SSE2, SSE3 and SSE4 on x86, fallback and NEON
+   on ARM) and run over randomized inputs, skipping implementations the CPU does not support.
+   Results are compared to a double precision reference and the max error in ULP (units in the
+   last place of the float reference) and absolute terms is reported together with the time per
+   operation for each implementation. ULP errors of results
+   close to zero from cancellation (dot, cross, sin at multiples of pi) are large by nature, the
+   absolute error shows the magnitude in those cases.
+
+   Usage: accuracy-vector [--csv] [--filter <substring>] [--seed <number>] */
+
+#include <foundation/foundation.h>
+#include <vector/vector.h>
+
+#include <float.h>
+#include <math.h>
+
+#include "accuracy.h"
+
+#if (FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64) && FOUNDATION_COMPILER_MSVC
+#include <intrin.h>
+#elif FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64
+#include <cpuid.h>
+#endif
+
+#if FOUNDATION_COMPILER_MSVC
+#define ACCURACY_BARRIER() _ReadWriteBarrier()
+#else
+#define ACCURACY_BARRIER() __asm__ __volatile__("" : : : "memory")
+#endif
+
+#define ACCURACY_COUNT 4096
+#define ACCURACY_SAMPLES 5
+
+//! Input ranges, each kernel reads up to three vectors a, b and c per element
+typedef enum accuracy_domain_t {
+	//! All components in [-100, 100]
+	ACCURACY_DOMAIN_SIGNED = 0,
+	//! Log-uniform magnitudes in [1e-4, 1e4], positive
+	ACCURACY_DOMAIN_POSITIVE,
+	//! a in [-100, 100], b with log-uniform magnitude in [1e-2, 1e2] and random sign
+	ACCURACY_DOMAIN_DIVISOR,
+	//! All components in [-1, 1]
+	ACCURACY_DOMAIN_UNIT,
+	//! All components in [-80, 80]
+	ACCURACY_DOMAIN_EXP,
+	//! Log-uniform magnitudes in [1e-30, 1e30], positive
+	ACCURACY_DOMAIN_LOG,
+	//! a and b unit quaternions, c.x interpolation factor in [0, 1]
+	ACCURACY_DOMAIN_QUATERNION,
+	//! a unit quaternion, b vector with components in [-10, 10]
+	ACCURACY_DOMAIN_ROTATION
+} accuracy_domain_t;
+
+//! Reference result of one element in double precision from the float input
+typedef void (*accuracy_reference_fn)(double* out, const float32_t* in);
+
+typedef struct accuracy_test_t {
+	const char* name;
+	accuracy_domain_t domain;
+	//! Bit mask of output components compared, bit 0 for x to bit 3 for w
+	unsigned int lanes;
+	accuracy_reference_fn reference;
+} accuracy_test_t;
+
+typedef struct accuracy_result_t {
+	double max_ulp;
+	double max_abs;
+	double ns;
+} accuracy_result_t;
+
+static const accuracy_backend_t* accuracy_backend[] = {&accuracy_backend_fallback, &accuracy_backend_sse2,
+                                                       &accuracy_backend_sse3, &accuracy_backend_sse4,
+                                                       &accuracy_backend_neon};
+
+static float32_t accuracy_input[ACCURACY_COUNT * ACCURACY_INPUT_LENGTH];
+static float32_t accuracy_output[ACCURACY_COUNT * ACCURACY_OUTPUT_LENGTH];
+static double accuracy_expected[ACCURACY_COUNT * ACCURACY_OUTPUT_LENGTH];
+
+static bool accuracy_csv;
+static string_const_t accuracy_filter;
+static uint64_t accuracy_seed = 0x9E3779B97F4A7C15ULL;
+
+static double
+accuracy_dot3(const float32_t* v0, const float32_t* v1) {
+	return (double)v0[0] * (double)v1[0] + (double)v0[1] * (double)v1[1] + (double)v0[2] * (double)v1[2];
+}
+
+static double
+accuracy_dot(const float32_t* v0, const float32_t* v1) {
+	return accuracy_dot3(v0, v1) + (double)v0[3] * (double)v1[3];
+}
+
+static void
+accuracy_reference_sqrt(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = sqrt((double)in[i]);
+}
+
+static void
+accuracy_reference_rsqrt(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = 1.0 / sqrt((double)in[i]);
+}
+
+static void
+accuracy_reference_div(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = (double)in[i] / (double)in[4 + i];
+}
+
+static void
+accuracy_reference_reciprocal(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = 1.0 / (double)in[i];
+}
+
+static void
+accuracy_reference_normalize(double* out, const float32_t* in) {
+	const double length = sqrt(accuracy_dot(in, in));
+	for (int i = 0; i < 4; ++i)
+		out[i] = (double)in[i] / length;
+}
+
+static void
+accuracy_reference_normalize3(double* out, const float32_t* in) {
+	const double length = sqrt(accuracy_dot3(in, in));
+	for (int i = 0; i < 3; ++i)
+		out[i] = (double)in[i] / length;
+	out[3] = 0;
+}
+
+static void
+accuracy_reference_length3(double* out, const float32_t* in) {
+	out[0] = out[1] = out[2] = out[3] = sqrt(accuracy_dot3(in, in));
+}
+
+static void
+accuracy_reference_dot3(double* out, const float32_t* in) {
+	out[0] = out[1] = out[2] = out[3] = accuracy_dot3(in, in + 4);
+}
+
+static void
+accuracy_reference_cross3(double* out, const float32_t* in) {
+	const float32_t* v0 = in;
+	const float32_t* v1 = in + 4;
+	out[0] = (double)v0[1] * (double)v1[2] - (double)v0[2] * (double)v1[1];
+	out[1] = (double)v0[2] * (double)v1[0] - (double)v0[0] * (double)v1[2];
+	out[2] = (double)v0[0] * (double)v1[1] - (double)v0[1] * (double)v1[0];
+	out[3] = 0;
+}
+
+static void
+accuracy_reference_floor(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = floor((double)in[i]);
+}
+
+static void
+accuracy_reference_round(double* out, const float32_t* in) {
+	// Ties to even
+	for (int i = 0; i < 4; ++i) {
+		const double lower = floor((double)in[i]);
+		const double diff = (double)in[i] - lower;
+		out[i] = ((diff > 0.5) || ((diff == 0.5) && (fmod(lower, 2.0) != 0))) ? lower + 1.0 : lower;
+	}
+}
+
+static void
+accuracy_reference_sin(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = sin((double)in[i]);
+}
+
+static void
+accuracy_reference_cos(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = cos((double)in[i]);
+}
+
+static void
+accuracy_reference_acos(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = acos((double)in[i]);
+}
+
+static void
+accuracy_reference_atan2(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = atan2((double)in[i], (double)in[4 + i]);
+}
+
+static void
+accuracy_reference_exp(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = exp((double)in[i]);
+}
+
+static void
+accuracy_reference_log(double* out, const float32_t* in) {
+	for (int i = 0; i < 4; ++i)
+		out[i] = log((double)in[i]);
+}
+
+static void
+accuracy_quaternion_mul(double* out, const double* q0, const double* q1) {
+	out[0] = q1[3] * q0[0] + q1[0] * q0[3] + q1[1] * q0[2] - q1[2] * q0[1];
+	out[1] = q1[3] * q0[1] - q1[0] * q0[2] + q1[1] * q0[3] + q1[2] * q0[0];
+	out[2] = q1[3] * q0[2] + q1[0] * q0[1] - q1[1] * q0[0] + q1[2] * q0[3];
+	out[3] = q1[3] * q0[3] - q1[0] * q0[0] - q1[1] * q0[1] - q1[2] * q0[2];
+}
+
+static void
+accuracy_reference_quaternion_mul(double* out, const float32_t* in) {
+	const double q0[4] = {in[0], in[1], in[2], in[3]};
+	const double q1[4] = {in[4], in[5], in[6], in[7]};
+	accuracy_quaternion_mul(out, q0, q1);
+}
+
+static void
+accuracy_reference_quaternion_rotate(double* out, const float32_t* in) {
+	// Conjugate of q, times v, times q in the order of quaternion_mul
+	const double q[4] = {in[0], in[1], in[2], in[3]};
+	const double conjugate[4] = {-q[0], -q[1], -q[2], q[3]};
+	const double v[4] = {in[4], in[5], in[6], 0};
+	double t[4];
+	accuracy_quaternion_mul(t, conjugate, v);
+	accuracy_quaternion_mul(out, t, q);
+	out[3] = in[7];
+}
+
+static void
+accuracy_reference_quaternion_slerp(double* out, const float32_t* in) {
+	const double factor = (double)in[8];
+	double cosval = accuracy_dot(in, in + 4);
+	const double sign = (cosval < 0) ? -1.0 : 1.0;
+	cosval *= sign;
+	double scale0 = 1.0 - factor;
+	double scale1 = factor;
+	if (cosval < 1.0) {
+		const double angle = acos(cosval);
+		const double sinval = sin(angle);
+		if (sinval > 1e-12) {
+			scale0 = sin((1.0 - factor) * angle) / sinval;
+			scale1 = sin(factor * angle) / sinval;
+		}
+	}
+	for (int i = 0; i < 4; ++i)
+		out[i] = scale0 * (double)in[i] + scale1 * sign * (double)in[4 + i];
+}
+
+static void
+accuracy_reference_quaternion_nlerp(double* out, const float32_t* in) {
+	const double factor = (double)in[8];
+	const double sign = (accuracy_dot(in, in + 4) < 0) ? -1.0 : 1.0;
+	double length = 0;
+	for (int i = 0; i < 4; ++i) {
+		out[i] = (1.0 - factor) * (double)in[i] + factor * sign * (double)in[4 + i];
+		length += out[i] * out[i];
+	}
+	length = sqrt(length);
+	for (int i = 0; i < 4; ++i)
+		out[i] /= length;
+}
+
+static const accuracy_test_t accuracy_test[ACCURACY_KERNEL_COUNT] = {
+    [ACCURACY_VECTOR_SQRT] = {"vector_sqrt", ACCURACY_DOMAIN_POSITIVE, 0xF, accuracy_reference_sqrt},
+    [ACCURACY_VECTOR_RSQRT_FAST] = {"vector_rsqrt_fast", ACCURACY_DOMAIN_POSITIVE, 0xF, accuracy_reference_rsqrt},
+    [ACCURACY_VECTOR_DIV] = {"vector_div", ACCURACY_DOMAIN_DIVISOR, 0xF, accuracy_reference_div},
+    [ACCURACY_VECTOR_RECIPROCAL_FAST] = {"vector_reciprocal_fast", ACCURACY_DOMAIN_POSITIVE, 0xF,
+                                         accuracy_reference_reciprocal},
+    [ACCURACY_VECTOR_NORMALIZE] = {"vector_normalize", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_normalize},
+    [ACCURACY_VECTOR_NORMALIZE3] = {"vector_normalize3", ACCURACY_DOMAIN_SIGNED, 0x7, accuracy_reference_normalize3},
+    [ACCURACY_VECTOR_NORMALIZE3_FAST] = {"vector_normalize3_fast", ACCURACY_DOMAIN_SIGNED, 0x7,
+                                         accuracy_reference_normalize3},
+    [ACCURACY_VECTOR_LENGTH3] = {"vector_length3", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_length3},
+    [ACCURACY_VECTOR_DOT3] = {"vector_dot3", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_dot3},
+    [ACCURACY_VECTOR_CROSS3] = {"vector_cross3", ACCURACY_DOMAIN_SIGNED, 0x7, accuracy_reference_cross3},
+    [ACCURACY_VECTOR_FLOOR] = {"vector_floor", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_floor},
+    [ACCURACY_VECTOR_ROUND] = {"vector_round", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_round},
+    [ACCURACY_VECTOR_SIN] = {"vector_sin", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_sin},
+    [ACCURACY_VECTOR_SIN_FAST] = {"vector_sin_fast", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_sin},
+    [ACCURACY_VECTOR_COS] = {"vector_cos", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_cos},
+    [ACCURACY_VECTOR_COS_FAST] = {"vector_cos_fast", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_cos},
+    [ACCURACY_VECTOR_ACOS] = {"vector_acos", ACCURACY_DOMAIN_UNIT, 0xF, accuracy_reference_acos},
+    [ACCURACY_VECTOR_ACOS_FAST] = {"vector_acos_fast", ACCURACY_DOMAIN_UNIT, 0xF, accuracy_reference_acos},
+    [ACCURACY_VECTOR_ATAN2] = {"vector_atan2", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_atan2},
+    [ACCURACY_VECTOR_ATAN2_FAST] = {"vector_atan2_fast", ACCURACY_DOMAIN_SIGNED, 0xF, accuracy_reference_atan2},
+    [ACCURACY_VECTOR_EXP] = {"vector_exp", ACCURACY_DOMAIN_EXP, 0xF, accuracy_reference_exp},
+    [ACCURACY_VECTOR_EXP_FAST] = {"vector_exp_fast", ACCURACY_DOMAIN_EXP, 0xF, accuracy_reference_exp},
+    [ACCURACY_VECTOR_LOG] = {"vector_log", ACCURACY_DOMAIN_LOG, 0xF, accuracy_reference_log},
+    [ACCURACY_VECTOR_LOG_FAST] = {"vector_log_fast", ACCURACY_DOMAIN_LOG, 0xF, accuracy_reference_log},
+    [ACCURACY_QUATERNION_MUL] = {"quaternion_mul", ACCURACY_DOMAIN_QUATERNION, 0xF, accuracy_reference_quaternion_mul},
+    [ACCURACY_QUATERNION_NORMALIZE] = {"quaternion_normalize", ACCURACY_DOMAIN_SIGNED, 0xF,
+                                       accuracy_reference_normalize},
+    [ACCURACY_QUATERNION_ROTATE] = {"quaternion_rotate", ACCURACY_DOMAIN_ROTATION, 0x7,
+                                    accuracy_reference_quaternion_rotate},
+    [ACCURACY_QUATERNION_SLERP] = {"quaternion_slerp", ACCURACY_DOMAIN_QUATERNION, 0xF,
+                                   accuracy_reference_quaternion_slerp},
+    [ACCURACY_QUATERNION_NLERP] = {"quaternion_nlerp", ACCURACY_DOMAIN_QUATERNION, 0xF,
+                                   accuracy_reference_quaternion_nlerp}};
+
+//! Uniform random number in [0, 1) from a xorshift generator, deterministic for a given seed
+static double
+accuracy_random(void) {
+	accuracy_seed ^= accuracy_seed << 13;
+	accuracy_seed ^= accuracy_seed >> 7;
+	accuracy_seed ^= accuracy_seed << 17;
+	return (double)(accuracy_seed >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static float32_t
+accuracy_random_range(double low, double high) {
+	return (float32_t)(low + (high - low) * accuracy_random());
+}
+
+static float32_t
+accuracy_random_log(double low, double high) {
+	return (float32_t)exp(log(low) + (log(high) - log(low)) * accuracy_random());
+}
+
+static void
+accuracy_random_quaternion(float32_t* q) {
+	double v[4];
+	double length;
+	do {
+		length = 0;
+		for (int i = 0; i < 4; ++i) {
+			v[i] = accuracy_random() * 2.0 - 1.0;
+			length += v[i] * v[i];
+		}
+	} while ((length > 1.0) || (length < 1e-4));
+	length = sqrt(length);
+	for (int i = 0; i < 4; ++i)
+		q[i] = (float32_t)(v[i] / length);
+}
+
+static void
+accuracy_generate(float32_t* in, accuracy_domain_t domain) {
+	int i;
+	switch (domain) {
+		case ACCURACY_DOMAIN_SIGNED:
+			for (i = 0; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_range(-100.0, 100.0);
+			break;
+		case ACCURACY_DOMAIN_POSITIVE:
+			for (i = 0; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_log(1e-4, 1e4);
+			break;
+		case ACCURACY_DOMAIN_DIVISOR:
+			for (i = 0; i < 4; ++i) {
+				in[i] = accuracy_random_range(-100.0, 100.0);
+				in[4 + i] = accuracy_random_log(1e-2, 1e2) * ((accuracy_random() < 0.5) ? -1.0f : 1.0f);
+				in[8 + i] = 0;
+			}
+			break;
+		case ACCURACY_DOMAIN_UNIT:
+			for (i = 0; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_range(-1.0, 1.0);
+			break;
+		case ACCURACY_DOMAIN_EXP:
+			for (i = 0; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_range(-80.0, 80.0);
+			break;
+		case ACCURACY_DOMAIN_LOG:
+			for (i = 0; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_log(1e-30, 1e30);
+			break;
+		case ACCURACY_DOMAIN_QUATERNION:
+			accuracy_random_quaternion(in);
+			accuracy_random_quaternion(in + 4);
+			for (i = 8; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_range(0.0, 1.0);
+			break;
+		case ACCURACY_DOMAIN_ROTATION:
+			accuracy_random_quaternion(in);
+			for (i = 4; i < ACCURACY_INPUT_LENGTH; ++i)
+				in[i] = accuracy_random_range(-10.0, 10.0);
+			break;
+	}
+}
+
+//! Size of one unit in the last place of the float closest to the reference
+static double
+accuracy_ulp(double reference) {
+	const double magnitude = fabs((double)(float32_t)reference);
+	if (magnitude < (double)FLT_MIN)
+		return ldexp(1.0, -149);
+	int exponent = 0;
+	frexp(magnitude, &exponent);
+	return ldexp(1.0, exponent - 24);
+}
+
+//! Max error of the output over all elements and compared components, infinite if a result
+//! is not a number where the reference is
+static void
+accuracy_compare(accuracy_result_t* result, const accuracy_test_t* test) {
+	result->max_ulp = 0;
+	result->max_abs = 0;
+	for (size_t i = 0; i < ACCURACY_COUNT * ACCURACY_OUTPUT_LENGTH; ++i) {
+		if (!(test->lanes & (1U << (i % ACCURACY_OUTPUT_LENGTH))))
+			continue;
+		const double expected = accuracy_expected[i];
+		const double actual = (double)accuracy_output[i];
+		double error = fabs(actual - expected);
+		if (isnan(actual) != isnan(expected))
+			error = INFINITY;
+		else if (isnan(actual) || (actual == expected))
+			error = 0;
+		const double ulp = error / accuracy_ulp(expected);
+		if (ulp > result->max_ulp)
+			result->max_ulp = ulp;
+		if (error > result->max_abs)
+			result->max_abs = error;
+	}
+}
+
+static size_t
+accuracy_run(accuracy_kernel_fn kernel, size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		kernel(accuracy_output, accuracy_input, ACCURACY_COUNT);
+		ACCURACY_BARRIER();
+	}
+	return rounds * ACCURACY_COUNT;
+}
+
+//! Best time in nanoseconds per operation over a number of samples, each sample run for enough
+//! rounds to take at least a few milliseconds
+static double
+accuracy_measure(accuracy_kernel_fn kernel) {
+	const tick_t min_ticks = time_ticks_per_second() / 200;
+	size_t rounds = 1;
+	tick_t start = time_current();
+	accuracy_run(kernel, rounds);
+	while (time_diff(start, time_current()) < min_ticks) {
+		rounds *= 2;
+		start = time_current();
+		accuracy_run(kernel, rounds);
+	}
+
+	double best = 0;
+	for (int sample = 0; sample < ACCURACY_SAMPLES; ++sample) {
+		start = time_current();
+		const size_t ops = accuracy_run(kernel, rounds);
+		const double ns = (double)time_ticks_to_seconds(time_diff(start, time_current())) * 1e9 / (double)ops;
+		if (!sample || (ns < best))
+			best = ns;
+	}
+	return best;
+}
+
+//! Check that the CPU supports the instruction set a backend is compiled for, the backends are
+//! built with target pragmas and would fault on older CPUs
+static bool
+accuracy_isa_supported(accuracy_isa_t isa) {
+	if (isa == ACCURACY_ISA_BASELINE)
+		return true;
+#if FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64
+	uint32_t ecx;
+#if FOUNDATION_COMPILER_MSVC
+	int info[4];
+	__cpuid(info, 1);
+	ecx = (uint32_t)info[2];
+#else
+	uint32_t eax, ebx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+#endif
+	if (isa == ACCURACY_ISA_SSE3)
+		return (ecx & 1U) != 0;
+	if (isa == ACCURACY_ISA_SSE41)
+		return (ecx & (1U << 19)) != 0;
+#endif
+	return false;
+}
+
+static void
+accuracy_report(const char* name, const char* backend, const accuracy_result_t* result) {
+	if (accuracy_csv)
+		log_infof(HASH_TOOL, STRING_CONST("%s,%s,%.2f,%.3e,%.3f"), name, backend, result->max_ulp, result->max_abs,
+		          result->ns);
+	else
+		log_infof(HASH_TOOL, STRING_CONST("%-24s %-9s %12.2f %12.3e %10.3f"), name, backend, result->max_ulp,
+		          result->max_abs, result->ns);
+}
+
+static bool
+accuracy_included(const char* name) {
+	if (!accuracy_filter.length)
+		return true;
+	const size_t length = string_length(name);
+	return string_find_string(name, length, STRING_ARGS(accuracy_filter), 0) != STRING_NPOS;
+}
+
+static void
+accuracy_parse_command_line(void) {
+	const string_const_t* cmdline = environment_command_line();
+	for (size_t iarg = 1, argsize = array_size(cmdline); iarg < argsize; ++iarg) {
+		if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--csv")))
+			accuracy_csv = true;
+		else if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--filter")) && (iarg + 1 < argsize))
+			accuracy_filter = cmdline[++iarg];
+		else if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--seed")) && (iarg + 1 < argsize)) {
+			++iarg;
+			accuracy_seed = string_to_uint64(STRING_ARGS(cmdline[iarg]), false);
+			if (!accuracy_seed)
+				accuracy_seed = 1;
+		}
+	}
+}
+
+int
+main_initialize(void) {
+	int ret = 0;
+
+	application_t application;
+	memset(&application, 0, sizeof(application));
+	application.name = string_const(STRING_CONST("Vector accuracy"));
+	application.short_name = string_const(STRING_CONST("accuracy"));
+	application.company = string_const(STRING_CONST(""));
+	application.version = vector_module_version();
+	application.flags = APPLICATION_UTILITY;
+
+	log_enable_prefix(false);
+
+	foundation_config_t config;
+	memset(&config, 0, sizeof(config));
+
+	if ((ret = foundation_initialize(memory_system_malloc(), application, config)) < 0)
+		return ret;
+
+	vector_config_t vector_config;
+	memset(&vector_config, 0, sizeof(vector_config));
+	return vector_module_initialize(vector_config);
+}
+
+int
+main_run(void* main_arg) {
+	FOUNDATION_UNUSED(main_arg);
+
+	log_set_suppress(HASH_TOOL, ERRORLEVEL_DEBUG);
+
+	accuracy_parse_command_line();
+
+	if (accuracy_csv)
+		log_info(HASH_TOOL, STRING_CONST("name,backend,max_ulp,max_abs,ns"));
+	else
+		log_infof(HASH_TOOL,
+		          STRING_CONST("Max error in ULP and absolute, time in ns per operation\n%-24s %-9s %12s %12s %10s"),
+		          "function", "backend", "ulp", "abs", "time");
+
+	const size_t backend_count = sizeof(accuracy_backend) / sizeof(accuracy_backend[0]);
+	for (int id = 0; id < ACCURACY_KERNEL_COUNT; ++id) {
+		const accuracy_test_t* test = accuracy_test + id;
+		if (!accuracy_included(test->name))
+			continue;
+
+		for (size_t i = 0; i < ACCURACY_COUNT; ++i) {
+			accuracy_generate(accuracy_input + (i * ACCURACY_INPUT_LENGTH), test->domain);
+			test->reference(accuracy_expected + (i * ACCURACY_OUTPUT_LENGTH),
+			                accuracy_input + (i * ACCURACY_INPUT_LENGTH));
+		}
+
+		for (size_t ibackend = 0; ibackend < backend_count; ++ibackend) {
+			const accuracy_backend_t* backend = accuracy_backend[ibackend];
+			const accuracy_kernel_fn kernel = backend->kernel[id];
+			if (!kernel || !accuracy_isa_supported(backend->isa))
+				continue;
+			accuracy_result_t result;
+			kernel(accuracy_output, accuracy_input, ACCURACY_COUNT);
+			accuracy_compare(&result, test);
+			result.ns = accuracy_measure(kernel);
+			accuracy_report(test->name, backend->name, &result);
+		}
+	}
+
+	return 0;
+}
+
+void
+main_finalize(void) {
+	vector_module_finalize();
+	foundation_finalize();
+}
@@ -0,0 +1,700 @@
+/* main.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+/* Microbenchmarks for the vector library. Each function is measured for throughput (independent
+   operations over an array small enough to stay in L1) and latency (chain where each result is the
+   input of the next operation). Batch kernels are measured once for every available dispatch tier.
+   Parallel functions are measured on large arrays with a worker per additional hardware thread,
+   next to the single threaded batch function on the same arrays.
+
+   Usage: bench-vector [--json | --csv] [--filter <substring>] */
+
+#include <foundation/foundation.h>
+#include <vector/vector.h>
+#include <vector/bounds.h>
+#include <vector/spline.h>
+
+#if FOUNDATION_COMPILER_MSVC
+#include <intrin.h>
+#define BENCH_BARRIER() _ReadWriteBarrier()
+#else
+#define BENCH_BARRIER() __asm__ __volatile__("" : : : "memory")
+#endif
+
+#define BENCH_COUNT 512
+#define BENCH_SPLINE_KEYS 16
+#define BENCH_SAMPLES 5
+#define BENCH_BONES 32
+#define BENCH_LARGE_COUNT (1024 * 1024)
+#define BENCH_LARGE_MATRICES (64 * 1024)
+
+typedef enum bench_format_t { BENCH_FORMAT_TEXT = 0, BENCH_FORMAT_JSON, BENCH_FORMAT_CSV } bench_format_t;
+
+typedef enum bench_mode_t {
+	BENCH_MODE_SINGLE = 0,
+	//! Batch kernel routed through the dispatch table, measured for each instruction set tier
+	BENCH_MODE_BATCH,
+	//! Large arrays measured with the parallel worker threads started
+	BENCH_MODE_PARALLEL
+} bench_mode_t;
+
+//! Run the benchmark for the given number of rounds, returning number of operations performed
+typedef size_t (*bench_fn)(size_t rounds);
+
+typedef struct bench_t {
+	const char* name;
+	bench_fn throughput;
+	//! Latency function, null for array conversions which have no dependency chain
+	bench_fn latency;
+	bench_mode_t mode;
+} bench_t;
+
+static vector_t bench_vector[BENCH_COUNT];
+static vector_t bench_vector_out[BENCH_COUNT];
+static quaternion_t bench_quaternion[BENCH_COUNT];
+static real bench_factor[BENCH_COUNT];
+static matrix_t bench_matrix[BENCH_COUNT];
+static matrix_t bench_matrix_out[BENCH_COUNT];
+static euler_angles_t bench_euler[BENCH_COUNT];
+static int32_t bench_parent[BENCH_COUNT];
+static dual_quaternion_t bench_bone[BENCH_BONES];
+static uint16_t bench_bone_index[BENCH_COUNT * 4];
+static vector_t bench_bone_weight[BENCH_COUNT];
+static uint16_t bench_packed16[BENCH_COUNT * 4];
+static uint32_t bench_packed32[BENCH_COUNT];
+static aabb_soa_t bench_aabb[BENCH_COUNT / 4];
+static vector_soa_t bench_sphere[BENCH_COUNT / 4];
+static uint32_t bench_mask[BENCH_COUNT / 32];
+static frustum_t bench_frustum;
+static ray_soa_t bench_ray[BENCH_COUNT / 4];
+static real bench_distance[BENCH_COUNT];
+static spline_t bench_spline[BENCH_COUNT];
+static real bench_spline_key_time[BENCH_SPLINE_KEYS];
+static quaternion_t bench_spline_inner[BENCH_SPLINE_KEYS];
+static real bench_spline_time[BENCH_COUNT];
+static uint32_t bench_spline_cursor[BENCH_COUNT];
+static const float32_t* bench_vector_points = (const float32_t*)bench_vector;
+// Positions in bench_vector, written to a 32 byte stride interleaved vertex layout or as half
+static const vector_view_t bench_view_position = {bench_vector, sizeof(vector_t), 3, VECTOR_VIEW_FLOAT32};
+static const vector_view_t bench_view_vertex = {bench_matrix_out, sizeof(float32_t) * 8, 3, VECTOR_VIEW_FLOAT32};
+static const vector_view_t bench_view_half = {bench_packed16, sizeof(uint16_t) * 4, 4, VECTOR_VIEW_HALF};
+static vector_t bench_constant;
+static matrix_t bench_transform;
+static vector_t* bench_large_vector;
+static vector_t* bench_large_vector_out;
+static matrix_t* bench_large_matrix;
+static matrix_t* bench_large_matrix_out;
+static int32_t* bench_large_parent;
+
+static bench_format_t bench_format;
+static string_const_t bench_filter;
+static size_t bench_reported;
+
+static const char* bench_isa_name[] = {"auto", "baseline", "sse4", "avx2", "avx512"};
+
+static const char*
+bench_backend(void) {
+#if VECTOR_IMPLEMENTATION_AVX512
+	return "avx512";
+#elif VECTOR_IMPLEMENTATION_AVX2
+	return "avx2";
+#elif VECTOR_IMPLEMENTATION_SSE4
+	return "sse4";
+#elif VECTOR_IMPLEMENTATION_SSE3
+	return "sse3";
+#elif VECTOR_IMPLEMENTATION_SSE2
+	return "sse2";
+#elif VECTOR_IMPLEMENTATION_NEON
+	return "neon";
+#else
+	return "fallback";
+#endif
+}
+
+// Function of input v of given type, the barrier between rounds keeps the compiler from
+// collapsing the repeated rounds into one
+#define BENCH_FUNCTION(name, type, input, output, expr)                  \
+	static size_t bench_##name##_throughput(size_t rounds) {             \
+		for (size_t round = 0; round < rounds; ++round) {                \
+			for (size_t i = 0; i < BENCH_COUNT; ++i) {                   \
+				const type v = input[i];                                 \
+				output[i] = (expr);                                      \
+			}                                                            \
+			BENCH_BARRIER();                                             \
+		}                                                                \
+		return rounds * BENCH_COUNT;                                     \
+	}                                                                    \
+	static size_t bench_##name##_latency(size_t rounds) {                \
+		type v = input[0];                                               \
+		for (size_t i = 0, count = rounds * BENCH_COUNT; i < count; ++i) \
+			v = (expr);                                                  \
+		output[0] = v;                                                   \
+		return rounds * BENCH_COUNT;                                     \
+	}
+
+#define BENCH_VECTOR(name, expr) BENCH_FUNCTION(name, vector_t, bench_vector, bench_vector_out, expr)
+#define BENCH_QUATERNION(name, expr) BENCH_FUNCTION(name, quaternion_t, bench_quaternion, bench_vector_out, expr)
+#define BENCH_MATRIX(name, expr) BENCH_FUNCTION(name, matrix_t, bench_matrix, bench_matrix_out, expr)
+
+BENCH_VECTOR(vector_add, vector_add(v, bench_constant))
+BENCH_VECTOR(vector_mul, vector_mul(v, bench_constant))
+BENCH_VECTOR(vector_div, vector_div(v, bench_constant))
+BENCH_VECTOR(vector_muladd, vector_muladd(v, bench_constant, bench_constant))
+BENCH_VECTOR(vector_dot, vector_dot(v, bench_constant))
+BENCH_VECTOR(vector_dot3, vector_dot3(v, bench_constant))
+BENCH_VECTOR(vector_cross3, vector_cross3(v, bench_constant))
+BENCH_VECTOR(vector_normalize, vector_normalize(v))
+BENCH_VECTOR(vector_normalize_fast, vector_normalize_fast(v))
+BENCH_VECTOR(vector_normalize3, vector_normalize3(v))
+BENCH_VECTOR(vector_normalize3_fast, vector_normalize3_fast(v))
+BENCH_VECTOR(vector_length, vector_add(vector_length(v), bench_constant))
+BENCH_VECTOR(vector_length_fast, vector_add(vector_length_fast(v), bench_constant))
+BENCH_VECTOR(vector_length3, vector_add(vector_length3(v), bench_constant))
+BENCH_VECTOR(vector_sqrt, vector_sqrt(v))
+BENCH_VECTOR(vector_rsqrt_fast, vector_rsqrt_fast(v))
+BENCH_VECTOR(vector_reciprocal_fast, vector_reciprocal_fast(v))
+BENCH_VECTOR(vector_sin, vector_sin(v))
+BENCH_VECTOR(vector_sin_fast, vector_sin_fast(v))
+BENCH_VECTOR(vector_acos, vector_acos(vector_min(v, vector_one())))
+BENCH_VECTOR(vector_atan2, vector_atan2(v, bench_constant))
+// Keep chained input in range of the exponent and logarithm
+BENCH_VECTOR(vector_exp, vector_exp(vector_min(v, vector_one())))
+BENCH_VECTOR(vector_exp_fast, vector_exp_fast(vector_min(v, vector_one())))
+BENCH_VECTOR(vector_log, vector_log(vector_add(vector_abs(v), vector_one())))
+BENCH_VECTOR(vector_log_fast, vector_log_fast(vector_add(vector_abs(v), vector_one())))
+BENCH_VECTOR(vector_shuffle, vector_shuffle(v, VECTOR_MASK_WZYX))
+BENCH_VECTOR(vector_rotate, vector_rotate(v, bench_transform))
+BENCH_VECTOR(vector_transform, vector_transform(v, bench_transform))
+
+BENCH_QUATERNION(quaternion_mul, quaternion_mul(v, bench_constant))
+BENCH_QUATERNION(quaternion_normalize, quaternion_normalize(v))
+BENCH_QUATERNION(quaternion_slerp, quaternion_slerp(v, bench_constant, REAL_C(0.3)))
+BENCH_QUATERNION(quaternion_nlerp, quaternion_nlerp(v, bench_constant, REAL_C(0.3)))
+BENCH_QUATERNION(quaternion_rotate, quaternion_rotate(bench_constant, v))
+// Keep the rotation order of the input in the w component when chaining
+BENCH_FUNCTION(euler_angles_to_quaternion, euler_angles_t, bench_euler, bench_vector_out,
+               euler_angles_to_quaternion(transform_splice_w(v, bench_euler[0])))
+
+BENCH_MATRIX(matrix_mul, matrix_mul(v, bench_transform))
+BENCH_MATRIX(matrix_transpose, matrix_transpose(v))
+BENCH_MATRIX(matrix_inverse, matrix_inverse(v))
+BENCH_MATRIX(matrix_inverse_orthonormal, matrix_inverse_orthonormal(v))
+
+static size_t
+bench_vector_batch_rotate(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		vector_batch_rotate(bench_vector_out, bench_vector, BENCH_COUNT, bench_transform);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_vector_batch_transform(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		vector_batch_transform(bench_vector_out, bench_vector, BENCH_COUNT, bench_transform);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_matrix_batch_mul(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		matrix_batch_mul(bench_matrix_out, bench_matrix, bench_matrix, BENCH_COUNT);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_matrix_batch_mul_chain(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		matrix_batch_mul_chain(bench_matrix_out, bench_matrix, bench_parent, BENCH_COUNT);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_quaternion_batch_slerp(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		quaternion_batch_slerp(bench_vector_out, bench_quaternion, bench_quaternion + 1, bench_factor, BENCH_COUNT - 1);
+		BENCH_BARRIER();
+	}
+	return rounds * (BENCH_COUNT - 1);
+}
+
+static size_t
+bench_quaternion_batch_nlerp(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		quaternion_batch_nlerp(bench_vector_out, bench_quaternion, bench_quaternion + 1, bench_factor, BENCH_COUNT - 1);
+		BENCH_BARRIER();
+	}
+	return rounds * (BENCH_COUNT - 1);
+}
+
+static size_t
+bench_dual_quaternion_batch_skin(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		dual_quaternion_batch_skin(bench_vector_out, bench_vector, BENCH_COUNT, bench_bone, bench_bone_index,
+		                           bench_bone_weight);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_euler_angles_to_quaternion_array(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		euler_angles_to_quaternion_array(bench_vector_out, bench_euler, BENCH_COUNT, EULER_XYZs);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_frustum_batch_cull_aabbs(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		frustum_batch_cull_aabbs(bench_mask, &bench_frustum, bench_aabb, BENCH_COUNT);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_frustum_batch_cull_spheres(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		frustum_batch_cull_spheres(bench_mask, &bench_frustum, bench_sphere, BENCH_COUNT);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_ray_batch_intersect_triangle(size_t rounds) {
+	const vector_t v0 = vector(REAL_C(-1.0), REAL_C(-1.0), REAL_C(2.0), REAL_C(1.0));
+	const vector_t v1 = vector(REAL_C(2.0), REAL_C(-1.0), REAL_C(2.0), REAL_C(1.0));
+	const vector_t v2 = vector(REAL_C(-1.0), REAL_C(2.0), REAL_C(2.0), REAL_C(1.0));
+	for (size_t round = 0; round < rounds; ++round) {
+		ray_batch_intersect_triangle(bench_mask, bench_distance, bench_ray, BENCH_COUNT, v0, v1, v2);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+static size_t
+bench_spline_batch_evaluate(size_t rounds) {
+	for (size_t round = 0; round < rounds; ++round) {
+		spline_batch_evaluate(bench_vector_out, bench_spline, bench_spline_time, bench_spline_cursor, BENCH_COUNT);
+		BENCH_BARRIER();
+	}
+	return rounds * BENCH_COUNT;
+}
+
+#define BENCH_ARRAY(name, call)                           \
+	static size_t bench_##name(size_t rounds) {           \
+		for (size_t round = 0; round < rounds; ++round) { \
+			call;                                         \
+			BENCH_BARRIER();                              \
+		}                                                 \
+		return rounds * BENCH_COUNT;                      \
+	}
+
+BENCH_ARRAY(vector_load_half_array, vector_load_half_array(bench_vector_out, bench_packed16, BENCH_COUNT))
+BENCH_ARRAY(vector_store_half_array, vector_store_half_array(bench_packed16, bench_vector, BENCH_COUNT))
+BENCH_ARRAY(vector_load_snorm16_array,
+            vector_load_snorm16_array(bench_vector_out, (const int16_t*)bench_packed16, BENCH_COUNT))
+BENCH_ARRAY(vector_store_snorm16_array,
+            vector_store_snorm16_array((int16_t*)bench_packed16, bench_vector, BENCH_COUNT))
+BENCH_ARRAY(vector_unpack_snorm1010102_array,
+            vector_unpack_snorm1010102_array(bench_vector_out, bench_packed32, BENCH_COUNT))
+BENCH_ARRAY(vector_pack_snorm1010102_array,
+            vector_pack_snorm1010102_array(bench_packed32, bench_vector, BENCH_COUNT))
+BENCH_ARRAY(vector_load3_array, vector_load3_array(bench_vector_out, bench_vector_points, BENCH_COUNT))
+BENCH_ARRAY(vector_store3_array, vector_store3_array((float32_t*)bench_matrix_out, bench_vector, BENCH_COUNT))
+BENCH_ARRAY(quaternion_load_smallest3_array,
+            quaternion_load_smallest3_array(bench_vector_out, bench_packed16, BENCH_COUNT))
+BENCH_ARRAY(quaternion_store_smallest3_array,
+            quaternion_store_smallest3_array(bench_packed16, bench_quaternion, BENCH_COUNT))
+// Results stored to the output array to keep the computation from being eliminated
+BENCH_ARRAY(aabb_from_points,
+            *(aabb_t*)bench_vector_out = aabb_from_points(bench_vector_points, sizeof(vector_t), BENCH_COUNT))
+BENCH_ARRAY(sphere_from_points,
+            bench_vector_out[0] = sphere_from_points(bench_vector_points, sizeof(vector_t), BENCH_COUNT))
+BENCH_ARRAY(vector_transform_view,
+            vector_transform_view(&bench_view_vertex, &bench_view_position, BENCH_COUNT, bench_transform))
+BENCH_ARRAY(vector_convert_view, vector_convert_view(&bench_view_half, &bench_view_position, BENCH_COUNT))
+BENCH_ARRAY(aabb_from_view, *(aabb_t*)bench_vector_out = aabb_from_view(&bench_view_half, BENCH_COUNT))
+
+#define BENCH_LARGE(name, call, count)                    \
+	static size_t bench_##name(size_t rounds) {           \
+		for (size_t round = 0; round < rounds; ++round) { \
+			call;                                         \
+			BENCH_BARRIER();                              \
+		}                                                 \
+		return rounds * count;                            \
+	}
+
+BENCH_LARGE(vector_batch_transform_large,
+            vector_batch_transform(bench_large_vector_out, bench_large_vector, BENCH_LARGE_COUNT, bench_transform),
+            BENCH_LARGE_COUNT)
+BENCH_LARGE(vector_batch_transform_stream,
+            vector_batch_transform_stream(bench_large_vector_out, bench_large_vector, BENCH_LARGE_COUNT,
+                                          bench_transform),
+            BENCH_LARGE_COUNT)
+BENCH_LARGE(vector_parallel_transform_array,
+            vector_parallel_transform_array(bench_large_vector_out, bench_large_vector, BENCH_LARGE_COUNT,
+                                            bench_transform),
+            BENCH_LARGE_COUNT)
+BENCH_LARGE(matrix_batch_mul_chain_large,
+            matrix_batch_mul_chain(bench_large_matrix_out, bench_large_matrix, bench_large_parent,
+                                   BENCH_LARGE_MATRICES),
+            BENCH_LARGE_MATRICES)
+BENCH_LARGE(matrix_parallel_mul_chain,
+            matrix_parallel_mul_chain(bench_large_matrix_out, bench_large_matrix, bench_large_parent,
+                                      BENCH_LARGE_MATRICES),
+            BENCH_LARGE_MATRICES)
+
+#define BENCH_ENTRY(name) {#name, bench_##name##_throughput, bench_##name##_latency, BENCH_MODE_SINGLE}
+#define BENCH_BATCH_ENTRY(name) {#name, bench_##name, 0, BENCH_MODE_BATCH}
+#define BENCH_ARRAY_ENTRY(name) {#name, bench_##name, 0, BENCH_MODE_SINGLE}
+#define BENCH_PARALLEL_ENTRY(name) {#name, bench_##name, 0, BENCH_MODE_PARALLEL}
+
+static const bench_t bench_list[] = {BENCH_ENTRY(vector_add),
+                                     BENCH_ENTRY(vector_mul),
+                                     BENCH_ENTRY(vector_div),
+                                     BENCH_ENTRY(vector_muladd),
+                                     BENCH_ENTRY(vector_dot),
+                                     BENCH_ENTRY(vector_dot3),
+                                     BENCH_ENTRY(vector_cross3),
+                                     BENCH_ENTRY(vector_normalize),
+                                     BENCH_ENTRY(vector_normalize_fast),
+                                     BENCH_ENTRY(vector_normalize3),
+                                     BENCH_ENTRY(vector_normalize3_fast),
+                                     BENCH_ENTRY(vector_length),
+                                     BENCH_ENTRY(vector_length_fast),
+                                     BENCH_ENTRY(vector_length3),
+                                     BENCH_ENTRY(vector_sqrt),
+                                     BENCH_ENTRY(vector_rsqrt_fast),
+                                     BENCH_ENTRY(vector_reciprocal_fast),
+                                     BENCH_ENTRY(vector_sin),
+                                     BENCH_ENTRY(vector_sin_fast),
+                                     BENCH_ENTRY(vector_acos),
+                                     BENCH_ENTRY(vector_atan2),
+                                     BENCH_ENTRY(vector_exp),
+                                     BENCH_ENTRY(vector_exp_fast),
+                                     BENCH_ENTRY(vector_log),
+                                     BENCH_ENTRY(vector_log_fast),
+                                     BENCH_ENTRY(vector_shuffle),
+                                     BENCH_ENTRY(vector_rotate),
+                                     BENCH_ENTRY(vector_transform),
+                                     BENCH_ENTRY(quaternion_mul),
+                                     BENCH_ENTRY(quaternion_normalize),
+                                     BENCH_ENTRY(quaternion_slerp),
+                                     BENCH_ENTRY(quaternion_nlerp),
+                                     BENCH_ENTRY(quaternion_rotate),
+                                     BENCH_ENTRY(euler_angles_to_quaternion),
+                                     BENCH_ENTRY(matrix_mul),
+                                     BENCH_ENTRY(matrix_transpose),
+                                     BENCH_ENTRY(matrix_inverse),
+                                     BENCH_ENTRY(matrix_inverse_orthonormal),
+                                     BENCH_BATCH_ENTRY(vector_batch_rotate),
+                                     BENCH_BATCH_ENTRY(vector_batch_transform),
+                                     BENCH_BATCH_ENTRY(matrix_batch_mul),
+                                     BENCH_BATCH_ENTRY(matrix_batch_mul_chain),
+                                     BENCH_BATCH_ENTRY(quaternion_batch_slerp),
+                                     BENCH_BATCH_ENTRY(quaternion_batch_nlerp),
+                                     BENCH_BATCH_ENTRY(dual_quaternion_batch_skin),
+                                     BENCH_BATCH_ENTRY(frustum_batch_cull_aabbs),
+                                     BENCH_BATCH_ENTRY(frustum_batch_cull_spheres),
+                                     BENCH_BATCH_ENTRY(ray_batch_intersect_triangle),
+                                     BENCH_BATCH_ENTRY(spline_batch_evaluate),
+                                     BENCH_ARRAY_ENTRY(euler_angles_to_quaternion_array),
+                                     BENCH_ARRAY_ENTRY(vector_load_half_array),
+                                     BENCH_ARRAY_ENTRY(vector_store_half_array),
+                                     BENCH_ARRAY_ENTRY(vector_load_snorm16_array),
+                                     BENCH_ARRAY_ENTRY(vector_store_snorm16_array),
+                                     BENCH_ARRAY_ENTRY(vector_unpack_snorm1010102_array),
+                                     BENCH_ARRAY_ENTRY(vector_pack_snorm1010102_array),
+                                     BENCH_ARRAY_ENTRY(vector_load3_array),
+                                     BENCH_ARRAY_ENTRY(vector_store3_array),
+                                     BENCH_ARRAY_ENTRY(quaternion_load_smallest3_array),
+                                     BENCH_ARRAY_ENTRY(quaternion_store_smallest3_array),
+                                     BENCH_ARRAY_ENTRY(aabb_from_points),
+                                     BENCH_ARRAY_ENTRY(sphere_from_points),
+                                     BENCH_ARRAY_ENTRY(vector_transform_view),
+                                     BENCH_ARRAY_ENTRY(vector_convert_view),
+                                     BENCH_ARRAY_ENTRY(aabb_from_view),
+                                     BENCH_PARALLEL_ENTRY(vector_batch_transform_large),
+                                     BENCH_PARALLEL_ENTRY(vector_batch_transform_stream),
+                                     BENCH_PARALLEL_ENTRY(vector_parallel_transform_array),
+                                     BENCH_PARALLEL_ENTRY(matrix_batch_mul_chain_large),
+                                     BENCH_PARALLEL_ENTRY(matrix_parallel_mul_chain)};
+
+static void
+bench_initialize_data(void) {
+	for (size_t i = 0; i < BENCH_COUNT; ++i) {
+		const real f = (real)i / (real)BENCH_COUNT;
+		bench_vector[i] = vector(REAL_C(0.5) + f, REAL_C(1.0) - f, REAL_C(0.25) + f * f, REAL_C(1.0));
+		bench_quaternion[i] = quaternion_normalize(quaternion_scalar(f, REAL_C(0.5), REAL_C(1.0) - f, REAL_C(0.8)));
+		bench_factor[i] = f;
+		bench_euler[i] = euler_angles(f, REAL_C(0.5) * f, REAL_C(1.0) - f, EULER_XYZs);
+		bench_matrix[i] = matrix_from_quaternion(bench_quaternion[i]);
+		bench_matrix[i].row[3] = vector(f, REAL_C(2.0) * f, REAL_C(-1.0), REAL_C(1.0));
+		bench_parent[i] = i ? (int32_t)((i - 1) / 2) : -1;
+		bench_bone_weight[i] = vector(REAL_C(0.4), REAL_C(0.3), REAL_C(0.2), REAL_C(0.1));
+		for (size_t j = 0; j < 4; ++j)
+			bench_bone_index[i * 4 + j] = (uint16_t)((i * 7 + j * 5) % BENCH_BONES);
+	}
+	for (size_t i = 0; i < BENCH_BONES; ++i)
+		bench_bone[i] = dual_quaternion(bench_quaternion[i * 13], vector((real)i, REAL_C(1.0), REAL_C(-2.0), 0));
+	vector_store_half_array(bench_packed16, bench_vector, BENCH_COUNT);
+	vector_pack_snorm1010102_array(bench_packed32, bench_vector, BENCH_COUNT);
+	for (size_t i = 0; i < BENCH_COUNT; i += 4) {
+		aabb_t box[4];
+		for (size_t j = 0; j < 4; ++j)
+			box[j] = aabb(vector_sub(bench_vector[i + j], vector_uniform(REAL_C(0.1))),
+			              vector_add(bench_vector[i + j], vector_uniform(REAL_C(0.1))));
+		aabb_soa_load_array(bench_aabb + i / 4, box, 4);
+	}
+	vector_soa_load_array(bench_sphere, bench_vector, BENCH_COUNT);
+	const vector_t ray_origin[4] = {vector_zero(), vector_zero(), vector_zero(), vector_zero()};
+	for (size_t i = 0; i < BENCH_COUNT; i += 4)
+		bench_ray[i / 4] = ray_soa_load(ray_origin, bench_vector + i);
+	for (size_t i = 0; i < BENCH_COUNT; ++i)
+		bench_distance[i] = REAL_C(100.0);
+	// Tracks grouped by interpolation type over shared keys, evaluated at times spread over the keys
+	for (size_t i = 0; i < BENCH_SPLINE_KEYS; ++i)
+		bench_spline_key_time[i] = (real)i;
+	spline_squad_controls(bench_spline_inner, bench_quaternion, BENCH_SPLINE_KEYS);
+	for (size_t i = 0; i < BENCH_COUNT; ++i) {
+		spline_t* spline = bench_spline + i;
+		spline->time = bench_spline_key_time;
+		spline->value = bench_vector;
+		spline->control = bench_vector + BENCH_SPLINE_KEYS;
+		spline->count = BENCH_SPLINE_KEYS;
+		spline->type = (spline_type_t)((i * 4) / BENCH_COUNT);
+		if (spline->type == SPLINE_SQUAD) {
+			spline->value = bench_quaternion;
+			spline->control = bench_spline_inner;
+		}
+		bench_spline_time[i] = bench_factor[i] * (real)(BENCH_SPLINE_KEYS - 1);
+	}
+	// Orthographic volume around part of the data set, to get a mix of visible and culled volumes
+	bench_frustum = frustum_from_matrix(matrix_mul(matrix_translation(vector(REAL_C(-1.0), REAL_C(-0.5), 0, 0)),
+	                                               matrix_scaling(vector(REAL_C(4.0), REAL_C(4.0), REAL_C(1.0), 1))));
+	// Constant close to identity for each operation type to keep the latency chains in range
+	bench_constant = quaternion_normalize(quaternion_scalar(REAL_C(0.01), REAL_C(0.02), REAL_C(0.03), REAL_C(1.0)));
+	bench_transform = matrix_from_quaternion(bench_constant);
+
+	// Many small hierarchies of 64 nodes for the parallel hierarchy propagation
+	bench_large_vector = memory_allocate(HASH_TOOL, sizeof(vector_t) * BENCH_LARGE_COUNT, 16, MEMORY_PERSISTENT);
+	bench_large_vector_out = memory_allocate(HASH_TOOL, sizeof(vector_t) * BENCH_LARGE_COUNT, 16, MEMORY_PERSISTENT);
+	bench_large_matrix = memory_allocate(HASH_TOOL, sizeof(matrix_t) * BENCH_LARGE_MATRICES, 16, MEMORY_PERSISTENT);
+	bench_large_matrix_out =
+	    memory_allocate(HASH_TOOL, sizeof(matrix_t) * BENCH_LARGE_MATRICES, 16, MEMORY_PERSISTENT);
+	bench_large_parent = memory_allocate(HASH_TOOL, sizeof(int32_t) * BENCH_LARGE_MATRICES, 0, MEMORY_PERSISTENT);
+	for (size_t i = 0; i < BENCH_LARGE_COUNT; ++i)
+		bench_large_vector[i] = bench_vector[i % BENCH_COUNT];
+	for (size_t i = 0; i < BENCH_LARGE_MATRICES; ++i) {
+		const size_t node = i % 64;
+		bench_large_matrix[i] = bench_matrix[i % BENCH_COUNT];
+		bench_large_parent[i] = node ? (int32_t)(i - node + (node - 1) / 2) : -1;
+	}
+}
+
+static void
+bench_finalize_data(void) {
+	memory_deallocate(bench_large_vector);
+	memory_deallocate(bench_large_vector_out);
+	memory_deallocate(bench_large_matrix);
+	memory_deallocate(bench_large_matrix_out);
+	memory_deallocate(bench_large_parent);
+}
+
+//! Best time in nanoseconds per operation over a number of samples, each sample run
+//! for enough rounds to take at least a few milliseconds
+static double
+bench_measure(bench_fn fn) {
+	const tick_t min_ticks = time_ticks_per_second() / 200;
+	size_t rounds = 1;
+	tick_t start = time_current();
+	fn(rounds);
+	while (time_diff(start, time_current()) < min_ticks) {
+		rounds *= 2;
+		start = time_current();
+		fn(rounds);
+	}
+
+	double best = 0;
+	for (int sample = 0; sample < BENCH_SAMPLES; ++sample) {
+		start = time_current();
+		const size_t ops = fn(rounds);
+		const double ns = (double)time_ticks_to_seconds(time_diff(start, time_current())) * 1e9 / (double)ops;
+		if (!sample || (ns < best))
+			best = ns;
+	}
+	return best;
+}
+
+static void
+bench_report(const char* name, const char* isa, double throughput, double latency) {
+	const bool has_latency = (latency > 0);
+	if (bench_format == BENCH_FORMAT_JSON) {
+		if (has_latency)
+			log_infof(HASH_TOOL,
+			          STRING_CONST("%s    {\"name\": \"%s\", \"backend\": \"%s\", \"isa\": \"%s\", "
+			                       "\"throughput_ns\": %.3f, \"latency_ns\": %.3f}"),
+			          bench_reported ? "," : "", name, bench_backend(), isa, throughput, latency);
+		else
+			log_infof(HASH_TOOL,
+			          STRING_CONST("%s    {\"name\": \"%s\", \"backend\": \"%s\", \"isa\": \"%s\", "
+			                       "\"throughput_ns\": %.3f, \"latency_ns\": null}"),
+			          bench_reported ? "," : "", name, bench_backend(), isa, throughput);
+	} else if (bench_format == BENCH_FORMAT_CSV) {
+		if (has_latency)
+			log_infof(HASH_TOOL, STRING_CONST("%s,%s,%s,%.3f,%.3f"), name, bench_backend(), isa, throughput, latency);
+		else
+			log_infof(HASH_TOOL, STRING_CONST("%s,%s,%s,%.3f,"), name, bench_backend(), isa, throughput);
+	} else {
+		if (has_latency)
+			log_infof(HASH_TOOL, STRING_CONST("%-32s %-9s %10.3f %10.3f"), name, isa, throughput, latency);
+		else
+			log_infof(HASH_TOOL, STRING_CONST("%-32s %-9s %10.3f %10s"), name, isa, throughput, "-");
+	}
+	++bench_reported;
+}
+
+static bool
+bench_included(const char* name) {
+	if (!bench_filter.length)
+		return true;
+	const size_t length = string_length(name);
+	return string_find_string(name, length, STRING_ARGS(bench_filter), 0) != STRING_NPOS;
+}
+
+static void
+bench_parse_command_line(void) {
+	const string_const_t* cmdline = environment_command_line();
+	for (size_t iarg = 1, argsize = array_size(cmdline); iarg < argsize; ++iarg) {
+		if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--json")))
+			bench_format = BENCH_FORMAT_JSON;
+		else if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--csv")))
+			bench_format = BENCH_FORMAT_CSV;
+		else if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--filter")) && (iarg + 1 < argsize))
+			bench_filter = cmdline[++iarg];
+	}
+}
+
+int
+main_initialize(void) {
+	int ret = 0;
+
+	application_t application;
+	memset(&application, 0, sizeof(application));
+	application.name = string_const(STRING_CONST("Vector benchmark"));
+	application.short_name = string_const(STRING_CONST("bench"));
+	application.company = string_const(STRING_CONST(""));
+	application.version = vector_module_version();
+	application.flags = APPLICATION_UTILITY;
+
+	log_enable_prefix(false);
+
+	foundation_config_t config;
+	memset(&config, 0, sizeof(config));
+
+	if ((ret = foundation_initialize(memory_system_malloc(), application, config)) < 0)
+		return ret;
+
+	vector_config_t vector_config;
+	memset(&vector_config, 0, sizeof(vector_config));
+	return vector_module_initialize(vector_config);
+}
+
+int
+main_run(void* main_arg) {
+	FOUNDATION_UNUSED(main_arg);
+
+	log_set_suppress(HASH_TOOL, ERRORLEVEL_DEBUG);
+
+#if VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+	// Flush denormals to zero so decaying latency chains do not hit the slow microcode path
+	_mm_setcsr(_mm_getcsr() | 0x8040);
+#endif
+
+	bench_parse_command_line();
+	bench_initialize_data();
+
+	const vector_isa_t isa_max = vector_module_isa();
+	const size_t bench_list_count = sizeof(bench_list) / sizeof(bench_list[0]);
+
+	if (bench_format == BENCH_FORMAT_JSON)
+		log_infof(HASH_TOOL, STRING_CONST("{\n  \"backend\": \"%s\",\n  \"isa\": \"%s\",\n  \"results\": ["),
+		          bench_backend(), bench_isa_name[isa_max]);
+	else if (bench_format == BENCH_FORMAT_CSV)
+		log_info(HASH_TOOL, STRING_CONST("name,backend,isa,throughput_ns,latency_ns"));
+	else
+		log_infof(HASH_TOOL, STRING_CONST("Backend %s, batch isa %s, time in ns per operation\n%-32s %-9s %10s %10s"),
+		          bench_backend(), bench_isa_name[isa_max], "function", "isa", "throughput", "latency");
+
+	for (size_t ibench = 0; ibench < bench_list_count; ++ibench) {
+		const bench_t* bench = bench_list + ibench;
+		if ((bench->mode == BENCH_MODE_SINGLE) && bench_included(bench->name))
+			bench_report(bench->name, bench_backend(), bench_measure(bench->throughput),
+			             bench->latency ? bench_measure(bench->latency) : 0);
+	}
+
+	// Batch kernels once per instruction set tier up to the best one available
+	vector_config_t config;
+	memset(&config, 0, sizeof(config));
+	for (int isa = vector_module_isa_compiled(); isa <= (int)isa_max; ++isa) {
+		vector_module_finalize();
+		config.isa_limit = (vector_isa_t)isa;
+		if (vector_module_initialize(config) < 0)
+			break;
+		for (size_t ibench = 0; ibench < bench_list_count; ++ibench) {
+			const bench_t* bench = bench_list + ibench;
+			if ((bench->mode == BENCH_MODE_BATCH) && bench_included(bench->name))
+				bench_report(bench->name, bench_isa_name[isa], bench_measure(bench->throughput), 0);
+		}
+	}
+
+	vector_module_finalize();
+	config.isa_limit = VECTOR_ISA_AUTO;
+	config.parallel_workers = system_hardware_threads() - 1;
+	if (vector_module_initialize(config) >= 0) {
+		for (size_t ibench = 0; ibench < bench_list_count; ++ibench) {
+			const bench_t* bench = bench_list + ibench;
+			if ((bench->mode == BENCH_MODE_PARALLEL) && bench_included(bench->name))
+				bench_report(bench->name, bench_isa_name[vector_module_isa()], bench_measure(bench->throughput), 0);
+		}
+	}
+
+	bench_finalize_data();
+
+	if (bench_format == BENCH_FORMAT_JSON)
+		log_info(HASH_TOOL, STRING_CONST("  ]\n}"));
+
+	return 0;
+}
+
+void
+main_finalize(void) {
+	vector_module_finalize();
+	foundation_finalize();
+}
@@ -14,6 +14,10 @@
  *
  */
 
+/* Generates vector/mask.h, or vector/mask_neon.h when run with --neon
+
+   Usage: maskgen [--neon] */
+
 #include <foundation/foundation.h>
 #include <vector/vector.h>
 
@@ -40,36 +44,190 @@ main_initialize(void) {
 	return 0;
 }
 
-int
-main_run(void* main_arg) {
-	const char element[4][2] = {"X", "Y", "Z", "W"};
-	FOUNDATION_UNUSED(main_arg);
+static const char maskgen_element[4][2] = {"X", "Y", "Z", "W"};
 
-	log_set_suppress(HASH_TOOL, ERRORLEVEL_DEBUG);
+//! Two lane result of an operation on the halves of the source vector, expressions for AArch64 and
+//! 32-bit ARM using lo and hi for the low and high halves
+typedef struct maskgen_half_t {
+	int lane[2];
+	int cost;
+	const char* expr[2];
+} maskgen_half_t;
+
+//! Four lane result of a single operation on the source vector
+typedef struct maskgen_full_t {
+	int lane[4];
+	int cost;
+	const char* expr[2];
+} maskgen_full_t;
+
+static const maskgen_half_t maskgen_half[] = {
+    {{0, 1}, 0, {"lo", "lo"}},
+    {{2, 3}, 0, {"hi", "hi"}},
+    {{1, 0}, 1, {"vrev64_f32(lo)", "vrev64_f32(lo)"}},
+    {{3, 2}, 1, {"vrev64_f32(hi)", "vrev64_f32(hi)"}},
+    {{0, 0}, 1, {"vdup_laneq_f32(v, 0)", "vdup_lane_f32(lo, 0)"}},
+    {{1, 1}, 1, {"vdup_laneq_f32(v, 1)", "vdup_lane_f32(lo, 1)"}},
+    {{2, 2}, 1, {"vdup_laneq_f32(v, 2)", "vdup_lane_f32(hi, 0)"}},
+    {{3, 3}, 1, {"vdup_laneq_f32(v, 3)", "vdup_lane_f32(hi, 1)"}},
+    {{1, 2}, 1, {"vext_f32(lo, hi, 1)", "vext_f32(lo, hi, 1)"}},
+    {{3, 0}, 1, {"vext_f32(hi, lo, 1)", "vext_f32(hi, lo, 1)"}},
+    {{0, 2}, 1, {"vtrn1_f32(lo, hi)", "vtrn_f32(lo, hi).val[0]"}},
+    {{1, 3}, 1, {"vtrn2_f32(lo, hi)", "vtrn_f32(lo, hi).val[1]"}},
+    {{2, 0}, 1, {"vtrn1_f32(hi, lo)", "vtrn_f32(hi, lo).val[0]"}},
+    {{3, 1}, 1, {"vtrn2_f32(hi, lo)", "vtrn_f32(hi, lo).val[1]"}},
+    {{2, 1}, 2, {"vrev64_f32(vext_f32(lo, hi, 1))", "vrev64_f32(vext_f32(lo, hi, 1))"}},
+    {{0, 3}, 2, {"vrev64_f32(vext_f32(hi, lo, 1))", "vrev64_f32(vext_f32(hi, lo, 1))"}}};
+
+static const maskgen_full_t maskgen_full[] = {
+    {{0, 1, 2, 3}, 0, {"v", "v"}},
+    {{1, 0, 3, 2}, 1, {"vrev64q_f32(v)", "vrev64q_f32(v)"}},
+    {{1, 2, 3, 0}, 1, {"vextq_f32(v, v, 1)", "vextq_f32(v, v, 1)"}},
+    {{2, 3, 0, 1}, 1, {"vextq_f32(v, v, 2)", "vextq_f32(v, v, 2)"}},
+    {{3, 0, 1, 2}, 1, {"vextq_f32(v, v, 3)", "vextq_f32(v, v, 3)"}},
+    {{0, 0, 1, 1}, 1, {"vzip1q_f32(v, v)", "vzipq_f32(v, v).val[0]"}},
+    {{2, 2, 3, 3}, 1, {"vzip2q_f32(v, v)", "vzipq_f32(v, v).val[1]"}},
+    {{0, 2, 0, 2}, 1, {"vuzp1q_f32(v, v)", "vuzpq_f32(v, v).val[0]"}},
+    {{1, 3, 1, 3}, 1, {"vuzp2q_f32(v, v)", "vuzpq_f32(v, v).val[1]"}},
+    {{0, 0, 2, 2}, 1, {"vtrn1q_f32(v, v)", "vtrnq_f32(v, v).val[0]"}},
+    {{1, 1, 3, 3}, 1, {"vtrn2q_f32(v, v)", "vtrnq_f32(v, v).val[1]"}},
+    {{0, 0, 0, 0}, 1, {"vdupq_laneq_f32(v, 0)", "vdupq_lane_f32(lo, 0)"}},
+    {{1, 1, 1, 1}, 1, {"vdupq_laneq_f32(v, 1)", "vdupq_lane_f32(lo, 1)"}},
+    {{2, 2, 2, 2}, 1, {"vdupq_laneq_f32(v, 2)", "vdupq_lane_f32(hi, 0)"}},
+    {{3, 3, 3, 3}, 1, {"vdupq_laneq_f32(v, 3)", "vdupq_lane_f32(hi, 1)"}}};
+
+#define MASKGEN_HALF_COUNT (sizeof(maskgen_half) / sizeof(maskgen_half[0]))
+#define MASKGEN_FULL_COUNT (sizeof(maskgen_full) / sizeof(maskgen_full[0]))
+
+//! Cost of a table lookup on AArch64, one instruction and a constant register hoisted out of loops
+#define MASKGEN_TABLE_COST 2
+
+//! Instruction sequence for one mask and architecture, a base operation followed by lane copies
+typedef struct maskgen_sequence_t {
+	int cost;
+	bool table;
+	char base[128];
+	int fixup[4];
+} maskgen_sequence_t;
 
+static int
+maskgen_fixups(const int* result, const int* lane, int* fixup) {
+	int count = 0;
+	for (int i = 0; i < 4; ++i) {
+		fixup[i] = (result[i] != lane[i]) ? lane[i] : -1;
+		count += (fixup[i] >= 0) ? 1 : 0;
+	}
+	return count;
+}
+
+//! Find the cheapest sequence of a full width operation, or two half operations combined, followed
+//! by single lane copies from the source. Ties keep the first sequence found, which favors the
+//! simpler forms
+static maskgen_sequence_t
+maskgen_sequence(const int* lane, int arch) {
+	maskgen_sequence_t best;
+	int fixup[4];
+	memset(&best, 0, sizeof(best));
+	best.cost = 1000;
+	for (size_t ifull = 0; ifull < MASKGEN_FULL_COUNT; ++ifull) {
+		const int cost = maskgen_full[ifull].cost + maskgen_fixups(maskgen_full[ifull].lane, lane, fixup);
+		if (cost < best.cost) {
+			best.cost = cost;
+			string_copy(best.base, sizeof(best.base), maskgen_full[ifull].expr[arch],
+			            string_length(maskgen_full[ifull].expr[arch]));
+			memcpy(best.fixup, fixup, sizeof(fixup));
+		}
+	}
+	for (size_t ilow = 0; ilow < MASKGEN_HALF_COUNT; ++ilow) {
+		for (size_t ihigh = 0; ihigh < MASKGEN_HALF_COUNT; ++ihigh) {
+			const maskgen_half_t* low = maskgen_half + ilow;
+			const maskgen_half_t* high = maskgen_half + ihigh;
+			const int result[4] = {low->lane[0], low->lane[1], high->lane[0], high->lane[1]};
+			const int cost = low->cost + high->cost + 1 + maskgen_fixups(result, lane, fixup);
+			if (cost < best.cost) {
+				best.cost = cost;
+				string_format(best.base, sizeof(best.base), STRING_CONST("vcombine_f32(%s, %s)"), low->expr[arch],
+				              high->expr[arch]);
+				memcpy(best.fixup, fixup, sizeof(fixup));
+			}
+		}
+	}
+	if ((arch == 0) && (MASKGEN_TABLE_COST < best.cost)) {
+		best.cost = MASKGEN_TABLE_COST;
+		best.table = true;
+	}
+	return best;
+}
+
+static void
+maskgen_print_sequence(const maskgen_sequence_t* sequence, const int* lane, int arch) {
+	if (sequence->table) {
+		log_infof(HASH_TOOL,
+		          STRING_CONST("\tstatic const uint8_t index[16] = {%d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, "
+		                       "%d, %d, %d, %d};"),
+		          lane[0] * 4, lane[0] * 4 + 1, lane[0] * 4 + 2, lane[0] * 4 + 3, lane[1] * 4, lane[1] * 4 + 1,
+		          lane[1] * 4 + 2, lane[1] * 4 + 3, lane[2] * 4, lane[2] * 4 + 1, lane[2] * 4 + 2, lane[2] * 4 + 3,
+		          lane[3] * 4, lane[3] * 4 + 1, lane[3] * 4 + 2, lane[3] * 4 + 3);
+		log_info(HASH_TOOL, STRING_CONST("\treturn vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), "
+		                                 "vld1q_u8(index)));"));
+		return;
+	}
+	const size_t length = string_length(sequence->base);
+	if (string_find_string(sequence->base, length, STRING_CONST("lo"), 0) != STRING_NPOS)
+		log_info(HASH_TOOL, STRING_CONST("\tconst float32x2_t lo = vget_low_f32(v);"));
+	if (string_find_string(sequence->base, length, STRING_CONST("hi"), 0) != STRING_NPOS)
+		log_info(HASH_TOOL, STRING_CONST("\tconst float32x2_t hi = vget_high_f32(v);"));
+	bool fixed = false;
+	for (int i = 0; i < 4; ++i) {
+		if (sequence->fixup[i] < 0)
+			continue;
+		if (!fixed)
+			log_infof(HASH_TOOL, STRING_CONST("\tvector_t r = %s;"), sequence->base);
+		fixed = true;
+		if (arch == 0)
+			log_infof(HASH_TOOL, STRING_CONST("\tr = vcopyq_laneq_f32(r, %d, v, %d);"), i, sequence->fixup[i]);
+		else
+			log_infof(HASH_TOOL, STRING_CONST("\tr = vsetq_lane_f32(vgetq_lane_f32(v, %d), r, %d);"),
+			          sequence->fixup[i], i);
+	}
+	if (fixed)
+		log_info(HASH_TOOL, STRING_CONST("\treturn r;"));
+	else
+		log_infof(HASH_TOOL, STRING_CONST("\treturn %s;"), sequence->base);
+}
+
+static void
+maskgen_print_license(const char* file) {
+	log_infof(HASH_TOOL,
+	          STRING_CONST("/* %s  -  Vector library  -  Public Domain  -  2013 Mattias Jansson\n"
+	                       " *\n"
+	                       " * This library provides a cross-platform vector math library in C11 providing basic "
+	                       "support data\n"
+	                       " * types and functions to write applications and games in a platform-independent fashion. "
+	                       "The latest\n"
+	                       " * source code is always available at\n"
+	                       " *\n"
+	                       " * https://github.com/mjansson/vector_lib\n"
+	                       " *\n"
+	                       " * This library is built on top of the foundation library available at\n"
+	                       " *\n"
+	                       " * https://github.com/mjansson/foundation_lib\n"
+	                       " *\n"
+	                       " * This library is put in the public domain; you can redistribute it and/or modify it "
+	                       "without any\n"
+	                       " * restrictions.\n"
+	                       " *\n"
+	                       " */\n\n"
+	                       "#pragma once\n"),
+	          file);
+}
+
+//! Generate mask.h with the mask definitions and the portable per-mask shuffles
+static void
+maskgen_masks(void) {
+	maskgen_print_license("mask.h");
 	log_info(HASH_TOOL,
-	         STRING_CONST("/* mask.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson\n"
-	                      " *\n"
-	                      " * This library provides a cross-platform vector math library in C11 providing basic "
-	                      "support data types and\n"
-	                      " * functions to write applications and games in a platform-independent fashion. The latest "
-	                      "source code is\n"
-	                      " * always available at\n"
-	                      " *\n"
-	                      " * https://github.com/mjansson/vector_lib\n"
-	                      " *\n"
-	                      " * This library is built on top of the foundation library available at\n"
-	                      " *\n"
-	                      " * https://github.com/mjansson/foundation_lib\n"
-	                      " *\n"
-	                      " * This library is put in the public domain; you can redistribute it and/or modify it "
-	                      "without any restrictions.\n"
-	                      " *\n"
-	                      "*/\n\n"
-
-	                      "#pragma once\n\n"
-
-	                      "/*! \\file math/mask.h\n"
+	         STRING_CONST("/*! \\file math/mask.h\n"
 	                      "    Vector mask definitions */\n\n"
 
 	                      "#include <vector/types.h>\n\n"
@@ -89,7 +247,121 @@ main_run(void* main_arg) {
 			for (int e2 = 0; e2 < 4; ++e2)
 				for (int e3 = 0; e3 < 4; ++e3)
 					log_infof(HASH_TOOL, STRING_CONST("#define VECTOR_MASK_%s%s%s%s VECTOR_MASK(%d, %d, %d, %d)"),
-					          element[e0], element[e1], element[e2], element[e3], e0, e1, e2, e3);
+					          maskgen_element[e0], maskgen_element[e1], maskgen_element[e2], maskgen_element[e3],
+					          e0, e1, e2, e3);
+
+	log_info(HASH_TOOL,
+	         STRING_CONST("\n/* Shuffles specialized per mask, vector_shuffle_abcd(v) is equal to\n"
+	                      "   vector_shuffle(v, VECTOR_MASK_abcd) but compiles to a fixed instruction sequence\n"
+	                      "   chosen for the mask. On SSE this is an immediate pshufd, the NEON sequences are\n"
+	                      "   generated by maskgen --neon into mask_neon.h, which also routes vector_shuffle\n"
+	                      "   with a constant mask to them */\n"
+	                      "#if VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2\n"
+	                      "#define VECTOR_SHUFFLE_IMMEDIATE(v, mask) "
+	                      "_mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(v), mask))\n"
+	                      "#elif !VECTOR_IMPLEMENTATION_NEON\n"
+	                      "#define VECTOR_SHUFFLE_IMMEDIATE(v, mask) vector_shuffle(v, mask)\n"
+	                      "#endif\n\n"
+	                      "#if !VECTOR_IMPLEMENTATION_NEON"));
+
+	for (int e0 = 0; e0 < 4; ++e0)
+		for (int e1 = 0; e1 < 4; ++e1)
+			for (int e2 = 0; e2 < 4; ++e2)
+				for (int e3 = 0; e3 < 4; ++e3)
+					log_infof(HASH_TOOL,
+					          STRING_CONST("#define vector_shuffle_%s%s%s%s(v) VECTOR_SHUFFLE_IMMEDIATE(v, "
+					                       "VECTOR_MASK_%s%s%s%s)"),
+					          maskgen_element[e0], maskgen_element[e1], maskgen_element[e2], maskgen_element[e3],
+					          maskgen_element[e0], maskgen_element[e1], maskgen_element[e2], maskgen_element[e3]);
+
+	log_info(HASH_TOOL, STRING_CONST("#endif"));
+}
+
+//! Generate mask_neon.h with the per-mask NEON shuffles and the shuffle dispatching on the mask
+static void
+maskgen_neon(void) {
+	maskgen_print_license("mask_neon.h");
+	log_info(HASH_TOOL,
+	         STRING_CONST("/*! \\file mask_neon.h\n"
+	                      "    NEON shuffles specialized per mask, generated by maskgen --neon. Each mask maps to\n"
+	                      "    the cheapest of a single permute (rev64, ext, zip, uzp, trn, dup), two half vector\n"
+	                      "    permutes combined, or one of those followed by single lane copies, and to a table\n"
+	                      "    lookup on AArch64 when that is cheaper */\n\n"
+	                      "#include <vector/types.h>\n"
+	                      "#include <vector/mask.h>\n"));
+
+	for (int e0 = 0; e0 < 4; ++e0) {
+		for (int e1 = 0; e1 < 4; ++e1) {
+			for (int e2 = 0; e2 < 4; ++e2) {
+				for (int e3 = 0; e3 < 4; ++e3) {
+					const int lane[4] = {e0, e1, e2, e3};
+					const maskgen_sequence_t seq64 = maskgen_sequence(lane, 0);
+					const maskgen_sequence_t seq32 = maskgen_sequence(lane, 1);
+					const bool same = !seq64.table && string_equal(seq64.base, string_length(seq64.base), seq32.base,
+					                                               string_length(seq32.base));
+					bool same_fixup = same;
+					for (int i = 0; i < 4; ++i)
+						same_fixup = same_fixup && (seq64.fixup[i] < 0) && (seq32.fixup[i] < 0);
+					log_infof(HASH_TOOL,
+					          STRING_CONST("static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t\n"
+					                       "vector_shuffle_%s%s%s%s(const vector_t v) {"),
+					          maskgen_element[e0], maskgen_element[e1], maskgen_element[e2], maskgen_element[e3]);
+					if (same_fixup) {
+						maskgen_print_sequence(&seq64, lane, 0);
+					} else {
+						log_info(HASH_TOOL, STRING_CONST("#if defined(__aarch64__)"));
+						maskgen_print_sequence(&seq64, lane, 0);
+						log_info(HASH_TOOL, STRING_CONST("#else"));
+						maskgen_print_sequence(&seq32, lane, 1);
+						log_info(HASH_TOOL, STRING_CONST("#endif"));
+					}
+					log_info(HASH_TOOL, STRING_CONST("}\n"));
+				}
+			}
+		}
+	}
+
+	log_info(HASH_TOOL,
+	         STRING_CONST("//! Shuffle by mask, folded to the specialized shuffle when the mask is a compile time\n"
+	                      "//! constant, see vector_shuffle\n"
+	                      "static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t\n"
+	                      "vector_shuffle_specialized(const vector_t v, const unsigned int mask) {\n"
+	                      "\tswitch (mask & 0xFF) {"));
+	for (int e0 = 0; e0 < 4; ++e0)
+		for (int e1 = 0; e1 < 4; ++e1)
+			for (int e2 = 0; e2 < 4; ++e2)
+				for (int e3 = 0; e3 < 4; ++e3) {
+					if ((e0 == 0) && (e1 == 1) && (e2 == 2) && (e3 == 3))
+						continue;
+					log_infof(HASH_TOOL,
+					          STRING_CONST("\t\tcase VECTOR_MASK_%s%s%s%s:\n\t\t\treturn vector_shuffle_%s%s%s%s(v);"),
+					          maskgen_element[e0], maskgen_element[e1], maskgen_element[e2], maskgen_element[e3],
+					          maskgen_element[e0], maskgen_element[e1], maskgen_element[e2], maskgen_element[e3]);
+				}
+	log_info(HASH_TOOL, STRING_CONST("\t\tdefault:\n"
+	                                 "\t\t\tbreak;\n"
+	                                 "\t}\n"
+	                                 "\treturn v;\n"
+	                                 "}"));
+}
+
+int
+main_run(void* main_arg) {
+	bool neon = false;
+	FOUNDATION_UNUSED(main_arg);
+
+	log_set_suppress(HASH_TOOL, ERRORLEVEL_DEBUG);
+
+	const string_const_t* cmdline = environment_command_line();
+	for (size_t iarg = 1, argsize = array_size(cmdline); iarg < argsize; ++iarg) {
+		if (string_equal(STRING_ARGS(cmdline[iarg]), STRING_CONST("--neon")))
+			neon = true;
+	}
+
+	if (neon)
+		maskgen_neon();
+	else
+		maskgen_masks();
 
 	return 0;
 }
@@ -0,0 +1,112 @@
+/* arena.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data types and
+ * functions to write applications and games in a platform-independent fashion. The latest source code is
+ * always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any restrictions.
+ *
+ */
+
+
+#include <foundation/foundation.h>
+
+#include <vector/vector.h>
+#include <vector/internal.h>
+
+#define VECTOR_ARENA_DEFAULT_SIZE (256 * 1024)
+
+typedef struct vector_arena_overflow_t vector_arena_overflow_t;
+
+//! Header of an overflow block, the allocated block follows at the next alignment boundary
+struct vector_arena_overflow_t {
+	vector_arena_overflow_t* next;
+};
+
+static vector_arena_t vector_frame;
+
+int
+vector_arena_initialize(vector_arena_t* arena, size_t capacity) {
+	memset(arena, 0, sizeof(vector_arena_t));
+	capacity = (capacity + (VECTOR_ARENA_ALIGNMENT - 1)) & ~(size_t)(VECTOR_ARENA_ALIGNMENT - 1);
+	if (capacity < VECTOR_ARENA_ALIGNMENT)
+		capacity = VECTOR_ARENA_ALIGNMENT;
+	arena->memory = memory_allocate(HASH_VECTOR, capacity, VECTOR_ARENA_ALIGNMENT, MEMORY_PERSISTENT);
+	if (!arena->memory)
+		return -1;
+	arena->capacity = capacity;
+	return 0;
+}
+
+static void
+vector_arena_release_overflow(vector_arena_t* arena) {
+	vector_arena_overflow_t* overflow = arena->overflow;
+	while (overflow) {
+		vector_arena_overflow_t* next = overflow->next;
+		memory_deallocate(overflow);
+		overflow = next;
+	}
+	arena->overflow = 0;
+	arena->overflow_size = 0;
+}
+
+void
+vector_arena_finalize(vector_arena_t* arena) {
+	vector_arena_release_overflow(arena);
+	memory_deallocate(arena->memory);
+	memset(arena, 0, sizeof(vector_arena_t));
+}
+
+void*
+vector_arena_allocate_overflow(vector_arena_t* arena, size_t size) {
+	vector_arena_overflow_t* overflow =
+	    memory_allocate(HASH_VECTOR, VECTOR_ARENA_ALIGNMENT + size, VECTOR_ARENA_ALIGNMENT, MEMORY_PERSISTENT);
+	if (!overflow)
+		return 0;
+	overflow->next = arena->overflow;
+	arena->overflow = overflow;
+	arena->overflow_size += size;
+	if (arena->used + arena->overflow_size > arena->peak)
+		arena->peak = arena->used + arena->overflow_size;
+	return (char*)overflow + VECTOR_ARENA_ALIGNMENT;
+}
+
+void
+vector_arena_reset(vector_arena_t* arena) {
+	if (arena->used > arena->peak)
+		arena->peak = arena->used;
+	arena->used = 0;
+	if (!arena->overflow)
+		return;
+
+	// Grow the buffer to hold everything allocated since the previous reset, the old buffer holds
+	// no live blocks at this point so the contents do not need to be preserved
+	vector_arena_release_overflow(arena);
+	void* memory = memory_allocate(HASH_VECTOR, arena->peak, VECTOR_ARENA_ALIGNMENT, MEMORY_PERSISTENT);
+	if (memory) {
+		memory_deallocate(arena->memory);
+		arena->memory = memory;
+		arena->capacity = arena->peak;
+	}
+}
+
+vector_arena_t*
+vector_frame_arena(void) {
+	return &vector_frame;
+}
+
+int
+vector_frame_arena_initialize(const vector_config_t config) {
+	return vector_arena_initialize(&vector_frame, config.arena_size ? config.arena_size : VECTOR_ARENA_DEFAULT_SIZE);
+}
+
+void
+vector_frame_arena_finalize(void) {
+	vector_arena_finalize(&vector_frame);
+}
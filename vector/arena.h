@@ -0,0 +1,108 @@
+/* arena.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file arena.h
+    Arena allocator for batch arrays. Every block is aligned to and padded to a multiple of
+    VECTOR_ARENA_ALIGNMENT bytes, which covers the widest SIMD registers and keeps blocks from
+    sharing cache lines, so the aligned load and store paths can always be used on arena arrays.
+    Allocation bumps an offset into one buffer and a reset releases everything at once. When the
+    buffer is exhausted blocks are allocated from the foundation memory system until the next reset,
+    which grows the buffer to the peak usage. Arenas are not thread safe */
+
+#include <foundation/platform.h>
+#include <foundation/types.h>
+
+#include <vector/types.h>
+
+//! Alignment and size granularity of arena blocks, one cache line
+#define VECTOR_ARENA_ALIGNMENT 64
+
+//! Initialize arena with a buffer of the given capacity in bytes, returns 0 if successful and <0 if
+//! the buffer could not be allocated
+VECTOR_API int
+vector_arena_initialize(vector_arena_t* arena, size_t capacity);
+
+//! Release the buffer and any overflow blocks of the arena
+VECTOR_API void
+vector_arena_finalize(vector_arena_t* arena);
+
+//! Allocate block of at least size bytes, aligned to VECTOR_ARENA_ALIGNMENT. The block is valid
+//! until the next reset. Returns null only if the memory system is out of memory
+static FOUNDATION_FORCEINLINE void*
+vector_arena_allocate(vector_arena_t* arena, size_t size);
+
+//! Allocate block when the buffer is exhausted, used by vector_arena_allocate
+VECTOR_API void*
+vector_arena_allocate_overflow(vector_arena_t* arena, size_t size);
+
+//! Release all blocks allocated from the arena. Cost is constant unless the buffer was exhausted
+//! since the previous reset, in which case overflow blocks are released and the buffer is grown
+VECTOR_API void
+vector_arena_reset(vector_arena_t* arena);
+
+//! Allocate array of vectors
+static FOUNDATION_FORCEINLINE vector_t*
+vector_arena_allocate_vectors(vector_arena_t* arena, size_t count);
+
+//! Allocate array of matrices
+static FOUNDATION_FORCEINLINE matrix_t*
+vector_arena_allocate_matrices(vector_arena_t* arena, size_t count);
+
+//! Allocate array of transforms
+static FOUNDATION_FORCEINLINE transform_t*
+vector_arena_allocate_transforms(vector_arena_t* arena, size_t count);
+
+//! Allocate structure-of-arrays groups holding count vectors, rounded up to groups of four
+static FOUNDATION_FORCEINLINE vector_soa_t*
+vector_arena_allocate_soa(vector_arena_t* arena, size_t count);
+
+//! Arena owned by the module with the capacity given in vector_config_t, intended to be reset once
+//! per frame by the thread driving the batch functions
+VECTOR_API vector_arena_t*
+vector_frame_arena(void);
+
+static FOUNDATION_FORCEINLINE void*
+vector_arena_allocate(vector_arena_t* arena, size_t size) {
+	const size_t padded = (size + (VECTOR_ARENA_ALIGNMENT - 1)) & ~(size_t)(VECTOR_ARENA_ALIGNMENT - 1);
+	if (padded <= arena->capacity - arena->used) {
+		void* block = (char*)arena->memory + arena->used;
+		arena->used += padded;
+		return block;
+	}
+	return vector_arena_allocate_overflow(arena, padded);
+}
+
+static FOUNDATION_FORCEINLINE vector_t*
+vector_arena_allocate_vectors(vector_arena_t* arena, size_t count) {
+	return (vector_t*)vector_arena_allocate(arena, sizeof(vector_t) * count);
+}
+
+static FOUNDATION_FORCEINLINE matrix_t*
+vector_arena_allocate_matrices(vector_arena_t* arena, size_t count) {
+	return (matrix_t*)vector_arena_allocate(arena, sizeof(matrix_t) * count);
+}
+
+static FOUNDATION_FORCEINLINE transform_t*
+vector_arena_allocate_transforms(vector_arena_t* arena, size_t count) {
+	return (transform_t*)vector_arena_allocate(arena, sizeof(transform_t) * count);
+}
+
+static FOUNDATION_FORCEINLINE vector_soa_t*
+vector_arena_allocate_soa(vector_arena_t* arena, size_t count) {
+	return (vector_soa_t*)vector_arena_allocate(arena, sizeof(vector_soa_t) * ((count + 3) / 4));
+}
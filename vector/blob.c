@@ -0,0 +1,154 @@
+/* blob.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data types and
+ * functions to write applications and games in a platform-independent fashion. The latest source code is
+ * always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any restrictions.
+ *
+ */
+
+#include <foundation/foundation.h>
+
+#include <vector/vector.h>
+#include <vector/internal.h>
+
+FOUNDATION_STATIC_ASSERT(sizeof(vector_blob_header_t) == 32, "blob header size");
+FOUNDATION_STATIC_ASSERT(sizeof(vector_blob_array_t) == 32, "blob array size");
+
+#if VECTOR_IMPLEMENTATION_SSE4
+#define VECTOR_BLOB_IMPLEMENTATION VECTOR_BLOB_IMPLEMENTATION_SSE4
+#elif VECTOR_IMPLEMENTATION_SSE3
+#define VECTOR_BLOB_IMPLEMENTATION VECTOR_BLOB_IMPLEMENTATION_SSE3
+#elif VECTOR_IMPLEMENTATION_SSE2
+#define VECTOR_BLOB_IMPLEMENTATION VECTOR_BLOB_IMPLEMENTATION_SSE2
+#elif VECTOR_IMPLEMENTATION_NEON
+#define VECTOR_BLOB_IMPLEMENTATION VECTOR_BLOB_IMPLEMENTATION_NEON
+#else
+#define VECTOR_BLOB_IMPLEMENTATION VECTOR_BLOB_IMPLEMENTATION_FALLBACK
+#endif
+
+static const size_t vector_blob_element_sizes[VECTOR_BLOB_TYPE_COUNT] = {
+	0,
+	sizeof(vector_t),
+	sizeof(matrix_t),
+	sizeof(transform_t),
+	sizeof(dual_quaternion_t),
+	sizeof(float32_t),
+	sizeof(uint32_t),
+	sizeof(uint16_t) * 4,
+	sizeof(int16_t) * 4,
+	sizeof(uint32_t),
+	sizeof(uint16_t) * 3
+};
+
+static size_t
+vector_blob_align(size_t size) {
+	return (size + (VECTOR_BLOB_ALIGNMENT - 1)) & ~(size_t)(VECTOR_BLOB_ALIGNMENT - 1);
+}
+
+size_t
+vector_blob_element_size(vector_blob_type_t type) {
+	if ((unsigned int)type >= VECTOR_BLOB_TYPE_COUNT)
+		return 0;
+	return vector_blob_element_sizes[type];
+}
+
+size_t
+vector_blob_write(void* buffer, size_t capacity, const vector_blob_source_t* source, size_t count) {
+	const size_t directory_end = sizeof(vector_blob_header_t) + sizeof(vector_blob_array_t) * count;
+	size_t size = vector_blob_align(directory_end);
+	for (size_t iarr = 0; iarr < count; ++iarr) {
+		const size_t element_size = vector_blob_element_size(source[iarr].type);
+		if (!element_size)
+			return 0;
+		size += vector_blob_align(element_size * source[iarr].count);
+	}
+	if (!buffer || (capacity < size))
+		return size;
+
+	char* data = buffer;
+	vector_blob_header_t* header = buffer;
+	vector_blob_array_t* array = (vector_blob_array_t*)(header + 1);
+	memset(data, 0, vector_blob_align(directory_end));
+	header->magic = VECTOR_BLOB_MAGIC;
+	header->byte_order = VECTOR_BLOB_BYTE_ORDER;
+	header->version = VECTOR_BLOB_VERSION;
+	header->implementation = VECTOR_BLOB_IMPLEMENTATION;
+	header->array_count = (uint32_t)count;
+	header->size = size;
+
+	size_t offset = vector_blob_align(directory_end);
+	for (size_t iarr = 0; iarr < count; ++iarr) {
+		const size_t element_size = vector_blob_element_size(source[iarr].type);
+		const size_t array_size = element_size * source[iarr].count;
+		const size_t padded_size = vector_blob_align(array_size);
+		array[iarr].id = source[iarr].id;
+		array[iarr].type = (uint32_t)source[iarr].type;
+		array[iarr].element_size = (uint32_t)element_size;
+		array[iarr].offset = offset;
+		array[iarr].count = source[iarr].count;
+		if (array_size)
+			memcpy(data + offset, source[iarr].data, array_size);
+		memset(data + offset + array_size, 0, padded_size - array_size);
+		offset += padded_size;
+	}
+	return size;
+}
+
+int
+vector_blob_open(vector_blob_t* blob, const void* buffer, size_t size) {
+	memset(blob, 0, sizeof(vector_blob_t));
+	if (!buffer || ((uintptr_t)buffer & (VECTOR_BLOB_ALIGNMENT - 1)) || (size < sizeof(vector_blob_header_t)))
+		return -1;
+
+	const vector_blob_header_t* header = buffer;
+	if ((header->magic != VECTOR_BLOB_MAGIC) || (header->byte_order != VECTOR_BLOB_BYTE_ORDER) ||
+	    (header->version != VECTOR_BLOB_VERSION) || (header->size > size) ||
+	    (header->size < sizeof(vector_blob_header_t)))
+		return -1;
+
+	// Compare counts instead of sizes so corrupt counts cannot overflow the bounds checks
+	const size_t container_size = (size_t)header->size;
+	const size_t array_count = header->array_count;
+	if (array_count > (container_size - sizeof(vector_blob_header_t)) / sizeof(vector_blob_array_t))
+		return -1;
+
+	const vector_blob_array_t* array = (const vector_blob_array_t*)(header + 1);
+	const size_t directory_end = sizeof(vector_blob_header_t) + sizeof(vector_blob_array_t) * array_count;
+	for (size_t iarr = 0; iarr < array_count; ++iarr) {
+		const size_t element_size = vector_blob_element_size((vector_blob_type_t)array[iarr].type);
+		if (!element_size || (array[iarr].element_size != element_size) ||
+		    (array[iarr].offset & (VECTOR_BLOB_ALIGNMENT - 1)) || (array[iarr].offset < directory_end) ||
+		    (array[iarr].offset > container_size) ||
+		    (array[iarr].count > (container_size - array[iarr].offset) / element_size))
+			return -1;
+	}
+
+	blob->data = buffer;
+	blob->size = container_size;
+	blob->header = header;
+	blob->array = array;
+	blob->array_count = array_count;
+	return 0;
+}
+
+const void*
+vector_blob_array(const vector_blob_t* blob, hash_t id, vector_blob_type_t type, size_t* count) {
+	for (size_t iarr = 0; iarr < blob->array_count; ++iarr) {
+		if ((blob->array[iarr].id == id) && (blob->array[iarr].type == (uint32_t)type)) {
+			if (count)
+				*count = (size_t)blob->array[iarr].count;
+			return (const char*)blob->data + blob->array[iarr].offset;
+		}
+	}
+	if (count)
+		*count = 0;
+	return 0;
+}
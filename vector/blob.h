@@ -0,0 +1,111 @@
+/* blob.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file blob.h
+    Versioned binary container of typed arrays, intended to be memory mapped and used in place.
+    A header and a directory of arrays are followed by the array data, with every array aligned to
+    and padded to a multiple of VECTOR_BLOB_ALIGNMENT bytes from the start of the container. When
+    the container itself is loaded or mapped at an aligned address (any page aligned mapping) the
+    arrays can be passed directly to the batch functions without parsing or copying. Quantized
+    arrays are decoded with the array functions of pack.h. Containers are stored in the byte order
+    of the writer and can only be opened on a platform of the same byte order */
+
+#include <foundation/platform.h>
+#include <foundation/types.h>
+
+#include <vector/types.h>
+
+//! Alignment of the container and of each array in it, one cache line
+#define VECTOR_BLOB_ALIGNMENT 64
+
+//! Magic number in the header, the characters "VBLB" when stored in little endian byte order
+#define VECTOR_BLOB_MAGIC 0x424C4256U
+
+//! Byte order marker in the header
+#define VECTOR_BLOB_BYTE_ORDER 0x01020304U
+
+//! Version of the container layout
+#define VECTOR_BLOB_VERSION 1
+
+//! Implementation tags in the header
+#define VECTOR_BLOB_IMPLEMENTATION_FALLBACK 0
+#define VECTOR_BLOB_IMPLEMENTATION_SSE2 1
+#define VECTOR_BLOB_IMPLEMENTATION_SSE3 2
+#define VECTOR_BLOB_IMPLEMENTATION_SSE4 3
+#define VECTOR_BLOB_IMPLEMENTATION_NEON 4
+
+//! Size in bytes of one element of the given type, 0 if the type is invalid
+VECTOR_API size_t
+vector_blob_element_size(vector_blob_type_t type);
+
+//! Write container with the given arrays to the buffer, which must be aligned to
+//! VECTOR_BLOB_ALIGNMENT. Returns the size of the container in bytes, which is also returned
+//! without writing anything if the buffer is null or the capacity is too small. Padding between
+//! arrays is zeroed so the same arrays always give the same bytes. Returns 0 if a source array has
+//! an invalid type
+VECTOR_API size_t
+vector_blob_write(void* buffer, size_t capacity, const vector_blob_source_t* source, size_t count);
+
+//! Open container stored in the buffer of the given size in bytes, without copying. The buffer
+//! must be aligned to VECTOR_BLOB_ALIGNMENT. Returns 0 if successful and <0 if the buffer is not a
+//! container of this version and byte order, or if the directory or any array does not fit in
+//! the buffer
+VECTOR_API int
+vector_blob_open(vector_blob_t* blob, const void* buffer, size_t size);
+
+//! Find first array with the given identifier and type. Returns a pointer to the first element in
+//! the container buffer and stores the number of elements in count (if not null), or returns null
+//! and stores 0 if there is no such array
+VECTOR_API const void*
+vector_blob_array(const vector_blob_t* blob, hash_t id, vector_blob_type_t type, size_t* count);
+
+//! Find array of vectors, see vector_blob_array
+static FOUNDATION_FORCEINLINE const vector_t*
+vector_blob_vectors(const vector_blob_t* blob, hash_t id, size_t* count);
+
+//! Find array of matrices, see vector_blob_array
+static FOUNDATION_FORCEINLINE const matrix_t*
+vector_blob_matrices(const vector_blob_t* blob, hash_t id, size_t* count);
+
+//! Find array of transforms, see vector_blob_array
+static FOUNDATION_FORCEINLINE const transform_t*
+vector_blob_transforms(const vector_blob_t* blob, hash_t id, size_t* count);
+
+//! Find array of dual quaternions, see vector_blob_array
+static FOUNDATION_FORCEINLINE const dual_quaternion_t*
+vector_blob_dual_quaternions(const vector_blob_t* blob, hash_t id, size_t* count);
+
+static FOUNDATION_FORCEINLINE const vector_t*
+vector_blob_vectors(const vector_blob_t* blob, hash_t id, size_t* count) {
+	return (const vector_t*)vector_blob_array(blob, id, VECTOR_BLOB_VECTOR, count);
+}
+
+static FOUNDATION_FORCEINLINE const matrix_t*
+vector_blob_matrices(const vector_blob_t* blob, hash_t id, size_t* count) {
+	return (const matrix_t*)vector_blob_array(blob, id, VECTOR_BLOB_MATRIX, count);
+}
+
+static FOUNDATION_FORCEINLINE const transform_t*
+vector_blob_transforms(const vector_blob_t* blob, hash_t id, size_t* count) {
+	return (const transform_t*)vector_blob_array(blob, id, VECTOR_BLOB_TRANSFORM, count);
+}
+
+static FOUNDATION_FORCEINLINE const dual_quaternion_t*
+vector_blob_dual_quaternions(const vector_blob_t* blob, hash_t id, size_t* count) {
+	return (const dual_quaternion_t*)vector_blob_array(blob, id, VECTOR_BLOB_DUAL_QUATERNION, count);
+}
@@ -0,0 +1,164 @@
+/* bounds.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file bounds.h
+    Planes, bounding volumes and frustum tests. Plane normals are unit length for distances to
+    be in world units. Frustum tests are conservative, a volume is only rejected if it is fully
+    outside one of the planes, and volumes touching a plane are visible. Cull functions write
+    one bit per volume (bit i & 31 of word i / 32), set for visible volumes. Bits past count in
+    the last word are cleared. Ray functions test packets of four rays in ray_soa_t against one
+    primitive and return a lane mask of hits as the vector comparison functions, with the
+    distance along each ray in the distance output */
+
+#include <vector/types.h>
+#include <vector/vector.h>
+#include <vector/quaternion.h>
+#include <vector/matrix.h>
+#include <vector/soa.h>
+#include <vector/transform.h>
+
+//! Plane from normal and point on plane, normal must be unit length
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL plane_t
+plane(const vector_t normal, const vector_t point);
+
+//! Plane through three points, normal points towards the side where the points wind counter-clockwise
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL plane_t
+plane_from_points(const vector_t p0, const vector_t p1, const vector_t p2);
+
+//! Scale plane to unit length normal
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL plane_t
+plane_normalize(const plane_t p);
+
+//! Signed distance from plane to point in all components, positive on the side the normal points to
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+plane_distance(const plane_t p, const vector_t point);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL sphere_t
+sphere(const vector_t center, const real radius);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL aabb_t
+aabb(const vector_t min, const vector_t max);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+aabb_center(const aabb_t box);
+
+//! Half size of box along each axis
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+aabb_extent(const aabb_t box);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL obb_t
+obb(const vector_t center, const vector_t extent, const quaternion_t rotation);
+
+//! Bounding box of count points with xyz components at the start of each stride bytes in the
+//! buffer. Stride must be at least 12 bytes, there are no alignment requirements. A zero box
+//! is returned for no points
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL aabb_t
+aabb_from_points(const float32_t* points, size_t stride, size_t count);
+
+//! Bounding sphere of points in a strided buffer as for aabb_from_points, by Ritter's method. The
+//! sphere is not minimal, typically within 5-20% larger than the minimal radius
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL sphere_t
+sphere_from_points(const float32_t* points, size_t stride, size_t count);
+
+//! Transpose an array of boxes into (count + 3) / 4 structure-of-arrays blocks. Unused lanes in
+//! the last block are set to zero
+static FOUNDATION_FORCEINLINE void
+aabb_soa_load_array(aabb_soa_t* FOUNDATION_RESTRICT out, const aabb_t* FOUNDATION_RESTRICT in, size_t count);
+
+//! Extract frustum planes from a view projection matrix, mapping points to clip space with
+//! x and y in [-w, w] and z in [0, w]. Planes are normalized
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL frustum_t
+frustum_from_matrix(const matrix_t view_projection);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_point(const frustum_t* frustum, const vector_t point);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_sphere(const frustum_t* frustum, const sphere_t s);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_aabb(const frustum_t* frustum, const aabb_t box);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_obb(const frustum_t* frustum, const obb_t box);
+
+//! Test (count + 3) / 4 blocks of boxes against the frustum, writing (count + 31) / 32 mask words
+static FOUNDATION_FORCEINLINE void
+frustum_cull_aabbs(uint32_t* FOUNDATION_RESTRICT out_mask, const frustum_t* FOUNDATION_RESTRICT frustum,
+                   const aabb_soa_t* FOUNDATION_RESTRICT aabbs, size_t count);
+
+//! Test (count + 3) / 4 blocks of spheres against the frustum, with center in the x, y and z and
+//! radius in the w member of each block. Writes (count + 31) / 32 mask words
+static FOUNDATION_FORCEINLINE void
+frustum_cull_spheres(uint32_t* FOUNDATION_RESTRICT out_mask, const frustum_t* FOUNDATION_RESTRICT frustum,
+                     const vector_soa_t* FOUNDATION_RESTRICT spheres, size_t count);
+
+//! Four rays from origins and directions in structure-of-arrays layout. Directions are not
+//! required to be unit length, distances are then in units of direction length
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL ray_soa_t
+ray_soa(const vector_soa_t origin, const vector_soa_t direction);
+
+//! Transpose four consecutive origins and directions into a ray packet
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL ray_soa_t
+ray_soa_load(const vector_t* FOUNDATION_RESTRICT origin, const vector_t* FOUNDATION_RESTRICT direction);
+
+//! Moller-Trumbore test against a two sided triangle. Hits are in [0, max_distance), rays
+//! parallel to the triangle plane miss
+static FOUNDATION_FORCEINLINE vectori_t
+ray_soa_intersect_triangle(const ray_soa_t* FOUNDATION_RESTRICT ray, const vector_t v0, const vector_t v1,
+                           const vector_t v2, const vector_t max_distance, vector_t* FOUNDATION_RESTRICT distance);
+
+//! Slab test against a box. Hits are rays entering the box in [0, max_distance], including rays
+//! starting inside the box which get distance zero. Rays with a zero direction component starting
+//! exactly on one of the corresponding box faces are undefined
+static FOUNDATION_FORCEINLINE vectori_t
+ray_soa_intersect_aabb(const ray_soa_t* FOUNDATION_RESTRICT ray, const aabb_t box, const vector_t max_distance,
+                       vector_t* FOUNDATION_RESTRICT distance);
+
+//! Test (count + 3) / 4 ray packets against one triangle. Distance holds count values with the
+//! max distance of each ray on input, replaced by the hit distance for rays hitting the triangle.
+//! Writes (count + 31) / 32 hit mask words
+static FOUNDATION_FORCEINLINE void
+ray_intersect_triangle_array(uint32_t* FOUNDATION_RESTRICT out_mask, real* FOUNDATION_RESTRICT distance,
+                             const ray_soa_t* FOUNDATION_RESTRICT rays, size_t count, const vector_t v0,
+                             const vector_t v1, const vector_t v2);
+
+//! Cull boxes using the implementation selected at module initialization, see frustum_cull_aabbs
+VECTOR_API void
+frustum_batch_cull_aabbs(uint32_t* out_mask, const frustum_t* frustum, const aabb_soa_t* aabbs, size_t count);
+
+//! Cull spheres using the implementation selected at module initialization, see frustum_cull_spheres
+VECTOR_API void
+frustum_batch_cull_spheres(uint32_t* out_mask, const frustum_t* frustum, const vector_soa_t* spheres, size_t count);
+
+//! Ray triangle test using the implementation selected at module initialization, see
+//! ray_intersect_triangle_array
+VECTOR_API void
+ray_batch_intersect_triangle(uint32_t* out_mask, real* distance, const ray_soa_t* rays, size_t count,
+                             const vector_t v0, const vector_t v1, const vector_t v2);
+
+#if VECTOR_IMPLEMENTATION_AVX2
+#include <vector/bounds_avx2.h>
+#elif VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+#include <vector/bounds_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON
+#include <vector/bounds_neon.h>
+#else
+#include <vector/bounds_fallback.h>
+#endif
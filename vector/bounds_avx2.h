@@ -0,0 +1,183 @@
+/* bounds_avx2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+// Eight volumes per iteration, two structure-of-arrays blocks combined in one 256-bit register
+// with the first block in the low lane. An odd last block is paired with itself
+#define VECTOR_BOUNDS_LOAD_AVX2(lo, hi) _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1)
+
+#ifndef VECTOR_HAVE_FRUSTUM_CULL_AABBS
+
+static FOUNDATION_FORCEINLINE void
+frustum_cull_aabbs(uint32_t* FOUNDATION_RESTRICT out_mask, const frustum_t* FOUNDATION_RESTRICT frustum,
+                   const aabb_soa_t* FOUNDATION_RESTRICT aabbs, size_t count) {
+	__m256 plane[6][4];
+	unsigned int corner[6][3];
+	for (int ip = 0; ip < 6; ++ip) {
+		for (int ic = 0; ic < 4; ++ic)
+			plane[ip][ic] = _mm256_set1_ps(vector_component(frustum->plane[ip], ic));
+		for (int ic = 0; ic < 3; ++ic)
+			corner[ip][ic] = (vector_component(frustum->plane[ip], ic) >= 0) ? 1 : 0;
+	}
+
+	const size_t blocks = (count + 3) / 4;
+	uint32_t word = 0;
+	for (size_t block = 0; block < blocks; block += 2) {
+		const aabb_soa_t* lo = aabbs + block;
+		const aabb_soa_t* hi = (block + 1 < blocks) ? lo + 1 : lo;
+		__m256 outside = _mm256_setzero_ps();
+		for (int ip = 0; ip < 6; ++ip) {
+			const unsigned int cx = corner[ip][0];
+			const unsigned int cy = corner[ip][1];
+			const unsigned int cz = corner[ip][2];
+			__m256 dist = _mm256_fmadd_ps(plane[ip][0], VECTOR_BOUNDS_LOAD_AVX2(lo->x[cx], hi->x[cx]), plane[ip][3]);
+			dist = _mm256_fmadd_ps(plane[ip][1], VECTOR_BOUNDS_LOAD_AVX2(lo->y[cy], hi->y[cy]), dist);
+			dist = _mm256_fmadd_ps(plane[ip][2], VECTOR_BOUNDS_LOAD_AVX2(lo->z[cz], hi->z[cz]), dist);
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_LT_OQ));
+		}
+		word |= (uint32_t)(~_mm256_movemask_ps(outside) & 0xFF) << ((block & 7) * 4);
+		if (((block & 7) == 6) || (block + 2 >= blocks)) {
+			if ((block + 2 >= blocks) && (count & 31))
+				word &= (1U << (count & 31)) - 1;
+			out_mask[block / 8] = word;
+			word = 0;
+		}
+	}
+}
+#define VECTOR_HAVE_FRUSTUM_CULL_AABBS 1
+
+#endif
+
+#ifndef VECTOR_HAVE_FRUSTUM_CULL_SPHERES
+
+static FOUNDATION_FORCEINLINE void
+frustum_cull_spheres(uint32_t* FOUNDATION_RESTRICT out_mask, const frustum_t* FOUNDATION_RESTRICT frustum,
+                     const vector_soa_t* FOUNDATION_RESTRICT spheres, size_t count) {
+	__m256 plane[6][4];
+	for (int ip = 0; ip < 6; ++ip) {
+		for (int ic = 0; ic < 4; ++ic)
+			plane[ip][ic] = _mm256_set1_ps(vector_component(frustum->plane[ip], ic));
+	}
+
+	const size_t blocks = (count + 3) / 4;
+	uint32_t word = 0;
+	for (size_t block = 0; block < blocks; block += 2) {
+		const vector_soa_t* lo = spheres + block;
+		const vector_soa_t* hi = (block + 1 < blocks) ? lo + 1 : lo;
+		const __m256 x = VECTOR_BOUNDS_LOAD_AVX2(lo->x, hi->x);
+		const __m256 y = VECTOR_BOUNDS_LOAD_AVX2(lo->y, hi->y);
+		const __m256 z = VECTOR_BOUNDS_LOAD_AVX2(lo->z, hi->z);
+		const __m256 limit = _mm256_sub_ps(_mm256_setzero_ps(), VECTOR_BOUNDS_LOAD_AVX2(lo->w, hi->w));
+		__m256 outside = _mm256_setzero_ps();
+		for (int ip = 0; ip < 6; ++ip) {
+			__m256 dist = _mm256_fmadd_ps(plane[ip][0], x, plane[ip][3]);
+			dist = _mm256_fmadd_ps(plane[ip][1], y, dist);
+			dist = _mm256_fmadd_ps(plane[ip][2], z, dist);
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(dist, limit, _CMP_LT_OQ));
+		}
+		word |= (uint32_t)(~_mm256_movemask_ps(outside) & 0xFF) << ((block & 7) * 4);
+		if (((block & 7) == 6) || (block + 2 >= blocks)) {
+			if ((block + 2 >= blocks) && (count & 31))
+				word &= (1U << (count & 31)) - 1;
+			out_mask[block / 8] = word;
+			word = 0;
+		}
+	}
+}
+#define VECTOR_HAVE_FRUSTUM_CULL_SPHERES 1
+
+#endif
+
+#ifndef VECTOR_HAVE_RAY_INTERSECT_TRIANGLE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+ray_intersect_triangle_array(uint32_t* FOUNDATION_RESTRICT out_mask, real* FOUNDATION_RESTRICT distance,
+                             const ray_soa_t* FOUNDATION_RESTRICT rays, size_t count, const vector_t v0,
+                             const vector_t v1, const vector_t v2) {
+	const vector_t edge1 = vector_sub(v1, v0);
+	const vector_t edge2 = vector_sub(v2, v0);
+	const __m256 p0x = _mm256_set1_ps(vector_x(v0));
+	const __m256 p0y = _mm256_set1_ps(vector_y(v0));
+	const __m256 p0z = _mm256_set1_ps(vector_z(v0));
+	const __m256 e1x = _mm256_set1_ps(vector_x(edge1));
+	const __m256 e1y = _mm256_set1_ps(vector_y(edge1));
+	const __m256 e1z = _mm256_set1_ps(vector_z(edge1));
+	const __m256 e2x = _mm256_set1_ps(vector_x(edge2));
+	const __m256 e2y = _mm256_set1_ps(vector_y(edge2));
+	const __m256 e2z = _mm256_set1_ps(vector_z(edge2));
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 sign = _mm256_set1_ps(-0.0f);
+
+	const size_t blocks = (count + 3) / 4;
+	uint32_t word = 0;
+	for (size_t block = 0; block < blocks; block += 2) {
+		const size_t i = block * 4;
+		const ray_soa_t* lo = rays + block;
+		const ray_soa_t* hi = (block + 1 < blocks) ? lo + 1 : lo;
+		const __m256 dx = VECTOR_BOUNDS_LOAD_AVX2(lo->direction.x, hi->direction.x);
+		const __m256 dy = VECTOR_BOUNDS_LOAD_AVX2(lo->direction.y, hi->direction.y);
+		const __m256 dz = VECTOR_BOUNDS_LOAD_AVX2(lo->direction.z, hi->direction.z);
+		const __m256 sx = _mm256_sub_ps(VECTOR_BOUNDS_LOAD_AVX2(lo->origin.x, hi->origin.x), p0x);
+		const __m256 sy = _mm256_sub_ps(VECTOR_BOUNDS_LOAD_AVX2(lo->origin.y, hi->origin.y), p0y);
+		const __m256 sz = _mm256_sub_ps(VECTOR_BOUNDS_LOAD_AVX2(lo->origin.z, hi->origin.z), p0z);
+
+		const __m256 px = _mm256_fmsub_ps(dy, e2z, _mm256_mul_ps(dz, e2y));
+		const __m256 py = _mm256_fmsub_ps(dz, e2x, _mm256_mul_ps(dx, e2z));
+		const __m256 pz = _mm256_fmsub_ps(dx, e2y, _mm256_mul_ps(dy, e2x));
+		const __m256 qx = _mm256_fmsub_ps(sy, e1z, _mm256_mul_ps(sz, e1y));
+		const __m256 qy = _mm256_fmsub_ps(sz, e1x, _mm256_mul_ps(sx, e1z));
+		const __m256 qz = _mm256_fmsub_ps(sx, e1y, _mm256_mul_ps(sy, e1x));
+		const __m256 det = _mm256_fmadd_ps(e1z, pz, _mm256_fmadd_ps(e1y, py, _mm256_mul_ps(e1x, px)));
+		const __m256 inv_det = _mm256_div_ps(one, det);
+		const __m256 sp = _mm256_fmadd_ps(sz, pz, _mm256_fmadd_ps(sy, py, _mm256_mul_ps(sx, px)));
+		const __m256 dq = _mm256_fmadd_ps(dz, qz, _mm256_fmadd_ps(dy, qy, _mm256_mul_ps(dx, qx)));
+		const __m256 eq = _mm256_fmadd_ps(e2z, qz, _mm256_fmadd_ps(e2y, qy, _mm256_mul_ps(e2x, qx)));
+		const __m256 u = _mm256_mul_ps(sp, inv_det);
+		const __m256 v = _mm256_mul_ps(dq, inv_det);
+		const __m256 t = _mm256_mul_ps(eq, inv_det);
+
+		float32_t block_distance[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+		const size_t valid = (count - i < 8) ? count - i : 8;
+		for (size_t j = 0; j < valid; ++j)
+			block_distance[j] = distance[i + j];
+		const __m256 max_distance = _mm256_loadu_ps(block_distance);
+
+		__m256 hit = _mm256_and_ps(_mm256_cmp_ps(_mm256_andnot_ps(sign, det), zero, _CMP_GT_OQ),
+		                           _mm256_cmp_ps(u, zero, _CMP_GE_OQ));
+		hit = _mm256_and_ps(hit, _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+		hit = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ));
+		hit = _mm256_and_ps(hit, _mm256_cmp_ps(t, zero, _CMP_GE_OQ));
+		hit = _mm256_and_ps(hit, _mm256_cmp_ps(t, max_distance, _CMP_LT_OQ));
+		const unsigned int hit_bits = (unsigned int)_mm256_movemask_ps(hit);
+		if (hit_bits) {
+			_mm256_storeu_ps(block_distance, _mm256_blendv_ps(max_distance, t, hit));
+			for (size_t j = 0; j < valid; ++j)
+				distance[i + j] = block_distance[j];
+		}
+
+		word |= (uint32_t)hit_bits << ((block & 7) * 4);
+		if (((block & 7) == 6) || (block + 2 >= blocks)) {
+			out_mask[block / 8] = word;
+			word = 0;
+		}
+	}
+}
+#define VECTOR_HAVE_RAY_INTERSECT_TRIANGLE_ARRAY 1
+
+#endif
+
+#include <vector/bounds_sse2.h>
@@ -0,0 +1,497 @@
+/* bounds_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_BOUNDS_MASK
+
+// Lane i of comparison mask to bit i
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vector_bounds_mask(const vectori_t mask) {
+	return (vectori_x(mask) ? 1U : 0U) | (vectori_y(mask) ? 2U : 0U) | (vectori_z(mask) ? 4U : 0U) |
+	       (vectori_w(mask) ? 8U : 0U);
+}
+
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL plane_t
+plane(const vector_t normal, const vector_t point) {
+	return transform_splice_w(normal, vector_neg(vector_dot3(normal, point)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL plane_t
+plane_from_points(const vector_t p0, const vector_t p1, const vector_t p2) {
+	return plane(vector_normalize3(vector_cross3(vector_sub(p1, p0), vector_sub(p2, p0))), p0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL plane_t
+plane_normalize(const plane_t p) {
+	return vector_div(p, vector_length3(p));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+plane_distance(const plane_t p, const vector_t point) {
+	return vector_dot(p, transform_splice_w(point, vector_one()));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL sphere_t
+sphere(const vector_t center, const real radius) {
+	return transform_splice_w(center, vector_uniform(radius));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL aabb_t
+aabb(const vector_t min, const vector_t max) {
+	aabb_t box;
+	box.min = min;
+	box.max = max;
+	return box;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+aabb_center(const aabb_t box) {
+	return vector_mul(vector_add(box.min, box.max), vector_half());
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+aabb_extent(const aabb_t box) {
+	return vector_mul(vector_sub(box.max, box.min), vector_half());
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL obb_t
+obb(const vector_t center, const vector_t extent, const quaternion_t rotation) {
+	obb_t box;
+	box.center = center;
+	box.extent = extent;
+	box.rotation = rotation;
+	return box;
+}
+
+// Load point i of a strided buffer. The w component is undefined except for the last point,
+// which is loaded without reading past the xyz components
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_bounds_load_point(const float32_t* points, size_t stride, size_t i, size_t count) {
+	const float32_t* point = (const float32_t*)((const char*)points + stride * i);
+	if (i + 1 < count)
+		return vector_unaligned(point);
+	return vector(point[0], point[1], point[2], 0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL aabb_t
+aabb_from_points(const float32_t* points, size_t stride, size_t count) {
+	if (!count)
+		return aabb(vector_zero(), vector_zero());
+	// Four independent min and max chains to hide latency, the last point is loaded separately
+	// to not read past the end of the buffer
+	const vector_t first = vector_bounds_load_point(points, stride, 0, count);
+	vector_t min0 = first, min1 = first, min2 = first, min3 = first;
+	vector_t max0 = first, max1 = first, max2 = first, max3 = first;
+	const char* point = (const char*)points;
+	size_t i = 0;
+	for (; i + 4 < count; i += 4, point += stride * 4) {
+		const vector_t p0 = vector_unaligned((const float32_t*)point);
+		const vector_t p1 = vector_unaligned((const float32_t*)(point + stride));
+		const vector_t p2 = vector_unaligned((const float32_t*)(point + stride * 2));
+		const vector_t p3 = vector_unaligned((const float32_t*)(point + stride * 3));
+		min0 = vector_min(min0, p0);
+		max0 = vector_max(max0, p0);
+		min1 = vector_min(min1, p1);
+		max1 = vector_max(max1, p1);
+		min2 = vector_min(min2, p2);
+		max2 = vector_max(max2, p2);
+		min3 = vector_min(min3, p3);
+		max3 = vector_max(max3, p3);
+	}
+	for (; i < count; ++i) {
+		const vector_t p = vector_bounds_load_point(points, stride, i, count);
+		min0 = vector_min(min0, p);
+		max0 = vector_max(max0, p);
+	}
+	const vector_t min = vector_min(vector_min(min0, min1), vector_min(min2, min3));
+	const vector_t max = vector_max(vector_max(max0, max1), vector_max(max2, max3));
+	return aabb(transform_splice_w(min, vector_zero()), transform_splice_w(max, vector_zero()));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL sphere_t
+sphere_from_points(const float32_t* points, size_t stride, size_t count) {
+	if (!count)
+		return vector_zero();
+
+	// Points with minimum and maximum coordinate along each axis, updated when any comparison
+	// lane is set which is rare after the first few points
+	const vector_t first = transform_splice_w(vector_bounds_load_point(points, stride, 0, count), vector_zero());
+	vector_t min_point[3] = {first, first, first};
+	vector_t max_point[3] = {first, first, first};
+	vector_t min = first;
+	vector_t max = first;
+	for (size_t i = 1; i < count; ++i) {
+		const vector_t p = vector_bounds_load_point(points, stride, i, count);
+		const unsigned int below = vector_bounds_mask(vector_less(p, min)) & 7;
+		const unsigned int above = vector_bounds_mask(vector_greater(p, max)) & 7;
+		if (below | above) {
+			for (int axis = 0; axis < 3; ++axis) {
+				if (below & (1U << axis))
+					min_point[axis] = p;
+				if (above & (1U << axis))
+					max_point[axis] = p;
+			}
+			min = vector_min(min, p);
+			max = vector_max(max, p);
+		}
+	}
+
+	// Initial sphere spanning the most distant pair, then grown to include points outside
+	int span_axis = 0;
+	real span = vector_x(vector_length3_sqr(vector_sub(max_point[0], min_point[0])));
+	for (int axis = 1; axis < 3; ++axis) {
+		const real axis_span = vector_x(vector_length3_sqr(vector_sub(max_point[axis], min_point[axis])));
+		if (axis_span > span) {
+			span = axis_span;
+			span_axis = axis;
+		}
+	}
+	vector_t center = vector_mul(vector_add(min_point[span_axis], max_point[span_axis]), vector_half());
+	real radius = math_sqrt(span) * REAL_C(0.5);
+	vector_t radius_sqr = vector_uniform(radius * radius);
+	for (size_t i = 0; i < count; ++i) {
+		const vector_t offset = vector_sub(vector_bounds_load_point(points, stride, i, count), center);
+		const vector_t distance_sqr = vector_length3_sqr(offset);
+		if (vector_bounds_mask(vector_greater(distance_sqr, radius_sqr)) & 1) {
+			const real distance = math_sqrt(vector_x(distance_sqr));
+			const real grown = (radius + distance) * REAL_C(0.5);
+			center = vector_add(center, vector_scale(offset, (grown - radius) / distance));
+			radius = grown;
+			radius_sqr = vector_uniform(radius * radius);
+		}
+	}
+	return sphere(center, radius);
+}
+
+static FOUNDATION_FORCEINLINE void
+aabb_soa_load_block(aabb_soa_t* FOUNDATION_RESTRICT out, const vector_t* min, const vector_t* max) {
+	const vector_soa_t soa_min = vector_soa_load(min);
+	const vector_soa_t soa_max = vector_soa_load(max);
+	out->x[0] = soa_min.x;
+	out->y[0] = soa_min.y;
+	out->z[0] = soa_min.z;
+	out->x[1] = soa_max.x;
+	out->y[1] = soa_max.y;
+	out->z[1] = soa_max.z;
+}
+
+static FOUNDATION_FORCEINLINE void
+aabb_soa_load_array(aabb_soa_t* FOUNDATION_RESTRICT out, const aabb_t* FOUNDATION_RESTRICT in, size_t count) {
+	vector_t min[4];
+	vector_t max[4];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		for (size_t j = 0; j < 4; ++j) {
+			min[j] = in[i + j].min;
+			max[j] = in[i + j].max;
+		}
+		aabb_soa_load_block(out++, min, max);
+	}
+	if (i < count) {
+		for (size_t j = 0; j < 4; ++j) {
+			min[j] = (i + j < count) ? in[i + j].min : vector_zero();
+			max[j] = (i + j < count) ? in[i + j].max : vector_zero();
+		}
+		aabb_soa_load_block(out, min, max);
+	}
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL frustum_t
+frustum_from_matrix(const matrix_t view_projection) {
+	// Clip space coordinates are dot products with the matrix columns, each plane is a sum of
+	// two columns where the clip coordinate equals the bound (Gribb and Hartmann)
+	const matrix_t column = matrix_transpose(view_projection);
+	frustum_t frustum;
+	frustum.plane[0] = plane_normalize(vector_add(column.row[3], column.row[0]));
+	frustum.plane[1] = plane_normalize(vector_sub(column.row[3], column.row[0]));
+	frustum.plane[2] = plane_normalize(vector_add(column.row[3], column.row[1]));
+	frustum.plane[3] = plane_normalize(vector_sub(column.row[3], column.row[1]));
+	frustum.plane[4] = plane_normalize(column.row[2]);
+	frustum.plane[5] = plane_normalize(vector_sub(column.row[3], column.row[2]));
+	return frustum;
+}
+
+// Single volume tests evaluate planes 0-3 and 2-5 as two structure-of-arrays blocks, the overlap
+// is cheaper than a partial block and does not change the result
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_point(const frustum_t* frustum, const vector_t point) {
+	const vector_soa_t p = vector_soa_splat(transform_splice_w(point, vector_one()));
+	const vector_t dist0 = vector_soa_dot(vector_soa_load(frustum->plane), p);
+	const vector_t dist1 = vector_soa_dot(vector_soa_load(frustum->plane + 2), p);
+	return !vector_bounds_mask(vectori_or(vector_less(dist0, vector_zero()), vector_less(dist1, vector_zero())));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_sphere(const frustum_t* frustum, const sphere_t s) {
+	const vector_soa_t center = vector_soa_splat(transform_splice_w(s, vector_one()));
+	const vector_t limit = vector_neg(vector_shuffle(s, VECTOR_MASK_WWWW));
+	const vector_t dist0 = vector_soa_dot(vector_soa_load(frustum->plane), center);
+	const vector_t dist1 = vector_soa_dot(vector_soa_load(frustum->plane + 2), center);
+	return !vector_bounds_mask(vectori_or(vector_less(dist0, limit), vector_less(dist1, limit)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_aabb(const frustum_t* frustum, const aabb_t box) {
+	// Distance to center plus the extent projected on the normal, the distance to the corner
+	// furthest along the normal
+	const vector_soa_t center = vector_soa_splat(transform_splice_w(aabb_center(box), vector_one()));
+	const vector_soa_t extent = vector_soa_splat(aabb_extent(box));
+	const vector_soa_t p0 = vector_soa_load(frustum->plane);
+	const vector_soa_t p1 = vector_soa_load(frustum->plane + 2);
+	const vector_soa_t n0 = vector_soa(vector_abs(p0.x), vector_abs(p0.y), vector_abs(p0.z), vector_zero());
+	const vector_soa_t n1 = vector_soa(vector_abs(p1.x), vector_abs(p1.y), vector_abs(p1.z), vector_zero());
+	const vector_t dist0 = vector_add(vector_soa_dot(p0, center), vector_soa_dot3(n0, extent));
+	const vector_t dist1 = vector_add(vector_soa_dot(p1, center), vector_soa_dot3(n1, extent));
+	return !vector_bounds_mask(vectori_or(vector_less(dist0, vector_zero()), vector_less(dist1, vector_zero())));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL bool
+frustum_test_obb(const frustum_t* frustum, const obb_t box) {
+	// As the axis aligned test with the normal projected on each box axis
+	const matrix_t axis = matrix_from_quaternion(box.rotation);
+	const vector_soa_t center = vector_soa_splat(transform_splice_w(box.center, vector_one()));
+	const vector_soa_t x = vector_soa_splat(axis.row[0]);
+	const vector_soa_t y = vector_soa_splat(axis.row[1]);
+	const vector_soa_t z = vector_soa_splat(axis.row[2]);
+	const vector_t ex = vector_shuffle(box.extent, VECTOR_MASK_XXXX);
+	const vector_t ey = vector_shuffle(box.extent, VECTOR_MASK_YYYY);
+	const vector_t ez = vector_shuffle(box.extent, VECTOR_MASK_ZZZZ);
+	const vector_soa_t p0 = vector_soa_load(frustum->plane);
+	const vector_soa_t p1 = vector_soa_load(frustum->plane + 2);
+	const vector_t r0 = vector_muladd(vector_abs(vector_soa_dot3(p0, z)), ez,
+	                                  vector_muladd(vector_abs(vector_soa_dot3(p0, y)), ey,
+	                                                vector_mul(vector_abs(vector_soa_dot3(p0, x)), ex)));
+	const vector_t r1 = vector_muladd(vector_abs(vector_soa_dot3(p1, z)), ez,
+	                                  vector_muladd(vector_abs(vector_soa_dot3(p1, y)), ey,
+	                                                vector_mul(vector_abs(vector_soa_dot3(p1, x)), ex)));
+	const vector_t dist0 = vector_add(vector_soa_dot(p0, center), r0);
+	const vector_t dist1 = vector_add(vector_soa_dot(p1, center), r1);
+	return !vector_bounds_mask(vectori_or(vector_less(dist0, vector_zero()), vector_less(dist1, vector_zero())));
+}
+
+// Plane components replicated over all lanes, and for boxes the corner index along each axis
+// selecting the corner furthest along the plane normal
+static FOUNDATION_FORCEINLINE void
+frustum_cull_planes(const frustum_t* frustum, vector_soa_t* plane, unsigned int (*corner)[3]) {
+	for (int ip = 0; ip < 6; ++ip) {
+		plane[ip] = vector_soa_splat(frustum->plane[ip]);
+		corner[ip][0] = (vector_x(frustum->plane[ip]) >= 0) ? 1 : 0;
+		corner[ip][1] = (vector_y(frustum->plane[ip]) >= 0) ? 1 : 0;
+		corner[ip][2] = (vector_z(frustum->plane[ip]) >= 0) ? 1 : 0;
+	}
+}
+
+// Store mask bits of the block if the mask word is complete, or after the last block
+static FOUNDATION_FORCEINLINE void
+vector_bounds_store_mask(uint32_t* out_mask, uint32_t* word, size_t block, size_t blocks, size_t count) {
+	if (((block & 7) == 7) || (block + 1 == blocks)) {
+		if ((block + 1 == blocks) && (count & 31))
+			*word &= (1U << (count & 31)) - 1;
+		out_mask[block / 8] = *word;
+		*word = 0;
+	}
+}
+
+#ifndef VECTOR_HAVE_FRUSTUM_CULL_AABBS
+
+// Lanes of a block of four boxes with the corner furthest along the plane normal outside the plane
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vectori_t
+frustum_cull_aabb_plane(const vector_soa_t* plane, const unsigned int* corner, const aabb_soa_t* box) {
+	const vector_t dist = vector_muladd(
+	    plane->z, box->z[corner[2]],
+	    vector_muladd(plane->y, box->y[corner[1]], vector_muladd(plane->x, box->x[corner[0]], plane->w)));
+	return vector_less(dist, vector_zero());
+}
+
+static FOUNDATION_FORCEINLINE void
+frustum_cull_aabbs(uint32_t* FOUNDATION_RESTRICT out_mask, const frustum_t* FOUNDATION_RESTRICT frustum,
+                   const aabb_soa_t* FOUNDATION_RESTRICT aabbs, size_t count) {
+	vector_soa_t plane[6];
+	unsigned int corner[6][3];
+	frustum_cull_planes(frustum, plane, corner);
+
+	const size_t blocks = (count + 3) / 4;
+	uint32_t word = 0;
+	for (size_t block = 0; block < blocks; ++block) {
+		const aabb_soa_t* box = aabbs + block;
+		const vectori_t outside01 = vectori_or(frustum_cull_aabb_plane(plane + 0, corner[0], box),
+		                                       frustum_cull_aabb_plane(plane + 1, corner[1], box));
+		const vectori_t outside23 = vectori_or(frustum_cull_aabb_plane(plane + 2, corner[2], box),
+		                                       frustum_cull_aabb_plane(plane + 3, corner[3], box));
+		const vectori_t outside45 = vectori_or(frustum_cull_aabb_plane(plane + 4, corner[4], box),
+		                                       frustum_cull_aabb_plane(plane + 5, corner[5], box));
+		const vectori_t outside = vectori_or(vectori_or(outside01, outside23), outside45);
+		word |= (uint32_t)(~vector_bounds_mask(outside) & 0xF) << ((block & 7) * 4);
+		vector_bounds_store_mask(out_mask, &word, block, blocks, count);
+	}
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_FRUSTUM_CULL_SPHERES
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vectori_t
+frustum_cull_sphere_plane(const vector_soa_t* plane, const vector_soa_t* s, const vector_t limit) {
+	const vector_t dist =
+	    vector_muladd(plane->z, s->z, vector_muladd(plane->y, s->y, vector_muladd(plane->x, s->x, plane->w)));
+	return vector_less(dist, limit);
+}
+
+static FOUNDATION_FORCEINLINE void
+frustum_cull_spheres(uint32_t* FOUNDATION_RESTRICT out_mask, const frustum_t* FOUNDATION_RESTRICT frustum,
+                     const vector_soa_t* FOUNDATION_RESTRICT spheres, size_t count) {
+	vector_soa_t plane[6];
+	unsigned int corner[6][3];
+	frustum_cull_planes(frustum, plane, corner);
+
+	const size_t blocks = (count + 3) / 4;
+	uint32_t word = 0;
+	for (size_t block = 0; block < blocks; ++block) {
+		const vector_soa_t* s = spheres + block;
+		const vector_t limit = vector_neg(s->w);
+		const vectori_t outside01 = vectori_or(frustum_cull_sphere_plane(plane + 0, s, limit),
+		                                       frustum_cull_sphere_plane(plane + 1, s, limit));
+		const vectori_t outside23 = vectori_or(frustum_cull_sphere_plane(plane + 2, s, limit),
+		                                       frustum_cull_sphere_plane(plane + 3, s, limit));
+		const vectori_t outside45 = vectori_or(frustum_cull_sphere_plane(plane + 4, s, limit),
+		                                       frustum_cull_sphere_plane(plane + 5, s, limit));
+		const vectori_t outside = vectori_or(vectori_or(outside01, outside23), outside45);
+		word |= (uint32_t)(~vector_bounds_mask(outside) & 0xF) << ((block & 7) * 4);
+		vector_bounds_store_mask(out_mask, &word, block, blocks, count);
+	}
+}
+
+#endif
+
+// Reciprocal of a direction component, zero components are replaced by a tiny value so the slabs
+// stay finite. Infinities are not reliable under the fast math build flags, which may also turn
+// the division into a reciprocal estimate giving NaN for zero
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+ray_soa_reciprocal(const vector_t d) {
+	const vector_t tiny = vector_uniform(REAL_C(1e-20));
+	const vector_t signed_tiny = vector_select(vector_less(d, vector_zero()), vector_neg(tiny), tiny);
+	return vector_div(vector_one(), vector_select(vector_less(vector_abs(d), tiny), signed_tiny, d));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL ray_soa_t
+ray_soa(const vector_soa_t origin, const vector_soa_t direction) {
+	ray_soa_t ray;
+	ray.origin = origin;
+	ray.direction = direction;
+	ray.inv_direction = vector_soa(ray_soa_reciprocal(direction.x), ray_soa_reciprocal(direction.y),
+	                               ray_soa_reciprocal(direction.z), vector_zero());
+	return ray;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL ray_soa_t
+ray_soa_load(const vector_t* FOUNDATION_RESTRICT origin, const vector_t* FOUNDATION_RESTRICT direction) {
+	return ray_soa(vector_soa_load(origin), vector_soa_load(direction));
+}
+
+// Triangle test with first vertex and edges replicated over all lanes, shared by the single
+// triangle test and the array version which sets them up once
+static FOUNDATION_FORCEINLINE vectori_t
+ray_soa_intersect_triangle_edges(const ray_soa_t* FOUNDATION_RESTRICT ray, const vector_soa_t v0,
+                                 const vector_soa_t e1, const vector_soa_t e2, const vector_t max_distance,
+                                 vector_t* FOUNDATION_RESTRICT distance) {
+	const vector_soa_t p = vector_soa_cross3(ray->direction, e2);
+	const vector_t det = vector_soa_dot3(e1, p);
+	const vector_t inv_det = vector_div(vector_one(), det);
+	const vector_soa_t s = vector_soa_sub(ray->origin, v0);
+	const vector_soa_t q = vector_soa_cross3(s, e1);
+	const vector_t u = vector_mul(vector_soa_dot3(s, p), inv_det);
+	const vector_t v = vector_mul(vector_soa_dot3(ray->direction, q), inv_det);
+	const vector_t t = vector_mul(vector_soa_dot3(e2, q), inv_det);
+	const vector_t zero = vector_zero();
+	vectori_t hit = vectori_and(vector_greater(vector_abs(det), zero), vector_gequal(u, zero));
+	hit = vectori_and(hit, vectori_and(vector_gequal(v, zero), vector_lequal(vector_add(u, v), vector_one())));
+	hit = vectori_and(hit, vectori_and(vector_gequal(t, zero), vector_less(t, max_distance)));
+	*distance = t;
+	return hit;
+}
+
+static FOUNDATION_FORCEINLINE vectori_t
+ray_soa_intersect_triangle(const ray_soa_t* FOUNDATION_RESTRICT ray, const vector_t v0, const vector_t v1,
+                           const vector_t v2, const vector_t max_distance, vector_t* FOUNDATION_RESTRICT distance) {
+	return ray_soa_intersect_triangle_edges(ray, vector_soa_splat(v0), vector_soa_splat(vector_sub(v1, v0)),
+	                                        vector_soa_splat(vector_sub(v2, v0)), max_distance, distance);
+}
+
+static FOUNDATION_FORCEINLINE vectori_t
+ray_soa_intersect_aabb(const ray_soa_t* FOUNDATION_RESTRICT ray, const aabb_t box, const vector_t max_distance,
+                       vector_t* FOUNDATION_RESTRICT distance) {
+	const vector_t x0 = vector_mul(vector_sub(vector_shuffle(box.min, VECTOR_MASK_XXXX), ray->origin.x),
+	                               ray->inv_direction.x);
+	const vector_t x1 = vector_mul(vector_sub(vector_shuffle(box.max, VECTOR_MASK_XXXX), ray->origin.x),
+	                               ray->inv_direction.x);
+	const vector_t y0 = vector_mul(vector_sub(vector_shuffle(box.min, VECTOR_MASK_YYYY), ray->origin.y),
+	                               ray->inv_direction.y);
+	const vector_t y1 = vector_mul(vector_sub(vector_shuffle(box.max, VECTOR_MASK_YYYY), ray->origin.y),
+	                               ray->inv_direction.y);
+	const vector_t z0 = vector_mul(vector_sub(vector_shuffle(box.min, VECTOR_MASK_ZZZZ), ray->origin.z),
+	                               ray->inv_direction.z);
+	const vector_t z1 = vector_mul(vector_sub(vector_shuffle(box.max, VECTOR_MASK_ZZZZ), ray->origin.z),
+	                               ray->inv_direction.z);
+	// Clamping the slab interval to [0, max_distance] covers the ray extent in the same test
+	const vector_t enter = vector_max(vector_max(vector_min(x0, x1), vector_min(y0, y1)),
+	                                  vector_max(vector_min(z0, z1), vector_zero()));
+	const vector_t leave =
+	    vector_min(vector_min(vector_max(x0, x1), vector_max(y0, y1)), vector_min(vector_max(z0, z1), max_distance));
+	*distance = enter;
+	return vector_lequal(enter, leave);
+}
+
+#ifndef VECTOR_HAVE_RAY_INTERSECT_TRIANGLE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+ray_intersect_triangle_array(uint32_t* FOUNDATION_RESTRICT out_mask, real* FOUNDATION_RESTRICT distance,
+                             const ray_soa_t* FOUNDATION_RESTRICT rays, size_t count, const vector_t v0,
+                             const vector_t v1, const vector_t v2) {
+	const vector_soa_t p0 = vector_soa_splat(v0);
+	const vector_soa_t e1 = vector_soa_splat(vector_sub(v1, v0));
+	const vector_soa_t e2 = vector_soa_splat(vector_sub(v2, v0));
+
+	const size_t blocks = (count + 3) / 4;
+	uint32_t word = 0;
+	for (size_t block = 0; block < blocks; ++block) {
+		const size_t i = block * 4;
+		float32_t block_distance[4] = {0, 0, 0, 0};
+		for (size_t j = 0; (j < 4) && (i + j < count); ++j)
+			block_distance[j] = distance[i + j];
+		vector_t t;
+		const unsigned int hit = vector_bounds_mask(ray_soa_intersect_triangle_edges(
+		    rays + block, p0, e1, e2, vector_unaligned(block_distance), &t));
+		// Hits are rare in typical use, store hit distances by lane
+		if (hit) {
+			for (size_t j = 0; (j < 4) && (i + j < count); ++j) {
+				if (hit & (1U << j))
+					distance[i + j] = vector_component(t, (int)j);
+			}
+		}
+		word |= (uint32_t)hit << ((block & 7) * 4);
+		vector_bounds_store_mask(out_mask, &word, block, blocks, count);
+	}
+}
+
+#endif
+
+#undef VECTOR_HAVE_BOUNDS_MASK
+#undef VECTOR_HAVE_FRUSTUM_CULL_AABBS
+#undef VECTOR_HAVE_FRUSTUM_CULL_SPHERES
+#undef VECTOR_HAVE_RAY_INTERSECT_TRIANGLE_ARRAY
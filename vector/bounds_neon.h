@@ -0,0 +1,35 @@
+/* bounds_neon.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_BOUNDS_MASK
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vector_bounds_mask(const vectori_t mask) {
+	const int32_t bit_values[4] = {1, 2, 4, 8};
+	const int32x4_t bits = vandq_s32(mask, vld1q_s32(bit_values));
+#if defined(__aarch64__)
+	return (unsigned int)vaddvq_s32(bits);
+#else
+	const int32x2_t sum = vadd_s32(vget_low_s32(bits), vget_high_s32(bits));
+	return (unsigned int)vget_lane_s32(vpadd_s32(sum, sum), 0);
+#endif
+}
+#define VECTOR_HAVE_BOUNDS_MASK 1
+
+#endif
+
+#include <vector/bounds_base.h>
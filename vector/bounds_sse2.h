@@ -0,0 +1,28 @@
+/* bounds_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_BOUNDS_MASK
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vector_bounds_mask(const vectori_t mask) {
+	return (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(mask));
+}
+#define VECTOR_HAVE_BOUNDS_MASK 1
+
+#endif
+
+#include <vector/bounds_base.h>
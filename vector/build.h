@@ -70,3 +70,96 @@
 #undef VECTOR_IMPLEMENTATION_NEON
 #define VECTOR_IMPLEMENTATION_NEON 1
 #endif
+
+// AVX2 and AVX-512 tiers extend the SSE4 implementation with 256-bit and 512-bit kernels, vector_t
+// is still a 128-bit type. Enabled when compiling with -mavx2 -mfma / -mavx512f (or /arch:AVX2 and
+// /arch:AVX512 for MSVC, which implies FMA)
+#define VECTOR_IMPLEMENTATION_AVX2 0
+#define VECTOR_IMPLEMENTATION_AVX512 0
+
+#if VECTOR_IMPLEMENTATION_SSE4 && defined(__AVX2__) && (defined(__FMA__) || FOUNDATION_COMPILER_MSVC)
+#undef VECTOR_IMPLEMENTATION_AVX2
+#define VECTOR_IMPLEMENTATION_AVX2 1
+#endif
+
+#if VECTOR_IMPLEMENTATION_AVX2 && defined(__AVX512F__)
+#undef VECTOR_IMPLEMENTATION_AVX512
+#define VECTOR_IMPLEMENTATION_AVX512 1
+#endif
+
+// Force an x86 implementation tier for a single translation unit. Used by the runtime dispatched
+// batch kernels which are compiled with target pragmas instead of global compiler flags
+#if (FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64) && \
+    (defined(VECTOR_TARGET_SSE4) || defined(VECTOR_TARGET_AVX2) || defined(VECTOR_TARGET_AVX512))
+#undef VECTOR_IMPLEMENTATION_FALLBACK
+#define VECTOR_IMPLEMENTATION_FALLBACK 0
+#undef VECTOR_IMPLEMENTATION_SSE2
+#define VECTOR_IMPLEMENTATION_SSE2 0
+#undef VECTOR_IMPLEMENTATION_SSE3
+#define VECTOR_IMPLEMENTATION_SSE3 0
+#undef VECTOR_IMPLEMENTATION_SSE4
+#define VECTOR_IMPLEMENTATION_SSE4 1
+#undef VECTOR_IMPLEMENTATION_AVX2
+#define VECTOR_IMPLEMENTATION_AVX2 0
+#undef VECTOR_IMPLEMENTATION_AVX512
+#define VECTOR_IMPLEMENTATION_AVX512 0
+#if defined(VECTOR_TARGET_AVX2) || defined(VECTOR_TARGET_AVX512)
+#undef VECTOR_IMPLEMENTATION_AVX2
+#define VECTOR_IMPLEMENTATION_AVX2 1
+#endif
+#if defined(VECTOR_TARGET_AVX512)
+#undef VECTOR_IMPLEMENTATION_AVX512
+#define VECTOR_IMPLEMENTATION_AVX512 1
+#endif
+#endif
+
+// Force the fallback implementation or a lower SSE tier for a single translation unit. Used by the
+// accuracy tool, which compiles the same kernels for each implementation side by side in one binary
+#if defined(VECTOR_TARGET_FALLBACK) || \
+    ((FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64) && (defined(VECTOR_TARGET_SSE2) || defined(VECTOR_TARGET_SSE3)))
+#undef VECTOR_IMPLEMENTATION_FALLBACK
+#define VECTOR_IMPLEMENTATION_FALLBACK 0
+#undef VECTOR_IMPLEMENTATION_SSE2
+#define VECTOR_IMPLEMENTATION_SSE2 0
+#undef VECTOR_IMPLEMENTATION_SSE3
+#define VECTOR_IMPLEMENTATION_SSE3 0
+#undef VECTOR_IMPLEMENTATION_SSE4
+#define VECTOR_IMPLEMENTATION_SSE4 0
+#undef VECTOR_IMPLEMENTATION_NEON
+#define VECTOR_IMPLEMENTATION_NEON 0
+#undef VECTOR_IMPLEMENTATION_AVX2
+#define VECTOR_IMPLEMENTATION_AVX2 0
+#undef VECTOR_IMPLEMENTATION_AVX512
+#define VECTOR_IMPLEMENTATION_AVX512 0
+#if defined(VECTOR_TARGET_FALLBACK)
+#undef VECTOR_IMPLEMENTATION_FALLBACK
+#define VECTOR_IMPLEMENTATION_FALLBACK 1
+#elif defined(VECTOR_TARGET_SSE3)
+#undef VECTOR_IMPLEMENTATION_SSE3
+#define VECTOR_IMPLEMENTATION_SSE3 1
+#else
+#undef VECTOR_IMPLEMENTATION_SSE2
+#define VECTOR_IMPLEMENTATION_SSE2 1
+#endif
+#endif
+
+//! Prefetch memory at the given address into cache for reading, a hint only which never faults
+#if FOUNDATION_COMPILER_GCC || FOUNDATION_COMPILER_CLANG
+#define VECTOR_PREFETCH(addr) __builtin_prefetch((const void*)(addr))
+#elif FOUNDATION_COMPILER_MSVC && (FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64)
+#define VECTOR_PREFETCH(addr) _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#else
+#define VECTOR_PREFETCH(addr) ((void)sizeof(addr))
+#endif
+
+//! Distance in bytes ahead of the current input element prefetched by the streaming array functions,
+//! can be tuned for the target memory system by defining it before including the library headers
+#ifndef VECTOR_STREAM_PREFETCH_DISTANCE
+#define VECTOR_STREAM_PREFETCH_DISTANCE 512
+#endif
+
+//! Collect call counts, element counts and elapsed time of the batch, parallel and view functions,
+//! see vector_module_statistics. Must be set to the same value when compiling the library and its users
+#ifndef VECTOR_ENABLE_PROFILING
+#define VECTOR_ENABLE_PROFILING 0
+#endif
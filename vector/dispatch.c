@@ -0,0 +1,321 @@
+/* dispatch.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#define VECTOR_DISPATCH_INITIALIZE vector_dispatch_initialize_baseline
+#include <vector/dispatch_kernels.h>
+#include <vector/internal.h>
+
+// Tiers are only selectable when the baseline is an SSE implementation, the fallback
+// implementation uses a different vector_t type
+#define VECTOR_DISPATCH_X86 \
+	((FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64) && !VECTOR_IMPLEMENTATION_FALLBACK)
+
+#if VECTOR_DISPATCH_X86 && FOUNDATION_COMPILER_MSVC
+#include <intrin.h>
+#elif VECTOR_DISPATCH_X86
+#include <cpuid.h>
+#endif
+
+// Baseline kernels until vector_module_initialize selects a tier, so the batch functions
+// can be called before the module is initialized
+vector_dispatch_t vector_dispatch = {
+    .rotate_array = vector_dispatch_rotate_array,
+    .rotate_array_unaligned = vector_dispatch_rotate_array_unaligned,
+    .transform_array = vector_dispatch_transform_array,
+    .transform_array_unaligned = vector_dispatch_transform_array_unaligned,
+    .rotate_array_stream = vector_dispatch_rotate_array_stream,
+    .transform_array_stream = vector_dispatch_transform_array_stream,
+    .mul_array = vector_dispatch_mul_array,
+    .mul_array_stream = vector_dispatch_mul_array_stream,
+    .mul_chain_range = vector_dispatch_mul_chain_range,
+    .skin_array = vector_dispatch_skin_array,
+    .skin_array_stream = vector_dispatch_skin_array_stream,
+    .slerp_array = vector_dispatch_slerp_array,
+    .nlerp_array = vector_dispatch_nlerp_array,
+    .rotate_pairs_array = vector_dispatch_rotate_pairs_array,
+    .from_matrix_array = vector_dispatch_from_matrix_array,
+    .decompose_array = vector_dispatch_decompose_array,
+    .hash_cells_array = vector_dispatch_hash_cells_array,
+    .cull_aabbs = vector_dispatch_cull_aabbs,
+    .cull_spheres = vector_dispatch_cull_spheres,
+    .intersect_triangle_array = vector_dispatch_intersect_triangle_array,
+    .spline_evaluate_array = vector_dispatch_spline_evaluate_array};
+
+#if VECTOR_DISPATCH_X86
+
+static void
+vector_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t* regs) {
+#if FOUNDATION_COMPILER_MSVC
+	int info[4];
+	__cpuidex(info, (int)leaf, (int)subleaf);
+	regs[0] = (uint32_t)info[0];
+	regs[1] = (uint32_t)info[1];
+	regs[2] = (uint32_t)info[2];
+	regs[3] = (uint32_t)info[3];
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t
+vector_xgetbv(void) {
+#if FOUNDATION_COMPILER_MSVC
+	return _xgetbv(0);
+#else
+	uint32_t eax, edx;
+	__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+//! Highest tier supported by both CPU and operating system (register state saved on context switch)
+static vector_isa_t
+vector_dispatch_cpu_isa(void) {
+	uint32_t regs[4];
+	vector_cpuid(0, 0, regs);
+	const uint32_t max_leaf = regs[0];
+	if (max_leaf < 1)
+		return VECTOR_ISA_BASELINE;
+
+	vector_cpuid(1, 0, regs);
+	const bool sse41 = (regs[2] & (1U << 19)) != 0;
+	const bool fma = (regs[2] & (1U << 12)) != 0;
+	const bool osxsave = (regs[2] & (1U << 27)) != 0;
+	const bool avx = (regs[2] & (1U << 28)) != 0;
+	if (!sse41)
+		return VECTOR_ISA_BASELINE;
+	if (!osxsave || !avx || !fma || (max_leaf < 7))
+		return VECTOR_ISA_SSE4;
+
+	// XMM and YMM state (bits 1-2), opmask and ZMM state (bits 5-7)
+	const uint64_t xcr0 = vector_xgetbv();
+	if ((xcr0 & 0x06) != 0x06)
+		return VECTOR_ISA_SSE4;
+
+	vector_cpuid(7, 0, regs);
+	const bool avx2 = (regs[1] & (1U << 5)) != 0;
+	const bool avx512f = (regs[1] & (1U << 16)) != 0;
+	if (!avx2)
+		return VECTOR_ISA_SSE4;
+	if (!avx512f || ((xcr0 & 0xE6) != 0xE6))
+		return VECTOR_ISA_AVX2;
+	return VECTOR_ISA_AVX512;
+}
+
+#endif
+
+vector_isa_t
+vector_dispatch_compiled_isa(void) {
+#if VECTOR_IMPLEMENTATION_AVX512
+	return VECTOR_ISA_AVX512;
+#elif VECTOR_IMPLEMENTATION_AVX2
+	return VECTOR_ISA_AVX2;
+#elif VECTOR_IMPLEMENTATION_SSE4
+	return VECTOR_ISA_SSE4;
+#else
+	return VECTOR_ISA_BASELINE;
+#endif
+}
+
+vector_isa_t
+vector_dispatch_initialize(const vector_config_t config) {
+	const vector_isa_t compiled = vector_dispatch_compiled_isa();
+	vector_isa_t isa = VECTOR_ISA_BASELINE;
+#if VECTOR_DISPATCH_X86
+	isa = vector_dispatch_cpu_isa();
+	if ((config.isa_limit != VECTOR_ISA_AUTO) && (isa > config.isa_limit))
+		isa = config.isa_limit;
+#else
+	FOUNDATION_UNUSED(config);
+#endif
+
+	// Kernels below the compiled tier do not exist, the baseline kernels already use it
+	vector_dispatch_initialize_baseline(&vector_dispatch);
+	if (isa <= compiled)
+		return compiled;
+
+#if VECTOR_DISPATCH_X86
+	if (isa == VECTOR_ISA_AVX512)
+		vector_dispatch_initialize_avx512(&vector_dispatch);
+	else if (isa == VECTOR_ISA_AVX2)
+		vector_dispatch_initialize_avx2(&vector_dispatch);
+	else if (isa == VECTOR_ISA_SSE4)
+		vector_dispatch_initialize_sse4(&vector_dispatch);
+#endif
+	return isa;
+}
+
+void
+vector_batch_rotate(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.rotate_array(out, in, count, &m);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_ROTATE, count);
+}
+
+void
+vector_batch_rotate_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.rotate_array_unaligned(out, in, count, &m);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_ROTATE_UNALIGNED, count);
+}
+
+void
+vector_batch_transform(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.transform_array(out, in, count, &m);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM, count);
+}
+
+void
+vector_batch_transform_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.transform_array_unaligned(out, in, count, &m);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM_UNALIGNED, count);
+}
+
+void
+vector_batch_rotate_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.rotate_array_stream(out, in, count, &m);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_ROTATE_STREAM, count);
+}
+
+void
+vector_batch_transform_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.transform_array_stream(out, in, count, &m);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM_STREAM, count);
+}
+
+void
+matrix_batch_mul(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.mul_array(out, m0, m1, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_BATCH_MUL, count);
+}
+
+void
+matrix_batch_mul_stream(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.mul_array_stream(out, m0, m1, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_BATCH_MUL_STREAM, count);
+}
+
+void
+matrix_batch_mul_chain(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.mul_chain_range(out, local, parent, 0, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_BATCH_MUL_CHAIN, count);
+}
+
+void
+matrix_batch_mul_chain_range(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t begin,
+                             size_t end) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.mul_chain_range(out, local, parent, begin, end);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_BATCH_MUL_CHAIN_RANGE, end - begin);
+}
+
+void
+dual_quaternion_batch_skin(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                           const uint16_t* bone_index, const vector_t* bone_weight) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.skin_array(out, in, count, bone, bone_index, bone_weight);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_DUAL_QUATERNION_BATCH_SKIN, count);
+}
+
+void
+dual_quaternion_batch_skin_stream(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                                  const uint16_t* bone_index, const vector_t* bone_weight) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.skin_array_stream(out, in, count, bone, bone_index, bone_weight);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_DUAL_QUATERNION_BATCH_SKIN_STREAM, count);
+}
+
+void
+quaternion_batch_slerp(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.slerp_array(out, q0, q1, factor, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_QUATERNION_BATCH_SLERP, count);
+}
+
+void
+quaternion_batch_nlerp(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.nlerp_array(out, q0, q1, factor, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_QUATERNION_BATCH_NLERP, count);
+}
+
+void
+quaternion_batch_rotate_pairs(vector_t* out, const quaternion_t* q, const vector_t* in, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.rotate_pairs_array(out, q, in, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_QUATERNION_BATCH_ROTATE_PAIRS, count);
+}
+
+void
+quaternion_batch_from_matrix(quaternion_t* out, const matrix_t* in, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.from_matrix_array(out, in, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_QUATERNION_BATCH_FROM_MATRIX, count);
+}
+
+void
+matrix_batch_decompose(transform_t* out, const matrix_t* in, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.decompose_array(out, in, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_BATCH_DECOMPOSE, count);
+}
+
+void
+vector_batch_hash_cells(uint32_t* out, const vector_t* in, size_t count, real cell_size) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.hash_cells_array(out, in, count, cell_size);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_BATCH_HASH_CELLS, count);
+}
+
+void
+frustum_batch_cull_aabbs(uint32_t* out_mask, const frustum_t* frustum, const aabb_soa_t* aabbs, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.cull_aabbs(out_mask, frustum, aabbs, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_FRUSTUM_BATCH_CULL_AABBS, count);
+}
+
+void
+frustum_batch_cull_spheres(uint32_t* out_mask, const frustum_t* frustum, const vector_soa_t* spheres, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.cull_spheres(out_mask, frustum, spheres, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_FRUSTUM_BATCH_CULL_SPHERES, count);
+}
+
+void
+ray_batch_intersect_triangle(uint32_t* out_mask, real* distance, const ray_soa_t* rays, size_t count,
+                             const vector_t v0, const vector_t v1, const vector_t v2) {
+	const vector_t triangle[3] = {v0, v1, v2};
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.intersect_triangle_array(out_mask, distance, rays, count, triangle);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_RAY_BATCH_INTERSECT_TRIANGLE, count);
+}
+
+void
+spline_batch_evaluate(vector_t* out, const spline_t* spline, const real* time, uint32_t* cursor, size_t count) {
+	VECTOR_PROFILE_BEGIN();
+	vector_dispatch.spline_evaluate_array(out, spline, time, cursor, count);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_SPLINE_BATCH_EVALUATE, count);
+}
@@ -0,0 +1,81 @@
+/* dispatch.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file dispatch.h
+    Function table for batch functions with implementations selected at runtime. Kernels
+    for each x86 tier are compiled in separate translation units (dispatch_<isa>.c) with
+    target pragmas, and the best tier supported by the CPU is selected in
+    vector_module_initialize */
+
+#include <vector/types.h>
+
+typedef struct vector_dispatch_t vector_dispatch_t;
+
+struct vector_dispatch_t {
+	void (*rotate_array)(vector_t* out, const vector_t* in, size_t count, const matrix_t* m);
+	void (*rotate_array_unaligned)(float32_t* out, const float32_t* in, size_t count, const matrix_t* m);
+	void (*transform_array)(vector_t* out, const vector_t* in, size_t count, const matrix_t* m);
+	void (*transform_array_unaligned)(float32_t* out, const float32_t* in, size_t count, const matrix_t* m);
+	void (*rotate_array_stream)(vector_t* out, const vector_t* in, size_t count, const matrix_t* m);
+	void (*transform_array_stream)(vector_t* out, const vector_t* in, size_t count, const matrix_t* m);
+	void (*mul_array)(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+	void (*mul_array_stream)(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+	void (*mul_chain_range)(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t begin, size_t end);
+	void (*skin_array)(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+	                   const uint16_t* bone_index, const vector_t* bone_weight);
+	void (*skin_array_stream)(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+	                          const uint16_t* bone_index, const vector_t* bone_weight);
+	void (*slerp_array)(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+	                    size_t count);
+	void (*nlerp_array)(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+	                    size_t count);
+	void (*rotate_pairs_array)(vector_t* out, const quaternion_t* q, const vector_t* in, size_t count);
+	void (*from_matrix_array)(quaternion_t* out, const matrix_t* in, size_t count);
+	void (*decompose_array)(transform_t* out, const matrix_t* in, size_t count);
+	void (*hash_cells_array)(uint32_t* out, const vector_t* in, size_t count, real cell_size);
+	void (*cull_aabbs)(uint32_t* out_mask, const frustum_t* frustum, const aabb_soa_t* aabbs, size_t count);
+	void (*cull_spheres)(uint32_t* out_mask, const frustum_t* frustum, const vector_soa_t* spheres, size_t count);
+	void (*intersect_triangle_array)(uint32_t* out_mask, real* distance, const ray_soa_t* rays, size_t count,
+	                                 const vector_t* triangle);
+	void (*spline_evaluate_array)(vector_t* out, const spline_t* spline, const real* time, uint32_t* cursor,
+	                              size_t count);
+};
+
+//! Currently selected batch functions
+extern vector_dispatch_t vector_dispatch;
+
+//! Tier the baseline implementation was compiled for
+vector_isa_t
+vector_dispatch_compiled_isa(void);
+
+//! Detect CPU features and fill the function table, returns the selected tier
+vector_isa_t
+vector_dispatch_initialize(const vector_config_t config);
+
+void
+vector_dispatch_initialize_baseline(vector_dispatch_t* dispatch);
+
+void
+vector_dispatch_initialize_sse4(vector_dispatch_t* dispatch);
+
+void
+vector_dispatch_initialize_avx2(vector_dispatch_t* dispatch);
+
+void
+vector_dispatch_initialize_avx512(vector_dispatch_t* dispatch);
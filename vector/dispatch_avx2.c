@@ -0,0 +1,42 @@
+/* dispatch_avx2.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#define VECTOR_TARGET_AVX2 1
+
+#include <foundation/platform.h>
+
+#include <vector/dispatch.h>
+
+#if FOUNDATION_ARCH_X86 || FOUNDATION_ARCH_X86_64
+
+#if FOUNDATION_COMPILER_CLANG
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#elif FOUNDATION_COMPILER_GCC
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+#define VECTOR_DISPATCH_INITIALIZE vector_dispatch_initialize_avx2
+#include <vector/dispatch_kernels.h>
+
+#if FOUNDATION_COMPILER_CLANG
+#pragma clang attribute pop
+#elif FOUNDATION_COMPILER_GCC
+#pragma GCC pop_options
+#endif
+
+#endif
@@ -0,0 +1,162 @@
+/* dispatch_kernels.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+/* Batch kernels for one implementation tier. Included by dispatch.c for the baseline
+   implementation and by each dispatch_<isa>.c after selecting the target instruction set.
+   VECTOR_DISPATCH_INITIALIZE must be defined to the name of the initialization function */
+
+#include <vector/vector.h>
+#include <vector/bounds.h>
+#include <vector/spline.h>
+#include <vector/dispatch.h>
+
+static void
+vector_dispatch_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t* m) {
+	vector_rotate_array(out, in, count, *m);
+}
+
+static void
+vector_dispatch_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t* m) {
+	vector_rotate_array_unaligned(out, in, count, *m);
+}
+
+static void
+vector_dispatch_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t* m) {
+	vector_transform_array(out, in, count, *m);
+}
+
+static void
+vector_dispatch_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t* m) {
+	vector_transform_array_unaligned(out, in, count, *m);
+}
+
+static void
+vector_dispatch_rotate_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t* m) {
+	vector_rotate_array_stream(out, in, count, *m);
+}
+
+static void
+vector_dispatch_transform_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t* m) {
+	vector_transform_array_stream(out, in, count, *m);
+}
+
+static void
+vector_dispatch_mul_array(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	matrix_mul_array(out, m0, m1, count);
+}
+
+static void
+vector_dispatch_mul_array_stream(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	matrix_mul_array_stream(out, m0, m1, count);
+}
+
+static void
+vector_dispatch_mul_chain_range(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t begin,
+                                size_t end) {
+	matrix_mul_chain_range(out, local, parent, begin, end);
+}
+
+static void
+vector_dispatch_skin_array(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                           const uint16_t* bone_index, const vector_t* bone_weight) {
+	dual_quaternion_skin_array(out, in, count, bone, bone_index, bone_weight);
+}
+
+static void
+vector_dispatch_skin_array_stream(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                                  const uint16_t* bone_index, const vector_t* bone_weight) {
+	dual_quaternion_skin_array_stream(out, in, count, bone, bone_index, bone_weight);
+}
+
+static void
+vector_dispatch_slerp_array(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                            size_t count) {
+	quaternion_slerp_array(out, q0, q1, factor, count);
+}
+
+static void
+vector_dispatch_nlerp_array(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                            size_t count) {
+	quaternion_nlerp_array(out, q0, q1, factor, count);
+}
+
+static void
+vector_dispatch_rotate_pairs_array(vector_t* out, const quaternion_t* q, const vector_t* in, size_t count) {
+	quaternion_rotate_pairs_array(out, q, in, count);
+}
+
+static void
+vector_dispatch_from_matrix_array(quaternion_t* out, const matrix_t* in, size_t count) {
+	quaternion_from_matrix_array(out, in, count);
+}
+
+static void
+vector_dispatch_decompose_array(transform_t* out, const matrix_t* in, size_t count) {
+	matrix_decompose_array(out, in, count);
+}
+
+static void
+vector_dispatch_hash_cells_array(uint32_t* out, const vector_t* in, size_t count, real cell_size) {
+	vector_hash_cells_array(out, in, count, cell_size);
+}
+
+static void
+vector_dispatch_cull_aabbs(uint32_t* out_mask, const frustum_t* frustum, const aabb_soa_t* aabbs, size_t count) {
+	frustum_cull_aabbs(out_mask, frustum, aabbs, count);
+}
+
+static void
+vector_dispatch_cull_spheres(uint32_t* out_mask, const frustum_t* frustum, const vector_soa_t* spheres, size_t count) {
+	frustum_cull_spheres(out_mask, frustum, spheres, count);
+}
+
+static void
+vector_dispatch_intersect_triangle_array(uint32_t* out_mask, real* distance, const ray_soa_t* rays, size_t count,
+                                         const vector_t* triangle) {
+	ray_intersect_triangle_array(out_mask, distance, rays, count, triangle[0], triangle[1], triangle[2]);
+}
+
+static void
+vector_dispatch_spline_evaluate_array(vector_t* out, const spline_t* spline, const real* time, uint32_t* cursor,
+                                      size_t count) {
+	spline_evaluate_array(out, spline, time, cursor, count);
+}
+
+void
+VECTOR_DISPATCH_INITIALIZE(vector_dispatch_t* dispatch) {
+	dispatch->rotate_array = vector_dispatch_rotate_array;
+	dispatch->rotate_array_unaligned = vector_dispatch_rotate_array_unaligned;
+	dispatch->transform_array = vector_dispatch_transform_array;
+	dispatch->transform_array_unaligned = vector_dispatch_transform_array_unaligned;
+	dispatch->rotate_array_stream = vector_dispatch_rotate_array_stream;
+	dispatch->transform_array_stream = vector_dispatch_transform_array_stream;
+	dispatch->mul_array = vector_dispatch_mul_array;
+	dispatch->mul_array_stream = vector_dispatch_mul_array_stream;
+	dispatch->mul_chain_range = vector_dispatch_mul_chain_range;
+	dispatch->skin_array = vector_dispatch_skin_array;
+	dispatch->skin_array_stream = vector_dispatch_skin_array_stream;
+	dispatch->slerp_array = vector_dispatch_slerp_array;
+	dispatch->nlerp_array = vector_dispatch_nlerp_array;
+	dispatch->rotate_pairs_array = vector_dispatch_rotate_pairs_array;
+	dispatch->from_matrix_array = vector_dispatch_from_matrix_array;
+	dispatch->decompose_array = vector_dispatch_decompose_array;
+	dispatch->hash_cells_array = vector_dispatch_hash_cells_array;
+	dispatch->cull_aabbs = vector_dispatch_cull_aabbs;
+	dispatch->cull_spheres = vector_dispatch_cull_spheres;
+	dispatch->intersect_triangle_array = vector_dispatch_intersect_triangle_array;
+	dispatch->spline_evaluate_array = vector_dispatch_spline_evaluate_array;
+}
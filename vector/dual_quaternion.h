@@ -0,0 +1,100 @@
+/* dual_quaternion.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file dual_quaternion.h
+    Rigid transforms as unit dual quaternions, used for skinning where linear blending of
+    dual quaternions avoids the volume loss of blended matrices. The real part q[0] is the
+    rotation and the dual part q[1] is half the translation multiplied by the rotation.
+    Dual quaternions cannot represent scale. */
+
+#include <vector/types.h>
+#include <vector/mask.h>
+#include <vector/quaternion.h>
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_identity(void);
+
+//! Construct from unit rotation quaternion and translation, rotation is applied first
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion(const quaternion_t rotation, const vector_t translation);
+
+//! Construct from rotation and translation of transform, scale is ignored
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_from_transform(const transform_t t);
+
+//! Concatenate, resulting dual quaternion applies d0 followed by d1 (same order as quaternion_mul)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_mul(const dual_quaternion_t d0, const dual_quaternion_t d1);
+
+//! Normalize to unit length and remove the part of the dual quaternion not orthogonal to the real part
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_normalize(const dual_quaternion_t d);
+
+//! Blend four weighted influences with the weights in the components of the weight vector (set the
+//! weights of unused influences to zero). Influences in the opposite hemisphere of the first are
+//! negated to blend along the shortest path, and the result is normalized
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_blend(const dual_quaternion_t d0, const dual_quaternion_t d1, const dual_quaternion_t d2,
+                      const dual_quaternion_t d3, const vector_t weight);
+
+//! Translation of unit dual quaternion as [x, y, z, 0]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_translation(const dual_quaternion_t d);
+
+//! Transform point by unit dual quaternion, treated as [x, y, z, 1] and returned as [x', y', z', 1]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_transform_point(const dual_quaternion_t d, const vector_t point);
+
+//! Rotate direction by unit dual quaternion, treated as [x, y, z, 0] and returned as [x', y', z', 0]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_transform_vector(const dual_quaternion_t d, const vector_t v);
+
+//! Skin array of points, each blending four bones selected by four consecutive indices in
+//! bone_index with weights from the components of the corresponding bone_weight vector.
+//! Output can be the same array as input for in-place skinning
+static FOUNDATION_FORCEINLINE void
+dual_quaternion_skin_array(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                           const uint16_t* bone_index, const vector_t* bone_weight);
+
+//! Skin array of points like dual_quaternion_skin_array, but with streaming stores for outputs which
+//! are not read back soon, such as vertices consumed by a GPU upload, see vector_stream. A
+//! vector_stream_fence is issued before returning
+static FOUNDATION_FORCEINLINE void
+dual_quaternion_skin_array_stream(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                                  const uint16_t* bone_index, const vector_t* bone_weight);
+
+//! Skin array of points using the implementation selected at module initialization,
+//! see dual_quaternion_skin_array
+VECTOR_API void
+dual_quaternion_batch_skin(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                           const uint16_t* bone_index, const vector_t* bone_weight);
+
+//! Skin array of points with streaming stores using the implementation selected at module
+//! initialization, see dual_quaternion_skin_array_stream
+VECTOR_API void
+dual_quaternion_batch_skin_stream(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                                  const uint16_t* bone_index, const vector_t* bone_weight);
+
+#if VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+#include <vector/dual_quaternion_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON
+#include <vector/dual_quaternion_neon.h>
+#else
+#include <vector/dual_quaternion_fallback.h>
+#endif
@@ -0,0 +1,220 @@
+/* dual_quaternion_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_BLEND_WEIGHT
+
+//! Weight negated if quaternion q is in the opposite hemisphere of the reference quaternion
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_blend_weight(const vector_t weight, const quaternion_t reference, const quaternion_t q) {
+	return (vector_x(vector_dot(reference, q)) < 0) ? vector_neg(weight) : weight;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_IDENTITY
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_identity(void) {
+	dual_quaternion_t d;
+	d.q[0] = quaternion_identity();
+	d.q[1] = vector_zero();
+	return d;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion(const quaternion_t rotation, const vector_t translation) {
+	// Dual part is 0.5 * t * r, in quaternion_mul order rotation followed by pure translation quaternion
+	const vector_t t = transform_splice_w(translation, vector_zero());
+	dual_quaternion_t d;
+	d.q[0] = rotation;
+	d.q[1] = vector_mul(quaternion_mul(rotation, t), vector_half());
+	return d;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_FROM_TRANSFORM
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_from_transform(const transform_t t) {
+	return dual_quaternion(t.rotation, t.translation);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_MUL
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_mul(const dual_quaternion_t d0, const dual_quaternion_t d1) {
+	dual_quaternion_t d;
+	d.q[0] = quaternion_mul(d0.q[0], d1.q[0]);
+	d.q[1] = vector_add(quaternion_mul(d0.q[1], d1.q[0]), quaternion_mul(d0.q[0], d1.q[1]));
+	return d;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_NORMALIZE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_normalize(const dual_quaternion_t d) {
+	const vector_t scale = vector_div(vector_one(), vector_sqrt(vector_dot(d.q[0], d.q[0])));
+	dual_quaternion_t r;
+	r.q[0] = vector_mul(d.q[0], scale);
+	r.q[1] = vector_mul(d.q[1], scale);
+	r.q[1] = vector_sub(r.q[1], vector_mul(r.q[0], vector_dot(r.q[0], r.q[1])));
+	return r;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_BLEND
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL dual_quaternion_t
+dual_quaternion_blend(const dual_quaternion_t d0, const dual_quaternion_t d1, const dual_quaternion_t d2,
+                      const dual_quaternion_t d3, const vector_t weight) {
+	const vector_t w0 = vector_shuffle(weight, VECTOR_MASK_XXXX);
+	const vector_t w1 = dual_quaternion_blend_weight(vector_shuffle(weight, VECTOR_MASK_YYYY), d0.q[0], d1.q[0]);
+	const vector_t w2 = dual_quaternion_blend_weight(vector_shuffle(weight, VECTOR_MASK_ZZZZ), d0.q[0], d2.q[0]);
+	const vector_t w3 = dual_quaternion_blend_weight(vector_shuffle(weight, VECTOR_MASK_WWWW), d0.q[0], d3.q[0]);
+	dual_quaternion_t d;
+	d.q[0] = vector_mul(d0.q[0], w0);
+	d.q[0] = vector_muladd(d1.q[0], w1, d.q[0]);
+	d.q[0] = vector_muladd(d2.q[0], w2, d.q[0]);
+	d.q[0] = vector_muladd(d3.q[0], w3, d.q[0]);
+	d.q[1] = vector_mul(d0.q[1], w0);
+	d.q[1] = vector_muladd(d1.q[1], w1, d.q[1]);
+	d.q[1] = vector_muladd(d2.q[1], w2, d.q[1]);
+	d.q[1] = vector_muladd(d3.q[1], w3, d.q[1]);
+	return dual_quaternion_normalize(d);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_TRANSLATION
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_translation(const dual_quaternion_t d) {
+	// Vector part of 2 * dual * conjugate(real)
+	const quaternion_t r = d.q[0];
+	const quaternion_t e = d.q[1];
+	vector_t t = vector_mul(e, vector_shuffle(r, VECTOR_MASK_WWWW));
+	t = vector_sub(t, vector_mul(r, vector_shuffle(e, VECTOR_MASK_WWWW)));
+	t = vector_add(t, vector_cross3(r, e));
+	return transform_splice_w(vector_add(t, t), vector_zero());
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_TRANSFORM_POINT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_transform_point(const dual_quaternion_t d, const vector_t point) {
+	const vector_t r = vector_add(transform_rotate3(d.q[0], point), dual_quaternion_translation(d));
+	return transform_splice_w(r, vector_one());
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_TRANSFORM_VECTOR
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_transform_vector(const dual_quaternion_t d, const vector_t v) {
+	return transform_splice_w(transform_rotate3(d.q[0], v), vector_zero());
+}
+
+#endif
+
+// Blend the four bones of a skinned point, shared by the skinning array functions
+static FOUNDATION_FORCEINLINE dual_quaternion_t
+dual_quaternion_skin_blend(const dual_quaternion_t* bone, const uint16_t* bone_index, const vector_t weight) {
+	const dual_quaternion_t d0 = bone[bone_index[0]];
+	const dual_quaternion_t d1 = bone[bone_index[1]];
+	const dual_quaternion_t d2 = bone[bone_index[2]];
+	const dual_quaternion_t d3 = bone[bone_index[3]];
+	const vector_t w0 = vector_shuffle(weight, VECTOR_MASK_XXXX);
+	const vector_t w1 = dual_quaternion_blend_weight(vector_shuffle(weight, VECTOR_MASK_YYYY), d0.q[0], d1.q[0]);
+	const vector_t w2 = dual_quaternion_blend_weight(vector_shuffle(weight, VECTOR_MASK_ZZZZ), d0.q[0], d2.q[0]);
+	const vector_t w3 = dual_quaternion_blend_weight(vector_shuffle(weight, VECTOR_MASK_WWWW), d0.q[0], d3.q[0]);
+
+	// Scaling by the inverse length is enough for transforming points, the non-orthogonal part
+	// of the blended dual part only affects the discarded scalar component of the translation
+	dual_quaternion_t d;
+	d.q[0] = vector_mul(d0.q[0], w0);
+	d.q[0] = vector_muladd(d1.q[0], w1, d.q[0]);
+	d.q[0] = vector_muladd(d2.q[0], w2, d.q[0]);
+	d.q[0] = vector_muladd(d3.q[0], w3, d.q[0]);
+	d.q[1] = vector_mul(d0.q[1], w0);
+	d.q[1] = vector_muladd(d1.q[1], w1, d.q[1]);
+	d.q[1] = vector_muladd(d2.q[1], w2, d.q[1]);
+	d.q[1] = vector_muladd(d3.q[1], w3, d.q[1]);
+	const vector_t scale = vector_div(vector_one(), vector_sqrt(vector_dot(d.q[0], d.q[0])));
+	d.q[0] = vector_mul(d.q[0], scale);
+	d.q[1] = vector_mul(d.q[1], scale);
+	return d;
+}
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_SKIN_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+dual_quaternion_skin_array(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                           const uint16_t* bone_index, const vector_t* bone_weight) {
+	for (size_t i = 0; i < count; ++i, bone_index += 4)
+		out[i] = dual_quaternion_transform_point(dual_quaternion_skin_blend(bone, bone_index, bone_weight[i]), in[i]);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_SKIN_ARRAY_STREAM
+
+static FOUNDATION_FORCEINLINE void
+dual_quaternion_skin_array_stream(vector_t* out, const vector_t* in, size_t count, const dual_quaternion_t* bone,
+                                  const uint16_t* bone_index, const vector_t* bone_weight) {
+	// Bone palette is small and stays cached, only the per-vertex streams are prefetched. Prefetch
+	// stops before the end to keep the addresses within the input arrays
+	const size_t prefetch_count = VECTOR_STREAM_PREFETCH_DISTANCE / sizeof(vector_t);
+	const size_t prefetch_end = (count > prefetch_count) ? count - prefetch_count : 0;
+	for (size_t i = 0; i < count; ++i, bone_index += 4) {
+		if (i < prefetch_end) {
+			VECTOR_PREFETCH(in + i + prefetch_count);
+			VECTOR_PREFETCH(bone_weight + i + prefetch_count);
+			VECTOR_PREFETCH(bone_index + prefetch_count * 4);
+		}
+		const dual_quaternion_t d = dual_quaternion_skin_blend(bone, bone_index, bone_weight[i]);
+		vector_stream(out + i, dual_quaternion_transform_point(d, in[i]));
+	}
+	vector_stream_fence();
+}
+
+#endif
+
+#undef VECTOR_HAVE_DUAL_QUATERNION_BLEND_WEIGHT
+#undef VECTOR_HAVE_DUAL_QUATERNION_IDENTITY
+#undef VECTOR_HAVE_DUAL_QUATERNION
+#undef VECTOR_HAVE_DUAL_QUATERNION_FROM_TRANSFORM
+#undef VECTOR_HAVE_DUAL_QUATERNION_MUL
+#undef VECTOR_HAVE_DUAL_QUATERNION_NORMALIZE
+#undef VECTOR_HAVE_DUAL_QUATERNION_BLEND
+#undef VECTOR_HAVE_DUAL_QUATERNION_TRANSLATION
+#undef VECTOR_HAVE_DUAL_QUATERNION_TRANSFORM_POINT
+#undef VECTOR_HAVE_DUAL_QUATERNION_TRANSFORM_VECTOR
+#undef VECTOR_HAVE_DUAL_QUATERNION_SKIN_ARRAY
+#undef VECTOR_HAVE_DUAL_QUATERNION_SKIN_ARRAY_STREAM
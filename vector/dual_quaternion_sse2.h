@@ -0,0 +1,29 @@
+/* dual_quaternion_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_DUAL_QUATERNION_BLEND_WEIGHT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+dual_quaternion_blend_weight(const vector_t weight, const quaternion_t reference, const quaternion_t q) {
+	// Sign bit of the dot product flipped into the weight without branching
+	return _mm_xor_ps(weight, _mm_and_ps(vector_dot(reference, q), _mm_set1_ps(-0.0f)));
+}
+#define VECTOR_HAVE_DUAL_QUATERNION_BLEND_WEIGHT 1
+
+#endif
+
+#include <vector/dual_quaternion_base.h>
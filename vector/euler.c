@@ -23,7 +23,9 @@ euler_angles(real rx, real ry, real rz, euler_angles_order_t order) {
 	v[0] = rx;
 	v[1] = ry;
 	v[2] = rz;
-	*((uint32_t*)v + 3) = order;
+	// Order is stored as the bit pattern of the w component, copy to avoid strict aliasing issues
+	uint32_t bits = (uint32_t)order;
+	memcpy(v + 3, &bits, sizeof(bits));
 	return vector_aligned(v);
 }
 
@@ -54,12 +56,15 @@ quaternion_t
 euler_angles_to_quaternion(const euler_angles_t angles) {
 	// From http://etclab.mie.utoronto.ca/people/david_dir/GEMS/GEMS.html
 	// https://web.archive.org/web/20101204012751/http://etclab.mie.utoronto.ca/people/david_dir/GEMS/GEMS.html
-	uint32_t order = *((const uint32_t*)&angles + 3);
+	float32_t orderbits = vector_w(angles);
+	uint32_t order;
 	real angle[3] = {vector_x(angles), vector_y(angles), vector_z(angles)};
-	real ti, tj, th, ci, cj, ch, si, sj, sh, cc, cs, sc, ss;
+	real ci, cj, ch, si, sj, sh, cc, cs, sc, ss;
+	vector_t sinval, cosval;
 	float32_aligned128_t q[4];
 	unsigned int i, j, k, n, s, f;
 
+	memcpy(&order, &orderbits, sizeof(order));
 	EULER_SPLICE_ORDER_DATA(order);
 
 	if (f == VECTOR_EULER_ROTATEFRAME) {
@@ -70,16 +75,15 @@ euler_angles_to_quaternion(const euler_angles_t angles) {
 	if (n == VECTOR_EULER_ODD)
 		angle[1] = -angle[1];
 
-	ti = angle[0] * 0.5f;
-	tj = angle[1] * 0.5f;
-	th = angle[2] * 0.5f;
+	// All three half angle sines and cosines in one vector operation
+	vector_sincos(vector_mul(vector(angle[0], angle[1], angle[2], 0), vector_half()), &sinval, &cosval);
 
-	ci = math_cos(ti);
-	cj = math_cos(tj);
-	ch = math_cos(th);
-	si = math_sin(ti);
-	sj = math_sin(tj);
-	sh = math_sin(th);
+	ci = vector_x(cosval);
+	cj = vector_y(cosval);
+	ch = vector_z(cosval);
+	si = vector_x(sinval);
+	sj = vector_y(sinval);
+	sh = vector_z(sinval);
 
 	cc = ci * ch;
 	cs = ci * sh;
@@ -104,60 +108,131 @@ euler_angles_to_quaternion(const euler_angles_t angles) {
 	return quaternion_normalize(quaternion_aligned(q));
 }
 
-/*
+void
+euler_angles_to_quaternion_array(quaternion_t* out, const euler_angles_t* angles, size_t count,
+                                 euler_angles_order_t order) {
+	uint32_t lorder = order;
+	unsigned int i, j, k, n, s, f;
+
+	EULER_SPLICE_ORDER_DATA(lorder);
+
+	// Four conversions at a time in structure-of-arrays layout, same algorithm as the
+	// single conversion above with the order handling hoisted out of the loop
+	const vector_t half = vector_half();
+	for (size_t ielem = 0; ielem < count; ielem += 4) {
+		const size_t block_count = (count - ielem < 4) ? (count - ielem) : 4;
+		vector_soa_t block;
+		if (block_count == 4) {
+			block = vector_soa_load(angles + ielem);
+		} else {
+			euler_angles_t pad[4];
+			for (size_t ipad = 0; ipad < 4; ++ipad)
+				pad[ipad] = (ipad < block_count) ? angles[ielem + ipad] : vector_zero();
+			block = vector_soa_load(pad);
+		}
+
+		const vector_t ai = (f == VECTOR_EULER_ROTATEFRAME) ? block.z : block.x;
+		const vector_t aj = (n == VECTOR_EULER_ODD) ? vector_neg(block.y) : block.y;
+		const vector_t ah = (f == VECTOR_EULER_ROTATEFRAME) ? block.x : block.z;
+
+		vector_t ci, cj, ch, si, sj, sh;
+		vector_sincos(vector_mul(ai, half), &si, &ci);
+		vector_sincos(vector_mul(aj, half), &sj, &cj);
+		vector_sincos(vector_mul(ah, half), &sh, &ch);
+
+		const vector_t cc = vector_mul(ci, ch);
+		const vector_t cs = vector_mul(ci, sh);
+		const vector_t sc = vector_mul(si, ch);
+		const vector_t ss = vector_mul(si, sh);
+
+		vector_soa_t q;
+		vector_t* qv[3] = {&q.x, &q.y, &q.z};
+		if (s == VECTOR_EULER_REPEAT) {
+			*qv[i] = vector_mul(cj, vector_add(cs, sc));
+			*qv[j] = vector_mul(sj, vector_add(cc, ss));
+			*qv[k] = vector_mul(sj, vector_sub(cs, sc));
+			q.w = vector_mul(cj, vector_sub(cc, ss));
+		} else {
+			*qv[i] = vector_sub(vector_mul(cj, sc), vector_mul(sj, cs));
+			*qv[j] = vector_add(vector_mul(cj, ss), vector_mul(sj, cc));
+			*qv[k] = vector_sub(vector_mul(cj, cs), vector_mul(sj, sc));
+			q.w = vector_add(vector_mul(cj, cc), vector_mul(sj, ss));
+		}
+
+		if (n == VECTOR_EULER_ODD)
+			*qv[j] = vector_neg(*qv[j]);
+
+		q = vector_soa_scale(q, vector_div(vector_one(), vector_sqrt(vector_soa_dot(q, q))));
+
+		if (block_count == 4) {
+			vector_soa_store(out + ielem, q);
+		} else {
+			quaternion_t result[4];
+			vector_soa_store(result, q);
+			for (size_t ipad = 0; ipad < block_count; ++ipad)
+				out[ielem + ipad] = result[ipad];
+		}
+	}
+}
+
 euler_angles_t
-euler_angles_from_quaterion(const quaternion_t q, euler_angles_order_t order) {
-    uint32_t lorder = order;
-    matrix_t mat = quaternion_to_matrix(q);
-
-    //From http://etclab.mie.utoronto.ca/people/david_dir/GEMS/GEMS.html
-    //https://web.archive.org/web/20101204012751/http://etclab.mie.utoronto.ca/people/david_dir/GEMS/GEMS.html
-    int i,j,k,n,s,f;
-    float32_aligned128_t angles[4];
-
-    EULER_SPLICE_ORDER_DATA(lorder);
-
-    if (s == VECTOR_EULER_REPEAT) {
-        real sy = math_sqrt(mat.frow[j][i] * mat.frow[j][i] + mat.frow[k][i] * mat.frow[k][i]);
-
-        if (!fltzero(sy)) {
-            angles[0] = math_atan2(mat.frow[j][i],  mat.frow[k][i]);
-            angles[1] = math_atan2(sy,              mat.frow[i][i]);
-            angles[2] = math_atan2(mat.frow[i][j], -mat.frow[i][k]);
-        }
-        else {
-            angles[0] = math_atan2(-mat.frow[k][j], mat.frow[j][j]);
-            angles[1] = math_atan2(sy,              mat.frow[i][i]);
-            angles[2] = 0.0f;
-        }
-    }
-    else
-    {
-        real cy = math_sqrt(mat.frow[i][i] * mat.frow[i][i] + mat.frow[i][j] * mat.frow[i][j]);
-
-        if (!fltzero(cy)) {
-            angles[0] = math_atan2( mat.frow[j][k], mat.frow[k][k]);
-            angles[1] = math_atan2(-mat.frow[i][k], cy            );
-            angles[2] = math_atan2( mat.frow[i][j], mat.frow[i][i]);
-        }
-        else {
-            angles[0] = math_atan2(-mat.frow[k][j], mat.frow[j][j]);
-            angles[1] = math_atan2(-mat.frow[i][k], cy            );
-            angles[2] = 0.0f;
-        }
-    }
-
-    if (n == VECTOR_EULER_ODD) {
-        angles[0] = -angles[0];
-        angles[1] = -angles[1];
-        angles[2] = -angles[2];
-    }
-    if (f == VECTOR_EULER_ROTATEFRAME) {
-        real t = angles[0];
-        angles[0] = angles[2];
-        angles[2] = t;
-    }
-
-    return euler_angles(vector_aligned(angles), order);
+euler_angles_from_quaternion(const quaternion_t q, euler_angles_order_t order) {
+	// From http://etclab.mie.utoronto.ca/people/david_dir/GEMS/GEMS.html
+	// https://web.archive.org/web/20101204012751/http://etclab.mie.utoronto.ca/people/david_dir/GEMS/GEMS.html
+	// using the rotation matrix in the column vector convention of the reference
+	uint32_t lorder = order;
+	const real qx = vector_x(q);
+	const real qy = vector_y(q);
+	const real qz = vector_z(q);
+	const real qw = vector_w(q);
+	const real norm = qx * qx + qy * qy + qz * qz + qw * qw;
+	const real scale = (norm > 0) ? (REAL_C(2.0) / norm) : 0;
+	const real xs = qx * scale, ys = qy * scale, zs = qz * scale;
+	const real wx = qw * xs, wy = qw * ys, wz = qw * zs;
+	const real xx = qx * xs, xy = qx * ys, xz = qx * zs;
+	const real yy = qy * ys, yz = qy * zs, zz = qz * zs;
+	const real mat[3][3] = {{REAL_C(1.0) - (yy + zz), xy - wz, xz + wy},
+	                        {xy + wz, REAL_C(1.0) - (xx + zz), yz - wx},
+	                        {xz - wy, yz + wx, REAL_C(1.0) - (xx + yy)}};
+	real angles[3];
+	unsigned int i, j, k, n, s, f;
+
+	EULER_SPLICE_ORDER_DATA(lorder);
+
+	if (s == VECTOR_EULER_REPEAT) {
+		const real sy = math_sqrt(mat[i][j] * mat[i][j] + mat[i][k] * mat[i][k]);
+		if (!math_real_is_zero(sy)) {
+			angles[0] = math_atan2(mat[i][j], mat[i][k]);
+			angles[1] = math_atan2(sy, mat[i][i]);
+			angles[2] = math_atan2(mat[j][i], -mat[k][i]);
+		} else {
+			angles[0] = math_atan2(-mat[j][k], mat[j][j]);
+			angles[1] = math_atan2(sy, mat[i][i]);
+			angles[2] = 0;
+		}
+	} else {
+		const real cy = math_sqrt(mat[i][i] * mat[i][i] + mat[j][i] * mat[j][i]);
+		if (!math_real_is_zero(cy)) {
+			angles[0] = math_atan2(mat[k][j], mat[k][k]);
+			angles[1] = math_atan2(-mat[k][i], cy);
+			angles[2] = math_atan2(mat[j][i], mat[i][i]);
+		} else {
+			angles[0] = math_atan2(-mat[j][k], mat[j][j]);
+			angles[1] = math_atan2(-mat[k][i], cy);
+			angles[2] = 0;
+		}
+	}
+
+	if (n == VECTOR_EULER_ODD) {
+		angles[0] = -angles[0];
+		angles[1] = -angles[1];
+		angles[2] = -angles[2];
+	}
+	if (f == VECTOR_EULER_ROTATEFRAME) {
+		real t = angles[0];
+		angles[0] = angles[2];
+		angles[2] = t;
+	}
+
+	return euler_angles(angles[0], angles[1], angles[2], order);
 }
-*/
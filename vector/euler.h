@@ -31,5 +31,12 @@ euler_angles(real rx, real ry, real rz, euler_angles_order_t order);
 VECTOR_API quaternion_t
 euler_angles_to_quaternion(const euler_angles_t angles);
 
-// VECTOR_API euler_angles_t
-// euler_angles_from_quaternion(const quaternion_t q, euler_angles_order_t order);
+//! Convert array of euler angles sharing the same rotation order to quaternions, four at a time
+//! with vectorized sine and cosine. The order stored in the w component of the input is ignored
+VECTOR_API void
+euler_angles_to_quaternion_array(quaternion_t* out, const euler_angles_t* angles, size_t count,
+                                 euler_angles_order_t order);
+
+//! Convert unit quaternion to euler angles in the given rotation order
+VECTOR_API euler_angles_t
+euler_angles_from_quaternion(const quaternion_t q, euler_angles_order_t order);
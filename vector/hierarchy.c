@@ -0,0 +1,186 @@
+/* hierarchy.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data types and
+ * functions to write applications and games in a platform-independent fashion. The latest source code is
+ * always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any restrictions.
+ *
+ */
+
+
+#include <foundation/foundation.h>
+
+#include <vector/vector.h>
+#include <vector/internal.h>
+
+int
+vector_hierarchy_initialize(vector_hierarchy_t* hierarchy, size_t capacity) {
+	const size_t words = (capacity + 31) / 32;
+	const size_t size = (sizeof(matrix_t) * 2 + sizeof(uint32_t) * 4) * capacity + sizeof(uint32_t) * words;
+	memset(hierarchy, 0, sizeof(vector_hierarchy_t));
+	char* memory = memory_allocate(HASH_VECTOR, size, 16, MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+	if (!memory)
+		return -1;
+	hierarchy->local = (matrix_t*)memory;
+	hierarchy->world = hierarchy->local + capacity;
+	hierarchy->parent = (int32_t*)(hierarchy->world + capacity);
+	hierarchy->subtree_end = (uint32_t*)(hierarchy->parent + capacity);
+	hierarchy->slot = hierarchy->subtree_end + capacity;
+	hierarchy->parent_node = (int32_t*)(hierarchy->slot + capacity);
+	hierarchy->dirty = (uint32_t*)(hierarchy->parent_node + capacity);
+	hierarchy->capacity = capacity;
+	return 0;
+}
+
+void
+vector_hierarchy_finalize(vector_hierarchy_t* hierarchy) {
+	memory_deallocate(hierarchy->local);
+	memset(hierarchy, 0, sizeof(vector_hierarchy_t));
+}
+
+int32_t
+vector_hierarchy_add(vector_hierarchy_t* hierarchy, int32_t parent, const matrix_t local) {
+	if ((hierarchy->count >= hierarchy->capacity) || (parent >= (int32_t)hierarchy->count))
+		return -1;
+
+	// New nodes are appended to the slots, which keeps the depth-first order for roots and for
+	// children of the subtree ending at the last slot
+	const uint32_t node = (uint32_t)hierarchy->count++;
+	const int32_t parent_slot = (parent >= 0) ? (int32_t)hierarchy->slot[parent] : -1;
+	hierarchy->slot[node] = node;
+	hierarchy->parent_node[node] = (parent >= 0) ? parent : -1;
+	hierarchy->local[node] = local;
+	hierarchy->parent[node] = parent_slot;
+	hierarchy->subtree_end[node] = node + 1;
+	if (parent_slot >= 0) {
+		if (hierarchy->subtree_end[parent_slot] == node) {
+			for (int32_t ancestor = parent_slot; ancestor >= 0; ancestor = hierarchy->parent[ancestor])
+				hierarchy->subtree_end[ancestor] = node + 1;
+		} else {
+			hierarchy->reorder = true;
+		}
+	}
+	vector_hierarchy_mark_dirty(hierarchy, node);
+	return (int32_t)node;
+}
+
+int
+vector_hierarchy_set_parent(vector_hierarchy_t* hierarchy, uint32_t node, int32_t parent) {
+	if ((node >= hierarchy->count) || (parent >= (int32_t)hierarchy->count))
+		return -1;
+	for (int32_t ancestor = parent; ancestor >= 0; ancestor = hierarchy->parent_node[ancestor]) {
+		if (ancestor == (int32_t)node)
+			return -1;
+	}
+	hierarchy->parent_node[node] = (parent >= 0) ? parent : -1;
+	hierarchy->reorder = true;
+	return 0;
+}
+
+void
+vector_hierarchy_set_local_transform(vector_hierarchy_t* hierarchy, uint32_t node, const transform_t local) {
+	vector_hierarchy_set_local(hierarchy, node, transform_to_matrix(local));
+}
+
+static int
+vector_hierarchy_reorder(vector_hierarchy_t* hierarchy) {
+	const size_t count = hierarchy->count;
+	size_t i;
+
+	// Copy of the local matrices followed by the child list offsets of each node, the child list,
+	// the depth-first stack and the node of each new slot
+	matrix_t* copy = memory_allocate(HASH_VECTOR, (sizeof(matrix_t) + sizeof(uint32_t) * 4) * count + sizeof(uint32_t),
+	                                 16, MEMORY_TEMPORARY | MEMORY_ZERO_INITIALIZED);
+	if (!copy)
+		return -1;
+	uint32_t* first = (uint32_t*)(copy + count);
+	uint32_t* child = first + count + 1;
+	uint32_t* stack = child + count;
+	uint32_t* order = stack + count;
+
+	// Children are listed in node order, with order used as the fill cursor of each list
+	for (i = 0; i < count; ++i) {
+		if (hierarchy->parent_node[i] >= 0)
+			++first[hierarchy->parent_node[i] + 1];
+	}
+	for (i = 0; i < count; ++i) {
+		first[i + 1] += first[i];
+		order[i] = first[i];
+	}
+	for (i = 0; i < count; ++i) {
+		if (hierarchy->parent_node[i] >= 0)
+			child[order[hierarchy->parent_node[i]]++] = (uint32_t)i;
+	}
+
+	// Depth-first traversal visiting roots and children in node order
+	size_t top = 0;
+	size_t next = 0;
+	for (i = count; i-- > 0;) {
+		if (hierarchy->parent_node[i] < 0)
+			stack[top++] = (uint32_t)i;
+	}
+	while (top) {
+		const uint32_t node = stack[--top];
+		order[next++] = node;
+		for (uint32_t c = first[node + 1]; c-- > first[node];)
+			stack[top++] = child[c];
+	}
+
+	for (i = 0; i < count; ++i)
+		copy[i] = hierarchy->local[hierarchy->slot[order[i]]];
+	memcpy(hierarchy->local, copy, sizeof(matrix_t) * count);
+	for (i = 0; i < count; ++i)
+		hierarchy->slot[order[i]] = (uint32_t)i;
+	for (i = 0; i < count; ++i) {
+		const int32_t parent = hierarchy->parent_node[order[i]];
+		hierarchy->parent[i] = (parent >= 0) ? (int32_t)hierarchy->slot[parent] : -1;
+		hierarchy->subtree_end[i] = (uint32_t)i + 1;
+	}
+	for (i = count; i-- > 0;) {
+		const int32_t parent = hierarchy->parent[i];
+		if ((parent >= 0) && (hierarchy->subtree_end[i] > hierarchy->subtree_end[parent]))
+			hierarchy->subtree_end[parent] = hierarchy->subtree_end[i];
+	}
+
+	memory_deallocate(copy);
+	hierarchy->reorder = false;
+	return 0;
+}
+
+int
+vector_hierarchy_update(vector_hierarchy_t* hierarchy) {
+	const size_t count = hierarchy->count;
+	const size_t words = (count + 31) / 32;
+
+	if (hierarchy->reorder) {
+		if (vector_hierarchy_reorder(hierarchy) < 0)
+			return -1;
+		matrix_batch_mul_chain(hierarchy->world, hierarchy->local, hierarchy->parent, count);
+		memset(hierarchy->dirty, 0, sizeof(uint32_t) * words);
+		return 0;
+	}
+
+	// Dirty slots are visited in order, so parents are updated before their children and a dirty
+	// slot inside an already recomputed subtree is skipped
+	size_t covered = 0;
+	for (size_t word = 0; word < words; ++word) {
+		uint32_t mask = hierarchy->dirty[word];
+		if (!mask)
+			continue;
+		hierarchy->dirty[word] = 0;
+		for (size_t slot = word * 32; mask; ++slot, mask >>= 1) {
+			if (!(mask & 1) || (slot < covered))
+				continue;
+			covered = hierarchy->subtree_end[slot];
+			matrix_batch_mul_chain_range(hierarchy->world, hierarchy->local, hierarchy->parent, slot, covered);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,108 @@
+/* hierarchy.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file hierarchy.h
+    Node hierarchy with cached world matrices. Nodes are kept in depth-first order in flat arrays
+    of local and world matrices and parent slots, so every subtree is a contiguous range of slots.
+    Changing a local matrix marks the node dirty, and an update recomputes only the world matrices
+    of the dirty subtrees with the batch matrix_mul_chain_range kernel. Nodes are identified by the
+    index returned when they were added, which is stable when slots are reordered. Adding a child
+    to the most recently added subtree (depth-first construction) keeps the order, other additions
+    and reparenting reorder the slots at the next update. Hierarchies are not thread safe */
+
+#include <foundation/platform.h>
+#include <foundation/types.h>
+
+#include <vector/types.h>
+
+//! Initialize hierarchy with room for the given number of nodes, returns 0 if successful and <0
+//! if the arrays could not be allocated
+VECTOR_API int
+vector_hierarchy_initialize(vector_hierarchy_t* hierarchy, size_t capacity);
+
+//! Release the arrays of the hierarchy
+VECTOR_API void
+vector_hierarchy_finalize(vector_hierarchy_t* hierarchy);
+
+//! Add node with the given parent node (negative for a root) and local matrix, returns the node
+//! index or <0 if the hierarchy is full or the parent is invalid
+VECTOR_API int32_t
+vector_hierarchy_add(vector_hierarchy_t* hierarchy, int32_t parent, const matrix_t local);
+
+//! Move node and its subtree to a new parent node (negative to make it a root), returns 0 if
+//! successful and <0 if the parent is invalid or inside the subtree of the node
+VECTOR_API int
+vector_hierarchy_set_parent(vector_hierarchy_t* hierarchy, uint32_t node, int32_t parent);
+
+//! Set local matrix of node from a transform and mark it dirty, see vector_hierarchy_set_local
+VECTOR_API void
+vector_hierarchy_set_local_transform(vector_hierarchy_t* hierarchy, uint32_t node, const transform_t local);
+
+//! Recompute world matrices of all dirty subtrees. The dirty bits are scanned a word of 32 slots
+//! at a time and a subtree is recomputed once even if several of its nodes are dirty. If the slots
+//! must be reordered all world matrices are recomputed. Returns 0 if successful and <0 if the
+//! temporary memory for reordering could not be allocated, in which case nothing is updated
+VECTOR_API int
+vector_hierarchy_update(vector_hierarchy_t* hierarchy);
+
+//! Set local matrix of node and mark it dirty
+static FOUNDATION_FORCEINLINE void
+vector_hierarchy_set_local(vector_hierarchy_t* hierarchy, uint32_t node, const matrix_t local);
+
+//! Local matrix of node
+static FOUNDATION_FORCEINLINE const matrix_t*
+vector_hierarchy_local(const vector_hierarchy_t* hierarchy, uint32_t node);
+
+//! World matrix of node as of the last update
+static FOUNDATION_FORCEINLINE const matrix_t*
+vector_hierarchy_world(const vector_hierarchy_t* hierarchy, uint32_t node);
+
+//! Parent node of node, negative for a root
+static FOUNDATION_FORCEINLINE int32_t
+vector_hierarchy_parent(const vector_hierarchy_t* hierarchy, uint32_t node);
+
+//! Mark node dirty, used by vector_hierarchy_set_local
+static FOUNDATION_FORCEINLINE void
+vector_hierarchy_mark_dirty(vector_hierarchy_t* hierarchy, uint32_t node);
+
+static FOUNDATION_FORCEINLINE void
+vector_hierarchy_mark_dirty(vector_hierarchy_t* hierarchy, uint32_t node) {
+	const uint32_t slot = hierarchy->slot[node];
+	hierarchy->dirty[slot >> 5] |= 1U << (slot & 31);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_hierarchy_set_local(vector_hierarchy_t* hierarchy, uint32_t node, const matrix_t local) {
+	hierarchy->local[hierarchy->slot[node]] = local;
+	vector_hierarchy_mark_dirty(hierarchy, node);
+}
+
+static FOUNDATION_FORCEINLINE const matrix_t*
+vector_hierarchy_local(const vector_hierarchy_t* hierarchy, uint32_t node) {
+	return hierarchy->local + hierarchy->slot[node];
+}
+
+static FOUNDATION_FORCEINLINE const matrix_t*
+vector_hierarchy_world(const vector_hierarchy_t* hierarchy, uint32_t node) {
+	return hierarchy->world + hierarchy->slot[node];
+}
+
+static FOUNDATION_FORCEINLINE int32_t
+vector_hierarchy_parent(const vector_hierarchy_t* hierarchy, uint32_t node) {
+	return hierarchy->parent_node[node];
+}
@@ -26,3 +26,42 @@
 
 #include <vector/types.h>
 #include <vector/hashstrings.h>
+
+//! Start the worker threads for the parallel batch functions
+int
+vector_parallel_initialize(const vector_config_t config);
+
+//! Stop and join the worker threads
+void
+vector_parallel_finalize(void);
+
+//! Allocate the buffer of the module frame arena
+int
+vector_frame_arena_initialize(const vector_config_t config);
+
+//! Release the module frame arena
+void
+vector_frame_arena_finalize(void);
+
+#if VECTOR_ENABLE_PROFILING
+
+#include <foundation/time.h>
+
+//! Add a call processing the given number of elements which started at the given tick to the
+//! counters of the calling thread
+void
+vector_profile_record(vector_profile_id_t id, size_t elements, tick_t start);
+
+#define VECTOR_PROFILE_BEGIN() const tick_t vector_profile_start = time_current()
+#define VECTOR_PROFILE_END(id, elements) vector_profile_record(id, elements, vector_profile_start)
+
+#else
+
+#define VECTOR_PROFILE_BEGIN() \
+	do {                       \
+	} while (0)
+#define VECTOR_PROFILE_END(id, elements) \
+	do {                                 \
+	} while (0)
+
+#endif
@@ -288,3 +288,273 @@
 #define VECTOR_MASK_WWWY VECTOR_MASK(3, 3, 3, 1)
 #define VECTOR_MASK_WWWZ VECTOR_MASK(3, 3, 3, 2)
 #define VECTOR_MASK_WWWW VECTOR_MASK(3, 3, 3, 3)
+
+/* Shuffles specialized per mask, vector_shuffle_abcd(v) is equal to
+   vector_shuffle(v, VECTOR_MASK_abcd) but compiles to a fixed instruction sequence
+   chosen for the mask. On SSE this is an immediate pshufd, the NEON sequences are
+   generated by maskgen --neon into mask_neon.h, which also routes vector_shuffle
+   with a constant mask to them */
+#if VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+#define VECTOR_SHUFFLE_IMMEDIATE(v, mask) _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(v), mask))
+#elif !VECTOR_IMPLEMENTATION_NEON
+#define VECTOR_SHUFFLE_IMMEDIATE(v, mask) vector_shuffle(v, mask)
+#endif
+
+#if !VECTOR_IMPLEMENTATION_NEON
+#define vector_shuffle_XXXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXXX)
+#define vector_shuffle_XXXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXXY)
+#define vector_shuffle_XXXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXXZ)
+#define vector_shuffle_XXXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXXW)
+#define vector_shuffle_XXYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXYX)
+#define vector_shuffle_XXYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXYY)
+#define vector_shuffle_XXYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXYZ)
+#define vector_shuffle_XXYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXYW)
+#define vector_shuffle_XXZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXZX)
+#define vector_shuffle_XXZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXZY)
+#define vector_shuffle_XXZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXZZ)
+#define vector_shuffle_XXZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXZW)
+#define vector_shuffle_XXWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXWX)
+#define vector_shuffle_XXWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXWY)
+#define vector_shuffle_XXWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXWZ)
+#define vector_shuffle_XXWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XXWW)
+#define vector_shuffle_XYXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYXX)
+#define vector_shuffle_XYXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYXY)
+#define vector_shuffle_XYXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYXZ)
+#define vector_shuffle_XYXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYXW)
+#define vector_shuffle_XYYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYYX)
+#define vector_shuffle_XYYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYYY)
+#define vector_shuffle_XYYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYYZ)
+#define vector_shuffle_XYYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYYW)
+#define vector_shuffle_XYZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYZX)
+#define vector_shuffle_XYZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYZY)
+#define vector_shuffle_XYZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYZZ)
+#define vector_shuffle_XYZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYZW)
+#define vector_shuffle_XYWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYWX)
+#define vector_shuffle_XYWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYWY)
+#define vector_shuffle_XYWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYWZ)
+#define vector_shuffle_XYWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XYWW)
+#define vector_shuffle_XZXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZXX)
+#define vector_shuffle_XZXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZXY)
+#define vector_shuffle_XZXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZXZ)
+#define vector_shuffle_XZXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZXW)
+#define vector_shuffle_XZYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZYX)
+#define vector_shuffle_XZYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZYY)
+#define vector_shuffle_XZYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZYZ)
+#define vector_shuffle_XZYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZYW)
+#define vector_shuffle_XZZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZZX)
+#define vector_shuffle_XZZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZZY)
+#define vector_shuffle_XZZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZZZ)
+#define vector_shuffle_XZZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZZW)
+#define vector_shuffle_XZWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZWX)
+#define vector_shuffle_XZWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZWY)
+#define vector_shuffle_XZWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZWZ)
+#define vector_shuffle_XZWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XZWW)
+#define vector_shuffle_XWXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWXX)
+#define vector_shuffle_XWXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWXY)
+#define vector_shuffle_XWXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWXZ)
+#define vector_shuffle_XWXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWXW)
+#define vector_shuffle_XWYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWYX)
+#define vector_shuffle_XWYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWYY)
+#define vector_shuffle_XWYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWYZ)
+#define vector_shuffle_XWYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWYW)
+#define vector_shuffle_XWZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWZX)
+#define vector_shuffle_XWZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWZY)
+#define vector_shuffle_XWZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWZZ)
+#define vector_shuffle_XWZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWZW)
+#define vector_shuffle_XWWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWWX)
+#define vector_shuffle_XWWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWWY)
+#define vector_shuffle_XWWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWWZ)
+#define vector_shuffle_XWWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_XWWW)
+#define vector_shuffle_YXXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXXX)
+#define vector_shuffle_YXXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXXY)
+#define vector_shuffle_YXXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXXZ)
+#define vector_shuffle_YXXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXXW)
+#define vector_shuffle_YXYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXYX)
+#define vector_shuffle_YXYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXYY)
+#define vector_shuffle_YXYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXYZ)
+#define vector_shuffle_YXYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXYW)
+#define vector_shuffle_YXZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXZX)
+#define vector_shuffle_YXZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXZY)
+#define vector_shuffle_YXZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXZZ)
+#define vector_shuffle_YXZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXZW)
+#define vector_shuffle_YXWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXWX)
+#define vector_shuffle_YXWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXWY)
+#define vector_shuffle_YXWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXWZ)
+#define vector_shuffle_YXWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YXWW)
+#define vector_shuffle_YYXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYXX)
+#define vector_shuffle_YYXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYXY)
+#define vector_shuffle_YYXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYXZ)
+#define vector_shuffle_YYXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYXW)
+#define vector_shuffle_YYYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYYX)
+#define vector_shuffle_YYYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYYY)
+#define vector_shuffle_YYYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYYZ)
+#define vector_shuffle_YYYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYYW)
+#define vector_shuffle_YYZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYZX)
+#define vector_shuffle_YYZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYZY)
+#define vector_shuffle_YYZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYZZ)
+#define vector_shuffle_YYZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYZW)
+#define vector_shuffle_YYWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYWX)
+#define vector_shuffle_YYWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYWY)
+#define vector_shuffle_YYWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYWZ)
+#define vector_shuffle_YYWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YYWW)
+#define vector_shuffle_YZXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZXX)
+#define vector_shuffle_YZXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZXY)
+#define vector_shuffle_YZXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZXZ)
+#define vector_shuffle_YZXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZXW)
+#define vector_shuffle_YZYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZYX)
+#define vector_shuffle_YZYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZYY)
+#define vector_shuffle_YZYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZYZ)
+#define vector_shuffle_YZYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZYW)
+#define vector_shuffle_YZZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZZX)
+#define vector_shuffle_YZZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZZY)
+#define vector_shuffle_YZZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZZZ)
+#define vector_shuffle_YZZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZZW)
+#define vector_shuffle_YZWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZWX)
+#define vector_shuffle_YZWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZWY)
+#define vector_shuffle_YZWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZWZ)
+#define vector_shuffle_YZWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YZWW)
+#define vector_shuffle_YWXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWXX)
+#define vector_shuffle_YWXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWXY)
+#define vector_shuffle_YWXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWXZ)
+#define vector_shuffle_YWXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWXW)
+#define vector_shuffle_YWYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWYX)
+#define vector_shuffle_YWYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWYY)
+#define vector_shuffle_YWYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWYZ)
+#define vector_shuffle_YWYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWYW)
+#define vector_shuffle_YWZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWZX)
+#define vector_shuffle_YWZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWZY)
+#define vector_shuffle_YWZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWZZ)
+#define vector_shuffle_YWZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWZW)
+#define vector_shuffle_YWWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWWX)
+#define vector_shuffle_YWWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWWY)
+#define vector_shuffle_YWWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWWZ)
+#define vector_shuffle_YWWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_YWWW)
+#define vector_shuffle_ZXXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXXX)
+#define vector_shuffle_ZXXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXXY)
+#define vector_shuffle_ZXXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXXZ)
+#define vector_shuffle_ZXXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXXW)
+#define vector_shuffle_ZXYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXYX)
+#define vector_shuffle_ZXYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXYY)
+#define vector_shuffle_ZXYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXYZ)
+#define vector_shuffle_ZXYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXYW)
+#define vector_shuffle_ZXZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXZX)
+#define vector_shuffle_ZXZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXZY)
+#define vector_shuffle_ZXZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXZZ)
+#define vector_shuffle_ZXZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXZW)
+#define vector_shuffle_ZXWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXWX)
+#define vector_shuffle_ZXWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXWY)
+#define vector_shuffle_ZXWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXWZ)
+#define vector_shuffle_ZXWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZXWW)
+#define vector_shuffle_ZYXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYXX)
+#define vector_shuffle_ZYXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYXY)
+#define vector_shuffle_ZYXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYXZ)
+#define vector_shuffle_ZYXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYXW)
+#define vector_shuffle_ZYYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYYX)
+#define vector_shuffle_ZYYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYYY)
+#define vector_shuffle_ZYYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYYZ)
+#define vector_shuffle_ZYYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYYW)
+#define vector_shuffle_ZYZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYZX)
+#define vector_shuffle_ZYZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYZY)
+#define vector_shuffle_ZYZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYZZ)
+#define vector_shuffle_ZYZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYZW)
+#define vector_shuffle_ZYWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYWX)
+#define vector_shuffle_ZYWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYWY)
+#define vector_shuffle_ZYWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYWZ)
+#define vector_shuffle_ZYWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZYWW)
+#define vector_shuffle_ZZXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZXX)
+#define vector_shuffle_ZZXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZXY)
+#define vector_shuffle_ZZXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZXZ)
+#define vector_shuffle_ZZXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZXW)
+#define vector_shuffle_ZZYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZYX)
+#define vector_shuffle_ZZYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZYY)
+#define vector_shuffle_ZZYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZYZ)
+#define vector_shuffle_ZZYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZYW)
+#define vector_shuffle_ZZZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZZX)
+#define vector_shuffle_ZZZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZZY)
+#define vector_shuffle_ZZZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZZZ)
+#define vector_shuffle_ZZZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZZW)
+#define vector_shuffle_ZZWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZWX)
+#define vector_shuffle_ZZWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZWY)
+#define vector_shuffle_ZZWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZWZ)
+#define vector_shuffle_ZZWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZZWW)
+#define vector_shuffle_ZWXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWXX)
+#define vector_shuffle_ZWXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWXY)
+#define vector_shuffle_ZWXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWXZ)
+#define vector_shuffle_ZWXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWXW)
+#define vector_shuffle_ZWYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWYX)
+#define vector_shuffle_ZWYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWYY)
+#define vector_shuffle_ZWYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWYZ)
+#define vector_shuffle_ZWYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWYW)
+#define vector_shuffle_ZWZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWZX)
+#define vector_shuffle_ZWZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWZY)
+#define vector_shuffle_ZWZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWZZ)
+#define vector_shuffle_ZWZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWZW)
+#define vector_shuffle_ZWWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWWX)
+#define vector_shuffle_ZWWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWWY)
+#define vector_shuffle_ZWWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWWZ)
+#define vector_shuffle_ZWWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_ZWWW)
+#define vector_shuffle_WXXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXXX)
+#define vector_shuffle_WXXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXXY)
+#define vector_shuffle_WXXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXXZ)
+#define vector_shuffle_WXXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXXW)
+#define vector_shuffle_WXYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXYX)
+#define vector_shuffle_WXYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXYY)
+#define vector_shuffle_WXYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXYZ)
+#define vector_shuffle_WXYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXYW)
+#define vector_shuffle_WXZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXZX)
+#define vector_shuffle_WXZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXZY)
+#define vector_shuffle_WXZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXZZ)
+#define vector_shuffle_WXZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXZW)
+#define vector_shuffle_WXWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXWX)
+#define vector_shuffle_WXWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXWY)
+#define vector_shuffle_WXWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXWZ)
+#define vector_shuffle_WXWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WXWW)
+#define vector_shuffle_WYXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYXX)
+#define vector_shuffle_WYXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYXY)
+#define vector_shuffle_WYXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYXZ)
+#define vector_shuffle_WYXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYXW)
+#define vector_shuffle_WYYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYYX)
+#define vector_shuffle_WYYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYYY)
+#define vector_shuffle_WYYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYYZ)
+#define vector_shuffle_WYYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYYW)
+#define vector_shuffle_WYZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYZX)
+#define vector_shuffle_WYZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYZY)
+#define vector_shuffle_WYZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYZZ)
+#define vector_shuffle_WYZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYZW)
+#define vector_shuffle_WYWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYWX)
+#define vector_shuffle_WYWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYWY)
+#define vector_shuffle_WYWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYWZ)
+#define vector_shuffle_WYWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WYWW)
+#define vector_shuffle_WZXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZXX)
+#define vector_shuffle_WZXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZXY)
+#define vector_shuffle_WZXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZXZ)
+#define vector_shuffle_WZXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZXW)
+#define vector_shuffle_WZYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZYX)
+#define vector_shuffle_WZYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZYY)
+#define vector_shuffle_WZYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZYZ)
+#define vector_shuffle_WZYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZYW)
+#define vector_shuffle_WZZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZZX)
+#define vector_shuffle_WZZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZZY)
+#define vector_shuffle_WZZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZZZ)
+#define vector_shuffle_WZZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZZW)
+#define vector_shuffle_WZWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZWX)
+#define vector_shuffle_WZWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZWY)
+#define vector_shuffle_WZWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZWZ)
+#define vector_shuffle_WZWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WZWW)
+#define vector_shuffle_WWXX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWXX)
+#define vector_shuffle_WWXY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWXY)
+#define vector_shuffle_WWXZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWXZ)
+#define vector_shuffle_WWXW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWXW)
+#define vector_shuffle_WWYX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWYX)
+#define vector_shuffle_WWYY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWYY)
+#define vector_shuffle_WWYZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWYZ)
+#define vector_shuffle_WWYW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWYW)
+#define vector_shuffle_WWZX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWZX)
+#define vector_shuffle_WWZY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWZY)
+#define vector_shuffle_WWZZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWZZ)
+#define vector_shuffle_WWZW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWZW)
+#define vector_shuffle_WWWX(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWWX)
+#define vector_shuffle_WWWY(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWWY)
+#define vector_shuffle_WWWZ(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWWZ)
+#define vector_shuffle_WWWW(v) VECTOR_SHUFFLE_IMMEDIATE(v, VECTOR_MASK_WWWW)
+#endif
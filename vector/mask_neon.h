@@ -0,0 +1,3906 @@
+/* mask_neon.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file mask_neon.h
+    NEON shuffles specialized per mask, generated by maskgen --neon. Each mask maps to
+    the cheapest of a single permute (rev64, ext, zip, uzp, trn, dup), two half vector
+    permutes combined, or one of those followed by single lane copies, and to a table
+    lookup on AArch64 when that is cheaper */
+
+#include <vector/types.h>
+#include <vector/mask.h>
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXXX(const vector_t v) {
+#if defined(__aarch64__)
+	return vdupq_laneq_f32(v, 0);
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	return vdupq_lane_f32(lo, 0);
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXYX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXYY(const vector_t v) {
+#if defined(__aarch64__)
+	return vzip1q_f32(v, v);
+#else
+	return vzipq_f32(v, v).val[0];
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 0, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXZZ(const vector_t v) {
+#if defined(__aarch64__)
+	return vtrn1q_f32(v, v);
+#else
+	return vtrnq_f32(v, v).val[0];
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 0);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 0, v, 0);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XXWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYXY(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	return vcombine_f32(lo, lo);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYYX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYZW(const vector_t v) {
+	return v;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XYWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZXZ(const vector_t v) {
+#if defined(__aarch64__)
+	return vuzp1q_f32(v, v);
+#else
+	return vuzpq_f32(v, v).val[0];
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 0, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XZWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 0);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 0, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWYZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWWX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 12, 13, 14, 15, 12, 13, 14, 15, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 12, 13, 14, 15, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWWZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {0, 1, 2, 3, 12, 13, 14, 15, 12, 13, 14, 15, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_XWWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 0);
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXXY(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	return vcombine_f32(vrev64_f32(lo), lo);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXXW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXZX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 2, v, 2);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXWZ(const vector_t v) {
+	return vrev64q_f32(v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YXWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 3, v, 3);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 1);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYXZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYYX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYYY(const vector_t v) {
+#if defined(__aarch64__)
+	return vdupq_laneq_f32(v, 1);
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	return vdupq_lane_f32(lo, 1);
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 1, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vtrn2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vtrnq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 1, v, 1);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YYWW(const vector_t v) {
+#if defined(__aarch64__)
+	return vtrn2q_f32(v, v);
+#else
+	return vtrnq_f32(v, v).val[1];
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZXY(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(vext_f32(lo, hi, 1), lo);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZXW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZYX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 1);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZYZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 8, 9, 10, 11, 4, 5, 6, 7, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 2, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 8, 9, 10, 11, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 2);
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZWX(const vector_t v) {
+	return vextq_f32(v, v, 1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YZWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 3, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWXZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWYX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWYW(const vector_t v) {
+#if defined(__aarch64__)
+	return vuzp2q_f32(v, v);
+#else
+	return vuzpq_f32(v, v).val[1];
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWZX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWZZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 1);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {4, 5, 6, 7, 12, 13, 14, 15, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_YWWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 0);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXXZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXXW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXYW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXZX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 8, 9, 10, 11, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vtrn1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vtrnq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXWX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZXWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 1, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYXZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 1);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYYZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 4, 5, 6, 7, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYWX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYWZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZYWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZYY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {8, 9, 10, 11, 8, 9, 10, 11, 4, 5, 6, 7, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZZZ(const vector_t v) {
+#if defined(__aarch64__)
+	return vdupq_laneq_f32(v, 2);
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	return vdupq_lane_f32(hi, 0);
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZZWW(const vector_t v) {
+#if defined(__aarch64__)
+	return vzip2q_f32(v, v);
+#else
+	return vzipq_f32(v, v).val[1];
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWXY(const vector_t v) {
+	return vextq_f32(v, v, 2);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 3, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWYX(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(hi, vrev64_f32(lo));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWYZ(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(hi, vext_f32(lo, hi, 1));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 2);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWZX(const vector_t v) {
+#if defined(__aarch64__)
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vcombine_f32(hi, hi);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vcombine_f32(hi, hi);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 2);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWZW(const vector_t v) {
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(hi, hi);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWWX(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(hi, vext_f32(hi, lo, 1));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWWZ(const vector_t v) {
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(hi, vrev64_f32(hi));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_ZWWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXXX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 0);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXXY(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(vext_f32(hi, lo, 1), lo);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXXW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXYX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXYZ(const vector_t v) {
+	return vextq_f32(v, v, 3);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXZX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXWX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 0, 1, 2, 3, 12, 13, 14, 15, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vrev64q_f32(v);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WXWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 0);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYXY(const vector_t v) {
+#if defined(__aarch64__)
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vcombine_f32(lo, lo);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vcombine_f32(lo, lo);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYXZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYYY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 1);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	const float32x2_t lo = vget_low_f32(v);
+	vector_t r = vdupq_lane_f32(lo, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 1);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYZX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYZY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYWX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 4, 5, 6, 7, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYWZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WYWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZXY(const vector_t v) {
+	const float32x2_t lo = vget_low_f32(v);
+	const float32x2_t hi = vget_high_f32(v);
+	return vcombine_f32(vrev64_f32(hi), lo);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZXZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp1q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[0];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZXW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZYY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZYW(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZZX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 8, 9, 10, 11, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZZZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 2);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 2);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 1);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZWY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZWZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vrev64q_f32(v);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WZWW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vzip2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = vzipq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWXX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWXY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 2);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWXZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWXW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 3);
+	r = vcopyq_laneq_f32(r, 2, v, 0);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWYX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 4, 5, 6, 7, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWYY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 4, 5, 6, 7, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = vextq_f32(v, v, 2);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 2);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWYZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vextq_f32(v, v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = vextq_f32(v, v, 3);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWYW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vuzp2q_f32(v, v);
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	return r;
+#else
+	vector_t r = vuzpq_f32(v, v).val[1];
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWZX(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 8, 9, 10, 11, 0, 1, 2, 3};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWZY(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWZZ(const vector_t v) {
+#if defined(__aarch64__)
+	static const uint8_t index[16] = {12, 13, 14, 15, 12, 13, 14, 15, 8, 9, 10, 11, 8, 9, 10, 11};
+	return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), vld1q_u8(index)));
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWZW(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = v;
+	r = vcopyq_laneq_f32(r, 0, v, 3);
+	r = vcopyq_laneq_f32(r, 1, v, 3);
+	return r;
+#else
+	vector_t r = v;
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 0);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 1);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWWX(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 0);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 0), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWWY(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 1);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 1), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWWZ(const vector_t v) {
+#if defined(__aarch64__)
+	vector_t r = vdupq_laneq_f32(v, 3);
+	r = vcopyq_laneq_f32(r, 3, v, 2);
+	return r;
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	vector_t r = vdupq_lane_f32(hi, 1);
+	r = vsetq_lane_f32(vgetq_lane_f32(v, 2), r, 3);
+	return r;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_WWWW(const vector_t v) {
+#if defined(__aarch64__)
+	return vdupq_laneq_f32(v, 3);
+#else
+	const float32x2_t hi = vget_high_f32(v);
+	return vdupq_lane_f32(hi, 1);
+#endif
+}
+
+//! Shuffle by mask, folded to the specialized shuffle when the mask is a compile time
+//! constant, see vector_shuffle
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_shuffle_specialized(const vector_t v, const unsigned int mask) {
+	switch (mask & 0xFF) {
+		case VECTOR_MASK_XXXX:
+			return vector_shuffle_XXXX(v);
+		case VECTOR_MASK_XXXY:
+			return vector_shuffle_XXXY(v);
+		case VECTOR_MASK_XXXZ:
+			return vector_shuffle_XXXZ(v);
+		case VECTOR_MASK_XXXW:
+			return vector_shuffle_XXXW(v);
+		case VECTOR_MASK_XXYX:
+			return vector_shuffle_XXYX(v);
+		case VECTOR_MASK_XXYY:
+			return vector_shuffle_XXYY(v);
+		case VECTOR_MASK_XXYZ:
+			return vector_shuffle_XXYZ(v);
+		case VECTOR_MASK_XXYW:
+			return vector_shuffle_XXYW(v);
+		case VECTOR_MASK_XXZX:
+			return vector_shuffle_XXZX(v);
+		case VECTOR_MASK_XXZY:
+			return vector_shuffle_XXZY(v);
+		case VECTOR_MASK_XXZZ:
+			return vector_shuffle_XXZZ(v);
+		case VECTOR_MASK_XXZW:
+			return vector_shuffle_XXZW(v);
+		case VECTOR_MASK_XXWX:
+			return vector_shuffle_XXWX(v);
+		case VECTOR_MASK_XXWY:
+			return vector_shuffle_XXWY(v);
+		case VECTOR_MASK_XXWZ:
+			return vector_shuffle_XXWZ(v);
+		case VECTOR_MASK_XXWW:
+			return vector_shuffle_XXWW(v);
+		case VECTOR_MASK_XYXX:
+			return vector_shuffle_XYXX(v);
+		case VECTOR_MASK_XYXY:
+			return vector_shuffle_XYXY(v);
+		case VECTOR_MASK_XYXZ:
+			return vector_shuffle_XYXZ(v);
+		case VECTOR_MASK_XYXW:
+			return vector_shuffle_XYXW(v);
+		case VECTOR_MASK_XYYX:
+			return vector_shuffle_XYYX(v);
+		case VECTOR_MASK_XYYY:
+			return vector_shuffle_XYYY(v);
+		case VECTOR_MASK_XYYZ:
+			return vector_shuffle_XYYZ(v);
+		case VECTOR_MASK_XYYW:
+			return vector_shuffle_XYYW(v);
+		case VECTOR_MASK_XYZX:
+			return vector_shuffle_XYZX(v);
+		case VECTOR_MASK_XYZY:
+			return vector_shuffle_XYZY(v);
+		case VECTOR_MASK_XYZZ:
+			return vector_shuffle_XYZZ(v);
+		case VECTOR_MASK_XYWX:
+			return vector_shuffle_XYWX(v);
+		case VECTOR_MASK_XYWY:
+			return vector_shuffle_XYWY(v);
+		case VECTOR_MASK_XYWZ:
+			return vector_shuffle_XYWZ(v);
+		case VECTOR_MASK_XYWW:
+			return vector_shuffle_XYWW(v);
+		case VECTOR_MASK_XZXX:
+			return vector_shuffle_XZXX(v);
+		case VECTOR_MASK_XZXY:
+			return vector_shuffle_XZXY(v);
+		case VECTOR_MASK_XZXZ:
+			return vector_shuffle_XZXZ(v);
+		case VECTOR_MASK_XZXW:
+			return vector_shuffle_XZXW(v);
+		case VECTOR_MASK_XZYX:
+			return vector_shuffle_XZYX(v);
+		case VECTOR_MASK_XZYY:
+			return vector_shuffle_XZYY(v);
+		case VECTOR_MASK_XZYZ:
+			return vector_shuffle_XZYZ(v);
+		case VECTOR_MASK_XZYW:
+			return vector_shuffle_XZYW(v);
+		case VECTOR_MASK_XZZX:
+			return vector_shuffle_XZZX(v);
+		case VECTOR_MASK_XZZY:
+			return vector_shuffle_XZZY(v);
+		case VECTOR_MASK_XZZZ:
+			return vector_shuffle_XZZZ(v);
+		case VECTOR_MASK_XZZW:
+			return vector_shuffle_XZZW(v);
+		case VECTOR_MASK_XZWX:
+			return vector_shuffle_XZWX(v);
+		case VECTOR_MASK_XZWY:
+			return vector_shuffle_XZWY(v);
+		case VECTOR_MASK_XZWZ:
+			return vector_shuffle_XZWZ(v);
+		case VECTOR_MASK_XZWW:
+			return vector_shuffle_XZWW(v);
+		case VECTOR_MASK_XWXX:
+			return vector_shuffle_XWXX(v);
+		case VECTOR_MASK_XWXY:
+			return vector_shuffle_XWXY(v);
+		case VECTOR_MASK_XWXZ:
+			return vector_shuffle_XWXZ(v);
+		case VECTOR_MASK_XWXW:
+			return vector_shuffle_XWXW(v);
+		case VECTOR_MASK_XWYX:
+			return vector_shuffle_XWYX(v);
+		case VECTOR_MASK_XWYY:
+			return vector_shuffle_XWYY(v);
+		case VECTOR_MASK_XWYZ:
+			return vector_shuffle_XWYZ(v);
+		case VECTOR_MASK_XWYW:
+			return vector_shuffle_XWYW(v);
+		case VECTOR_MASK_XWZX:
+			return vector_shuffle_XWZX(v);
+		case VECTOR_MASK_XWZY:
+			return vector_shuffle_XWZY(v);
+		case VECTOR_MASK_XWZZ:
+			return vector_shuffle_XWZZ(v);
+		case VECTOR_MASK_XWZW:
+			return vector_shuffle_XWZW(v);
+		case VECTOR_MASK_XWWX:
+			return vector_shuffle_XWWX(v);
+		case VECTOR_MASK_XWWY:
+			return vector_shuffle_XWWY(v);
+		case VECTOR_MASK_XWWZ:
+			return vector_shuffle_XWWZ(v);
+		case VECTOR_MASK_XWWW:
+			return vector_shuffle_XWWW(v);
+		case VECTOR_MASK_YXXX:
+			return vector_shuffle_YXXX(v);
+		case VECTOR_MASK_YXXY:
+			return vector_shuffle_YXXY(v);
+		case VECTOR_MASK_YXXZ:
+			return vector_shuffle_YXXZ(v);
+		case VECTOR_MASK_YXXW:
+			return vector_shuffle_YXXW(v);
+		case VECTOR_MASK_YXYX:
+			return vector_shuffle_YXYX(v);
+		case VECTOR_MASK_YXYY:
+			return vector_shuffle_YXYY(v);
+		case VECTOR_MASK_YXYZ:
+			return vector_shuffle_YXYZ(v);
+		case VECTOR_MASK_YXYW:
+			return vector_shuffle_YXYW(v);
+		case VECTOR_MASK_YXZX:
+			return vector_shuffle_YXZX(v);
+		case VECTOR_MASK_YXZY:
+			return vector_shuffle_YXZY(v);
+		case VECTOR_MASK_YXZZ:
+			return vector_shuffle_YXZZ(v);
+		case VECTOR_MASK_YXZW:
+			return vector_shuffle_YXZW(v);
+		case VECTOR_MASK_YXWX:
+			return vector_shuffle_YXWX(v);
+		case VECTOR_MASK_YXWY:
+			return vector_shuffle_YXWY(v);
+		case VECTOR_MASK_YXWZ:
+			return vector_shuffle_YXWZ(v);
+		case VECTOR_MASK_YXWW:
+			return vector_shuffle_YXWW(v);
+		case VECTOR_MASK_YYXX:
+			return vector_shuffle_YYXX(v);
+		case VECTOR_MASK_YYXY:
+			return vector_shuffle_YYXY(v);
+		case VECTOR_MASK_YYXZ:
+			return vector_shuffle_YYXZ(v);
+		case VECTOR_MASK_YYXW:
+			return vector_shuffle_YYXW(v);
+		case VECTOR_MASK_YYYX:
+			return vector_shuffle_YYYX(v);
+		case VECTOR_MASK_YYYY:
+			return vector_shuffle_YYYY(v);
+		case VECTOR_MASK_YYYZ:
+			return vector_shuffle_YYYZ(v);
+		case VECTOR_MASK_YYYW:
+			return vector_shuffle_YYYW(v);
+		case VECTOR_MASK_YYZX:
+			return vector_shuffle_YYZX(v);
+		case VECTOR_MASK_YYZY:
+			return vector_shuffle_YYZY(v);
+		case VECTOR_MASK_YYZZ:
+			return vector_shuffle_YYZZ(v);
+		case VECTOR_MASK_YYZW:
+			return vector_shuffle_YYZW(v);
+		case VECTOR_MASK_YYWX:
+			return vector_shuffle_YYWX(v);
+		case VECTOR_MASK_YYWY:
+			return vector_shuffle_YYWY(v);
+		case VECTOR_MASK_YYWZ:
+			return vector_shuffle_YYWZ(v);
+		case VECTOR_MASK_YYWW:
+			return vector_shuffle_YYWW(v);
+		case VECTOR_MASK_YZXX:
+			return vector_shuffle_YZXX(v);
+		case VECTOR_MASK_YZXY:
+			return vector_shuffle_YZXY(v);
+		case VECTOR_MASK_YZXZ:
+			return vector_shuffle_YZXZ(v);
+		case VECTOR_MASK_YZXW:
+			return vector_shuffle_YZXW(v);
+		case VECTOR_MASK_YZYX:
+			return vector_shuffle_YZYX(v);
+		case VECTOR_MASK_YZYY:
+			return vector_shuffle_YZYY(v);
+		case VECTOR_MASK_YZYZ:
+			return vector_shuffle_YZYZ(v);
+		case VECTOR_MASK_YZYW:
+			return vector_shuffle_YZYW(v);
+		case VECTOR_MASK_YZZX:
+			return vector_shuffle_YZZX(v);
+		case VECTOR_MASK_YZZY:
+			return vector_shuffle_YZZY(v);
+		case VECTOR_MASK_YZZZ:
+			return vector_shuffle_YZZZ(v);
+		case VECTOR_MASK_YZZW:
+			return vector_shuffle_YZZW(v);
+		case VECTOR_MASK_YZWX:
+			return vector_shuffle_YZWX(v);
+		case VECTOR_MASK_YZWY:
+			return vector_shuffle_YZWY(v);
+		case VECTOR_MASK_YZWZ:
+			return vector_shuffle_YZWZ(v);
+		case VECTOR_MASK_YZWW:
+			return vector_shuffle_YZWW(v);
+		case VECTOR_MASK_YWXX:
+			return vector_shuffle_YWXX(v);
+		case VECTOR_MASK_YWXY:
+			return vector_shuffle_YWXY(v);
+		case VECTOR_MASK_YWXZ:
+			return vector_shuffle_YWXZ(v);
+		case VECTOR_MASK_YWXW:
+			return vector_shuffle_YWXW(v);
+		case VECTOR_MASK_YWYX:
+			return vector_shuffle_YWYX(v);
+		case VECTOR_MASK_YWYY:
+			return vector_shuffle_YWYY(v);
+		case VECTOR_MASK_YWYZ:
+			return vector_shuffle_YWYZ(v);
+		case VECTOR_MASK_YWYW:
+			return vector_shuffle_YWYW(v);
+		case VECTOR_MASK_YWZX:
+			return vector_shuffle_YWZX(v);
+		case VECTOR_MASK_YWZY:
+			return vector_shuffle_YWZY(v);
+		case VECTOR_MASK_YWZZ:
+			return vector_shuffle_YWZZ(v);
+		case VECTOR_MASK_YWZW:
+			return vector_shuffle_YWZW(v);
+		case VECTOR_MASK_YWWX:
+			return vector_shuffle_YWWX(v);
+		case VECTOR_MASK_YWWY:
+			return vector_shuffle_YWWY(v);
+		case VECTOR_MASK_YWWZ:
+			return vector_shuffle_YWWZ(v);
+		case VECTOR_MASK_YWWW:
+			return vector_shuffle_YWWW(v);
+		case VECTOR_MASK_ZXXX:
+			return vector_shuffle_ZXXX(v);
+		case VECTOR_MASK_ZXXY:
+			return vector_shuffle_ZXXY(v);
+		case VECTOR_MASK_ZXXZ:
+			return vector_shuffle_ZXXZ(v);
+		case VECTOR_MASK_ZXXW:
+			return vector_shuffle_ZXXW(v);
+		case VECTOR_MASK_ZXYX:
+			return vector_shuffle_ZXYX(v);
+		case VECTOR_MASK_ZXYY:
+			return vector_shuffle_ZXYY(v);
+		case VECTOR_MASK_ZXYZ:
+			return vector_shuffle_ZXYZ(v);
+		case VECTOR_MASK_ZXYW:
+			return vector_shuffle_ZXYW(v);
+		case VECTOR_MASK_ZXZX:
+			return vector_shuffle_ZXZX(v);
+		case VECTOR_MASK_ZXZY:
+			return vector_shuffle_ZXZY(v);
+		case VECTOR_MASK_ZXZZ:
+			return vector_shuffle_ZXZZ(v);
+		case VECTOR_MASK_ZXZW:
+			return vector_shuffle_ZXZW(v);
+		case VECTOR_MASK_ZXWX:
+			return vector_shuffle_ZXWX(v);
+		case VECTOR_MASK_ZXWY:
+			return vector_shuffle_ZXWY(v);
+		case VECTOR_MASK_ZXWZ:
+			return vector_shuffle_ZXWZ(v);
+		case VECTOR_MASK_ZXWW:
+			return vector_shuffle_ZXWW(v);
+		case VECTOR_MASK_ZYXX:
+			return vector_shuffle_ZYXX(v);
+		case VECTOR_MASK_ZYXY:
+			return vector_shuffle_ZYXY(v);
+		case VECTOR_MASK_ZYXZ:
+			return vector_shuffle_ZYXZ(v);
+		case VECTOR_MASK_ZYXW:
+			return vector_shuffle_ZYXW(v);
+		case VECTOR_MASK_ZYYX:
+			return vector_shuffle_ZYYX(v);
+		case VECTOR_MASK_ZYYY:
+			return vector_shuffle_ZYYY(v);
+		case VECTOR_MASK_ZYYZ:
+			return vector_shuffle_ZYYZ(v);
+		case VECTOR_MASK_ZYYW:
+			return vector_shuffle_ZYYW(v);
+		case VECTOR_MASK_ZYZX:
+			return vector_shuffle_ZYZX(v);
+		case VECTOR_MASK_ZYZY:
+			return vector_shuffle_ZYZY(v);
+		case VECTOR_MASK_ZYZZ:
+			return vector_shuffle_ZYZZ(v);
+		case VECTOR_MASK_ZYZW:
+			return vector_shuffle_ZYZW(v);
+		case VECTOR_MASK_ZYWX:
+			return vector_shuffle_ZYWX(v);
+		case VECTOR_MASK_ZYWY:
+			return vector_shuffle_ZYWY(v);
+		case VECTOR_MASK_ZYWZ:
+			return vector_shuffle_ZYWZ(v);
+		case VECTOR_MASK_ZYWW:
+			return vector_shuffle_ZYWW(v);
+		case VECTOR_MASK_ZZXX:
+			return vector_shuffle_ZZXX(v);
+		case VECTOR_MASK_ZZXY:
+			return vector_shuffle_ZZXY(v);
+		case VECTOR_MASK_ZZXZ:
+			return vector_shuffle_ZZXZ(v);
+		case VECTOR_MASK_ZZXW:
+			return vector_shuffle_ZZXW(v);
+		case VECTOR_MASK_ZZYX:
+			return vector_shuffle_ZZYX(v);
+		case VECTOR_MASK_ZZYY:
+			return vector_shuffle_ZZYY(v);
+		case VECTOR_MASK_ZZYZ:
+			return vector_shuffle_ZZYZ(v);
+		case VECTOR_MASK_ZZYW:
+			return vector_shuffle_ZZYW(v);
+		case VECTOR_MASK_ZZZX:
+			return vector_shuffle_ZZZX(v);
+		case VECTOR_MASK_ZZZY:
+			return vector_shuffle_ZZZY(v);
+		case VECTOR_MASK_ZZZZ:
+			return vector_shuffle_ZZZZ(v);
+		case VECTOR_MASK_ZZZW:
+			return vector_shuffle_ZZZW(v);
+		case VECTOR_MASK_ZZWX:
+			return vector_shuffle_ZZWX(v);
+		case VECTOR_MASK_ZZWY:
+			return vector_shuffle_ZZWY(v);
+		case VECTOR_MASK_ZZWZ:
+			return vector_shuffle_ZZWZ(v);
+		case VECTOR_MASK_ZZWW:
+			return vector_shuffle_ZZWW(v);
+		case VECTOR_MASK_ZWXX:
+			return vector_shuffle_ZWXX(v);
+		case VECTOR_MASK_ZWXY:
+			return vector_shuffle_ZWXY(v);
+		case VECTOR_MASK_ZWXZ:
+			return vector_shuffle_ZWXZ(v);
+		case VECTOR_MASK_ZWXW:
+			return vector_shuffle_ZWXW(v);
+		case VECTOR_MASK_ZWYX:
+			return vector_shuffle_ZWYX(v);
+		case VECTOR_MASK_ZWYY:
+			return vector_shuffle_ZWYY(v);
+		case VECTOR_MASK_ZWYZ:
+			return vector_shuffle_ZWYZ(v);
+		case VECTOR_MASK_ZWYW:
+			return vector_shuffle_ZWYW(v);
+		case VECTOR_MASK_ZWZX:
+			return vector_shuffle_ZWZX(v);
+		case VECTOR_MASK_ZWZY:
+			return vector_shuffle_ZWZY(v);
+		case VECTOR_MASK_ZWZZ:
+			return vector_shuffle_ZWZZ(v);
+		case VECTOR_MASK_ZWZW:
+			return vector_shuffle_ZWZW(v);
+		case VECTOR_MASK_ZWWX:
+			return vector_shuffle_ZWWX(v);
+		case VECTOR_MASK_ZWWY:
+			return vector_shuffle_ZWWY(v);
+		case VECTOR_MASK_ZWWZ:
+			return vector_shuffle_ZWWZ(v);
+		case VECTOR_MASK_ZWWW:
+			return vector_shuffle_ZWWW(v);
+		case VECTOR_MASK_WXXX:
+			return vector_shuffle_WXXX(v);
+		case VECTOR_MASK_WXXY:
+			return vector_shuffle_WXXY(v);
+		case VECTOR_MASK_WXXZ:
+			return vector_shuffle_WXXZ(v);
+		case VECTOR_MASK_WXXW:
+			return vector_shuffle_WXXW(v);
+		case VECTOR_MASK_WXYX:
+			return vector_shuffle_WXYX(v);
+		case VECTOR_MASK_WXYY:
+			return vector_shuffle_WXYY(v);
+		case VECTOR_MASK_WXYZ:
+			return vector_shuffle_WXYZ(v);
+		case VECTOR_MASK_WXYW:
+			return vector_shuffle_WXYW(v);
+		case VECTOR_MASK_WXZX:
+			return vector_shuffle_WXZX(v);
+		case VECTOR_MASK_WXZY:
+			return vector_shuffle_WXZY(v);
+		case VECTOR_MASK_WXZZ:
+			return vector_shuffle_WXZZ(v);
+		case VECTOR_MASK_WXZW:
+			return vector_shuffle_WXZW(v);
+		case VECTOR_MASK_WXWX:
+			return vector_shuffle_WXWX(v);
+		case VECTOR_MASK_WXWY:
+			return vector_shuffle_WXWY(v);
+		case VECTOR_MASK_WXWZ:
+			return vector_shuffle_WXWZ(v);
+		case VECTOR_MASK_WXWW:
+			return vector_shuffle_WXWW(v);
+		case VECTOR_MASK_WYXX:
+			return vector_shuffle_WYXX(v);
+		case VECTOR_MASK_WYXY:
+			return vector_shuffle_WYXY(v);
+		case VECTOR_MASK_WYXZ:
+			return vector_shuffle_WYXZ(v);
+		case VECTOR_MASK_WYXW:
+			return vector_shuffle_WYXW(v);
+		case VECTOR_MASK_WYYX:
+			return vector_shuffle_WYYX(v);
+		case VECTOR_MASK_WYYY:
+			return vector_shuffle_WYYY(v);
+		case VECTOR_MASK_WYYZ:
+			return vector_shuffle_WYYZ(v);
+		case VECTOR_MASK_WYYW:
+			return vector_shuffle_WYYW(v);
+		case VECTOR_MASK_WYZX:
+			return vector_shuffle_WYZX(v);
+		case VECTOR_MASK_WYZY:
+			return vector_shuffle_WYZY(v);
+		case VECTOR_MASK_WYZZ:
+			return vector_shuffle_WYZZ(v);
+		case VECTOR_MASK_WYZW:
+			return vector_shuffle_WYZW(v);
+		case VECTOR_MASK_WYWX:
+			return vector_shuffle_WYWX(v);
+		case VECTOR_MASK_WYWY:
+			return vector_shuffle_WYWY(v);
+		case VECTOR_MASK_WYWZ:
+			return vector_shuffle_WYWZ(v);
+		case VECTOR_MASK_WYWW:
+			return vector_shuffle_WYWW(v);
+		case VECTOR_MASK_WZXX:
+			return vector_shuffle_WZXX(v);
+		case VECTOR_MASK_WZXY:
+			return vector_shuffle_WZXY(v);
+		case VECTOR_MASK_WZXZ:
+			return vector_shuffle_WZXZ(v);
+		case VECTOR_MASK_WZXW:
+			return vector_shuffle_WZXW(v);
+		case VECTOR_MASK_WZYX:
+			return vector_shuffle_WZYX(v);
+		case VECTOR_MASK_WZYY:
+			return vector_shuffle_WZYY(v);
+		case VECTOR_MASK_WZYZ:
+			return vector_shuffle_WZYZ(v);
+		case VECTOR_MASK_WZYW:
+			return vector_shuffle_WZYW(v);
+		case VECTOR_MASK_WZZX:
+			return vector_shuffle_WZZX(v);
+		case VECTOR_MASK_WZZY:
+			return vector_shuffle_WZZY(v);
+		case VECTOR_MASK_WZZZ:
+			return vector_shuffle_WZZZ(v);
+		case VECTOR_MASK_WZZW:
+			return vector_shuffle_WZZW(v);
+		case VECTOR_MASK_WZWX:
+			return vector_shuffle_WZWX(v);
+		case VECTOR_MASK_WZWY:
+			return vector_shuffle_WZWY(v);
+		case VECTOR_MASK_WZWZ:
+			return vector_shuffle_WZWZ(v);
+		case VECTOR_MASK_WZWW:
+			return vector_shuffle_WZWW(v);
+		case VECTOR_MASK_WWXX:
+			return vector_shuffle_WWXX(v);
+		case VECTOR_MASK_WWXY:
+			return vector_shuffle_WWXY(v);
+		case VECTOR_MASK_WWXZ:
+			return vector_shuffle_WWXZ(v);
+		case VECTOR_MASK_WWXW:
+			return vector_shuffle_WWXW(v);
+		case VECTOR_MASK_WWYX:
+			return vector_shuffle_WWYX(v);
+		case VECTOR_MASK_WWYY:
+			return vector_shuffle_WWYY(v);
+		case VECTOR_MASK_WWYZ:
+			return vector_shuffle_WWYZ(v);
+		case VECTOR_MASK_WWYW:
+			return vector_shuffle_WWYW(v);
+		case VECTOR_MASK_WWZX:
+			return vector_shuffle_WWZX(v);
+		case VECTOR_MASK_WWZY:
+			return vector_shuffle_WWZY(v);
+		case VECTOR_MASK_WWZZ:
+			return vector_shuffle_WWZZ(v);
+		case VECTOR_MASK_WWZW:
+			return vector_shuffle_WWZW(v);
+		case VECTOR_MASK_WWWX:
+			return vector_shuffle_WWWX(v);
+		case VECTOR_MASK_WWWY:
+			return vector_shuffle_WWWY(v);
+		case VECTOR_MASK_WWWZ:
+			return vector_shuffle_WWWZ(v);
+		case VECTOR_MASK_WWWW:
+			return vector_shuffle_WWWW(v);
+		default:
+			break;
+	}
+	return v;
+}
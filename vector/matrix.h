@@ -88,7 +88,112 @@ matrix_sub(const matrix_t m0, const matrix_t m1);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 matrix_get_translation(const matrix_t m);
 
-#if VECTOR_IMPLEMENTATION_SSE4
+//! Multiply arrays of matrices, out[i] = m0[i] * m1[i]. Output can be the same array as either
+//! input for in-place multiplication, but arrays must not partially overlap
+static FOUNDATION_FORCEINLINE void
+matrix_mul_array(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+
+//! Multiply arrays of matrices like matrix_mul_array, but with streaming stores for outputs which are
+//! not read back soon, see vector_stream. Inputs are prefetched VECTOR_STREAM_PREFETCH_DISTANCE bytes
+//! ahead and a vector_stream_fence is issued before returning
+static FOUNDATION_FORCEINLINE void
+matrix_mul_array_stream(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+
+//! Propagate a hierarchy of local matrices to world matrices, out[i] = local[i] * out[parent[i]].
+//! Parents must precede their children (parent[i] < i), a negative parent index marks a root with
+//! out[i] = local[i]. Output can be the same array as local for in-place propagation
+static FOUNDATION_FORCEINLINE void
+matrix_mul_chain(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t count);
+
+//! Propagate nodes begin to end-1 of a hierarchy, see matrix_mul_chain. World matrices of parents
+//! before begin must already be in out, which allows updating a contiguous subtree only
+static FOUNDATION_FORCEINLINE void
+matrix_mul_chain_range(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t begin, size_t end);
+
+//! General inverse, matrix must be non-singular
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse(const matrix_t m);
+
+//! Inverse of an affine transform with orthogonal, optionally scaled, 3x3 part and translation in row 3
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse_affine(const matrix_t m);
+
+//! Inverse of a rigid transform with orthonormal 3x3 rotation and translation in row 3
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse_orthonormal(const matrix_t m);
+
+//! View matrix for a camera at eye looking at target. View space is left handed with x right, y up
+//! and the camera looking along positive z. Up must not be parallel to the view direction
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_look_at(const vector_t eye, const vector_t target, const vector_t up);
+
+//! View matrix for a camera at eye with orientation given by a unit quaternion rotating the view
+//! space axes to world space, see matrix_look_at
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_look_at_quaternion(const vector_t eye, const quaternion_t rotation);
+
+//! Perspective projection from vertical field of view in radians and width over height aspect
+//! ratio. Maps view space to clip space with x and y in [-w, w] and z in [0, w], near plane at 0
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective(const real fov_y, const real aspect, const real znear, const real zfar);
+
+//! Perspective projection with reversed depth, near plane at z = w and far plane at z = 0
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective_reversed(const real fov_y, const real aspect, const real znear, const real zfar);
+
+//! Perspective projection with the far plane at infinity, depth approaches w with distance
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective_infinite(const real fov_y, const real aspect, const real znear);
+
+//! Perspective projection with reversed depth and the far plane at infinity, depth approaches zero
+//! with distance. Gives the best depth precision with floating point depth buffers
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective_infinite_reversed(const real fov_y, const real aspect, const real znear);
+
+//! Orthographic projection of the view space box to clip space with x and y in [-1, 1] and z
+//! in [0, 1]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_orthographic(const real left, const real right, const real bottom, const real top, const real znear,
+                    const real zfar);
+
+//! Multiply view and projection matrices. The projection must only have nonzero elements in the
+//! diagonal, m23 and the last row, as the perspective and orthographic projections above, which
+//! takes two multiplies per row instead of four for matrix_mul
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_view_projection(const matrix_t view, const matrix_t projection);
+
+//! View projection matrices for the six cube map faces at position, in order +x, -x, +y, -y, +z
+//! and -z with the face orientations of Direct3D and Vulkan cube maps. The projection is normally
+//! a square 90 degree perspective, see matrix_view_projection for the requirements
+static FOUNDATION_FORCEINLINE void
+matrix_cube_faces(matrix_t* out, const vector_t position, const matrix_t projection);
+
+//! Multiply arrays of matrices using the implementation selected at module initialization,
+//! see matrix_mul_array
+VECTOR_API void
+matrix_batch_mul(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+
+//! Multiply arrays of matrices with streaming stores using the implementation selected at module
+//! initialization, see matrix_mul_array_stream
+VECTOR_API void
+matrix_batch_mul_stream(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+
+//! Propagate a hierarchy of local matrices to world matrices using the implementation selected
+//! at module initialization, see matrix_mul_chain
+VECTOR_API void
+matrix_batch_mul_chain(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t count);
+
+//! Propagate a range of a hierarchy using the implementation selected at module initialization,
+//! see matrix_mul_chain_range
+VECTOR_API void
+matrix_batch_mul_chain_range(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t begin,
+                             size_t end);
+
+#if VECTOR_IMPLEMENTATION_AVX512
+#include <vector/matrix_avx512.h>
+#elif VECTOR_IMPLEMENTATION_AVX2
+#include <vector/matrix_avx2.h>
+#elif VECTOR_IMPLEMENTATION_SSE4
 #include <vector/matrix_sse4.h>
 #elif VECTOR_IMPLEMENTATION_SSE3
 #include <vector/matrix_sse3.h>
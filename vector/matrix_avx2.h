@@ -0,0 +1,79 @@
+/* matrix_avx2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_MATRIX_MUL
+
+// Two rows of m0 per 256-bit register, rows of m1 broadcast to both lanes and accumulated with
+// fused multiply-add after splatting each m0 row component within its lane
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_mul(const matrix_t m0, const matrix_t m1) {
+	matrix_t ret;
+
+	const __m256 m0_r01 = _mm256_loadu_ps(m0.arr);
+	const __m256 m0_r23 = _mm256_loadu_ps(m0.arr + 8);
+
+	const __m256 m1_r0 = _mm256_broadcast_ps(&m1.row[0]);
+	__m256 r01 = _mm256_mul_ps(_mm256_permute_ps(m0_r01, VECTOR_MASK_XXXX), m1_r0);
+	__m256 r23 = _mm256_mul_ps(_mm256_permute_ps(m0_r23, VECTOR_MASK_XXXX), m1_r0);
+
+	const __m256 m1_r1 = _mm256_broadcast_ps(&m1.row[1]);
+	r01 = _mm256_fmadd_ps(_mm256_permute_ps(m0_r01, VECTOR_MASK_YYYY), m1_r1, r01);
+	r23 = _mm256_fmadd_ps(_mm256_permute_ps(m0_r23, VECTOR_MASK_YYYY), m1_r1, r23);
+
+	const __m256 m1_r2 = _mm256_broadcast_ps(&m1.row[2]);
+	r01 = _mm256_fmadd_ps(_mm256_permute_ps(m0_r01, VECTOR_MASK_ZZZZ), m1_r2, r01);
+	r23 = _mm256_fmadd_ps(_mm256_permute_ps(m0_r23, VECTOR_MASK_ZZZZ), m1_r2, r23);
+
+	const __m256 m1_r3 = _mm256_broadcast_ps(&m1.row[3]);
+	r01 = _mm256_fmadd_ps(_mm256_permute_ps(m0_r01, VECTOR_MASK_WWWW), m1_r3, r01);
+	r23 = _mm256_fmadd_ps(_mm256_permute_ps(m0_r23, VECTOR_MASK_WWWW), m1_r3, r23);
+
+	_mm256_storeu_ps(ret.arr, r01);
+	_mm256_storeu_ps(ret.arr + 8, r23);
+	return ret;
+}
+#define VECTOR_HAVE_MATRIX_MUL 1
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_ADD
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_add(const matrix_t m0, const matrix_t m1) {
+	matrix_t ret;
+	_mm256_storeu_ps(ret.arr, _mm256_add_ps(_mm256_loadu_ps(m0.arr), _mm256_loadu_ps(m1.arr)));
+	_mm256_storeu_ps(ret.arr + 8, _mm256_add_ps(_mm256_loadu_ps(m0.arr + 8), _mm256_loadu_ps(m1.arr + 8)));
+	return ret;
+}
+#define VECTOR_HAVE_MATRIX_ADD 1
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_SUB
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_sub(const matrix_t m0, const matrix_t m1) {
+	matrix_t ret;
+	_mm256_storeu_ps(ret.arr, _mm256_sub_ps(_mm256_loadu_ps(m0.arr), _mm256_loadu_ps(m1.arr)));
+	_mm256_storeu_ps(ret.arr + 8, _mm256_sub_ps(_mm256_loadu_ps(m0.arr + 8), _mm256_loadu_ps(m1.arr + 8)));
+	return ret;
+}
+#define VECTOR_HAVE_MATRIX_SUB 1
+
+#endif
+
+#include <vector/matrix_sse4.h>
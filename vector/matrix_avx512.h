@@ -0,0 +1,36 @@
+/* matrix_avx512.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_MATRIX_MUL
+
+// All four rows of m0 in one 512-bit register, rows of m1 broadcast to all lanes
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_mul(const matrix_t m0, const matrix_t m1) {
+	matrix_t ret;
+	const __m512 m0_rows = _mm512_loadu_ps(m0.arr);
+	__m512 r = _mm512_mul_ps(_mm512_permute_ps(m0_rows, VECTOR_MASK_XXXX), _mm512_broadcast_f32x4(m1.row[0]));
+	r = _mm512_fmadd_ps(_mm512_permute_ps(m0_rows, VECTOR_MASK_YYYY), _mm512_broadcast_f32x4(m1.row[1]), r);
+	r = _mm512_fmadd_ps(_mm512_permute_ps(m0_rows, VECTOR_MASK_ZZZZ), _mm512_broadcast_f32x4(m1.row[2]), r);
+	r = _mm512_fmadd_ps(_mm512_permute_ps(m0_rows, VECTOR_MASK_WWWW), _mm512_broadcast_f32x4(m1.row[3]), r);
+	_mm512_storeu_ps(ret.arr, r);
+	return ret;
+}
+#define VECTOR_HAVE_MATRIX_MUL 1
+
+#endif
+
+#include <vector/matrix_avx2.h>
@@ -121,6 +121,78 @@ matrix_mul(const matrix_t m0, const matrix_t m1) {
 
 #endif
 
+// Prefetch distance in matrices, four cache lines ahead of the current matrix
+#define VECTOR_MATRIX_PREFETCH_DISTANCE 4
+
+#ifndef VECTOR_HAVE_MATRIX_MUL_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+matrix_mul_array(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	// Stop prefetching before the end to keep the addresses within the arrays
+	const size_t prefetch_end =
+	    (count > VECTOR_MATRIX_PREFETCH_DISTANCE) ? count - VECTOR_MATRIX_PREFETCH_DISTANCE : 0;
+	size_t i = 0;
+	for (; i < prefetch_end; ++i) {
+		VECTOR_PREFETCH(m0 + i + VECTOR_MATRIX_PREFETCH_DISTANCE);
+		VECTOR_PREFETCH(m1 + i + VECTOR_MATRIX_PREFETCH_DISTANCE);
+		out[i] = matrix_mul(m0[i], m1[i]);
+	}
+	for (; i < count; ++i)
+		out[i] = matrix_mul(m0[i], m1[i]);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_MUL_ARRAY_STREAM
+
+static FOUNDATION_FORCEINLINE void
+matrix_mul_array_stream(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	// Prefetch stops before the end to keep the addresses within the input arrays
+	const size_t prefetch_count = VECTOR_STREAM_PREFETCH_DISTANCE / sizeof(matrix_t);
+	const size_t prefetch_end = (count > prefetch_count) ? count - prefetch_count : 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (i < prefetch_end) {
+			VECTOR_PREFETCH(m0 + i + prefetch_count);
+			VECTOR_PREFETCH(m1 + i + prefetch_count);
+		}
+		const matrix_t r = matrix_mul(m0[i], m1[i]);
+		vector_stream(out[i].row, r.row[0]);
+		vector_stream(out[i].row + 1, r.row[1]);
+		vector_stream(out[i].row + 2, r.row[2]);
+		vector_stream(out[i].row + 3, r.row[3]);
+	}
+	vector_stream_fence();
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_MUL_CHAIN
+
+static FOUNDATION_FORCEINLINE void
+matrix_mul_chain_range(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t begin, size_t end) {
+	// Parent world matrices of upcoming nodes are usually far behind in a large hierarchy,
+	// prefetch them together with the local matrices streamed in order
+	const size_t prefetch_end =
+	    (end > begin + VECTOR_MATRIX_PREFETCH_DISTANCE) ? end - VECTOR_MATRIX_PREFETCH_DISTANCE : begin;
+	size_t i = begin;
+	for (; i < prefetch_end; ++i) {
+		const int32_t prefetch_parent = parent[i + VECTOR_MATRIX_PREFETCH_DISTANCE];
+		VECTOR_PREFETCH(local + i + VECTOR_MATRIX_PREFETCH_DISTANCE);
+		if (prefetch_parent >= 0)
+			VECTOR_PREFETCH(out + prefetch_parent);
+		out[i] = (parent[i] >= 0) ? matrix_mul(local[i], out[parent[i]]) : local[i];
+	}
+	for (; i < end; ++i)
+		out[i] = (parent[i] >= 0) ? matrix_mul(local[i], out[parent[i]]) : local[i];
+}
+
+static FOUNDATION_FORCEINLINE void
+matrix_mul_chain(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t count) {
+	matrix_mul_chain_range(out, local, parent, 0, count);
+}
+
+#endif
+
 #ifndef VECTOR_HAVE_MATRIX_ADD
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
@@ -197,6 +269,215 @@ matrix_from_quaternion(const quaternion_t q) {
 
 #endif
 
+#ifndef VECTOR_HAVE_MATRIX_INVERSE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse(const matrix_t m) {
+	const float32_t* a = m.arr;
+	matrix_t r;
+	float32_t* inv = r.arr;
+
+	// Cofactors from the 2x2 sub determinants of the lower and upper row pairs
+	const float32_t s0 = a[0] * a[5] - a[4] * a[1];
+	const float32_t s1 = a[0] * a[6] - a[4] * a[2];
+	const float32_t s2 = a[0] * a[7] - a[4] * a[3];
+	const float32_t s3 = a[1] * a[6] - a[5] * a[2];
+	const float32_t s4 = a[1] * a[7] - a[5] * a[3];
+	const float32_t s5 = a[2] * a[7] - a[6] * a[3];
+
+	const float32_t c5 = a[10] * a[15] - a[14] * a[11];
+	const float32_t c4 = a[9] * a[15] - a[13] * a[11];
+	const float32_t c3 = a[9] * a[14] - a[13] * a[10];
+	const float32_t c2 = a[8] * a[15] - a[12] * a[11];
+	const float32_t c1 = a[8] * a[14] - a[12] * a[10];
+	const float32_t c0 = a[8] * a[13] - a[12] * a[9];
+
+	const float32_t det_inv = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+	inv[0] = (a[5] * c5 - a[6] * c4 + a[7] * c3) * det_inv;
+	inv[1] = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * det_inv;
+	inv[2] = (a[13] * s5 - a[14] * s4 + a[15] * s3) * det_inv;
+	inv[3] = (-a[9] * s5 + a[10] * s4 - a[11] * s3) * det_inv;
+
+	inv[4] = (-a[4] * c5 + a[6] * c2 - a[7] * c1) * det_inv;
+	inv[5] = (a[0] * c5 - a[2] * c2 + a[3] * c1) * det_inv;
+	inv[6] = (-a[12] * s5 + a[14] * s2 - a[15] * s1) * det_inv;
+	inv[7] = (a[8] * s5 - a[10] * s2 + a[11] * s1) * det_inv;
+
+	inv[8] = (a[4] * c4 - a[5] * c2 + a[7] * c0) * det_inv;
+	inv[9] = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * det_inv;
+	inv[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) * det_inv;
+	inv[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) * det_inv;
+
+	inv[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) * det_inv;
+	inv[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * det_inv;
+	inv[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) * det_inv;
+	inv[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) * det_inv;
+
+	return r;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_INVERSE_ORTHONORMAL
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse_orthonormal(const matrix_t m) {
+	// Inverse rotation is the transpose, inverse translation is the negated translation rotated by it
+	matrix_t r = m;
+	r.row[3] = vector_zero();
+	r = matrix_transpose(r);
+
+	const vector_t t = m.row[3];
+	vector_t rt = vector_mul(vector_shuffle(t, VECTOR_MASK_XXXX), r.row[0]);
+	rt = vector_muladd(vector_shuffle(t, VECTOR_MASK_YYYY), r.row[1], rt);
+	rt = vector_muladd(vector_shuffle(t, VECTOR_MASK_ZZZZ), r.row[2], rt);
+	r.row[3] = vector_sub(vector_origo(), rt);
+	return r;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_INVERSE_AFFINE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse_affine(const matrix_t m) {
+	// As the orthonormal inverse, with each column of the transposed 3x3 divided by the squared axis scale
+	matrix_t r = m;
+	r.row[3] = vector_zero();
+	r = matrix_transpose(r);
+
+	vector_t scale_sqr = vector_muladd(r.row[0], r.row[0], vector_origo());
+	scale_sqr = vector_muladd(r.row[1], r.row[1], scale_sqr);
+	scale_sqr = vector_muladd(r.row[2], r.row[2], scale_sqr);
+	const vector_t scale_inv = vector_div(vector_one(), scale_sqr);
+	r.row[0] = vector_mul(r.row[0], scale_inv);
+	r.row[1] = vector_mul(r.row[1], scale_inv);
+	r.row[2] = vector_mul(r.row[2], scale_inv);
+
+	const vector_t t = m.row[3];
+	vector_t rt = vector_mul(vector_shuffle(t, VECTOR_MASK_XXXX), r.row[0]);
+	rt = vector_muladd(vector_shuffle(t, VECTOR_MASK_YYYY), r.row[1], rt);
+	rt = vector_muladd(vector_shuffle(t, VECTOR_MASK_ZZZZ), r.row[2], rt);
+	r.row[3] = vector_sub(vector_origo(), rt);
+	return r;
+}
+
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_look_at(const vector_t eye, const vector_t target, const vector_t up) {
+	// View space axes in world space are the columns of the rotation, the translation is the
+	// negated eye position rotated to view space as in matrix_inverse_orthonormal
+	matrix_t r;
+	r.row[2] = vector_normalize3(vector_sub(target, eye));
+	r.row[0] = vector_normalize3(vector_cross3(up, r.row[2]));
+	r.row[1] = vector_cross3(r.row[2], r.row[0]);
+	r.row[3] = vector_origo();
+	r = matrix_transpose(r);
+
+	vector_t rt = vector_mul(vector_shuffle(eye, VECTOR_MASK_XXXX), r.row[0]);
+	rt = vector_muladd(vector_shuffle(eye, VECTOR_MASK_YYYY), r.row[1], rt);
+	rt = vector_muladd(vector_shuffle(eye, VECTOR_MASK_ZZZZ), r.row[2], rt);
+	r.row[3] = vector_sub(vector_origo(), rt);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_look_at_quaternion(const vector_t eye, const quaternion_t rotation) {
+	matrix_t world = matrix_from_quaternion(rotation);
+	world.row[3] = vector_set_component(eye, 3, REAL_C(1.0));
+	return matrix_inverse_orthonormal(world);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_projection_scalar(float32_t xscale, float32_t yscale, float32_t zscale, float32_t zoffset) {
+	// Clip w is view space z, clip z is zscale * z + zoffset
+	vector_arr_t aligned_matrix[4] = {{xscale, 0, 0, 0}, {0, yscale, 0, 0}, {0, 0, zscale, 1}, {0, 0, zoffset, 0}};
+	return matrix_aligned((float32_aligned128_t*)aligned_matrix);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective(const real fov_y, const real aspect, const real znear, const real zfar) {
+	const real yscale = REAL_C(1.0) / math_tan(fov_y * REAL_C(0.5));
+	const real zscale = zfar / (zfar - znear);
+	return matrix_projection_scalar(yscale / aspect, yscale, zscale, -znear * zscale);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective_reversed(const real fov_y, const real aspect, const real znear, const real zfar) {
+	const real yscale = REAL_C(1.0) / math_tan(fov_y * REAL_C(0.5));
+	const real zscale = znear / (znear - zfar);
+	return matrix_projection_scalar(yscale / aspect, yscale, zscale, -zfar * zscale);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective_infinite(const real fov_y, const real aspect, const real znear) {
+	const real yscale = REAL_C(1.0) / math_tan(fov_y * REAL_C(0.5));
+	return matrix_projection_scalar(yscale / aspect, yscale, REAL_C(1.0), -znear);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_perspective_infinite_reversed(const real fov_y, const real aspect, const real znear) {
+	const real yscale = REAL_C(1.0) / math_tan(fov_y * REAL_C(0.5));
+	return matrix_projection_scalar(yscale / aspect, yscale, REAL_C(0.0), znear);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_orthographic(const real left, const real right, const real bottom, const real top, const real znear,
+                    const real zfar) {
+	const real width_inv = REAL_C(1.0) / (right - left);
+	const real height_inv = REAL_C(1.0) / (top - bottom);
+	const real depth_inv = REAL_C(1.0) / (zfar - znear);
+	const real xoffset = -(left + right) * width_inv;
+	const real yoffset = -(bottom + top) * height_inv;
+	vector_arr_t aligned_matrix[4] = {{REAL_C(2.0) * width_inv, 0, 0, 0},
+	                                  {0, REAL_C(2.0) * height_inv, 0, 0},
+	                                  {0, 0, depth_inv, 0},
+	                                  {xoffset, yoffset, -znear * depth_inv, 1}};
+	return matrix_aligned((float32_aligned128_t*)aligned_matrix);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_view_projection(const matrix_t view, const matrix_t projection) {
+	// Projection rows 0-2 hold one nonzero element each except m23, so the sum of the rows is
+	// the per-column scale of view x, y, z, z. The last row is scaled by view w
+	const vector_t scale = vector_add(vector_add(projection.row[0], projection.row[1]), projection.row[2]);
+	const vector_t offset = projection.row[3];
+	matrix_t r;
+	for (int row = 0; row < 4; ++row) {
+		const vector_t v = view.row[row];
+		r.row[row] = vector_muladd(vector_shuffle(v, VECTOR_MASK_XYZZ), scale,
+		                           vector_mul(vector_shuffle(v, VECTOR_MASK_WWWW), offset));
+	}
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE void
+matrix_cube_faces(matrix_t* out, const vector_t position, const matrix_t projection) {
+	// Rotation rows of the view matrix for each face, columns are the right, up and forward axes
+	static const vector_arr_t face_rotation[6][3] = {{{0, 0, 1, 0}, {0, 1, 0, 0}, {-1, 0, 0, 0}},
+	                                                 {{0, 0, -1, 0}, {0, 1, 0, 0}, {1, 0, 0, 0}},
+	                                                 {{1, 0, 0, 0}, {0, 0, 1, 0}, {0, -1, 0, 0}},
+	                                                 {{1, 0, 0, 0}, {0, 0, -1, 0}, {0, 1, 0, 0}},
+	                                                 {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}},
+	                                                 {{-1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, -1, 0}}};
+	const vector_t px = vector_shuffle(position, VECTOR_MASK_XXXX);
+	const vector_t py = vector_shuffle(position, VECTOR_MASK_YYYY);
+	const vector_t pz = vector_shuffle(position, VECTOR_MASK_ZZZZ);
+	for (int face = 0; face < 6; ++face) {
+		matrix_t view;
+		view.row[0] = vector_aligned((const float32_aligned128_t*)face_rotation[face][0]);
+		view.row[1] = vector_aligned((const float32_aligned128_t*)face_rotation[face][1]);
+		view.row[2] = vector_aligned((const float32_aligned128_t*)face_rotation[face][2]);
+		vector_t rt = vector_mul(px, view.row[0]);
+		rt = vector_muladd(py, view.row[1], rt);
+		rt = vector_muladd(pz, view.row[2], rt);
+		view.row[3] = vector_sub(vector_origo(), rt);
+		out[face] = matrix_view_projection(view, projection);
+	}
+}
+
 #if FOUNDATION_COMPILER_CLANG
 #pragma clang diagnostic pop
 #endif
@@ -207,6 +488,13 @@ matrix_from_quaternion(const quaternion_t q) {
 #undef VECTOR_HAVE_MATRIX_ALIGNED
 #undef VECTOR_HAVE_MATRIX_TRANSPOSE
 #undef VECTOR_HAVE_MATRIX_MUL
+#undef VECTOR_HAVE_MATRIX_MUL_ARRAY
+#undef VECTOR_HAVE_MATRIX_MUL_ARRAY_STREAM
+#undef VECTOR_HAVE_MATRIX_MUL_CHAIN
+#undef VECTOR_MATRIX_PREFETCH_DISTANCE
 #undef VECTOR_HAVE_MATRIX_ADD
 #undef VECTOR_HAVE_MATRIX_SUB
 #undef VECTOR_HAVE_MATRIX_FROM_QUATERNION
+#undef VECTOR_HAVE_MATRIX_INVERSE
+#undef VECTOR_HAVE_MATRIX_INVERSE_AFFINE
+#undef VECTOR_HAVE_MATRIX_INVERSE_ORTHONORMAL
@@ -15,4 +15,127 @@
  *
  */
 
+#ifndef VECTOR_HAVE_MATRIX_TRANSPOSE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_transpose(const matrix_t m) {
+	const float32x4x2_t t01 = vtrnq_f32(m.row[0], m.row[1]);
+	const float32x4x2_t t23 = vtrnq_f32(m.row[2], m.row[3]);
+	matrix_t mt;
+	mt.row[0] = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+	mt.row[1] = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+	mt.row[2] = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+	mt.row[3] = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	return mt;
+}
+#define VECTOR_HAVE_MATRIX_TRANSPOSE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_MUL
+
+// Multiply-accumulate each row of m1 by a lane of the m0 row without separate splats,
+// fused on AArch64
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_mul(const matrix_t m0, const matrix_t m1) {
+	matrix_t ret;
+	for (int row = 0; row < 4; ++row) {
+		const vector_t m0_r = m0.row[row];
+#if defined(__aarch64__)
+		vector_t lo = vmulq_laneq_f32(m1.row[0], m0_r, 0);
+		vector_t hi = vmulq_laneq_f32(m1.row[2], m0_r, 2);
+		lo = vfmaq_laneq_f32(lo, m1.row[1], m0_r, 1);
+		hi = vfmaq_laneq_f32(hi, m1.row[3], m0_r, 3);
+#else
+		vector_t lo = vmulq_lane_f32(m1.row[0], vget_low_f32(m0_r), 0);
+		vector_t hi = vmulq_lane_f32(m1.row[2], vget_high_f32(m0_r), 0);
+		lo = vmlaq_lane_f32(lo, m1.row[1], vget_low_f32(m0_r), 1);
+		hi = vmlaq_lane_f32(hi, m1.row[3], vget_high_f32(m0_r), 1);
+#endif
+		ret.row[row] = vaddq_f32(lo, hi);
+	}
+	return ret;
+}
+#define VECTOR_HAVE_MATRIX_MUL 1
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_INVERSE
+
+// Product of 2x2 matrices stored row major in one vector, m0 * m1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+matrix_mul2x2(const vector_t m0, const vector_t m1) {
+	return vector_muladd(m0, vector_shuffle(m1, VECTOR_MASK_XWXW),
+	                     vector_mul(vrev64q_f32(m0), vector_shuffle(m1, VECTOR_MASK_ZYZY)));
+}
+
+// Adjugate of m0 times m1, adj(m0) * m1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+matrix_adjmul2x2(const vector_t m0, const vector_t m1) {
+	return vector_sub(vector_mul(vector_shuffle(m0, VECTOR_MASK_WWXX), m1),
+	                  vector_mul(vector_shuffle(m0, VECTOR_MASK_YYZZ), vextq_f32(m1, m1, 2)));
+}
+
+// m0 times adjugate of m1, m0 * adj(m1)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+matrix_muladj2x2(const vector_t m0, const vector_t m1) {
+	return vector_sub(vector_mul(m0, vector_shuffle(m1, VECTOR_MASK_WXWX)),
+	                  vector_mul(vrev64q_f32(m0), vector_shuffle(m1, VECTOR_MASK_ZYZY)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse(const matrix_t m) {
+	// Blockwise inverse, Cramer's rule applied to the four 2x2 sub matrices
+	//   | A B |
+	//   | C D |
+	const vector_t a = vcombine_f32(vget_low_f32(m.row[0]), vget_low_f32(m.row[1]));
+	const vector_t b = vcombine_f32(vget_high_f32(m.row[0]), vget_high_f32(m.row[1]));
+	const vector_t c = vcombine_f32(vget_low_f32(m.row[2]), vget_low_f32(m.row[3]));
+	const vector_t d = vcombine_f32(vget_high_f32(m.row[2]), vget_high_f32(m.row[3]));
+
+	// Sub matrix determinants as [ |A| |B| |C| |D| ]
+	const float32x4x2_t even_odd_02 = vuzpq_f32(m.row[0], m.row[2]);
+	const float32x4x2_t even_odd_13 = vuzpq_f32(m.row[1], m.row[3]);
+	const vector_t det_sub = vector_sub(vector_mul(even_odd_02.val[0], even_odd_13.val[1]),
+	                                    vector_mul(even_odd_02.val[1], even_odd_13.val[0]));
+	const vector_t det_a = vdupq_lane_f32(vget_low_f32(det_sub), 0);
+	const vector_t det_b = vdupq_lane_f32(vget_low_f32(det_sub), 1);
+	const vector_t det_c = vdupq_lane_f32(vget_high_f32(det_sub), 0);
+	const vector_t det_d = vdupq_lane_f32(vget_high_f32(det_sub), 1);
+
+	const vector_t adj_d_c = matrix_adjmul2x2(d, c);
+	const vector_t adj_a_b = matrix_adjmul2x2(a, b);
+
+	// Adjugates of the inverse sub matrices
+	vector_t x = vector_sub(vector_mul(det_d, a), matrix_mul2x2(b, adj_d_c));
+	vector_t w = vector_sub(vector_mul(det_a, d), matrix_mul2x2(c, adj_a_b));
+	vector_t y = vector_sub(vector_mul(det_b, c), matrix_muladj2x2(d, adj_a_b));
+	vector_t z = vector_sub(vector_mul(det_c, b), matrix_muladj2x2(a, adj_d_c));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+	vector_t trace = vector_mul(adj_a_b, vector_shuffle(adj_d_c, VECTOR_MASK_XZYW));
+	trace = vector_add(trace, vextq_f32(trace, trace, 2));
+	trace = vector_add(trace, vrev64q_f32(trace));
+	const vector_t det = vector_sub(vector_muladd(det_a, det_d, vector_mul(det_b, det_c)), trace);
+
+	const vector_t det_inv = vector_div(vector(1, -1, -1, 1), det);
+	x = vector_mul(x, det_inv);
+	y = vector_mul(y, det_inv);
+	z = vector_mul(z, det_inv);
+	w = vector_mul(w, det_inv);
+
+	// Adjugate and reassemble rows, [x.w x.y y.w y.y] and [x.z x.x y.z y.x]
+	const float32x4x2_t xy = vuzpq_f32(x, y);
+	const float32x4x2_t zw = vuzpq_f32(z, w);
+	matrix_t r;
+	r.row[0] = vrev64q_f32(xy.val[1]);
+	r.row[1] = vrev64q_f32(xy.val[0]);
+	r.row[2] = vrev64q_f32(zw.val[1]);
+	r.row[3] = vrev64q_f32(zw.val[0]);
+	return r;
+}
+#define VECTOR_HAVE_MATRIX_INVERSE 1
+
+#endif
+
 #include <vector/matrix_base.h>
@@ -88,4 +88,81 @@ matrix_mul(const matrix_t m0, const matrix_t m1) {
 
 #endif
 
+#ifndef VECTOR_HAVE_MATRIX_INVERSE
+
+// Product of 2x2 matrices stored row major in one vector, m0 * m1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+matrix_mul2x2(const vector_t m0, const vector_t m1) {
+	return vector_muladd(m0, vector_shuffle(m1, VECTOR_MASK_XWXW),
+	                     vector_mul(vector_shuffle(m0, VECTOR_MASK_YXWZ), vector_shuffle(m1, VECTOR_MASK_ZYZY)));
+}
+
+// Adjugate of m0 times m1, adj(m0) * m1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+matrix_adjmul2x2(const vector_t m0, const vector_t m1) {
+	return vector_sub(vector_mul(vector_shuffle(m0, VECTOR_MASK_WWXX), m1),
+	                  vector_mul(vector_shuffle(m0, VECTOR_MASK_YYZZ), vector_shuffle(m1, VECTOR_MASK_ZWXY)));
+}
+
+// m0 times adjugate of m1, m0 * adj(m1)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+matrix_muladj2x2(const vector_t m0, const vector_t m1) {
+	return vector_sub(vector_mul(m0, vector_shuffle(m1, VECTOR_MASK_WXWX)),
+	                  vector_mul(vector_shuffle(m0, VECTOR_MASK_YXWZ), vector_shuffle(m1, VECTOR_MASK_ZYZY)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_inverse(const matrix_t m) {
+	// Blockwise inverse, Cramer's rule applied to the four 2x2 sub matrices
+	//   | A B |
+	//   | C D |
+	const vector_t a = _mm_movelh_ps(m.row[0], m.row[1]);
+	const vector_t b = _mm_movehl_ps(m.row[1], m.row[0]);
+	const vector_t c = _mm_movelh_ps(m.row[2], m.row[3]);
+	const vector_t d = _mm_movehl_ps(m.row[3], m.row[2]);
+
+	// Sub matrix determinants as [ |A| |B| |C| |D| ]
+	const vector_t det_sub =
+	    vector_sub(vector_mul(vector_shuffle2(m.row[0], m.row[2], VECTOR_MASK_XZXZ),
+	                          vector_shuffle2(m.row[1], m.row[3], VECTOR_MASK_YWYW)),
+	               vector_mul(vector_shuffle2(m.row[0], m.row[2], VECTOR_MASK_YWYW),
+	                          vector_shuffle2(m.row[1], m.row[3], VECTOR_MASK_XZXZ)));
+	const vector_t det_a = vector_shuffle(det_sub, VECTOR_MASK_XXXX);
+	const vector_t det_b = vector_shuffle(det_sub, VECTOR_MASK_YYYY);
+	const vector_t det_c = vector_shuffle(det_sub, VECTOR_MASK_ZZZZ);
+	const vector_t det_d = vector_shuffle(det_sub, VECTOR_MASK_WWWW);
+
+	const vector_t adj_d_c = matrix_adjmul2x2(d, c);
+	const vector_t adj_a_b = matrix_adjmul2x2(a, b);
+
+	// Adjugates of the inverse sub matrices
+	vector_t x = vector_sub(vector_mul(det_d, a), matrix_mul2x2(b, adj_d_c));
+	vector_t w = vector_sub(vector_mul(det_a, d), matrix_mul2x2(c, adj_a_b));
+	vector_t y = vector_sub(vector_mul(det_b, c), matrix_muladj2x2(d, adj_a_b));
+	vector_t z = vector_sub(vector_mul(det_c, b), matrix_muladj2x2(a, adj_d_c));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+	vector_t trace = vector_mul(adj_a_b, vector_shuffle(adj_d_c, VECTOR_MASK_XZYW));
+	trace = vector_add(trace, vector_shuffle(trace, VECTOR_MASK_ZWXY));
+	trace = vector_add(trace, vector_shuffle(trace, VECTOR_MASK_YXWZ));
+	const vector_t det = vector_sub(vector_muladd(det_a, det_d, vector_mul(det_b, det_c)), trace);
+
+	const vector_t det_inv = vector_div(vector(1, -1, -1, 1), det);
+	x = vector_mul(x, det_inv);
+	y = vector_mul(y, det_inv);
+	z = vector_mul(z, det_inv);
+	w = vector_mul(w, det_inv);
+
+	// Adjugate and reassemble rows in one shuffle
+	matrix_t r;
+	r.row[0] = vector_shuffle2(x, y, VECTOR_MASK_WYWY);
+	r.row[1] = vector_shuffle2(x, y, VECTOR_MASK_ZXZX);
+	r.row[2] = vector_shuffle2(z, w, VECTOR_MASK_WYWY);
+	r.row[3] = vector_shuffle2(z, w, VECTOR_MASK_ZXZX);
+	return r;
+}
+#define VECTOR_HAVE_MATRIX_INVERSE 1
+
+#endif
+
 #include <vector/matrix_base.h>
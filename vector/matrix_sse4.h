@@ -15,25 +15,32 @@
  *
  */
 
-/*
 #ifndef VECTOR_HAVE_MATRIX_MUL
 
-matrix_t FOUNDATION_CONSTCALL
-matrix_mul( const matrix_t m0, const matrix_t m1 )
-{
-    //For SSE4 dot+or we need to zero out initial memory
-    matrix_t ret = matrix_zero();
+// Each row is split in two independent multiply-add pairs summed at the end, halving the dependency
+// chain compared to accumulating all four products in sequence. Multiply-adds are fused with FMA3
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_mul(const matrix_t m0, const matrix_t m1) {
+	matrix_t ret;
 
-    ret.row[0] = _mm_dp_ps( _v, m2._m[0], DP_PUTX_4F);
-    ret.row[1] = _mm_or_ps( _rm[i], _mm_dp_ps(_v, m2._m[1], DP_PUTY_4F) );
-    ret.row[2] = _mm_or_ps( _rm[i], _mm_dp_ps(_v, m2._m[2], DP_PUTZ_4F) );
-    ret.row[3] = _mm_or_ps( _rm[i], _mm_dp_ps(_v, m2._m[3], DP_PUTW_4F) );
+	const vector_t m1_r0 = m1.row[0];
+	const vector_t m1_r1 = m1.row[1];
+	const vector_t m1_r2 = m1.row[2];
+	const vector_t m1_r3 = m1.row[3];
 
-    return ret;
+	for (int row = 0; row < 4; ++row) {
+		const vector_t m0_r = m0.row[row];
+		const vector_t lo = vector_muladd(vector_shuffle(m0_r, VECTOR_MASK_YYYY), m1_r1,
+		                                  vector_mul(vector_shuffle(m0_r, VECTOR_MASK_XXXX), m1_r0));
+		const vector_t hi = vector_muladd(vector_shuffle(m0_r, VECTOR_MASK_WWWW), m1_r3,
+		                                  vector_mul(vector_shuffle(m0_r, VECTOR_MASK_ZZZZ), m1_r2));
+		ret.row[row] = vector_add(lo, hi);
+	}
+
+	return ret;
 }
+#define VECTOR_HAVE_MATRIX_MUL 1
 
-#define VECTOR_HAVE_MATRIX_MUL
 #endif
-*/
 
 #include <vector/matrix_sse3.h>
@@ -0,0 +1,135 @@
+/* pack.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file pack.h
+    Conversion between vectors and compact storage formats. Normalized integer formats map the
+    full integer range to [0, 1] (unorm) or [-1, 1] (snorm, where the most negative integer also
+    maps to -1). Stores clamp to the representable range and round to nearest. Array variants
+    convert count vectors, with count * 4 components (or count packed values) in the storage
+    buffer, which has no alignment requirement. */
+
+#include <vector/types.h>
+#include <vector/vector.h>
+#include <vector/quaternion.h>
+
+//! Load four IEEE 754 half precision values
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_half(const uint16_t* in);
+
+//! Store as four IEEE 754 half precision values, rounding to nearest even. Values out of range
+//! become infinity, NaN is preserved as a quiet NaN
+static FOUNDATION_FORCEINLINE void
+vector_store_half(uint16_t* out, const vector_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm8(const uint8_t* in);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm8(uint8_t* out, const vector_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm8(const int8_t* in);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm8(int8_t* out, const vector_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm16(const uint16_t* in);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm16(uint16_t* out, const vector_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm16(const int16_t* in);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm16(int16_t* out, const vector_t v);
+
+//! Unpack signed normalized 10:10:10:2 value, x in the lowest bits and w in the top two bits
+//! (same layout as GL_INT_2_10_10_10_REV). Intended for normals and tangents, where w holds the
+//! handedness as -1, 0 or 1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_unpack_snorm1010102(uint32_t packed);
+
+//! Pack to signed normalized 10:10:10:2 value, see vector_unpack_snorm1010102
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL uint32_t
+vector_pack_snorm1010102(const vector_t v);
+
+//! Load unit quaternion stored as smallest three components in 48 bits. Each of the three
+//! smallest components is quantized to 15 bits over [-1/sqrt(2), 1/sqrt(2)], with the index of
+//! the largest component in the top bit of the first two values. Max component error about 6e-5
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL quaternion_t
+quaternion_load_smallest3(const uint16_t* in);
+
+//! Store unit quaternion as smallest three components, see quaternion_load_smallest3. The
+//! quaternion is negated if needed to make the largest component positive
+static FOUNDATION_FORCEINLINE void
+quaternion_store_smallest3(uint16_t* out, const quaternion_t q);
+
+// Array conversions, see the single value functions above
+static FOUNDATION_FORCEINLINE void
+vector_load_half_array(vector_t* out, const uint16_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_half_array(uint16_t* out, const vector_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_load_unorm8_array(vector_t* out, const uint8_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm8_array(uint8_t* out, const vector_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_load_snorm8_array(vector_t* out, const int8_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm8_array(int8_t* out, const vector_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_load_unorm16_array(vector_t* out, const uint16_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm16_array(uint16_t* out, const vector_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_load_snorm16_array(vector_t* out, const int16_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm16_array(int16_t* out, const vector_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_unpack_snorm1010102_array(vector_t* out, const uint32_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+vector_pack_snorm1010102_array(uint32_t* out, const vector_t* in, size_t count);
+
+//! Load array of quaternions with count * 3 values in the storage buffer
+static FOUNDATION_FORCEINLINE void
+quaternion_load_smallest3_array(quaternion_t* out, const uint16_t* in, size_t count);
+
+static FOUNDATION_FORCEINLINE void
+quaternion_store_smallest3_array(uint16_t* out, const quaternion_t* in, size_t count);
+
+#if VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+#include <vector/pack_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON
+#include <vector/pack_neon.h>
+#else
+#include <vector/pack_fallback.h>
+#endif
@@ -0,0 +1,356 @@
+/* pack_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_PACK_HALF_COMPONENT
+
+//! Convert single precision to half precision with round to nearest even
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL uint16_t
+vector_pack_half_component(real value) {
+	union {
+		uint32_t u;
+		float32_t f;
+	} bits, magic;
+	bits.f = value;
+	const uint32_t sign = bits.u & 0x80000000U;
+	uint32_t half;
+	bits.u ^= sign;
+	if (bits.u >= ((127U + 16U) << 23)) {
+		// Infinity or NaN, keep NaN quiet
+		half = (bits.u > 0x7F800000U) ? 0x7E00U : 0x7C00U;
+	} else if (bits.u < (113U << 23)) {
+		// Subnormal or zero, the addition rounds the mantissa into place
+		magic.u = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+		bits.f += magic.f;
+		half = bits.u - magic.u;
+	} else {
+		const uint32_t mantissa_odd = (bits.u >> 13) & 1U;
+		bits.u += ((uint32_t)(15 - 127) << 23) + 0xFFFU;
+		bits.u += mantissa_odd;
+		half = bits.u >> 13;
+	}
+	return (uint16_t)(half | (sign >> 16));
+}
+
+//! Convert half precision to single precision
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL real
+vector_unpack_half_component(uint16_t half) {
+	union {
+		uint32_t u;
+		float32_t f;
+	} bits, magic;
+	const uint32_t shifted_exponent = 0x7C00U << 13;
+	bits.u = ((uint32_t)half & 0x7FFFU) << 13;
+	const uint32_t exponent = bits.u & shifted_exponent;
+	bits.u += (127U - 15U) << 23;
+	if (exponent == shifted_exponent) {
+		// Infinity or NaN
+		bits.u += (128U - 16U) << 23;
+	} else if (!exponent) {
+		// Subnormal, renormalize
+		magic.u = 113U << 23;
+		bits.u += 1U << 23;
+		bits.f -= magic.f;
+	}
+	bits.u |= ((uint32_t)half & 0x8000U) << 16;
+	return bits.f;
+}
+#define VECTOR_HAVE_PACK_HALF_COMPONENT 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_HALF
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_half(const uint16_t* in) {
+	return vector(vector_unpack_half_component(in[0]), vector_unpack_half_component(in[1]),
+	              vector_unpack_half_component(in[2]), vector_unpack_half_component(in[3]));
+}
+#define VECTOR_HAVE_LOAD_HALF 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_HALF
+
+static FOUNDATION_FORCEINLINE void
+vector_store_half(uint16_t* out, const vector_t v) {
+	out[0] = vector_pack_half_component(vector_x(v));
+	out[1] = vector_pack_half_component(vector_y(v));
+	out[2] = vector_pack_half_component(vector_z(v));
+	out[3] = vector_pack_half_component(vector_w(v));
+}
+#define VECTOR_HAVE_STORE_HALF 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_UNORM8
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm8(const uint8_t* in) {
+	return vector_mul(vector((real)in[0], (real)in[1], (real)in[2], (real)in[3]), vector_uniform(REAL_C(1.0) / 255));
+}
+#define VECTOR_HAVE_LOAD_UNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_UNORM8
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm8(uint8_t* out, const vector_t v) {
+	const vector_t s = vector_mul(vector_saturate(v), vector_uniform(255));
+	out[0] = (uint8_t)math_round(vector_x(s));
+	out[1] = (uint8_t)math_round(vector_y(s));
+	out[2] = (uint8_t)math_round(vector_z(s));
+	out[3] = (uint8_t)math_round(vector_w(s));
+}
+#define VECTOR_HAVE_STORE_UNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_SNORM8
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm8(const int8_t* in) {
+	const vector_t v = vector((real)in[0], (real)in[1], (real)in[2], (real)in[3]);
+	return vector_max(vector_mul(v, vector_uniform(REAL_C(1.0) / 127)), vector_neg(vector_one()));
+}
+#define VECTOR_HAVE_LOAD_SNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_SNORM8
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm8(int8_t* out, const vector_t v) {
+	const vector_t clamped = vector_clamp(v, vector_neg(vector_one()), vector_one());
+	const vector_t s = vector_mul(clamped, vector_uniform(127));
+	out[0] = (int8_t)math_round(vector_x(s));
+	out[1] = (int8_t)math_round(vector_y(s));
+	out[2] = (int8_t)math_round(vector_z(s));
+	out[3] = (int8_t)math_round(vector_w(s));
+}
+#define VECTOR_HAVE_STORE_SNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_UNORM16
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm16(const uint16_t* in) {
+	return vector_mul(vector((real)in[0], (real)in[1], (real)in[2], (real)in[3]), vector_uniform(REAL_C(1.0) / 65535));
+}
+#define VECTOR_HAVE_LOAD_UNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_UNORM16
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm16(uint16_t* out, const vector_t v) {
+	const vector_t s = vector_mul(vector_saturate(v), vector_uniform(65535));
+	out[0] = (uint16_t)math_round(vector_x(s));
+	out[1] = (uint16_t)math_round(vector_y(s));
+	out[2] = (uint16_t)math_round(vector_z(s));
+	out[3] = (uint16_t)math_round(vector_w(s));
+}
+#define VECTOR_HAVE_STORE_UNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_SNORM16
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm16(const int16_t* in) {
+	const vector_t v = vector((real)in[0], (real)in[1], (real)in[2], (real)in[3]);
+	return vector_max(vector_mul(v, vector_uniform(REAL_C(1.0) / 32767)), vector_neg(vector_one()));
+}
+#define VECTOR_HAVE_LOAD_SNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_SNORM16
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm16(int16_t* out, const vector_t v) {
+	const vector_t clamped = vector_clamp(v, vector_neg(vector_one()), vector_one());
+	const vector_t s = vector_mul(clamped, vector_uniform(32767));
+	out[0] = (int16_t)math_round(vector_x(s));
+	out[1] = (int16_t)math_round(vector_y(s));
+	out[2] = (int16_t)math_round(vector_z(s));
+	out[3] = (int16_t)math_round(vector_w(s));
+}
+#define VECTOR_HAVE_STORE_SNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_UNPACK_SNORM1010102
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_unpack_snorm1010102(uint32_t packed) {
+	// Shift each field to the top and back down to sign extend
+	const int32_t x = (int32_t)(packed << 22) >> 22;
+	const int32_t y = (int32_t)(packed << 12) >> 22;
+	const int32_t z = (int32_t)(packed << 2) >> 22;
+	const int32_t w = (int32_t)packed >> 30;
+	const real scale = REAL_C(1.0) / 511;
+	const vector_t v = vector_mul(vector((real)x, (real)y, (real)z, (real)w), vector(scale, scale, scale, 1));
+	return vector_max(v, vector_neg(vector_one()));
+}
+#define VECTOR_HAVE_UNPACK_SNORM1010102 1
+
+#endif
+
+#ifndef VECTOR_HAVE_PACK_SNORM1010102
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL uint32_t
+vector_pack_snorm1010102(const vector_t v) {
+	const vector_t clamped = vector_clamp(v, vector_neg(vector_one()), vector_one());
+	const vector_t s = vector_mul(clamped, vector(511, 511, 511, 1));
+	const uint32_t x = (uint32_t)(int32_t)math_round(vector_x(s)) & 0x3FFU;
+	const uint32_t y = (uint32_t)(int32_t)math_round(vector_y(s)) & 0x3FFU;
+	const uint32_t z = (uint32_t)(int32_t)math_round(vector_z(s)) & 0x3FFU;
+	const uint32_t w = (uint32_t)(int32_t)math_round(vector_w(s)) & 0x3U;
+	return x | (y << 10) | (z << 20) | (w << 30);
+}
+#define VECTOR_HAVE_PACK_SNORM1010102 1
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_LOAD_SMALLEST3
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL quaternion_t
+quaternion_load_smallest3(const uint16_t* in) {
+	const unsigned int largest = ((in[0] >> 15) & 1U) | ((in[1] >> 14) & 2U);
+	// Quantized [0, 32767] maps to [-1/sqrt(2), 1/sqrt(2)]
+	const vector_t scale = vector_uniform(REAL_C(1.4142135623730950) / 32767);
+	const vector_t bias = vector_uniform(REAL_C(-0.70710678118654752));
+	const vector_t quantized = vector((real)(in[0] & 0x7FFFU), (real)(in[1] & 0x7FFFU), (real)(in[2] & 0x7FFFU), 0);
+	const vector_t small = vector_muladd(quantized, scale, bias);
+	const real a = vector_x(small);
+	const real b = vector_y(small);
+	const real c = vector_z(small);
+	const real sqr = REAL_C(1.0) - (a * a + b * b + c * c);
+	const real d = (sqr > 0) ? math_sqrt(sqr) : 0;
+	switch (largest) {
+		case 0:
+			return quaternion_scalar(d, a, b, c);
+		case 1:
+			return quaternion_scalar(a, d, b, c);
+		case 2:
+			return quaternion_scalar(a, b, d, c);
+		default:
+			break;
+	}
+	return quaternion_scalar(a, b, c, d);
+}
+#define VECTOR_HAVE_QUATERNION_LOAD_SMALLEST3 1
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_STORE_SMALLEST3
+
+static FOUNDATION_FORCEINLINE void
+quaternion_store_smallest3(uint16_t* out, const quaternion_t q) {
+	const vector_t a = vector_abs(q);
+	unsigned int largest = 0;
+	real largest_value = vector_x(a);
+	for (unsigned int icomp = 1; icomp < 4; ++icomp) {
+		if (vector_component(a, (int)icomp) > largest_value) {
+			largest_value = vector_component(a, (int)icomp);
+			largest = icomp;
+		}
+	}
+	const quaternion_t positive = (vector_component(q, (int)largest) < 0) ? quaternion_neg(q) : q;
+	real small[3];
+	for (unsigned int icomp = 0, ismall = 0; icomp < 4; ++icomp) {
+		if (icomp != largest)
+			small[ismall++] = vector_component(positive, (int)icomp);
+	}
+	const vector_t range = vector_uniform(REAL_C(0.70710678118654752));
+	const vector_t clamped = vector_clamp(vector(small[0], small[1], small[2], 0), vector_neg(range), range);
+	const vector_t scale = vector_uniform(REAL_C(32767.0) / REAL_C(1.4142135623730950));
+	const vector_t s = vector_mul(vector_add(clamped, range), scale);
+	out[0] = (uint16_t)((uint32_t)math_round(vector_x(s)) | ((largest & 1U) << 15));
+	out[1] = (uint16_t)((uint32_t)math_round(vector_y(s)) | ((largest & 2U) << 14));
+	out[2] = (uint16_t)math_round(vector_z(s));
+}
+#define VECTOR_HAVE_QUATERNION_STORE_SMALLEST3 1
+
+#endif
+
+#ifndef VECTOR_HAVE_PACK_ARRAY
+
+// Array conversions are plain loops over the single value conversions, components are
+// consumed in groups of four (or packed values one by one) from the storage buffer
+#define VECTOR_PACK_LOAD_ARRAY(name, type, stride)                                                  \
+	static FOUNDATION_FORCEINLINE void name##_array(vector_t* out, const type* in, size_t count) { \
+		for (size_t i = 0; i < count; ++i)                                                            \
+			out[i] = name(in + (i * stride));                                                         \
+	}
+
+#define VECTOR_PACK_STORE_ARRAY(name, type, stride)                                                 \
+	static FOUNDATION_FORCEINLINE void name##_array(type* out, const vector_t* in, size_t count) { \
+		for (size_t i = 0; i < count; ++i)                                                            \
+			name(out + (i * stride), in[i]);                                                          \
+	}
+
+VECTOR_PACK_LOAD_ARRAY(vector_load_half, uint16_t, 4)
+VECTOR_PACK_STORE_ARRAY(vector_store_half, uint16_t, 4)
+VECTOR_PACK_LOAD_ARRAY(vector_load_unorm8, uint8_t, 4)
+VECTOR_PACK_STORE_ARRAY(vector_store_unorm8, uint8_t, 4)
+VECTOR_PACK_LOAD_ARRAY(vector_load_snorm8, int8_t, 4)
+VECTOR_PACK_STORE_ARRAY(vector_store_snorm8, int8_t, 4)
+VECTOR_PACK_LOAD_ARRAY(vector_load_unorm16, uint16_t, 4)
+VECTOR_PACK_STORE_ARRAY(vector_store_unorm16, uint16_t, 4)
+VECTOR_PACK_LOAD_ARRAY(vector_load_snorm16, int16_t, 4)
+VECTOR_PACK_STORE_ARRAY(vector_store_snorm16, int16_t, 4)
+VECTOR_PACK_LOAD_ARRAY(quaternion_load_smallest3, uint16_t, 3)
+VECTOR_PACK_STORE_ARRAY(quaternion_store_smallest3, uint16_t, 3)
+
+#undef VECTOR_PACK_LOAD_ARRAY
+#undef VECTOR_PACK_STORE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_unpack_snorm1010102_array(vector_t* out, const uint32_t* in, size_t count) {
+	for (size_t i = 0; i < count; ++i)
+		out[i] = vector_unpack_snorm1010102(in[i]);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_pack_snorm1010102_array(uint32_t* out, const vector_t* in, size_t count) {
+	for (size_t i = 0; i < count; ++i)
+		out[i] = vector_pack_snorm1010102(in[i]);
+}
+#define VECTOR_HAVE_PACK_ARRAY 1
+
+#endif
+
+#undef VECTOR_HAVE_PACK_HALF_COMPONENT
+#undef VECTOR_HAVE_LOAD_HALF
+#undef VECTOR_HAVE_STORE_HALF
+#undef VECTOR_HAVE_LOAD_UNORM8
+#undef VECTOR_HAVE_STORE_UNORM8
+#undef VECTOR_HAVE_LOAD_SNORM8
+#undef VECTOR_HAVE_STORE_SNORM8
+#undef VECTOR_HAVE_LOAD_UNORM16
+#undef VECTOR_HAVE_STORE_UNORM16
+#undef VECTOR_HAVE_LOAD_SNORM16
+#undef VECTOR_HAVE_STORE_SNORM16
+#undef VECTOR_HAVE_UNPACK_SNORM1010102
+#undef VECTOR_HAVE_PACK_SNORM1010102
+#undef VECTOR_HAVE_QUATERNION_LOAD_SMALLEST3
+#undef VECTOR_HAVE_QUATERNION_STORE_SMALLEST3
+#undef VECTOR_HAVE_PACK_ARRAY
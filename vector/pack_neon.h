@@ -0,0 +1,186 @@
+/* pack_neon.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#include <string.h>
+
+#if defined(__aarch64__)
+
+#ifndef VECTOR_HAVE_LOAD_HALF
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_half(const uint16_t* in) {
+	return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(in)));
+}
+#define VECTOR_HAVE_LOAD_HALF 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_HALF
+
+static FOUNDATION_FORCEINLINE void
+vector_store_half(uint16_t* out, const vector_t v) {
+	vst1_u16(out, vreinterpret_u16_f16(vcvt_f16_f32(v)));
+}
+#define VECTOR_HAVE_STORE_HALF 1
+
+#endif
+
+#endif
+
+//! Round to nearest integer, away from zero on ties for targets without a rounding conversion
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL int32x4_t
+vector_pack_round(const vector_t v) {
+#if defined(__aarch64__)
+	return vcvtnq_s32_f32(v);
+#else
+	const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000U));
+	const vector_t half = vreinterpretq_f32_u32(vorrq_u32(sign, vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+	return vcvtq_s32_f32(vaddq_f32(v, half));
+#endif
+}
+
+#ifndef VECTOR_HAVE_LOAD_UNORM8
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm8(const uint8_t* in) {
+	uint32_t bytes;
+	memcpy(&bytes, in, sizeof(bytes));
+	const uint16x4_t word = vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(bytes))));
+	return vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(word)), 1.0f / 255.0f);
+}
+#define VECTOR_HAVE_LOAD_UNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_UNORM8
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm8(uint8_t* out, const vector_t v) {
+	const vector_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+	const uint16x4_t word = vqmovn_u32(vreinterpretq_u32_s32(vector_pack_round(vmulq_n_f32(clamped, 255.0f))));
+	const uint32_t bytes = vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(word, word))), 0);
+	memcpy(out, &bytes, sizeof(bytes));
+}
+#define VECTOR_HAVE_STORE_UNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_SNORM8
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm8(const int8_t* in) {
+	uint32_t bytes;
+	memcpy(&bytes, in, sizeof(bytes));
+	const int16x4_t word = vget_low_s16(vmovl_s8(vreinterpret_s8_u32(vdup_n_u32(bytes))));
+	const vector_t v = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(word)), 1.0f / 127.0f);
+	return vmaxq_f32(v, vdupq_n_f32(-1.0f));
+}
+#define VECTOR_HAVE_LOAD_SNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_SNORM8
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm8(int8_t* out, const vector_t v) {
+	const vector_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f));
+	const int16x4_t word = vqmovn_s32(vector_pack_round(vmulq_n_f32(clamped, 127.0f)));
+	const uint32_t bytes = vget_lane_u32(vreinterpret_u32_s8(vqmovn_s16(vcombine_s16(word, word))), 0);
+	memcpy(out, &bytes, sizeof(bytes));
+}
+#define VECTOR_HAVE_STORE_SNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_UNORM16
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm16(const uint16_t* in) {
+	return vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vld1_u16(in))), 1.0f / 65535.0f);
+}
+#define VECTOR_HAVE_LOAD_UNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_UNORM16
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm16(uint16_t* out, const vector_t v) {
+	const vector_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+	vst1_u16(out, vqmovn_u32(vreinterpretq_u32_s32(vector_pack_round(vmulq_n_f32(clamped, 65535.0f)))));
+}
+#define VECTOR_HAVE_STORE_UNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_SNORM16
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm16(const int16_t* in) {
+	const vector_t v = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vld1_s16(in))), 1.0f / 32767.0f);
+	return vmaxq_f32(v, vdupq_n_f32(-1.0f));
+}
+#define VECTOR_HAVE_LOAD_SNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_SNORM16
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm16(int16_t* out, const vector_t v) {
+	const vector_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f));
+	vst1_s16(out, vqmovn_s32(vector_pack_round(vmulq_n_f32(clamped, 32767.0f))));
+}
+#define VECTOR_HAVE_STORE_SNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_UNPACK_SNORM1010102
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_unpack_snorm1010102(uint32_t packed) {
+	// Shift each field to the top of the lane and arithmetic shift down to sign extend
+	const int32_t shift_up[4] = {22, 12, 2, 0};
+	const int32_t shift_down[4] = {-22, -22, -22, -30};
+	const int32x4_t top = vshlq_s32(vdupq_n_s32((int32_t)packed), vld1q_s32(shift_up));
+	const int32x4_t fields = vshlq_s32(top, vld1q_s32(shift_down));
+	const float32_t scale[4] = {1.0f / 511.0f, 1.0f / 511.0f, 1.0f / 511.0f, 1.0f};
+	const vector_t v = vmulq_f32(vcvtq_f32_s32(fields), vld1q_f32(scale));
+	return vmaxq_f32(v, vdupq_n_f32(-1.0f));
+}
+#define VECTOR_HAVE_UNPACK_SNORM1010102 1
+
+#endif
+
+#ifndef VECTOR_HAVE_PACK_SNORM1010102
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL uint32_t
+vector_pack_snorm1010102(const vector_t v) {
+	const float32_t scale[4] = {511.0f, 511.0f, 511.0f, 1.0f};
+	const uint32_t mask[4] = {0x3FF, 0x3FF, 0x3FF, 0x3};
+	const int32_t shift[4] = {0, 10, 20, 30};
+	const vector_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f));
+	const uint32x4_t value = vreinterpretq_u32_s32(vector_pack_round(vmulq_f32(clamped, vld1q_f32(scale))));
+	const uint32x4_t fields = vshlq_u32(vandq_u32(value, vld1q_u32(mask)), vld1q_s32(shift));
+	const uint32x2_t pair = vorr_u32(vget_low_u32(fields), vget_high_u32(fields));
+	return vget_lane_u32(pair, 0) | vget_lane_u32(pair, 1);
+}
+#define VECTOR_HAVE_PACK_SNORM1010102 1
+
+#endif
+
+#include <vector/pack_base.h>
@@ -0,0 +1,244 @@
+/* pack_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#include <string.h>
+
+#if VECTOR_IMPLEMENTATION_AVX2 && (defined(__F16C__) || FOUNDATION_COMPILER_MSVC)
+
+#ifndef VECTOR_HAVE_LOAD_HALF
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_half(const uint16_t* in) {
+	return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)in));
+}
+#define VECTOR_HAVE_LOAD_HALF 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_HALF
+
+static FOUNDATION_FORCEINLINE void
+vector_store_half(uint16_t* out, const vector_t v) {
+	_mm_storel_epi64((__m128i*)out, _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+}
+#define VECTOR_HAVE_STORE_HALF 1
+
+#endif
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_HALF
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_half(const uint16_t* in) {
+	// Shift exponent and mantissa into place and rescale the exponent with a multiply, which also
+	// renormalizes subnormals. Infinity and NaN get the exponent bits set explicitly
+	const __m128i half = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)in), _mm_setzero_si128());
+	const __m128i exponent_mantissa = _mm_and_si128(half, _mm_set1_epi32(0x7FFF));
+	const __m128i sign = _mm_slli_epi32(_mm_xor_si128(half, exponent_mantissa), 16);
+	const vector_t magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+	const vector_t scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponent_mantissa, 13)), magic);
+	const __m128i infnan = _mm_cmpgt_epi32(exponent_mantissa, _mm_set1_epi32(0x7BFF));
+	const __m128i infnan_exponent = _mm_and_si128(infnan, _mm_set1_epi32(255 << 23));
+	return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infnan_exponent)));
+}
+#define VECTOR_HAVE_LOAD_HALF 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_HALF
+
+static FOUNDATION_FORCEINLINE void
+vector_store_half(uint16_t* out, const vector_t v) {
+	// Normal results round to nearest even by biasing before truncating the mantissa, subnormal
+	// results are rounded by a float addition which aligns the mantissa
+	const vector_t sign_bit = _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000U));
+	const vector_t sign = _mm_and_ps(sign_bit, v);
+	const vector_t absv = _mm_xor_ps(v, sign);
+	const __m128i bits = _mm_castps_si128(absv);
+	const __m128i subnormal_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+	const __m128i nan = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(absv, absv)), _mm_set1_epi32(0x200));
+	const __m128i infnan = _mm_or_si128(nan, _mm_set1_epi32(0x7C00));
+	const __m128i regular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), bits);
+	const __m128i subnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), bits);
+
+	const vector_t subnormal_round = _mm_add_ps(absv, _mm_castsi128_ps(subnormal_magic));
+	const __m128i subnormal_result = _mm_sub_epi32(_mm_castps_si128(subnormal_round), subnormal_magic);
+
+	const __m128i mantissa_odd = _mm_srai_epi32(_mm_slli_epi32(bits, 31 - 13), 31);
+	const __m128i normal_round = _mm_add_epi32(bits, _mm_set1_epi32(0xFFF - ((127 - 15) << 23)));
+	const __m128i normal_result = _mm_srli_epi32(_mm_sub_epi32(normal_round, mantissa_odd), 13);
+
+	const __m128i finite =
+	    _mm_or_si128(_mm_and_si128(subnormal, subnormal_result), _mm_andnot_si128(subnormal, normal_result));
+	const __m128i result = _mm_or_si128(_mm_and_si128(regular, finite), _mm_andnot_si128(regular, infnan));
+	// Sign shifted in as 0xFFFF8000 keeps the signed saturating pack exact
+	const __m128i half = _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+	_mm_storel_epi64((__m128i*)out, _mm_packs_epi32(half, half));
+}
+#define VECTOR_HAVE_STORE_HALF 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_UNORM8
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm8(const uint8_t* in) {
+	int32_t bytes;
+	memcpy(&bytes, in, sizeof(bytes));
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i value = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+	return _mm_mul_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(1.0f / 255.0f));
+}
+#define VECTOR_HAVE_LOAD_UNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_UNORM8
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm8(uint8_t* out, const vector_t v) {
+	const vector_t clamped = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	const __m128i value = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(255.0f)));
+	const __m128i word = _mm_packs_epi32(value, value);
+	const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(word, word));
+	memcpy(out, &bytes, sizeof(bytes));
+}
+#define VECTOR_HAVE_STORE_UNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_SNORM8
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm8(const int8_t* in) {
+	int32_t bytes;
+	memcpy(&bytes, in, sizeof(bytes));
+	// Unpack into the top of each lane and shift down arithmetically to sign extend
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i word = _mm_unpacklo_epi8(zero, _mm_cvtsi32_si128(bytes));
+	const __m128i value = _mm_srai_epi32(_mm_unpacklo_epi16(zero, word), 24);
+	const vector_t v = _mm_mul_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(1.0f / 127.0f));
+	return _mm_max_ps(v, _mm_set1_ps(-1.0f));
+}
+#define VECTOR_HAVE_LOAD_SNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_SNORM8
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm8(int8_t* out, const vector_t v) {
+	const vector_t clamped = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+	const __m128i value = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(127.0f)));
+	const __m128i word = _mm_packs_epi32(value, value);
+	const int32_t bytes = _mm_cvtsi128_si32(_mm_packs_epi16(word, word));
+	memcpy(out, &bytes, sizeof(bytes));
+}
+#define VECTOR_HAVE_STORE_SNORM8 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_UNORM16
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_unorm16(const uint16_t* in) {
+	const __m128i value = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)in), _mm_setzero_si128());
+	return _mm_mul_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(1.0f / 65535.0f));
+}
+#define VECTOR_HAVE_LOAD_UNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_UNORM16
+
+static FOUNDATION_FORCEINLINE void
+vector_store_unorm16(uint16_t* out, const vector_t v) {
+	const vector_t clamped = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	const __m128i value = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(65535.0f)));
+	// No unsigned saturating 32 to 16 bit pack before SSE4.1, bias into signed range and back
+	const __m128i biased = _mm_sub_epi32(value, _mm_set1_epi32(0x8000));
+	const __m128i word = _mm_xor_si128(_mm_packs_epi32(biased, biased), _mm_set1_epi16((short)0x8000));
+	_mm_storel_epi64((__m128i*)out, word);
+}
+#define VECTOR_HAVE_STORE_UNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOAD_SNORM16
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load_snorm16(const int16_t* in) {
+	const __m128i word = _mm_loadl_epi64((const __m128i*)in);
+	const __m128i value = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), word), 16);
+	const vector_t v = _mm_mul_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(1.0f / 32767.0f));
+	return _mm_max_ps(v, _mm_set1_ps(-1.0f));
+}
+#define VECTOR_HAVE_LOAD_SNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_STORE_SNORM16
+
+static FOUNDATION_FORCEINLINE void
+vector_store_snorm16(int16_t* out, const vector_t v) {
+	const vector_t clamped = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+	const __m128i value = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(32767.0f)));
+	_mm_storel_epi64((__m128i*)out, _mm_packs_epi32(value, value));
+}
+#define VECTOR_HAVE_STORE_SNORM16 1
+
+#endif
+
+#ifndef VECTOR_HAVE_UNPACK_SNORM1010102
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_unpack_snorm1010102(uint32_t packed) {
+	// Mask out each field in place, the conversion and per lane scale are exact. The w field
+	// occupies the sign bit and is sign extended by the conversion, xyz are sign corrected after
+	const __m128i mask = _mm_setr_epi32(0x3FF, 0x3FF << 10, 0x3FF << 20, (int)0xC0000000U);
+	const __m128i fields = _mm_and_si128(_mm_set1_epi32((int)packed), mask);
+	const vector_t scale = _mm_setr_ps(1.0f, 1.0f / 1024.0f, 1.0f / 1048576.0f, 1.0f / 1073741824.0f);
+	vector_t v = _mm_mul_ps(_mm_cvtepi32_ps(fields), scale);
+	const vector_t negative = _mm_cmpge_ps(v, _mm_setr_ps(512.0f, 512.0f, 512.0f, 4.0f));
+	v = _mm_sub_ps(v, _mm_and_ps(negative, _mm_set1_ps(1024.0f)));
+	v = _mm_mul_ps(v, _mm_setr_ps(1.0f / 511.0f, 1.0f / 511.0f, 1.0f / 511.0f, 1.0f));
+	return _mm_max_ps(v, _mm_set1_ps(-1.0f));
+}
+#define VECTOR_HAVE_UNPACK_SNORM1010102 1
+
+#endif
+
+#ifndef VECTOR_HAVE_PACK_SNORM1010102
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL uint32_t
+vector_pack_snorm1010102(const vector_t v) {
+	const vector_t clamped = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+	const vector_t scale = _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f);
+	const __m128i mask = _mm_setr_epi32(0x3FF, 0x3FF, 0x3FF, 3);
+	const __m128i fields = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(clamped, scale)), mask);
+	// Shift the fields into place in pairs and fold the halves together
+	const __m128i shifted = _mm_or_si128(fields, _mm_slli_epi64(_mm_srli_epi64(fields, 32), 10));
+	const __m128i combined = _mm_or_si128(shifted, _mm_slli_epi64(_mm_srli_si128(shifted, 8), 20));
+	return (uint32_t)_mm_cvtsi128_si32(combined);
+}
+#define VECTOR_HAVE_PACK_SNORM1010102 1
+
+#endif
+
+#include <vector/pack_base.h>
@@ -0,0 +1,253 @@
+/* parallel.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data types and
+ * functions to write applications and games in a platform-independent fashion. The latest source code is
+ * always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any restrictions.
+ *
+ */
+
+#include <foundation/foundation.h>
+
+#include <vector/vector.h>
+#include <vector/internal.h>
+
+#define VECTOR_PARALLEL_DEFAULT_CHUNK_SIZE (64 * 1024)
+
+typedef struct vector_parallel_job_t vector_parallel_job_t;
+
+struct vector_parallel_job_t {
+	vector_parallel_fn fn;
+	void* context;
+	size_t count;
+	size_t chunk;
+	size_t chunks;
+	atomic32_t next;
+};
+
+static thread_t* vector_parallel_thread;
+static unsigned int vector_parallel_thread_count;
+static size_t vector_parallel_chunk_size = VECTOR_PARALLEL_DEFAULT_CHUNK_SIZE;
+static semaphore_t vector_parallel_wake;
+static semaphore_t vector_parallel_finished;
+static atomic32_t vector_parallel_busy;
+static bool vector_parallel_exit;
+static vector_parallel_job_t vector_parallel_job;
+
+//! Claim and process chunks in increasing order until all are claimed
+static void
+vector_parallel_run(vector_parallel_job_t* job) {
+	while (true) {
+		const size_t index = (size_t)(atomic_incr32(&job->next, memory_order_relaxed) - 1);
+		if (index >= job->chunks)
+			break;
+		const size_t begin = index * job->chunk;
+		const size_t end = (job->count - begin > job->chunk) ? begin + job->chunk : job->count;
+		job->fn(job->context, begin, end);
+	}
+}
+
+static void*
+vector_parallel_worker(void* arg) {
+	FOUNDATION_UNUSED(arg);
+	while (true) {
+		semaphore_wait(&vector_parallel_wake);
+		if (vector_parallel_exit)
+			break;
+		vector_parallel_run(&vector_parallel_job);
+		semaphore_post(&vector_parallel_finished);
+	}
+	return 0;
+}
+
+int
+vector_parallel_initialize(const vector_config_t config) {
+	vector_parallel_chunk_size =
+	    config.parallel_chunk_size ? config.parallel_chunk_size : VECTOR_PARALLEL_DEFAULT_CHUNK_SIZE;
+	vector_parallel_thread_count = 0;
+	if (!config.parallel_workers)
+		return 0;
+
+	vector_parallel_thread =
+	    memory_allocate(HASH_VECTOR, sizeof(thread_t) * config.parallel_workers, 0, MEMORY_PERSISTENT);
+	if (!vector_parallel_thread)
+		return -1;
+	vector_parallel_exit = false;
+	semaphore_initialize(&vector_parallel_wake, 0);
+	semaphore_initialize(&vector_parallel_finished, 0);
+	for (unsigned int i = 0; i < config.parallel_workers; ++i) {
+		thread_t* thread = vector_parallel_thread + vector_parallel_thread_count;
+		thread_initialize(thread, vector_parallel_worker, 0, STRING_CONST("vector_parallel"), THREAD_PRIORITY_NORMAL,
+		                  0);
+		if (!thread_start(thread)) {
+			thread_finalize(thread);
+			break;
+		}
+		++vector_parallel_thread_count;
+	}
+	return 0;
+}
+
+void
+vector_parallel_finalize(void) {
+	if (vector_parallel_thread) {
+		vector_parallel_exit = true;
+		for (unsigned int i = 0; i < vector_parallel_thread_count; ++i)
+			semaphore_post(&vector_parallel_wake);
+		for (unsigned int i = 0; i < vector_parallel_thread_count; ++i) {
+			thread_join(vector_parallel_thread + i);
+			thread_finalize(vector_parallel_thread + i);
+		}
+		semaphore_finalize(&vector_parallel_wake);
+		semaphore_finalize(&vector_parallel_finished);
+		memory_deallocate(vector_parallel_thread);
+	}
+	vector_parallel_thread = 0;
+	vector_parallel_thread_count = 0;
+}
+
+//! Elements per chunk for elements of the given size
+static size_t
+vector_parallel_chunk(size_t element_size) {
+	const size_t chunk = vector_parallel_chunk_size / element_size;
+	return chunk ? chunk : 1;
+}
+
+void
+vector_parallel_for(size_t count, size_t chunk, vector_parallel_fn fn, void* context) {
+	if (!chunk)
+		chunk = 1;
+	// Chunk indices are claimed with a 32-bit counter
+	if (count / chunk >= INT32_MAX)
+		chunk = (count / INT32_MAX) + 1;
+	const size_t chunks = (count + chunk - 1) / chunk;
+	if ((chunks < 2) || !vector_parallel_thread_count ||
+	    !atomic_cas32(&vector_parallel_busy, 1, 0, memory_order_acquire, memory_order_relaxed)) {
+		if (count)
+			fn(context, 0, count);
+		return;
+	}
+
+	vector_parallel_job_t* job = &vector_parallel_job;
+	job->fn = fn;
+	job->context = context;
+	job->count = count;
+	job->chunk = chunk;
+	job->chunks = chunks;
+	atomic_store32(&job->next, 0, memory_order_relaxed);
+
+	const unsigned int workers =
+	    (chunks - 1 < vector_parallel_thread_count) ? (unsigned int)(chunks - 1) : vector_parallel_thread_count;
+	for (unsigned int i = 0; i < workers; ++i)
+		semaphore_post(&vector_parallel_wake);
+	vector_parallel_run(job);
+	for (unsigned int i = 0; i < workers; ++i)
+		semaphore_wait(&vector_parallel_finished);
+
+	atomic_store32(&vector_parallel_busy, 0, memory_order_release);
+}
+
+typedef struct {
+	void* out;
+	const void* in;
+	const void* arg;
+	const int32_t* parent;
+	size_t chunk;
+	atomic32_t* done;
+} vector_parallel_array_t;
+
+static void
+vector_parallel_rotate_range(void* context, size_t begin, size_t end) {
+	const vector_parallel_array_t* array = context;
+	vector_batch_rotate((vector_t*)array->out + begin, (const vector_t*)array->in + begin, end - begin,
+	                    *(const matrix_t*)array->arg);
+}
+
+static void
+vector_parallel_transform_range(void* context, size_t begin, size_t end) {
+	const vector_parallel_array_t* array = context;
+	vector_batch_transform((vector_t*)array->out + begin, (const vector_t*)array->in + begin, end - begin,
+	                       *(const matrix_t*)array->arg);
+}
+
+static void
+matrix_parallel_mul_range(void* context, size_t begin, size_t end) {
+	const vector_parallel_array_t* array = context;
+	matrix_batch_mul((matrix_t*)array->out + begin, (const matrix_t*)array->in + begin,
+	                 (const matrix_t*)array->arg + begin, end - begin);
+}
+
+static void
+matrix_parallel_mul_chain_range(void* context, size_t begin, size_t end) {
+	const vector_parallel_array_t* array = context;
+	matrix_t* out = array->out;
+	const matrix_t* local = array->in;
+	const int32_t* parent = array->parent;
+	size_t i;
+
+	// Chunks are claimed in order, so the chunks holding parents are done or in progress
+	size_t lowest = begin;
+	for (i = begin; i < end; ++i) {
+		if ((parent[i] >= 0) && ((size_t)parent[i] < lowest))
+			lowest = (size_t)parent[i];
+	}
+	for (size_t chunk = lowest / array->chunk; chunk < begin / array->chunk; ++chunk) {
+		while (!atomic_load32(array->done + chunk, memory_order_acquire))
+			thread_yield();
+	}
+
+	matrix_batch_mul_chain_range(out, local, parent, begin, end);
+
+	atomic_store32(array->done + (begin / array->chunk), 1, memory_order_release);
+}
+
+void
+vector_parallel_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	vector_parallel_array_t array = {out, in, &m, 0, 0, 0};
+	VECTOR_PROFILE_BEGIN();
+	vector_parallel_for(count, vector_parallel_chunk(sizeof(vector_t)), vector_parallel_rotate_range, &array);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_PARALLEL_ROTATE_ARRAY, count);
+}
+
+void
+vector_parallel_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	vector_parallel_array_t array = {out, in, &m, 0, 0, 0};
+	VECTOR_PROFILE_BEGIN();
+	vector_parallel_for(count, vector_parallel_chunk(sizeof(vector_t)), vector_parallel_transform_range, &array);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_PARALLEL_TRANSFORM_ARRAY, count);
+}
+
+void
+matrix_parallel_mul_array(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count) {
+	vector_parallel_array_t array = {out, m0, m1, 0, 0, 0};
+	VECTOR_PROFILE_BEGIN();
+	vector_parallel_for(count, vector_parallel_chunk(sizeof(matrix_t) * 2), matrix_parallel_mul_range, &array);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_PARALLEL_MUL_ARRAY, count);
+}
+
+void
+matrix_parallel_mul_chain(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t count) {
+	const size_t chunk = vector_parallel_chunk(sizeof(matrix_t));
+	atomic32_t* done = 0;
+	VECTOR_PROFILE_BEGIN();
+	if (vector_parallel_thread_count && (count > chunk)) {
+		const size_t chunks = (count + chunk - 1) / chunk;
+		done = memory_allocate(HASH_VECTOR, sizeof(atomic32_t) * chunks, 0, MEMORY_TEMPORARY | MEMORY_ZERO_INITIALIZED);
+	}
+	// Run serially when there are no workers, a single chunk or the chunk state could not be allocated
+	if (!done) {
+		matrix_batch_mul_chain(out, local, parent, count);
+	} else {
+		vector_parallel_array_t array = {out, local, 0, parent, chunk, done};
+		vector_parallel_for(count, chunk, matrix_parallel_mul_chain_range, &array);
+		memory_deallocate(done);
+	}
+	VECTOR_PROFILE_END(VECTOR_PROFILE_MATRIX_PARALLEL_MUL_CHAIN, count);
+}
@@ -0,0 +1,52 @@
+/* parallel.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file parallel.h
+    Parallel batch functions splitting large arrays into chunks processed by the worker threads
+    configured in vector_config_t and the calling thread. Functions return when all chunks are
+    done. One parallel call runs at a time, a call made while another is in progress (from another
+    thread or from inside a parallel function) runs on the calling thread only */
+
+#include <foundation/platform.h>
+#include <foundation/types.h>
+
+#include <vector/types.h>
+
+//! Call fn for ranges covering [0, count) in chunks of the given number of elements, on the
+//! worker threads and the calling thread. Ranges start at a multiple of chunk, but a range can
+//! span several chunks when the call runs on the calling thread only
+VECTOR_API void
+vector_parallel_for(size_t count, size_t chunk, vector_parallel_fn fn, void* context);
+
+//! Rotate array of vectors by matrix in parallel, see vector_batch_rotate
+VECTOR_API void
+vector_parallel_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Transform array of vectors by matrix in parallel, see vector_batch_transform
+VECTOR_API void
+vector_parallel_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Multiply arrays of matrices in parallel, see matrix_batch_mul
+VECTOR_API void
+matrix_parallel_mul_array(matrix_t* out, const matrix_t* m0, const matrix_t* m1, size_t count);
+
+//! Propagate a hierarchy of local matrices in parallel, see matrix_mul_chain. A chunk waits for
+//! the chunks holding the parents of its matrices, so this scales when the array holds many
+//! independent hierarchies, such as the skeletons of many characters, rather than a single deep one
+VECTOR_API void
+matrix_parallel_mul_chain(matrix_t* out, const matrix_t* local, const int32_t* parent, size_t count);
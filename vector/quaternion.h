@@ -23,6 +23,7 @@ Rotation abstraction using quaternions */
 #include <vector/types.h>
 #include <vector/mask.h>
 #include <vector/vector.h>
+#include <vector/soa.h>
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
 quaternion_zero(void);
@@ -42,9 +43,16 @@ quaternion_unaligned(const float32_t* FOUNDATION_RESTRICT q);
 static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL quaternion_t
 quaternion_aligned(const float32_aligned128_t* FOUNDATION_RESTRICT q);
 
+//! Rotation of matrix, upper 3x3 part must be a rotation (orthonormal without reflection).
+//! Branchless, all four Shoemake candidates are formed and selected by mask
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
 quaternion_from_matrix(const matrix_t m);
 
+//! Rotations of four matrices in structure-of-arrays layout, rowN holds row N of the four matrices
+//! (as loaded by vector_soa_load) and lane i of the result the quaternion of matrix i
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_from_matrix_soa(const vector_soa_t row0, const vector_soa_t row1, const vector_soa_t row2);
+
 //! Calculate quaternion representing rotation of "from" vector to "to" vector,
 //! i.e to = quaternion_rotate(quaternion_rotating_vector(from, to), from)
 //! \param from From vector
@@ -82,11 +90,86 @@ quaternion_sub(const quaternion_t q0, const quaternion_t q1);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
 quaternion_slerp(const quaternion_t q0, const quaternion_t q1, real factor);
 
+//! Normalized linear interpolation along the shortest arc, quaternions must be unit length
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_nlerp(const quaternion_t q0, const quaternion_t q1, real factor);
+
+//! Logarithm of unit quaternion, (axis * angle / 2, 0) for a rotation of angle around axis
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_log(const quaternion_t q);
+
+//! Exponential of quaternion with zero w component, inverse of quaternion_log
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_exp(const quaternion_t q);
+
+//! Slerp four quaternion pairs in structure-of-arrays layout with the factors in the lanes of the
+//! factor vector, along the shortest arc. Uses a branchless polynomial approximation of the slerp
+//! weights (Eberly, "A Fast and Accurate Algorithm for Computing SLERP") with max error about 1e-6
+//! in each weight
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_slerp_soa(const vector_soa_t q0, const vector_soa_t q1, const vector_t factor);
+
+//! Nlerp four quaternion pairs in structure-of-arrays layout, see quaternion_slerp_soa
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_nlerp_soa(const vector_soa_t q0, const vector_soa_t q1, const vector_t factor);
+
+//! Slerp arrays of unit quaternions, out[i] = slerp(q0[i], q1[i], factor[i]), four at a time in
+//! structure-of-arrays layout. Output can be the same array as one of the inputs
+static FOUNDATION_FORCEINLINE void
+quaternion_slerp_array(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count);
+
+//! Nlerp arrays of unit quaternions, see quaternion_slerp_array
+static FOUNDATION_FORCEINLINE void
+quaternion_nlerp_array(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count);
+
+//! Rotations of an array of matrices, out[i] = quaternion_from_matrix(in[i]), four at a time in
+//! structure-of-arrays layout
+static FOUNDATION_FORCEINLINE void
+quaternion_from_matrix_array(quaternion_t* out, const matrix_t* in, size_t count);
+
+//! Slerp arrays using the implementation selected at module initialization, see quaternion_slerp_array
+VECTOR_API void
+quaternion_batch_slerp(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count);
+
+//! Nlerp arrays using the implementation selected at module initialization, see quaternion_nlerp_array
+VECTOR_API void
+quaternion_batch_nlerp(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count);
+
+//! Rotations of matrices using the implementation selected at module initialization, see
+//! quaternion_from_matrix_array
+VECTOR_API void
+quaternion_batch_from_matrix(quaternion_t* out, const matrix_t* in, size_t count);
+
 // Vector is treated as directional vector [x, y, z, 0] and returns
 // a directional vector [x', y', z', 0]
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 quaternion_rotate(const quaternion_t q, const vector_t v);
 
+//! Rotate four vectors by four quaternions in structure-of-arrays layout, lane i of the result is
+//! vector i in v rotated by quaternion i in q. The w lanes of v are passed through
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_rotate_soa(const vector_soa_t q, const vector_soa_t v);
+
+//! Rotate an array of vectors by one quaternion, out[i] = quaternion_rotate(q, in[i]). The rotated
+//! axes are computed once, each vector then costs three multiply-adds. Output can be the same
+//! array as the input
+static FOUNDATION_FORCEINLINE void
+quaternion_rotate_array(vector_t* out, const vector_t* in, size_t count, const quaternion_t q);
+
+//! Rotate an array of vectors by an array of quaternions, out[i] = quaternion_rotate(q[i], in[i]),
+//! four at a time in structure-of-arrays layout. Output can be the same array as the input
+static FOUNDATION_FORCEINLINE void
+quaternion_rotate_pairs_array(vector_t* out, const quaternion_t* q, const vector_t* in, size_t count);
+
+//! Rotate pairs using the implementation selected at module initialization, see
+//! quaternion_rotate_pairs_array
+VECTOR_API void
+quaternion_batch_rotate_pairs(vector_t* out, const quaternion_t* q, const vector_t* in, size_t count);
+
 #if VECTOR_IMPLEMENTATION_SSE4
 #include <vector/quaternion_sse4.h>
 #elif VECTOR_IMPLEMENTATION_SSE3
@@ -98,3 +181,7 @@ quaternion_rotate(const quaternion_t q, const vector_t v);
 #else
 #include <vector/quaternion_fallback.h>
 #endif
+
+#include <vector/transform.h>
+#include <vector/dual_quaternion.h>
+#include <vector/pack.h>
@@ -167,86 +167,71 @@ quaternion_slerp(const quaternion_t q0, const quaternion_t q1, real factor) {
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 quaternion_rotate(const quaternion_t q, const vector_t v) {
-	// Quaternion "q" rotation of vector "w" is calculated by constructing
-	// a quaternion "v" with values (0,w) and the formula (where q' is the conjugate of q)
-	// q * v * q'
-	//
-	// Breaking this down and calculating q * v =
-	//    qs*0 - qv . w = -qv . w   (scalar part)
-	//    qs*w + qv x w             (vector part)
-	//
-	// Final calculation of q * v * q'
-	//  (scalar part)  -(qv . w)*qs + (qs*w + qv x w) . qv   = -(qv.w)*qs + (qv.w)*qs + ((qv x w) .
-	//  qv)    = 0 (vector part)  -qv*(-qv . w) + (qs*w + qv x w)*qs - (qs*w + qv x w) x qv
-	//
-	// Precalculating the vector v1 = (qs*w + qv x w) yields the final formula
-	//
-	//  qv * ( qv . w ) + v1 * qs - v1 % qv
-
-	// Potentially faster:
-	// t = 2 * cross(q.xyz, v)
-	// v' = v + q.w * t + cross(q.xyz, t)
-
-	vector_t v1 = vector_cross3(q, v);
-
-	v1.x += v.x * q.w;
-	v1.y += v.y * q.w;
-	v1.z += v.z * q.w;
-
-	vector_t v2 = vector_cross3(v1, q);
-	float32_t dot = (q.x * v.x + q.y * v.y + q.z * v.z);
-
-	vector_t r = {q.x * dot + v1.x * q.w - v2.x, q.y * dot + v1.y * q.w - v2.y, q.z * dot + v1.z * q.w - v2.z, v.w};
+	// Expanding q * (v, 0) * q' with t = 2 * (q.xyz x v) gives
+	// v' = v + q.w * t + q.xyz x t
+	const float32_t tx = 2 * (q.y * v.z - q.z * v.y);
+	const float32_t ty = 2 * (q.z * v.x - q.x * v.z);
+	const float32_t tz = 2 * (q.x * v.y - q.y * v.x);
+
+	vector_t r = {v.x + q.w * tx + (q.y * tz - q.z * ty), v.y + q.w * ty + (q.z * tx - q.x * tz),
+	              v.z + q.w * tz + (q.x * ty - q.y * tx), v.w};
 
 	return r;
 }
 
 #endif
 
-#ifndef VECTOR_HAVE_QUATERNION_FROM_MATRIX
+#ifndef VECTOR_HAVE_QUATERNION_FROM_MATRIX_SOA
 
-static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
-quaternion_from_matrix(const matrix_t m) {
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_from_matrix_soa(const vector_soa_t row0, const vector_soa_t row1, const vector_soa_t row2) {
 	// Algorithm in Ken Shoemake's article in 1987 SIGGRAPH course notes
-	// article "Quaternion Calculus and Fast Animation".
-	real trace = m.frow[0][0] + m.frow[1][1] + m.frow[2][2];
-	real root;
-	quaternion_t q;
-
-	if (trace > 0) {
-		root = math_sqrt(trace + REAL_C(1.0));
-		real w = REAL_C(0.5) * root;
-		root = REAL_C(0.5) / root;
-		q = quaternion_scalar((m.frow[1][2] - m.frow[2][1]) * root, (m.frow[2][0] - m.frow[0][2]) * root,
-		                      (m.frow[0][1] - m.frow[1][0]) * root, w);
-	} else {
-		int next[3] = {1, 2, 0};
-		int i = 0;
+	// article "Quaternion Calculus and Fast Animation". All four candidates are formed and the
+	// one Shoemake's branches would pick is selected per lane. Each candidate is the quaternion
+	// scaled by four times its largest component, so the final normalization removes the root
+	const vector_t one = vector_one();
+	const vector_t trace = vector_add(vector_add(row0.x, row1.y), row2.z);
+	const vector_t sum01 = vector_add(row0.y, row1.x);
+	const vector_t sum02 = vector_add(row2.x, row0.z);
+	const vector_t sum12 = vector_add(row1.z, row2.y);
+	const vector_t diff01 = vector_sub(row0.y, row1.x);
+	const vector_t diff02 = vector_sub(row2.x, row0.z);
+	const vector_t diff12 = vector_sub(row1.z, row2.y);
+
+	const vector_t tx = vector_sub(vector_add(one, row0.x), vector_add(row1.y, row2.z));
+	const vector_t ty = vector_sub(vector_add(one, row1.y), vector_add(row0.x, row2.z));
+	const vector_t tz = vector_sub(vector_add(one, row2.z), vector_add(row0.x, row1.y));
+	const vector_t tw = vector_add(one, trace);
+
+	vector_soa_t q = vector_soa(tx, sum01, sum02, diff12);
+	q = vector_soa_select(vector_greater(row1.y, row0.x), vector_soa(sum01, ty, sum12, diff02), q);
+	q = vector_soa_select(vector_greater(row2.z, vector_max(row0.x, row1.y)), vector_soa(sum02, sum12, tz, diff01),
+	                      q);
+	q = vector_soa_select(vector_greater(trace, vector_zero()), vector_soa(diff12, diff02, diff01, tw), q);
 
-		if (m.frow[1][1] > m.frow[0][0])
-			i = 1;
-		if (m.frow[2][2] > m.frow[i][i])
-			i = 2;
-
-		int j = next[i];
-		int k = next[j];
-
-		root = math_sqrt(m.frow[i][i] - m.frow[j][j] - m.frow[k][k] + REAL_C(1.0));
-
-		real FOUNDATION_ALIGN(16) quat[4] = {0, 0, 0, 0};
-
-		quat[i] = REAL_C(0.5) * root;
-		root = 0.5f / root;
+	// Since we represent a rotation, make sure we are unit length
+	return vector_soa_scale(q, vector_div(one, vector_sqrt(vector_soa_dot(q, q))));
+}
 
-		quat[j] = (m.frow[i][j] + m.frow[j][i]) * root;
-		quat[k] = (m.frow[i][k] + m.frow[k][i]) * root;
-		quat[3] = (m.frow[j][k] - m.frow[k][j]) * root;
+#endif
 
-		q = quaternion_aligned(quat);
-	}
+#ifndef VECTOR_HAVE_QUATERNION_FROM_MATRIX
 
-	// Since we represent a rotation, make sure we are unit length
-	return quaternion_normalize(q);
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_from_matrix(const matrix_t m) {
+	// Lanes of the splatted rows are identical, so lane 0 of the result holds the quaternion
+	const vector_soa_t row0 = vector_soa(vector_shuffle(m.row[0], VECTOR_MASK_XXXX),
+	                                     vector_shuffle(m.row[0], VECTOR_MASK_YYYY),
+	                                     vector_shuffle(m.row[0], VECTOR_MASK_ZZZZ), vector_zero());
+	const vector_soa_t row1 = vector_soa(vector_shuffle(m.row[1], VECTOR_MASK_XXXX),
+	                                     vector_shuffle(m.row[1], VECTOR_MASK_YYYY),
+	                                     vector_shuffle(m.row[1], VECTOR_MASK_ZZZZ), vector_zero());
+	const vector_soa_t row2 = vector_soa(vector_shuffle(m.row[2], VECTOR_MASK_XXXX),
+	                                     vector_shuffle(m.row[2], VECTOR_MASK_YYYY),
+	                                     vector_shuffle(m.row[2], VECTOR_MASK_ZZZZ), vector_zero());
+	const vector_soa_t q = quaternion_from_matrix_soa(row0, row1, row2);
+	return vector_shuffle2(vector_shuffle2(q.x, q.y, VECTOR_MASK_XXXX), vector_shuffle2(q.z, q.w, VECTOR_MASK_XXXX),
+	                       VECTOR_MASK_XZXZ);
 }
 
 #endif
@@ -264,6 +249,209 @@ quaternion_rotating_vector(const vector_t from, const vector_t to) {
 
 #endif
 
+#ifndef VECTOR_HAVE_QUATERNION_NLERP
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_nlerp(const quaternion_t q0, const quaternion_t q1, real factor) {
+	// Negate target if in the opposite hemisphere to avoid extra spins
+	const quaternion_t target = (vector_x(vector_dot(q0, q1)) < 0) ? quaternion_neg(q1) : q1;
+	return quaternion_normalize(vector_lerp(q0, target, factor));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_LOG
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_log(const quaternion_t q) {
+	real cosval = vector_w(q);
+	cosval = (cosval > REAL_C(1.0)) ? REAL_C(1.0) : ((cosval < REAL_C(-1.0)) ? REAL_C(-1.0) : cosval);
+	const real sinval = math_sqrt(REAL_C(1.0) - cosval * cosval);
+	// Limit of angle / sin(angle) is one for small angles
+	const real scale = (sinval > REAL_C(1e-6)) ? math_acos(cosval) / sinval : REAL_C(1.0);
+	return vector_mul(q, vector(scale, scale, scale, 0));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_EXP
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_exp(const quaternion_t q) {
+	const real angle = vector_x(vector_length3(q));
+	const real scale = (angle > REAL_C(1e-6)) ? math_sin(angle) / angle : REAL_C(1.0);
+	return vector_set_component(vector_scale(q, scale), 3, math_cos(angle));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_SLERP_SOA
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_slerp_soa(const vector_soa_t q0, const vector_soa_t q1, const vector_t factor) {
+	// Series sin(t * a) / sin(a) = sum b[i] * (cos(a) - 1)^i with b[0] = t and
+	// b[i] = b[i-1] * (u[i] * t^2 - v[i]), u[i] = 1 / (i * (2i + 1)), v[i] = i / (2i + 1), truncated
+	// to twelve terms with the last term scaled to minimize the max error for cos(a) in [0, 1]
+	static const float32_t u[12] = {1.0f / 3.0f,   1.0f / 10.0f,  1.0f / 21.0f,  1.0f / 36.0f,
+	                                1.0f / 55.0f,  1.0f / 78.0f,  1.0f / 105.0f, 1.0f / 136.0f,
+	                                1.0f / 171.0f, 1.0f / 210.0f, 1.0f / 253.0f, 1.89372f / 300.0f};
+	static const float32_t v[12] = {1.0f / 3.0f,   2.0f / 5.0f,   3.0f / 7.0f,   4.0f / 9.0f,
+	                                5.0f / 11.0f,  6.0f / 13.0f,  7.0f / 15.0f,  8.0f / 17.0f,
+	                                9.0f / 19.0f,  10.0f / 21.0f, 11.0f / 23.0f, 1.89372f * 12.0f / 25.0f};
+	const vector_t one = vector_one();
+	const vector_t cosval = vector_soa_dot(q0, q1);
+	// Negate target lanes in the opposite hemisphere to avoid extra spins
+	const vectori_t flip = vector_less(cosval, vector_zero());
+	const vector_soa_t target = vector_soa_select(flip, vector_soa_sub(vector_soa_splat(vector_zero()), q1), q1);
+	const vector_t xm1 = vector_sub(vector_abs(cosval), one);
+	const vector_t inv_factor = vector_sub(one, factor);
+	const vector_t sqr_factor = vector_mul(factor, factor);
+	const vector_t sqr_inv_factor = vector_mul(inv_factor, inv_factor);
+	vector_t c0 = one;
+	vector_t c1 = one;
+	for (int i = 11; i >= 0; --i) {
+		const vector_t ui = vector_uniform(u[i]);
+		const vector_t vi = vector_uniform(v[i]);
+		c0 = vector_muladd(vector_mul(vector_sub(vector_mul(ui, sqr_inv_factor), vi), xm1), c0, one);
+		c1 = vector_muladd(vector_mul(vector_sub(vector_mul(ui, sqr_factor), vi), xm1), c1, one);
+	}
+	c0 = vector_mul(c0, inv_factor);
+	c1 = vector_mul(c1, factor);
+	return vector_soa_add(vector_soa_scale(q0, c0), vector_soa_scale(target, c1));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_NLERP_SOA
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_nlerp_soa(const vector_soa_t q0, const vector_soa_t q1, const vector_t factor) {
+	const vectori_t flip = vector_less(vector_soa_dot(q0, q1), vector_zero());
+	const vector_soa_t target = vector_soa_select(flip, vector_soa_sub(vector_soa_splat(vector_zero()), q1), q1);
+	const vector_soa_t q = vector_soa_add(q0, vector_soa_scale(vector_soa_sub(target, q0), factor));
+	return vector_soa_scale(q, vector_rsqrt_fast(vector_soa_dot(q, q)));
+}
+
+#endif
+
+// Interpolate arrays four at a time in structure-of-arrays layout, with the remaining
+// quaternions padded with identity in the last block
+#define VECTOR_QUATERNION_INTERPOLATE_ARRAY(out, q0, q1, factor, count, interpolate)                     \
+	do {                                                                                                 \
+		size_t i = 0;                                                                                    \
+		for (; i + 4 <= (count); i += 4) {                                                               \
+			const vector_soa_t s0 = vector_soa_load((q0) + i);                                           \
+			const vector_soa_t s1 = vector_soa_load((q1) + i);                                           \
+			vector_soa_store((out) + i, interpolate(s0, s1, vector_unaligned((factor) + i)));            \
+		}                                                                                                \
+		if (i < (count)) {                                                                               \
+			quaternion_t block[3][4];                                                                    \
+			float32_t block_factor[4] = {0, 0, 0, 0};                                                    \
+			for (size_t j = 0; j < 4; ++j) {                                                             \
+				block[0][j] = (i + j < (count)) ? (q0)[i + j] : quaternion_identity();                   \
+				block[1][j] = (i + j < (count)) ? (q1)[i + j] : quaternion_identity();                   \
+				if (i + j < (count))                                                                     \
+					block_factor[j] = (factor)[i + j];                                                   \
+			}                                                                                            \
+			vector_soa_store(block[2], interpolate(vector_soa_load(block[0]), vector_soa_load(block[1]), \
+			                                       vector_unaligned(block_factor)));                     \
+			for (size_t j = 0; i + j < (count); ++j)                                                     \
+				(out)[i + j] = block[2][j];                                                              \
+		}                                                                                                \
+	} while (0)
+
+#ifndef VECTOR_HAVE_QUATERNION_SLERP_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+quaternion_slerp_array(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count) {
+	VECTOR_QUATERNION_INTERPOLATE_ARRAY(out, q0, q1, factor, count, quaternion_slerp_soa);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_NLERP_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+quaternion_nlerp_array(quaternion_t* out, const quaternion_t* q0, const quaternion_t* q1, const real* factor,
+                       size_t count) {
+	VECTOR_QUATERNION_INTERPOLATE_ARRAY(out, q0, q1, factor, count, quaternion_nlerp_soa);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_FROM_MATRIX_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+quaternion_from_matrix_array(quaternion_t* out, const matrix_t* in, size_t count) {
+	vector_t block[3][4];
+	quaternion_t result[4];
+	for (size_t i = 0; i < count; i += 4) {
+		for (size_t j = 0; j < 4; ++j) {
+			const matrix_t* m = (i + j < count) ? in + i + j : in + i;
+			block[0][j] = m->row[0];
+			block[1][j] = m->row[1];
+			block[2][j] = m->row[2];
+		}
+		vector_soa_store(result, quaternion_from_matrix_soa(vector_soa_load(block[0]), vector_soa_load(block[1]),
+		                                                    vector_soa_load(block[2])));
+		for (size_t j = 0; (j < 4) && (i + j < count); ++j)
+			out[i + j] = result[j];
+	}
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_ROTATE_SOA
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+quaternion_rotate_soa(const vector_soa_t q, const vector_soa_t v) {
+	const vector_soa_t t = vector_soa_cross3(q, vector_soa_add(v, v));
+	return vector_soa_add(vector_soa_add(v, vector_soa_scale(t, q.w)), vector_soa_cross3(q, t));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_ROTATE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+quaternion_rotate_array(vector_t* out, const vector_t* in, size_t count, const quaternion_t q) {
+	// Rotate the axes once, each vector is then a linear combination of the rotated axes
+	const vector_t xaxis = quaternion_rotate(q, vector(1, 0, 0, 0));
+	const vector_t yaxis = quaternion_rotate(q, vector(0, 1, 0, 0));
+	const vector_t zaxis = quaternion_rotate(q, vector(0, 0, 1, 0));
+	const vector_t waxis = vector(0, 0, 0, 1);
+	for (size_t i = 0; i < count; ++i) {
+		const vector_t v = in[i];
+		vector_t r = vector_mul(vector_shuffle(v, VECTOR_MASK_WWWW), waxis);
+		r = vector_muladd(vector_shuffle(v, VECTOR_MASK_XXXX), xaxis, r);
+		r = vector_muladd(vector_shuffle(v, VECTOR_MASK_YYYY), yaxis, r);
+		out[i] = vector_muladd(vector_shuffle(v, VECTOR_MASK_ZZZZ), zaxis, r);
+	}
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_QUATERNION_ROTATE_PAIRS_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+quaternion_rotate_pairs_array(vector_t* out, const quaternion_t* q, const vector_t* in, size_t count) {
+	vector_t block[2][4];
+	for (size_t i = 0; i < count; i += 4) {
+		for (size_t j = 0; j < 4; ++j) {
+			block[0][j] = (i + j < count) ? q[i + j] : quaternion_identity();
+			block[1][j] = (i + j < count) ? in[i + j] : vector_zero();
+		}
+		vector_soa_store(block[1], quaternion_rotate_soa(vector_soa_load(block[0]), vector_soa_load(block[1])));
+		for (size_t j = 0; (j < 4) && (i + j < count); ++j)
+			out[i + j] = block[1][j];
+	}
+}
+
+#endif
+
+#undef VECTOR_QUATERNION_INTERPOLATE_ARRAY
+
 #undef VECTOR_HAVE_QUATERNION_ZERO
 #undef VECTOR_HAVE_QUATERNION_IDENTITY
 #undef VECTOR_HAVE_QUATERNION_UNALIGNED
@@ -276,6 +464,18 @@ quaternion_rotating_vector(const vector_t from, const vector_t to) {
 #undef VECTOR_HAVE_QUATERNION_ADD
 #undef VECTOR_HAVE_QUATERNION_SUB
 #undef VECTOR_HAVE_QUATERNION_SLERP
+#undef VECTOR_HAVE_QUATERNION_NLERP
+#undef VECTOR_HAVE_QUATERNION_LOG
+#undef VECTOR_HAVE_QUATERNION_EXP
+#undef VECTOR_HAVE_QUATERNION_SLERP_SOA
+#undef VECTOR_HAVE_QUATERNION_NLERP_SOA
+#undef VECTOR_HAVE_QUATERNION_SLERP_ARRAY
+#undef VECTOR_HAVE_QUATERNION_NLERP_ARRAY
 #undef VECTOR_HAVE_QUATERNION_ROTATE
+#undef VECTOR_HAVE_QUATERNION_ROTATE_SOA
+#undef VECTOR_HAVE_QUATERNION_ROTATE_ARRAY
+#undef VECTOR_HAVE_QUATERNION_ROTATE_PAIRS_ARRAY
+#undef VECTOR_HAVE_QUATERNION_FROM_MATRIX_SOA
 #undef VECTOR_HAVE_QUATERNION_FROM_MATRIX
+#undef VECTOR_HAVE_QUATERNION_FROM_MATRIX_ARRAY
 #undef VECTOR_HAVE_QUATERNION_ROTATING_VECTOR
@@ -19,38 +19,16 @@
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
 quaternion_mul(const quaternion_t q0, const quaternion_t q1) {
-	// From http://momchil-velikov.blogspot.de/2013/10/fast-sse-quternion-multiplication.html
-	const vector_t q0_wwww = vector_shuffle(q0, VECTOR_MASK_WWWW);
-	const vector_t q1_yxwz = vector_shuffle(q1, VECTOR_MASK_YXWZ);
-	const vector_t q0_xxxx = vector_shuffle(q0, VECTOR_MASK_XXXX);
-	const vector_t q1_zwxy = vector_shuffle(q1, VECTOR_MASK_ZWXY);
-	const vector_t q0_yyyy = vector_shuffle(q0, VECTOR_MASK_YYYY);
-	const vector_t q1_ywxz = vector_shuffle(q1, VECTOR_MASK_YWXZ);
-
-	/* q0.w * q1.yxwz */
-	const vector_t q0w_q1yxzw = vector_mul(q0_wwww, q1_yxwz);
-
-	/* q0.x * q1.zwxy */
-	const vector_t q0x_q1zwxy = vector_mul(q0_xxxx, q1_zwxy);
-
-	/* q0.y * q1.ywxz */
-	const vector_t q0y_q1ywxz = vector_mul(q0_yyyy, q1_ywxz);
-
-	/* q0.z * q1.yxzw */
-	const vector_t q0_zzzz = vector_shuffle(q0, VECTOR_MASK_ZZZZ);
-	const vector_t q1_yxzw = vector_shuffle(q1, VECTOR_MASK_YXZW);
-	const vector_t q0z_q1yxzw = vector_mul(q0_zzzz, q1_yxzw);
-
-	vector_arr_t signs = {1, -1, 1, -1};
-	const vector_t signshuffle = vector_aligned(signs);
-	vector_t e = vector_add(q0w_q1yxzw, vector_mul(q0x_q1zwxy, signshuffle));
-	e = vector_shuffle(e, VECTOR_MASK_ZXWY);
-
-	e = vector_add(e, vector_mul(q0y_q1ywxz, signshuffle));
-	e = vector_shuffle(e, VECTOR_MASK_WYXZ);
-
-	e = vector_add(e, vector_mul(q0z_q1yxzw, signshuffle));
-	return vector_shuffle(e, VECTOR_MASK_XYWZ);
+	// Product q1 * q0 (rotation q0 followed by q1) expanded per component of q1
+	vector_arr_t signs[3] = {{1, -1, 1, -1}, {1, 1, -1, -1}, {-1, 1, 1, -1}};
+	const vector_t q0_zwxy = vextq_f32(q0, q0, 2);
+	const vector_t q0_wzyx = vrev64q_f32(q0_zwxy);
+	const vector_t q0_yxwz = vrev64q_f32(q0);
+	vector_t r = vmulq_lane_f32(q0, vget_high_f32(q1), 1);
+	r = vector_muladd(vector_mul(vector_shuffle(q1, VECTOR_MASK_XXXX), vector_aligned(signs[0])), q0_wzyx, r);
+	r = vector_muladd(vector_mul(vector_shuffle(q1, VECTOR_MASK_YYYY), vector_aligned(signs[1])), q0_zwxy, r);
+	r = vector_muladd(vector_mul(vector_shuffle(q1, VECTOR_MASK_ZZZZ), vector_aligned(signs[2])), q0_yxwz, r);
+	return r;
 }
 #define VECTOR_HAVE_QUATERNION_MUL 1
 
@@ -60,14 +38,9 @@ quaternion_mul(const quaternion_t q0, const quaternion_t q1) {
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 quaternion_rotate(const quaternion_t q, const vector_t v) {
-	const vector_t v1 = vector_cross3(q, v);
-	const vector_t qw = vector_shuffle(q, VECTOR_MASK_WWWW);
-	const vector_t v2 = vector_muladd(v, qw, v1);
-	const vector_t v3 = vector_cross3(v2, q);
-	const vector_t dot = vector_dot(q, v);
-	const vector_t v4 = vector_muladd(v2, qw, vector_neg(v3));
-	const vector_t r = vector_muladd(q, dot, v4);
-	return r;
+	// t = 2 * (q.xyz x v), v' = v + q.w * t + q.xyz x t
+	const vector_t t = vector_cross3(q, vector_add(v, v));
+	return vector_add(vector_muladd(vector_shuffle(q, VECTOR_MASK_WWWW), t, v), vector_cross3(q, t));
 }
 #define VECTOR_HAVE_QUATERNION_ROTATE 1
 
@@ -89,4 +62,18 @@ quaternion_rotating_vector(const vector_t from, const vector_t to) {
 
 #endif
 
+#ifndef VECTOR_HAVE_QUATERNION_NLERP
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_nlerp(const quaternion_t q0, const quaternion_t q1, real factor) {
+	// Negate target if in the opposite hemisphere to avoid extra spins, sign bit of the
+	// dot product flipped into the target without branching
+	const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(vector_dot(q0, q1)), vdupq_n_u32(0x80000000U));
+	const vector_t target = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(q1), sign));
+	return quaternion_normalize(vector_lerp(q0, target, factor));
+}
+#define VECTOR_HAVE_QUATERNION_NLERP 1
+
+#endif
+
 #include <vector/quaternion_base.h>
@@ -0,0 +1,137 @@
+/* soa.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file soa.h
+    Structure-of-arrays operations on four vectors at once. Each member of vector_soa_t holds
+    one component of four vectors, so operations like dot products are computed with vertical
+    instructions only, producing four results in one vector without horizontal shuffles. */
+
+#include <vector/types.h>
+#include <vector/mask.h>
+#include <vector/vector.h>
+#include <vector/matrix.h>
+
+//! Construct from component vectors (x components of all four vectors in x, and so on)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa(const vector_t x, const vector_t y, const vector_t z, const vector_t w);
+
+//! Replicate one vector into all four lanes
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_splat(const vector_t v);
+
+//! Transpose four consecutive vectors into structure-of-arrays layout
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_soa_t
+vector_soa_load(const vector_t* FOUNDATION_RESTRICT v);
+
+//! Transpose back and store as four consecutive vectors
+static FOUNDATION_FORCEINLINE void
+vector_soa_store(vector_t* FOUNDATION_RESTRICT v, const vector_soa_t s);
+
+//! Transpose an array of vectors into (count + 3) / 4 structure-of-arrays blocks. Unused lanes
+//! in the last block are set to zero
+static FOUNDATION_FORCEINLINE void
+vector_soa_load_array(vector_soa_t* FOUNDATION_RESTRICT out, const vector_t* FOUNDATION_RESTRICT in, size_t count);
+
+//! Transpose (count + 3) / 4 structure-of-arrays blocks back into an array of count vectors
+static FOUNDATION_FORCEINLINE void
+vector_soa_store_array(vector_t* FOUNDATION_RESTRICT out, const vector_soa_t* FOUNDATION_RESTRICT in, size_t count);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_add(const vector_soa_t s0, const vector_soa_t s1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_sub(const vector_soa_t s0, const vector_soa_t s1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_mul(const vector_soa_t s0, const vector_soa_t s1);
+
+//! Multiply s0 and s1 and add s2 (s0 * s1 + s2)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_muladd(const vector_soa_t s0, const vector_soa_t s1, const vector_soa_t s2);
+
+//! Scale each vector by the corresponding lane in the scale vector
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_scale(const vector_soa_t s, const vector_t scale);
+
+//! Four dot products, lane i holds the dot product of vector i in s0 and s1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_dot(const vector_soa_t s0, const vector_soa_t s1);
+
+//! Four three-component dot products, lane i holds the result for vector i
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_dot3(const vector_soa_t s0, const vector_soa_t s1);
+
+//! Four three-component cross products, w components are set to zero
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_cross3(const vector_soa_t s0, const vector_soa_t s1);
+
+//! Four three-component lengths, lane i holds the length of vector i
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_length3(const vector_soa_t s);
+
+//! Four squared three-component lengths, lane i holds the squared length of vector i
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_length3_sqr(const vector_soa_t s);
+
+//! Normalize x, y and z components of the four vectors, w components are preserved
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_normalize3(const vector_soa_t s);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_min(const vector_soa_t s0, const vector_soa_t s1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_max(const vector_soa_t s0, const vector_soa_t s1);
+
+//! Select vectors by lane mask, lane i is taken from s0 if mask lane i is set (all bits), otherwise
+//! from s1. Masks are as returned by the vector comparison functions, for example
+//! vector_less(vector_soa_dot3(s0, s1), limit)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_select(const vectori_t mask, const vector_soa_t s0, const vector_soa_t s1);
+
+//! Spatial hash keys of the grid cells containing four points, lane i holds the key of point i.
+//! Cell coordinates are floor(p * inv_cell_size) of the x, y and z components, combined by
+//! multiplying with large primes and xor, so keys of distinct cells can collide
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vector_soa_hash_cells(const vector_soa_t s, const vector_t inv_cell_size);
+
+//! Spatial hash keys of the grid cells of size cell_size containing an array of points, four at a
+//! time in structure-of-arrays layout, see vector_soa_hash_cells
+static FOUNDATION_FORCEINLINE void
+vector_hash_cells_array(uint32_t* FOUNDATION_RESTRICT out, const vector_t* FOUNDATION_RESTRICT in, size_t count,
+                        real cell_size);
+
+//! Hash grid cells of points using the implementation selected at module initialization, see
+//! vector_hash_cells_array
+VECTOR_API void
+vector_batch_hash_cells(uint32_t* out, const vector_t* in, size_t count, real cell_size);
+
+#if VECTOR_IMPLEMENTATION_AVX2
+#include <vector/soa_avx2.h>
+#elif VECTOR_IMPLEMENTATION_SSE4
+#include <vector/soa_sse4.h>
+#elif VECTOR_IMPLEMENTATION_SSE3
+#include <vector/soa_sse3.h>
+#elif VECTOR_IMPLEMENTATION_SSE2
+#include <vector/soa_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON
+#include <vector/soa_neon.h>
+#else
+#include <vector/soa_fallback.h>
+#endif
@@ -0,0 +1,100 @@
+/* soa_avx2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+// Transpose two blocks of four vectors at once, each 128-bit lane holds one block. Same
+// unpack and shuffle sequence as _MM_TRANSPOSE4_PS
+#define VECTOR_SOA_TRANSPOSE_AVX2(r0, r1, r2, r3)         \
+	do {                                                  \
+		const __m256 t0 = _mm256_unpacklo_ps(r0, r1);     \
+		const __m256 t1 = _mm256_unpackhi_ps(r0, r1);     \
+		const __m256 t2 = _mm256_unpacklo_ps(r2, r3);     \
+		const __m256 t3 = _mm256_unpackhi_ps(r2, r3);     \
+		r0 = _mm256_shuffle_ps(t0, t2, VECTOR_MASK_XYXY); \
+		r1 = _mm256_shuffle_ps(t0, t2, VECTOR_MASK_ZWZW); \
+		r2 = _mm256_shuffle_ps(t1, t3, VECTOR_MASK_XYXY); \
+		r3 = _mm256_shuffle_ps(t1, t3, VECTOR_MASK_ZWZW); \
+	} while (0)
+
+#ifndef VECTOR_HAVE_SOA_LOAD_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_load_array(vector_soa_t* FOUNDATION_RESTRICT out, const vector_t* FOUNDATION_RESTRICT in, size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8, out += 2) {
+		__m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[i]), in[i + 4], 1);
+		__m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[i + 1]), in[i + 5], 1);
+		__m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[i + 2]), in[i + 6], 1);
+		__m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[i + 3]), in[i + 7], 1);
+		VECTOR_SOA_TRANSPOSE_AVX2(r0, r1, r2, r3);
+		out[0].x = _mm256_castps256_ps128(r0);
+		out[0].y = _mm256_castps256_ps128(r1);
+		out[0].z = _mm256_castps256_ps128(r2);
+		out[0].w = _mm256_castps256_ps128(r3);
+		out[1].x = _mm256_extractf128_ps(r0, 1);
+		out[1].y = _mm256_extractf128_ps(r1, 1);
+		out[1].z = _mm256_extractf128_ps(r2, 1);
+		out[1].w = _mm256_extractf128_ps(r3, 1);
+	}
+	for (; i + 4 <= count; i += 4)
+		*out++ = vector_soa_load(in + i);
+	if (i < count) {
+		vector_t tail[4];
+		for (size_t j = 0; j < 4; ++j)
+			tail[j] = (i + j < count) ? in[i + j] : vector_zero();
+		*out = vector_soa_load(tail);
+	}
+}
+#define VECTOR_HAVE_SOA_LOAD_ARRAY 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_STORE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_store_array(vector_t* FOUNDATION_RESTRICT out, const vector_soa_t* FOUNDATION_RESTRICT in, size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8, in += 2) {
+		__m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[0].x), in[1].x, 1);
+		__m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[0].y), in[1].y, 1);
+		__m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[0].z), in[1].z, 1);
+		__m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(in[0].w), in[1].w, 1);
+		VECTOR_SOA_TRANSPOSE_AVX2(r0, r1, r2, r3);
+		out[i] = _mm256_castps256_ps128(r0);
+		out[i + 1] = _mm256_castps256_ps128(r1);
+		out[i + 2] = _mm256_castps256_ps128(r2);
+		out[i + 3] = _mm256_castps256_ps128(r3);
+		out[i + 4] = _mm256_extractf128_ps(r0, 1);
+		out[i + 5] = _mm256_extractf128_ps(r1, 1);
+		out[i + 6] = _mm256_extractf128_ps(r2, 1);
+		out[i + 7] = _mm256_extractf128_ps(r3, 1);
+	}
+	for (; i + 4 <= count; i += 4)
+		vector_soa_store(out + i, *in++);
+	if (i < count) {
+		vector_t tail[4];
+		vector_soa_store(tail, *in);
+		for (size_t j = 0; i + j < count; ++j)
+			out[i + j] = tail[j];
+	}
+}
+#define VECTOR_HAVE_SOA_STORE_ARRAY 1
+
+#endif
+
+#undef VECTOR_SOA_TRANSPOSE_AVX2
+
+#include <vector/soa_sse4.h>
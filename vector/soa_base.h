@@ -0,0 +1,221 @@
+/* soa_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#include <string.h>
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa(const vector_t x, const vector_t y, const vector_t z, const vector_t w) {
+	vector_soa_t s;
+	s.x = x;
+	s.y = y;
+	s.z = z;
+	s.w = w;
+	return s;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_splat(const vector_t v) {
+	return vector_soa(vector_shuffle(v, VECTOR_MASK_XXXX), vector_shuffle(v, VECTOR_MASK_YYYY),
+	                  vector_shuffle(v, VECTOR_MASK_ZZZZ), vector_shuffle(v, VECTOR_MASK_WWWW));
+}
+
+#ifndef VECTOR_HAVE_SOA_LOAD
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_soa_t
+vector_soa_load(const vector_t* FOUNDATION_RESTRICT v) {
+	matrix_t m;
+	m.row[0] = v[0];
+	m.row[1] = v[1];
+	m.row[2] = v[2];
+	m.row[3] = v[3];
+	m = matrix_transpose(m);
+	return vector_soa(m.row[0], m.row[1], m.row[2], m.row[3]);
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_STORE
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_store(vector_t* FOUNDATION_RESTRICT v, const vector_soa_t s) {
+	matrix_t m;
+	m.row[0] = s.x;
+	m.row[1] = s.y;
+	m.row[2] = s.z;
+	m.row[3] = s.w;
+	m = matrix_transpose(m);
+	v[0] = m.row[0];
+	v[1] = m.row[1];
+	v[2] = m.row[2];
+	v[3] = m.row[3];
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_LOAD_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_load_array(vector_soa_t* FOUNDATION_RESTRICT out, const vector_t* FOUNDATION_RESTRICT in, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		*out++ = vector_soa_load(in + i);
+	if (i < count) {
+		vector_t tail[4];
+		for (size_t j = 0; j < 4; ++j)
+			tail[j] = (i + j < count) ? in[i + j] : vector_zero();
+		*out = vector_soa_load(tail);
+	}
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_STORE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_store_array(vector_t* FOUNDATION_RESTRICT out, const vector_soa_t* FOUNDATION_RESTRICT in, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		vector_soa_store(out + i, *in++);
+	if (i < count) {
+		vector_t tail[4];
+		vector_soa_store(tail, *in);
+		for (size_t j = 0; i + j < count; ++j)
+			out[i + j] = tail[j];
+	}
+}
+
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_add(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_add(s0.x, s1.x), vector_add(s0.y, s1.y), vector_add(s0.z, s1.z), vector_add(s0.w, s1.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_sub(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_sub(s0.x, s1.x), vector_sub(s0.y, s1.y), vector_sub(s0.z, s1.z), vector_sub(s0.w, s1.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_mul(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_mul(s0.x, s1.x), vector_mul(s0.y, s1.y), vector_mul(s0.z, s1.z), vector_mul(s0.w, s1.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_muladd(const vector_soa_t s0, const vector_soa_t s1, const vector_soa_t s2) {
+	return vector_soa(vector_muladd(s0.x, s1.x, s2.x), vector_muladd(s0.y, s1.y, s2.y),
+	                  vector_muladd(s0.z, s1.z, s2.z), vector_muladd(s0.w, s1.w, s2.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_scale(const vector_soa_t s, const vector_t scale) {
+	return vector_soa(vector_mul(s.x, scale), vector_mul(s.y, scale), vector_mul(s.z, scale), vector_mul(s.w, scale));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_dot(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_muladd(s0.w, s1.w, vector_muladd(s0.z, s1.z, vector_muladd(s0.y, s1.y, vector_mul(s0.x, s1.x))));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_dot3(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_muladd(s0.z, s1.z, vector_muladd(s0.y, s1.y, vector_mul(s0.x, s1.x)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_cross3(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_sub(vector_mul(s0.y, s1.z), vector_mul(s0.z, s1.y)),
+	                  vector_sub(vector_mul(s0.z, s1.x), vector_mul(s0.x, s1.z)),
+	                  vector_sub(vector_mul(s0.x, s1.y), vector_mul(s0.y, s1.x)), vector_zero());
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_length3_sqr(const vector_soa_t s) {
+	return vector_soa_dot3(s, s);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_length3(const vector_soa_t s) {
+	return vector_sqrt(vector_soa_dot3(s, s));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_normalize3(const vector_soa_t s) {
+	const vector_t inv_length = vector_div(vector_one(), vector_sqrt(vector_soa_dot3(s, s)));
+	return vector_soa(vector_mul(s.x, inv_length), vector_mul(s.y, inv_length), vector_mul(s.z, inv_length), s.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_min(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_min(s0.x, s1.x), vector_min(s0.y, s1.y), vector_min(s0.z, s1.z), vector_min(s0.w, s1.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_max(const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_max(s0.x, s1.x), vector_max(s0.y, s1.y), vector_max(s0.z, s1.z), vector_max(s0.w, s1.w));
+}
+
+#ifndef VECTOR_HAVE_SOA_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_soa_select_lanes(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	return vector(vectori_x(mask) ? vector_x(v0) : vector_x(v1), vectori_y(mask) ? vector_y(v0) : vector_y(v1),
+	              vectori_z(mask) ? vector_z(v0) : vector_z(v1), vectori_w(mask) ? vector_w(v0) : vector_w(v1));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_select(const vectori_t mask, const vector_soa_t s0, const vector_soa_t s1) {
+	return vector_soa(vector_soa_select_lanes(mask, s0.x, s1.x), vector_soa_select_lanes(mask, s0.y, s1.y),
+	                  vector_soa_select_lanes(mask, s0.z, s1.z), vector_soa_select_lanes(mask, s0.w, s1.w));
+}
+
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vector_soa_hash_cells(const vector_soa_t s, const vector_t inv_cell_size) {
+	const vectori_t x = vector_to_vectori(vector_floor(vector_mul(s.x, inv_cell_size)));
+	const vectori_t y = vector_to_vectori(vector_floor(vector_mul(s.y, inv_cell_size)));
+	const vectori_t z = vector_to_vectori(vector_floor(vector_mul(s.z, inv_cell_size)));
+	const vectori_t hx = vectori_mul(x, vectori_uniform(73856093));
+	const vectori_t hy = vectori_mul(y, vectori_uniform(19349663));
+	const vectori_t hz = vectori_mul(z, vectori_uniform(83492791));
+	return vectori_xor(vectori_xor(hx, hy), hz);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_hash_cells_array(uint32_t* FOUNDATION_RESTRICT out, const vector_t* FOUNDATION_RESTRICT in, size_t count,
+                        real cell_size) {
+	const vector_t inv_cell_size = vector_uniform(REAL_C(1.0) / cell_size);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const vectori_t key = vector_soa_hash_cells(vector_soa_load(in + i), inv_cell_size);
+		memcpy(out + i, &key, sizeof(key));
+	}
+	if (i < count) {
+		vector_t tail[4];
+		for (size_t j = 0; j < 4; ++j)
+			tail[j] = (i + j < count) ? in[i + j] : vector_zero();
+		const vectori_t key = vector_soa_hash_cells(vector_soa_load(tail), inv_cell_size);
+		memcpy(out + i, &key, sizeof(uint32_t) * (count - i));
+	}
+}
+
+#undef VECTOR_HAVE_SOA_LOAD
+#undef VECTOR_HAVE_SOA_STORE
+#undef VECTOR_HAVE_SOA_LOAD_ARRAY
+#undef VECTOR_HAVE_SOA_STORE_ARRAY
+#undef VECTOR_HAVE_SOA_SELECT
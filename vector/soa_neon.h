@@ -0,0 +1,71 @@
+/* soa_neon.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_transpose(const vector_t v0, const vector_t v1, const vector_t v2, const vector_t v3) {
+	// t01 = [x0 x1 z0 z1] [y0 y1 w0 w1], t23 = [x2 x3 z2 z3] [y2 y3 w2 w3]
+	const float32x4x2_t t01 = vtrnq_f32(v0, v1);
+	const float32x4x2_t t23 = vtrnq_f32(v2, v3);
+	vector_soa_t s;
+	s.x = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+	s.y = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+	s.z = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+	s.w = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	return s;
+}
+
+#ifndef VECTOR_HAVE_SOA_LOAD
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_soa_t
+vector_soa_load(const vector_t* FOUNDATION_RESTRICT v) {
+	return vector_soa_transpose(v[0], v[1], v[2], v[3]);
+}
+#define VECTOR_HAVE_SOA_LOAD 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_STORE
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_store(vector_t* FOUNDATION_RESTRICT v, const vector_soa_t s) {
+	const vector_soa_t t = vector_soa_transpose(s.x, s.y, s.z, s.w);
+	v[0] = t.x;
+	v[1] = t.y;
+	v[2] = t.z;
+	v[3] = t.w;
+}
+#define VECTOR_HAVE_SOA_STORE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_select(const vectori_t mask, const vector_soa_t s0, const vector_soa_t s1) {
+	const uint32x4_t m = vreinterpretq_u32_s32(mask);
+	vector_soa_t r;
+	r.x = vbslq_f32(m, s0.x, s1.x);
+	r.y = vbslq_f32(m, s0.y, s1.y);
+	r.z = vbslq_f32(m, s0.z, s1.z);
+	r.w = vbslq_f32(m, s0.w, s1.w);
+	return r;
+}
+#define VECTOR_HAVE_SOA_SELECT 1
+
+#endif
+
+#include <vector/soa_base.h>
@@ -0,0 +1,68 @@
+/* soa_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_SOA_LOAD
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_soa_t
+vector_soa_load(const vector_t* FOUNDATION_RESTRICT v) {
+	vector_soa_t s;
+	s.x = v[0];
+	s.y = v[1];
+	s.z = v[2];
+	s.w = v[3];
+	_MM_TRANSPOSE4_PS(s.x, s.y, s.z, s.w);
+	return s;
+}
+#define VECTOR_HAVE_SOA_LOAD 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_STORE
+
+static FOUNDATION_FORCEINLINE void
+vector_soa_store(vector_t* FOUNDATION_RESTRICT v, const vector_soa_t s) {
+	vector_t r0 = s.x;
+	vector_t r1 = s.y;
+	vector_t r2 = s.z;
+	vector_t r3 = s.w;
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	v[0] = r0;
+	v[1] = r1;
+	v[2] = r2;
+	v[3] = r3;
+}
+#define VECTOR_HAVE_SOA_STORE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SOA_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_select(const vectori_t mask, const vector_soa_t s0, const vector_soa_t s1) {
+	const vector_t m = _mm_castsi128_ps(mask);
+	vector_soa_t r;
+	r.x = _mm_or_ps(_mm_and_ps(m, s0.x), _mm_andnot_ps(m, s1.x));
+	r.y = _mm_or_ps(_mm_and_ps(m, s0.y), _mm_andnot_ps(m, s1.y));
+	r.z = _mm_or_ps(_mm_and_ps(m, s0.z), _mm_andnot_ps(m, s1.z));
+	r.w = _mm_or_ps(_mm_and_ps(m, s0.w), _mm_andnot_ps(m, s1.w));
+	return r;
+}
+#define VECTOR_HAVE_SOA_SELECT 1
+
+#endif
+
+#include <vector/soa_base.h>
@@ -0,0 +1,34 @@
+/* soa_sse4.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_SOA_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+vector_soa_select(const vectori_t mask, const vector_soa_t s0, const vector_soa_t s1) {
+	const vector_t m = _mm_castsi128_ps(mask);
+	vector_soa_t r;
+	r.x = _mm_blendv_ps(s1.x, s0.x, m);
+	r.y = _mm_blendv_ps(s1.y, s0.y, m);
+	r.z = _mm_blendv_ps(s1.z, s0.z, m);
+	r.w = _mm_blendv_ps(s1.w, s0.w, m);
+	return r;
+}
+#define VECTOR_HAVE_SOA_SELECT 1
+
+#endif
+
+#include <vector/soa_sse3.h>
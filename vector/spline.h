@@ -0,0 +1,87 @@
+/* spline.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file spline.h
+    Cubic spline evaluation for keyframe animation. Segment functions evaluate one cubic segment
+    at a parameter in [0, 1], as a weighted sum of four points computed with vector_muladd. Splines
+    (spline_t) reference sorted key tables and are evaluated at a time, clamped to the first and
+    last key. The segment containing the time is found from a cursor cached between evaluations,
+    which is the segment of the previous evaluation or the next one for playback moving forward,
+    and by a branchless binary search over the key times otherwise. Batch functions evaluate many
+    splines, each at its own time, four at a time in structure-of-arrays layout */
+
+#include <vector/types.h>
+#include <vector/vector.h>
+#include <vector/quaternion.h>
+#include <vector/soa.h>
+
+//! Cubic Hermite segment from p0 with tangent m0 to p1 with tangent m1, tangents given as the
+//! derivative over the parameter t
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_hermite(const vector_t p0, const vector_t m0, const vector_t p1, const vector_t m1, real t);
+
+//! Cubic Bezier segment from p0 to p1 with control points c0 and c1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_bezier(const vector_t p0, const vector_t c0, const vector_t c1, const vector_t p1, real t);
+
+//! Uniform Catmull-Rom segment from p1 to p2, with p0 and p3 the previous and next points
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_catmull_rom(const vector_t p0, const vector_t p1, const vector_t p2, const vector_t p3, real t);
+
+//! Spherical quadrangle interpolation from unit quaternion q0 to q1 with inner quadrangle points
+//! s0 and s1, see quaternion_squad_control. Interpolates along the shortest arcs
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_squad(const quaternion_t q0, const quaternion_t s0, const quaternion_t s1, const quaternion_t q1,
+                 real t);
+
+//! Inner quadrangle point of unit quaternion q with the previous and next keys, giving a squad
+//! curve with continuous angular velocity through q. Keys in the opposite hemisphere of q are
+//! negated first
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_squad_control(const quaternion_t prev, const quaternion_t q, const quaternion_t next);
+
+//! Inner quadrangle points of count keys for a SPLINE_SQUAD spline, the first and last key use
+//! themselves as the missing neighbour
+static FOUNDATION_FORCEINLINE void
+spline_squad_controls(quaternion_t* out, const quaternion_t* key, size_t count);
+
+//! Index of the segment from key i to i + 1 containing time t, in [0, count - 2] (0 if there are
+//! fewer than three keys). Times before the first key give segment 0 and times after the last key
+//! give the last segment. The cursor is the segment from a previous search, which is checked
+//! together with the segment after it before searching
+static FOUNDATION_FORCEINLINE size_t
+spline_find_segment(const real* time, size_t count, real t, size_t cursor);
+
+//! Evaluate spline at time t, clamped to the time range of the keys. Cursor holds the segment of
+//! the previous evaluation and is updated, zero initialize it before the first evaluation or pass
+//! null to always search
+static FOUNDATION_FORCEINLINE vector_t
+spline_evaluate(const spline_t* spline, real t, uint32_t* cursor);
+
+//! Evaluate count splines, out[i] = spline_evaluate(spline + i, time[i], cursor + i), four at a time
+//! in structure-of-arrays layout. Cursor can be null. The squad interpolation uses
+//! quaternion_slerp_soa, with max error about 1e-6 in each weight
+static FOUNDATION_FORCEINLINE void
+spline_evaluate_array(vector_t* out, const spline_t* spline, const real* time, uint32_t* cursor, size_t count);
+
+//! Evaluate splines using the implementation selected at module initialization, see
+//! spline_evaluate_array
+VECTOR_API void
+spline_batch_evaluate(vector_t* out, const spline_t* spline, const real* time, uint32_t* cursor, size_t count);
+
+#include <vector/spline_base.h>
@@ -0,0 +1,308 @@
+/* spline_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+// Weights of the four segment points at parameter t
+static FOUNDATION_FORCEINLINE void
+spline_weights(real* w, spline_type_t type, real t) {
+	const real t2 = t * t;
+	const real t3 = t2 * t;
+	if (type == SPLINE_HERMITE) {
+		w[0] = REAL_C(2.0) * t3 - REAL_C(3.0) * t2 + REAL_C(1.0);
+		w[1] = t3 - REAL_C(2.0) * t2 + t;
+		w[2] = REAL_C(1.0) - w[0];
+		w[3] = t3 - t2;
+	} else if (type == SPLINE_BEZIER) {
+		const real s = REAL_C(1.0) - t;
+		w[0] = s * s * s;
+		w[1] = REAL_C(3.0) * t * s * s;
+		w[2] = REAL_C(3.0) * t2 * s;
+		w[3] = t3;
+	} else if (type == SPLINE_CATMULL_ROM) {
+		w[0] = REAL_C(0.5) * (-t3 + REAL_C(2.0) * t2 - t);
+		w[1] = REAL_C(0.5) * (REAL_C(3.0) * t3 - REAL_C(5.0) * t2 + REAL_C(2.0));
+		w[2] = REAL_C(0.5) * (REAL_C(-3.0) * t3 + REAL_C(4.0) * t2 + t);
+		w[3] = REAL_C(0.5) * (t3 - t2);
+	} else {
+		w[0] = w[1] = w[2] = w[3] = 0;
+	}
+}
+
+// Weights of the four segment points for the parameters in the lanes of t, same as spline_weights
+static FOUNDATION_FORCEINLINE void
+spline_weights_soa(vector_t* w, spline_type_t type, const vector_t t) {
+	const vector_t one = vector_one();
+	const vector_t t2 = vector_mul(t, t);
+	if (type == SPLINE_HERMITE) {
+		// (2t - 3)t^2 + 1, ((t - 2)t + 1)t, 1 - w0, (t - 1)t^2
+		w[0] = vector_muladd(vector_muladd(t, vector_two(), vector_uniform(REAL_C(-3.0))), t2, one);
+		w[1] = vector_mul(vector_muladd(vector_sub(t, vector_two()), t, one), t);
+		w[2] = vector_sub(one, w[0]);
+		w[3] = vector_mul(vector_sub(t, one), t2);
+	} else if (type == SPLINE_BEZIER) {
+		const vector_t s = vector_sub(one, t);
+		const vector_t three_ts = vector_mul(vector_uniform(REAL_C(3.0)), vector_mul(t, s));
+		w[0] = vector_mul(vector_mul(s, s), s);
+		w[1] = vector_mul(three_ts, s);
+		w[2] = vector_mul(three_ts, t);
+		w[3] = vector_mul(t2, t);
+	} else if (type == SPLINE_CATMULL_ROM) {
+		// ((-t/2 + 1)t - 1/2)t, (3t/2 - 5/2)t^2 + 1, ((-3t/2 + 2)t + 1/2)t, (t/2 - 1/2)t^2
+		const vector_t half = vector_half();
+		const vector_t three_half = vector_uniform(REAL_C(1.5));
+		w[0] = vector_mul(vector_muladd(vector_sub(one, vector_mul(t, half)), t, vector_neg(half)), t);
+		w[1] = vector_muladd(vector_sub(vector_mul(t, three_half), vector_uniform(REAL_C(2.5))), t2, one);
+		w[2] = vector_mul(vector_muladd(vector_sub(vector_two(), vector_mul(t, three_half)), t, half), t);
+		w[3] = vector_mul(vector_mul(vector_sub(t, one), half), t2);
+	} else {
+		w[0] = w[1] = w[2] = w[3] = vector_zero();
+	}
+}
+
+// Weighted sum of the four segment points
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+spline_combine(const vector_t p0, const vector_t p1, const vector_t p2, const vector_t p3, const real* w) {
+	const vector_t sum = vector_muladd(p1, vector_uniform(w[1]), vector_mul(p0, vector_uniform(w[0])));
+	return vector_muladd(p3, vector_uniform(w[3]), vector_muladd(p2, vector_uniform(w[2]), sum));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_hermite(const vector_t p0, const vector_t m0, const vector_t p1, const vector_t m1, real t) {
+	real w[4];
+	spline_weights(w, SPLINE_HERMITE, t);
+	return spline_combine(p0, m0, p1, m1, w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_bezier(const vector_t p0, const vector_t c0, const vector_t c1, const vector_t p1, real t) {
+	real w[4];
+	spline_weights(w, SPLINE_BEZIER, t);
+	return spline_combine(p0, c0, c1, p1, w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_catmull_rom(const vector_t p0, const vector_t p1, const vector_t p2, const vector_t p3, real t) {
+	real w[4];
+	spline_weights(w, SPLINE_CATMULL_ROM, t);
+	return spline_combine(p0, p1, p2, p3, w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_squad(const quaternion_t q0, const quaternion_t s0, const quaternion_t s1, const quaternion_t q1,
+                 real t) {
+	return quaternion_slerp(quaternion_slerp(q0, q1, t), quaternion_slerp(s0, s1, t),
+	                        REAL_C(2.0) * t * (REAL_C(1.0) - t));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL quaternion_t
+quaternion_squad_control(const quaternion_t prev, const quaternion_t q, const quaternion_t next) {
+	const quaternion_t qprev = (vector_x(vector_dot(prev, q)) < 0) ? quaternion_neg(prev) : prev;
+	const quaternion_t qnext = (vector_x(vector_dot(next, q)) < 0) ? quaternion_neg(next) : next;
+	// q exp(-(log(q^-1 next) + log(q^-1 prev)) / 4), quaternion_mul(q0, q1) applies q0 first
+	const quaternion_t qinv = quaternion_conjugate(q);
+	const quaternion_t sum = vector_add(quaternion_log(quaternion_mul(qnext, qinv)),
+	                                    quaternion_log(quaternion_mul(qprev, qinv)));
+	return quaternion_mul(quaternion_exp(vector_scale(sum, REAL_C(-0.25))), q);
+}
+
+static FOUNDATION_FORCEINLINE void
+spline_squad_controls(quaternion_t* out, const quaternion_t* key, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		const quaternion_t prev = key[i ? i - 1 : 0];
+		const quaternion_t next = key[(i + 1 < count) ? i + 1 : i];
+		out[i] = quaternion_squad_control(prev, key[i], next);
+	}
+}
+
+static FOUNDATION_FORCEINLINE size_t
+spline_find_segment(const real* time, size_t count, real t, size_t cursor) {
+	if (count < 3)
+		return 0;
+	const size_t last = count - 2;
+	// Playback is mostly in the cached segment or just moved into the next one
+	if ((cursor <= last) && (t >= time[cursor])) {
+		if ((cursor == last) || (t < time[cursor + 1]))
+			return cursor;
+		if ((cursor + 1 == last) || (t < time[cursor + 2]))
+			return cursor + 1;
+	}
+	// Last segment starting at or before t, with a conditional move instead of a branch per step
+	size_t base = 0;
+	size_t remain = last + 1;
+	while (remain > 1) {
+		const size_t half = remain / 2;
+		base = (time[base + half] <= t) ? base + half : base;
+		remain -= half;
+	}
+	return base;
+}
+
+// Segment of spline containing time t with the clamped parameter and duration of the segment,
+// updating the cursor if not null
+static FOUNDATION_FORCEINLINE size_t
+spline_locate(const spline_t* spline, real t, uint32_t* cursor, real* u, real* duration) {
+	const size_t segment = spline_find_segment(spline->time, spline->count, t, cursor ? *cursor : 0);
+	if (cursor)
+		*cursor = (uint32_t)segment;
+	const size_t next = (segment + 1 < spline->count) ? segment + 1 : segment;
+	const real start = spline->time[segment];
+	const real dt = spline->time[next] - start;
+	real param = (dt > 0) ? (t - start) / dt : 0;
+	param = (param < 0) ? 0 : ((param > REAL_C(1.0)) ? REAL_C(1.0) : param);
+	*u = param;
+	*duration = dt;
+	return segment;
+}
+
+// The four points of a segment in the order of the weights, squad segments give q0, s0, s1, q1
+static FOUNDATION_FORCEINLINE void
+spline_points(const spline_t* spline, size_t segment, vector_t* p) {
+	const size_t count = spline->count;
+	const size_t next = (segment + 1 < count) ? segment + 1 : segment;
+	const vector_t* value = spline->value;
+	const vector_t* control = spline->control;
+	if (spline->type == SPLINE_HERMITE) {
+		p[0] = value[segment];
+		p[1] = control[segment];
+		p[2] = value[next];
+		p[3] = control[next];
+	} else if (spline->type == SPLINE_BEZIER) {
+		p[0] = value[segment];
+		p[1] = control[(segment * 2) + 1];
+		p[2] = control[next * 2];
+		p[3] = value[next];
+	} else if (spline->type == SPLINE_CATMULL_ROM) {
+		p[0] = value[segment ? segment - 1 : 0];
+		p[1] = value[segment];
+		p[2] = value[next];
+		p[3] = value[(next + 1 < count) ? next + 1 : next];
+	} else {
+		p[0] = value[segment];
+		p[1] = control[segment];
+		p[2] = control[next];
+		p[3] = value[next];
+	}
+}
+
+static FOUNDATION_FORCEINLINE vector_t
+spline_evaluate(const spline_t* spline, real t, uint32_t* cursor) {
+	real u, duration;
+	vector_t p[4];
+	const size_t segment = spline_locate(spline, t, cursor, &u, &duration);
+	spline_points(spline, segment, p);
+	if (spline->type == SPLINE_SQUAD)
+		return quaternion_squad(p[0], p[1], p[2], p[3], u);
+	real w[4];
+	spline_weights(w, spline->type, u);
+	if (spline->type == SPLINE_HERMITE) {
+		// Tangents are over time, the segment parameter spans the segment duration
+		w[1] *= duration;
+		w[3] *= duration;
+	}
+	return spline_combine(p[0], p[1], p[2], p[3], w);
+}
+
+// Squad of four quaternion segments in structure-of-arrays layout, see quaternion_squad
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_soa_t
+spline_squad_soa(const vector_soa_t q0, const vector_soa_t s0, const vector_soa_t s1, const vector_soa_t q1,
+                 const vector_t t) {
+	const vector_t factor = vector_mul(vector_mul(vector_two(), t), vector_sub(vector_one(), t));
+	return quaternion_slerp_soa(quaternion_slerp_soa(q0, q1, t), quaternion_slerp_soa(s0, s1, t), factor);
+}
+
+static FOUNDATION_FORCEINLINE void
+spline_evaluate_array(vector_t* out, const spline_t* spline, const real* time, uint32_t* cursor, size_t count) {
+	vector_t point[4][4];
+	vector_t result[4];
+	for (size_t i = 0; i < count; i += 4) {
+		// Block of four splines with the segment points by point then lane as loaded by
+		// vector_soa_load, the remaining lanes of the last block repeat the first spline
+		float32_t param[4];
+		float32_t duration[4];
+		spline_type_t type[4];
+		bool uniform = true;
+		bool squad = false;
+		bool cubic = false;
+		for (size_t j = 0; j < 4; ++j) {
+			const size_t index = (i + j < count) ? i + j : i;
+			const spline_t* track = spline + index;
+			vector_t p[4];
+			real u, dt;
+			const size_t segment = spline_locate(track, time[index], cursor ? cursor + index : 0, &u, &dt);
+			spline_points(track, segment, p);
+			point[0][j] = p[0];
+			point[1][j] = p[1];
+			point[2][j] = p[2];
+			point[3][j] = p[3];
+			param[j] = (float32_t)u;
+			duration[j] = (track->type == SPLINE_HERMITE) ? (float32_t)dt : 1.0f;
+			type[j] = track->type;
+			uniform = uniform && (type[j] == type[0]);
+			squad = squad || (type[j] == SPLINE_SQUAD);
+			cubic = cubic || (type[j] != SPLINE_SQUAD);
+		}
+
+		const vector_t u = vector_unaligned(param);
+		const vector_soa_t p0 = vector_soa_load(point[0]);
+		const vector_soa_t p1 = vector_soa_load(point[1]);
+		const vector_soa_t p2 = vector_soa_load(point[2]);
+		const vector_soa_t p3 = vector_soa_load(point[3]);
+
+		if (!cubic) {
+			vector_soa_store(result, spline_squad_soa(p0, p1, p2, p3, u));
+		} else {
+			vector_t w[4];
+			if (uniform) {
+				spline_weights_soa(w, type[0], u);
+			} else {
+				// Mixed interpolation types in the block, weights by lane
+				float32_t lane_weight[4][4];
+				for (size_t j = 0; j < 4; ++j) {
+					real wj[4];
+					spline_weights(wj, type[j], param[j]);
+					lane_weight[0][j] = (float32_t)wj[0];
+					lane_weight[1][j] = (float32_t)wj[1];
+					lane_weight[2][j] = (float32_t)wj[2];
+					lane_weight[3][j] = (float32_t)wj[3];
+				}
+				w[0] = vector_unaligned(lane_weight[0]);
+				w[1] = vector_unaligned(lane_weight[1]);
+				w[2] = vector_unaligned(lane_weight[2]);
+				w[3] = vector_unaligned(lane_weight[3]);
+			}
+			// Hermite tangents are over time, duration is one in the other lanes
+			const vector_t dt = vector_unaligned(duration);
+			w[1] = vector_mul(w[1], dt);
+			w[3] = vector_mul(w[3], dt);
+			vector_soa_t sum = vector_soa_scale(p0, w[0]);
+			sum = vector_soa_muladd(p1, vector_soa(w[1], w[1], w[1], w[1]), sum);
+			sum = vector_soa_muladd(p2, vector_soa(w[2], w[2], w[2], w[2]), sum);
+			sum = vector_soa_muladd(p3, vector_soa(w[3], w[3], w[3], w[3]), sum);
+			vector_soa_store(result, sum);
+			if (squad) {
+				vector_t squad_result[4];
+				vector_soa_store(squad_result, spline_squad_soa(p0, p1, p2, p3, u));
+				for (size_t j = 0; j < 4; ++j) {
+					if (type[j] == SPLINE_SQUAD)
+						result[j] = squad_result[j];
+				}
+			}
+		}
+
+		for (size_t j = 0; (j < 4) && (i + j < count); ++j)
+			out[i + j] = result[j];
+	}
+}
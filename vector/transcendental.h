@@ -0,0 +1,100 @@
+/* transcendental.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file transcendental.h
+    Trigonometric, exponential and logarithm functions evaluated on all four components with
+    polynomial approximations. The fast variants use lower degree polynomials with a max error
+    of about 1e-4 relative to the result range. */
+
+#include <vector/types.h>
+#include <vector/vector.h>
+
+//! Sine of each component. Max absolute error about 5e-7 for |v| up to 100, the range reduction
+//! keeps the error small for larger arguments but precision degrades with magnitude
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_sin(const vector_t v);
+
+//! Cosine of each component, see vector_sin
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_cos(const vector_t v);
+
+//! Sine and cosine of each component, see vector_sin
+static FOUNDATION_FORCEINLINE void
+vector_sincos(const vector_t v, vector_t* sinval, vector_t* cosval);
+
+//! Arc cosine of each component in [-1, 1], result in [0, pi]. Max absolute error about 4e-7
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_acos(const vector_t v);
+
+//! Arc tangent of y / x for each component pair using the signs to select quadrant, result in
+//! [-pi, pi]. Max absolute error about 3e-7, atan2(0, 0) is 0 and the sign of a zero y is not
+//! considered (atan2(-0, -1) is pi)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_atan2(const vector_t y, const vector_t x);
+
+//! Natural exponent of each component. Max relative error about 2e-7, input is clamped to
+//! [-87.3365, 88.0] to keep the result finite. The result at the lower clamp is just below the
+//! smallest normalized float, a denormal or zero if denormals are flushed
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_exp(const vector_t v);
+
+//! Natural logarithm of each component. Max absolute error about 5e-8 for results in [-1, 1] and
+//! about half an ulp of the result outside it (4e-6 near the top of the float range), input must
+//! be a positive normalized value, zero, negative or denormal input gives undefined result
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_log(const vector_t v);
+
+//! Sine with max absolute error about 7e-5, see vector_sin
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_sin_fast(const vector_t v);
+
+//! Cosine with max absolute error about 7e-5, see vector_sin
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_cos_fast(const vector_t v);
+
+//! Sine and cosine with max absolute error about 7e-5, see vector_sin
+static FOUNDATION_FORCEINLINE void
+vector_sincos_fast(const vector_t v, vector_t* sinval, vector_t* cosval);
+
+//! Arc cosine with max absolute error about 7e-5, see vector_acos
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_acos_fast(const vector_t v);
+
+//! Arc tangent with max absolute error about 2e-6, see vector_atan2
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_atan2_fast(const vector_t y, const vector_t x);
+
+//! Natural exponent with max relative error about 8e-5, see vector_exp for the input clamp and the
+//! denormal result at the lower end
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_exp_fast(const vector_t v);
+
+//! Natural logarithm with max absolute error about 8e-5, see vector_log
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_log_fast(const vector_t v);
+
+#if VECTOR_IMPLEMENTATION_SSE4
+#include <vector/transcendental_sse4.h>
+#elif VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+#include <vector/transcendental_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON
+#include <vector/transcendental_neon.h>
+#else
+#include <vector/transcendental_fallback.h>
+#endif
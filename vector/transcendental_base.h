@@ -0,0 +1,449 @@
+/* transcendental_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SELECT
+
+//! Select component from v0 where mask is set, otherwise from v1
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	return vector(vectori_x(mask) ? vector_x(v0) : vector_x(v1), vectori_y(mask) ? vector_y(v0) : vector_y(v1),
+	              vectori_z(mask) ? vector_z(v0) : vector_z(v1), vectori_w(mask) ? vector_w(v0) : vector_w(v1));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SELECT 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_BARRIER
+
+//! Value of v opaque to the optimizer, used between the parts of the multi part constant range
+//! reductions which fast math flags (reassociation) would otherwise merge into one product
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_barrier(vector_t v) {
+#if FOUNDATION_COMPILER_GCC || FOUNDATION_COMPILER_CLANG
+	__asm__("" : "+m"(v));
+#endif
+	return v;
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_BARRIER 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_ROUND
+
+//! Round to nearest integral value (ties to even), valid for |v| < 2^22. The barrier keeps fast
+//! math flags from folding the magic constant add and subtract back into v
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_round(const vector_t v) {
+	const vector_t magic = vector_uniform(12582912.0f);
+	return vector_sub(vector_transcendental_barrier(vector_add(v, magic)), magic);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_ROUND 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_EXP2I
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float32_t
+vector_transcendental_exp2i_component(real n) {
+	union {
+		int32_t i;
+		float32_t f;
+	} bits;
+	bits.i = ((int32_t)n + 127) << 23;
+	return bits.f;
+}
+
+//! Two raised to integral valued components in [-126, 127]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_exp2i(const vector_t n) {
+	return vector(vector_transcendental_exp2i_component(vector_x(n)),
+	              vector_transcendental_exp2i_component(vector_y(n)),
+	              vector_transcendental_exp2i_component(vector_z(n)),
+	              vector_transcendental_exp2i_component(vector_w(n)));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_EXP2I 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_FREXP
+
+static FOUNDATION_FORCEINLINE float32_t
+vector_transcendental_frexp_component(real v, float32_t* exponent) {
+	union {
+		int32_t i;
+		float32_t f;
+	} bits;
+	bits.f = v;
+	*exponent = (float32_t)(((bits.i >> 23) & 0xFF) - 126);
+	bits.i = (bits.i & 0x007FFFFF) | 0x3F000000;
+	return bits.f;
+}
+
+//! Split positive normalized components into mantissa in [0.5, 1) and integral exponent
+static FOUNDATION_FORCEINLINE vector_t
+vector_transcendental_frexp(const vector_t v, vector_t* exponent) {
+	float32_t e[4];
+	const vector_t m = vector(vector_transcendental_frexp_component(vector_x(v), e),
+	                          vector_transcendental_frexp_component(vector_y(v), e + 1),
+	                          vector_transcendental_frexp_component(vector_z(v), e + 2),
+	                          vector_transcendental_frexp_component(vector_w(v), e + 3));
+	*exponent = vector(e[0], e[1], e[2], e[3]);
+	return m;
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_FREXP 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SIN_REDUCE
+
+//! Reduce angle offset by a number of quarter turns (0 for sine, 1 for cosine) to [-pi/2, pi/2]
+//! with equal sine, by range reduction over 2*pi followed by reflection around +-pi/2
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_sin_reduce(const vector_t v, const vector_t quarter) {
+	const vector_t offset = vector_mul(quarter, vector_uniform(0.25f));
+	const vector_t turns = vector_muladd(v, vector_uniform(0.15915494309189535f), offset);
+	const vector_t k = vector_transcendental_round(turns);
+	// Two part constant for 2*pi to keep precision in the reduction
+	vector_t x = vector_transcendental_barrier(vector_sub(v, vector_mul(k, vector_uniform(6.28125f))));
+	x = vector_transcendental_barrier(vector_sub(x, vector_mul(k, vector_uniform(1.9353071795864769e-3f))));
+	x = vector_muladd(quarter, vector_uniform(1.57079632679489662f), x);
+	const vector_t pi = vector_uniform(3.14159265358979323846f);
+	return vector_max(vector_min(x, vector_sub(pi, x)), vector_sub(vector_neg(pi), x));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SIN_REDUCE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SIN_POLY
+
+//! Sine of reduced angle in [-pi/2, pi/2] by odd polynomial of degree 11
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_sin_poly(const vector_t x) {
+	const vector_t x2 = vector_mul(x, x);
+	vector_t p = vector_muladd(x2, vector_uniform(-2.3889859e-8f), vector_uniform(2.7525562e-6f));
+	p = vector_muladd(x2, p, vector_uniform(-1.9840874e-4f));
+	p = vector_muladd(x2, p, vector_uniform(8.3333310e-3f));
+	p = vector_muladd(x2, p, vector_uniform(-1.6666667e-1f));
+	return vector_muladd(vector_mul(x, x2), p, x);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SIN_POLY 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SIN_POLY_FAST
+
+//! Sine of reduced angle in [-pi/2, pi/2] by odd polynomial of degree 5
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_sin_poly_fast(const vector_t x) {
+	const vector_t x2 = vector_mul(x, x);
+	vector_t p = vector_muladd(x2, vector_uniform(7.5143772e-3f), vector_uniform(-1.6567308e-1f));
+	p = vector_muladd(x2, p, vector_uniform(9.9969677e-1f));
+	return vector_mul(x, p);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SIN_POLY_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SIN
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_sin(const vector_t v) {
+	return vector_transcendental_sin_poly(vector_transcendental_sin_reduce(v, vector_zero()));
+}
+#define VECTOR_HAVE_SIN 1
+
+#endif
+
+#ifndef VECTOR_HAVE_COS
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_cos(const vector_t v) {
+	return vector_transcendental_sin_poly(vector_transcendental_sin_reduce(v, vector_one()));
+}
+#define VECTOR_HAVE_COS 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SINCOS
+
+static FOUNDATION_FORCEINLINE void
+vector_sincos(const vector_t v, vector_t* sinval, vector_t* cosval) {
+	*sinval = vector_sin(v);
+	*cosval = vector_cos(v);
+}
+#define VECTOR_HAVE_SINCOS 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SIN_FAST
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_sin_fast(const vector_t v) {
+	return vector_transcendental_sin_poly_fast(vector_transcendental_sin_reduce(v, vector_zero()));
+}
+#define VECTOR_HAVE_SIN_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_COS_FAST
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_cos_fast(const vector_t v) {
+	return vector_transcendental_sin_poly_fast(vector_transcendental_sin_reduce(v, vector_one()));
+}
+#define VECTOR_HAVE_COS_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_SINCOS_FAST
+
+static FOUNDATION_FORCEINLINE void
+vector_sincos_fast(const vector_t v, vector_t* sinval, vector_t* cosval) {
+	*sinval = vector_sin_fast(v);
+	*cosval = vector_cos_fast(v);
+}
+#define VECTOR_HAVE_SINCOS_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_ACOS
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_acos(const vector_t v) {
+	// Abramowitz and Stegun 4.4.46, acos(|x|) = sqrt(1 - |x|) * p(|x|) mirrored for negative x
+	const vector_t a = vector_abs(v);
+	vector_t p = vector_muladd(a, vector_uniform(-1.2624911e-3f), vector_uniform(6.6700901e-3f));
+	p = vector_muladd(a, p, vector_uniform(-1.70881256e-2f));
+	p = vector_muladd(a, p, vector_uniform(3.08918810e-2f));
+	p = vector_muladd(a, p, vector_uniform(-5.01743046e-2f));
+	p = vector_muladd(a, p, vector_uniform(8.89789874e-2f));
+	p = vector_muladd(a, p, vector_uniform(-2.145988016e-1f));
+	p = vector_muladd(a, p, vector_uniform(1.5707963050f));
+	const vector_t r = vector_mul(vector_sqrt(vector_sub(vector_one(), a)), p);
+	return vector_transcendental_select(vector_less(v, vector_zero()),
+	                                    vector_sub(vector_uniform(3.14159265358979323846f), r), r);
+}
+#define VECTOR_HAVE_ACOS 1
+
+#endif
+
+#ifndef VECTOR_HAVE_ACOS_FAST
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_acos_fast(const vector_t v) {
+	// Abramowitz and Stegun 4.4.45
+	const vector_t a = vector_abs(v);
+	vector_t p = vector_muladd(a, vector_uniform(-1.87293e-2f), vector_uniform(7.42610e-2f));
+	p = vector_muladd(a, p, vector_uniform(-2.121144e-1f));
+	p = vector_muladd(a, p, vector_uniform(1.5707288f));
+	const vector_t r = vector_mul(vector_sqrt(vector_sub(vector_one(), a)), p);
+	return vector_transcendental_select(vector_less(v, vector_zero()),
+	                                    vector_sub(vector_uniform(3.14159265358979323846f), r), r);
+}
+#define VECTOR_HAVE_ACOS_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_ATAN2_QUADRANT
+
+//! Map arc tangent of min(|x|,|y|) / max(|x|,|y|) in [0, pi/4] to the quadrant given by x and y
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_atan2_quadrant(const vector_t r, const vector_t y, const vector_t x) {
+	const vector_t pi = vector_uniform(3.14159265358979323846f);
+	const vector_t zero = vector_zero();
+	vector_t angle = vector_transcendental_select(vector_greater(vector_abs(y), vector_abs(x)),
+	                                              vector_sub(vector_mul(pi, vector_half()), r), r);
+	angle = vector_transcendental_select(vector_less(x, zero), vector_sub(pi, angle), angle);
+	return vector_transcendental_select(vector_less(y, zero), vector_neg(angle), angle);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_ATAN2_QUADRANT 1
+
+#endif
+
+#ifndef VECTOR_HAVE_ATAN2
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_atan2(const vector_t y, const vector_t x) {
+	const vector_t ax = vector_abs(x);
+	const vector_t ay = vector_abs(y);
+	const vector_t lo = vector_min(ax, ay);
+	const vector_t hi = vector_max(ax, ay);
+	// Ratios above tan(pi/8) use atan(t) = pi/4 + atan((t - 1) / (t + 1)), single division for both
+	const vectori_t upper = vector_greater(lo, vector_mul(hi, vector_uniform(0.414213562373095f)));
+	const vector_t num = vector_transcendental_select(upper, vector_sub(lo, hi), lo);
+	const vector_t den = vector_transcendental_select(upper, vector_add(lo, hi), hi);
+	const vector_t t = vector_div(num, vector_max(den, vector_uniform(1e-30f)));
+	const vector_t t2 = vector_mul(t, t);
+	vector_t p = vector_muladd(t2, vector_uniform(8.05374449538e-2f), vector_uniform(-1.38776856032e-1f));
+	p = vector_muladd(t2, p, vector_uniform(1.99777106478e-1f));
+	p = vector_muladd(t2, p, vector_uniform(-3.33329491539e-1f));
+	vector_t r = vector_muladd(vector_mul(t, t2), p, t);
+	r = vector_add(r, vector_transcendental_select(upper, vector_uniform(0.785398163397448f), vector_zero()));
+	return vector_transcendental_atan2_quadrant(r, y, x);
+}
+#define VECTOR_HAVE_ATAN2 1
+
+#endif
+
+#ifndef VECTOR_HAVE_ATAN2_FAST
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_atan2_fast(const vector_t y, const vector_t x) {
+	const vector_t ax = vector_abs(x);
+	const vector_t ay = vector_abs(y);
+	const vector_t hi = vector_max(ax, ay);
+	const vector_t t = vector_div(vector_min(ax, ay), vector_max(hi, vector_uniform(1e-30f)));
+	const vector_t t2 = vector_mul(t, t);
+	vector_t p = vector_muladd(t2, vector_uniform(-1.172120e-2f), vector_uniform(5.265332e-2f));
+	p = vector_muladd(t2, p, vector_uniform(-1.1643287e-1f));
+	p = vector_muladd(t2, p, vector_uniform(1.9354346e-1f));
+	p = vector_muladd(t2, p, vector_uniform(-3.3262347e-1f));
+	p = vector_muladd(t2, p, vector_uniform(9.9997726e-1f));
+	return vector_transcendental_atan2_quadrant(vector_mul(t, p), y, x);
+}
+#define VECTOR_HAVE_ATAN2_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_EXP_REDUCE
+
+//! Reduce exponent to exp(v) = exp(r) * 2^n with r in [-ln(2)/2, ln(2)/2]
+static FOUNDATION_FORCEINLINE vector_t
+vector_transcendental_exp_reduce(const vector_t v, vector_t* n) {
+	const vector_t x = vector_min(vector_max(v, vector_uniform(-87.3365447504f)), vector_uniform(88.0f));
+	*n = vector_transcendental_round(vector_mul(x, vector_uniform(1.44269504088896341f)));
+	// Two part constant for ln(2) to keep precision in the reduction
+	const vector_t r = vector_transcendental_barrier(vector_sub(x, vector_mul(*n, vector_uniform(0.693359375f))));
+	return vector_sub(r, vector_mul(*n, vector_uniform(-2.12194440e-4f)));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_EXP_REDUCE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_EXP
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_exp(const vector_t v) {
+	vector_t n;
+	const vector_t r = vector_transcendental_exp_reduce(v, &n);
+	vector_t p = vector_muladd(r, vector_uniform(1.9875691500e-4f), vector_uniform(1.3981999507e-3f));
+	p = vector_muladd(r, p, vector_uniform(8.3334519073e-3f));
+	p = vector_muladd(r, p, vector_uniform(4.1665795894e-2f));
+	p = vector_muladd(r, p, vector_uniform(1.6666665459e-1f));
+	p = vector_muladd(r, p, vector_uniform(5.0000001201e-1f));
+	p = vector_muladd(vector_mul(r, r), p, vector_add(r, vector_one()));
+	return vector_mul(p, vector_transcendental_exp2i(n));
+}
+#define VECTOR_HAVE_EXP 1
+
+#endif
+
+#ifndef VECTOR_HAVE_EXP_FAST
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_exp_fast(const vector_t v) {
+	vector_t n;
+	const vector_t r = vector_transcendental_exp_reduce(v, &n);
+	vector_t p = vector_muladd(r, vector_uniform(1.6566842e-1f), vector_uniform(5.0496326e-1f));
+	p = vector_muladd(r, p, vector_uniform(1.0001642f));
+	p = vector_muladd(r, p, vector_uniform(9.9992807e-1f));
+	return vector_mul(p, vector_transcendental_exp2i(n));
+}
+#define VECTOR_HAVE_EXP_FAST 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_LOG_REDUCE
+
+//! Reduce logarithm to log(v) = log(1 + x) + e * ln(2) with 1 + x in [sqrt(0.5), sqrt(2))
+static FOUNDATION_FORCEINLINE vector_t
+vector_transcendental_log_reduce(const vector_t v, vector_t* e) {
+	vector_t exponent;
+	const vector_t m = vector_transcendental_frexp(v, &exponent);
+	const vectori_t low = vector_less(m, vector_uniform(0.707106781186547524f));
+	*e = vector_transcendental_select(low, vector_sub(exponent, vector_one()), exponent);
+	return vector_transcendental_select(low, vector_sub(vector_add(m, m), vector_one()), vector_sub(m, vector_one()));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_LOG_REDUCE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOG
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_log(const vector_t v) {
+	vector_t e;
+	const vector_t x = vector_transcendental_log_reduce(v, &e);
+	const vector_t z = vector_mul(x, x);
+	vector_t p = vector_muladd(x, vector_uniform(7.0376836292e-2f), vector_uniform(-1.1514610310e-1f));
+	p = vector_muladd(x, p, vector_uniform(1.1676998740e-1f));
+	p = vector_muladd(x, p, vector_uniform(-1.2420140846e-1f));
+	p = vector_muladd(x, p, vector_uniform(1.4249322787e-1f));
+	p = vector_muladd(x, p, vector_uniform(-1.6668057665e-1f));
+	p = vector_muladd(x, p, vector_uniform(2.0000714765e-1f));
+	p = vector_muladd(x, p, vector_uniform(-2.4999993993e-1f));
+	p = vector_muladd(x, p, vector_uniform(3.3333331174e-1f));
+	// Two part constant for ln(2), small part folded in before the larger terms
+	vector_t y = vector_mul(vector_mul(x, z), p);
+	y = vector_muladd(e, vector_uniform(-2.12194440e-4f), y);
+	y = vector_muladd(z, vector_uniform(-0.5f), y);
+	return vector_muladd(e, vector_uniform(0.693359375f), vector_transcendental_barrier(vector_add(x, y)));
+}
+#define VECTOR_HAVE_LOG 1
+
+#endif
+
+#ifndef VECTOR_HAVE_LOG_FAST
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_log_fast(const vector_t v) {
+	vector_t e;
+	const vector_t x = vector_transcendental_log_reduce(v, &e);
+	vector_t p = vector_muladd(x, vector_uniform(-2.2848191e-1f), vector_uniform(3.5871017e-1f));
+	p = vector_muladd(x, p, vector_uniform(-5.0246528e-1f));
+	p = vector_muladd(x, p, vector_uniform(9.9935233e-1f));
+	return vector_muladd(e, vector_uniform(0.693147180559945f), vector_mul(x, p));
+}
+#define VECTOR_HAVE_LOG_FAST 1
+
+#endif
+
+#undef VECTOR_HAVE_TRANSCENDENTAL_SELECT
+#undef VECTOR_HAVE_TRANSCENDENTAL_BARRIER
+#undef VECTOR_HAVE_TRANSCENDENTAL_ROUND
+#undef VECTOR_HAVE_TRANSCENDENTAL_EXP2I
+#undef VECTOR_HAVE_TRANSCENDENTAL_FREXP
+#undef VECTOR_HAVE_TRANSCENDENTAL_SIN_REDUCE
+#undef VECTOR_HAVE_TRANSCENDENTAL_SIN_POLY
+#undef VECTOR_HAVE_TRANSCENDENTAL_SIN_POLY_FAST
+#undef VECTOR_HAVE_SIN
+#undef VECTOR_HAVE_COS
+#undef VECTOR_HAVE_SINCOS
+#undef VECTOR_HAVE_SIN_FAST
+#undef VECTOR_HAVE_COS_FAST
+#undef VECTOR_HAVE_SINCOS_FAST
+#undef VECTOR_HAVE_ACOS
+#undef VECTOR_HAVE_ACOS_FAST
+#undef VECTOR_HAVE_TRANSCENDENTAL_ATAN2_QUADRANT
+#undef VECTOR_HAVE_ATAN2
+#undef VECTOR_HAVE_ATAN2_FAST
+#undef VECTOR_HAVE_TRANSCENDENTAL_EXP_REDUCE
+#undef VECTOR_HAVE_EXP
+#undef VECTOR_HAVE_EXP_FAST
+#undef VECTOR_HAVE_TRANSCENDENTAL_LOG_REDUCE
+#undef VECTOR_HAVE_LOG
+#undef VECTOR_HAVE_LOG_FAST
@@ -0,0 +1,99 @@
+/* transcendental_neon.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	return vbslq_f32(vreinterpretq_u32_s32(mask), v0, v1);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SELECT 1
+
+#endif
+
+#if defined(__aarch64__)
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_ROUND
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_round(const vector_t v) {
+	return vrndnq_f32(v);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_ROUND 1
+
+#endif
+
+#else
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_ROUND
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_round(const vector_t v) {
+	// No round to nearest instruction before ARMv8, truncate v + copysign(0.5, v) instead
+	// (ties away from zero, which does not matter for the range reductions)
+	const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000));
+	const vector_t half = vreinterpretq_f32_u32(vorrq_u32(sign, vdupq_n_u32(0x3F000000)));
+	return vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(v, half)));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_ROUND 1
+
+#endif
+
+#endif
+
+#if FOUNDATION_COMPILER_GCC || FOUNDATION_COMPILER_CLANG
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_BARRIER
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_barrier(vector_t v) {
+	__asm__("" : "+w"(v));
+	return v;
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_BARRIER 1
+
+#endif
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_EXP2I
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_exp2i(const vector_t n) {
+	// Biased exponent shifted directly into the exponent bits
+	const int32x4_t biased = vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127));
+	return vreinterpretq_f32_s32(vshlq_n_s32(biased, 23));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_EXP2I 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_FREXP
+
+static FOUNDATION_FORCEINLINE vector_t
+vector_transcendental_frexp(const vector_t v, vector_t* exponent) {
+	const uint32x4_t bits = vreinterpretq_u32_f32(v);
+	const int32x4_t biased = vreinterpretq_s32_u32(vshrq_n_u32(bits, 23));
+	*exponent = vcvtq_f32_s32(vsubq_s32(biased, vdupq_n_s32(126)));
+	const uint32x4_t mantissa = vandq_u32(bits, vdupq_n_u32(0x007FFFFF));
+	return vreinterpretq_f32_u32(vorrq_u32(mantissa, vdupq_n_u32(0x3F000000)));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_FREXP 1
+
+#endif
+
+#include <vector/transcendental_base.h>
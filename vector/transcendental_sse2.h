@@ -0,0 +1,80 @@
+/* transcendental_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	const vector_t m = _mm_castsi128_ps(mask);
+	return _mm_or_ps(_mm_and_ps(m, v0), _mm_andnot_ps(m, v1));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SELECT 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_ROUND
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_round(const vector_t v) {
+	// Conversion uses the current rounding mode, which is round to nearest even by default
+	return _mm_cvtepi32_ps(_mm_cvtps_epi32(v));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_ROUND 1
+
+#endif
+
+#if FOUNDATION_COMPILER_GCC || FOUNDATION_COMPILER_CLANG
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_BARRIER
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_barrier(vector_t v) {
+	__asm__("" : "+x"(v));
+	return v;
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_BARRIER 1
+
+#endif
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_EXP2I
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_exp2i(const vector_t n) {
+	// Biased exponent shifted directly into the exponent bits
+	const __m128i biased = _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127));
+	return _mm_castsi128_ps(_mm_slli_epi32(biased, 23));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_EXP2I 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_FREXP
+
+static FOUNDATION_FORCEINLINE vector_t
+vector_transcendental_frexp(const vector_t v, vector_t* exponent) {
+	const __m128i bits = _mm_castps_si128(v);
+	*exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+	const __m128i mantissa = _mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF));
+	return _mm_castsi128_ps(_mm_or_si128(mantissa, _mm_set1_epi32(0x3F000000)));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_FREXP 1
+
+#endif
+
+#include <vector/transcendental_base.h>
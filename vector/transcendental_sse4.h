@@ -0,0 +1,38 @@
+/* transcendental_sse4.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_SELECT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	return _mm_blendv_ps(v1, v0, _mm_castsi128_ps(mask));
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_SELECT 1
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSCENDENTAL_ROUND
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transcendental_round(const vector_t v) {
+	return _mm_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+#define VECTOR_HAVE_TRANSCENDENTAL_ROUND 1
+
+#endif
+
+#include <vector/transcendental_sse2.h>
@@ -0,0 +1,89 @@
+/* transform.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#pragma once
+
+/*! \file transform.h
+    Rotation, translation and uniform scale transforms. The rotation is a unit quaternion and
+    the scale is stored in the w component of the translation vector. Transforms are applied as
+    scale, then rotation, then translation, matching a matrix from transform_to_matrix applied
+    with vector_transform. */
+
+#include <vector/types.h>
+#include <vector/mask.h>
+#include <vector/quaternion.h>
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_identity(void);
+
+//! Construct from rotation, translation and uniform scale
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform(const quaternion_t rotation, const vector_t translation, real scale);
+
+//! Concatenate transforms, resulting transform applies t0 followed by t1 (same order as matrix_mul)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_mul(const transform_t t0, const transform_t t1);
+
+//! Inverse transform, scale must be non-zero
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_inverse(const transform_t t);
+
+//! Transform point, treated as [x, y, z, 1] and returned as [x', y', z', 1]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_apply_point(const transform_t t, const vector_t point);
+
+//! Transform direction, scaled and rotated but not translated, treated as [x, y, z, 0] and
+//! returned as [x', y', z', 0]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_apply_vector(const transform_t t, const vector_t v);
+
+//! Interpolate transforms, translation and scale linearly and rotation by normalized linear
+//! interpolation along the shortest arc
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_lerp(const transform_t t0, const transform_t t1, real factor);
+
+//! Convert to matrix, vector_transform(v, transform_to_matrix(t)) equals transform_apply_point(t, v)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+transform_to_matrix(const transform_t t);
+
+//! Decompose matrix into transform, inverse of transform_to_matrix. Scale is the mean length of
+//! the three axis rows, negated if the matrix is a reflection, and the rotation is taken from the
+//! Gram-Schmidt orthonormalized rows. Any shear or non-uniform scale is discarded
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+matrix_decompose(const matrix_t m);
+
+//! Decompose an array of matrices, out[i] = matrix_decompose(in[i]), four at a time in
+//! structure-of-arrays layout
+static FOUNDATION_FORCEINLINE void
+matrix_decompose_array(transform_t* out, const matrix_t* in, size_t count);
+
+//! Decompose matrices using the implementation selected at module initialization, see
+//! matrix_decompose_array
+VECTOR_API void
+matrix_batch_decompose(transform_t* out, const matrix_t* in, size_t count);
+
+#if VECTOR_IMPLEMENTATION_SSE4
+#include <vector/transform_sse4.h>
+#elif VECTOR_IMPLEMENTATION_SSE3
+#include <vector/transform_sse3.h>
+#elif VECTOR_IMPLEMENTATION_SSE2
+#include <vector/transform_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON
+#include <vector/transform_neon.h>
+#else
+#include <vector/transform_fallback.h>
+#endif
@@ -0,0 +1,251 @@
+/* transform_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_TRANSFORM_SPLICE_W
+
+//! Combine x, y and z components of the first vector with the w component of the second
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_splice_w(const vector_t xyz, const vector_t w) {
+	return vector_set_component(xyz, 3, vector_w(w));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_ROTATE3
+
+//! Rotate x, y and z components of vector by unit quaternion, resulting w component is undefined.
+//! v' = v + q.w * t + q.xyz x t where t = 2 * (q.xyz x v)
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_rotate3(const quaternion_t q, const vector_t v) {
+	const vector_t t = vector_cross3(q, vector_add(v, v));
+	return vector_add(vector_muladd(vector_shuffle(q, VECTOR_MASK_WWWW), t, v), vector_cross3(q, t));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_IDENTITY
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_identity(void) {
+	transform_t t;
+	t.rotation = quaternion_identity();
+	t.translation = vector_origo();
+	return t;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform(const quaternion_t rotation, const vector_t translation, real scale) {
+	transform_t t;
+	t.rotation = rotation;
+	t.translation = transform_splice_w(translation, vector_uniform(scale));
+	return t;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_MUL
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_mul(const transform_t t0, const transform_t t1) {
+	// Translation of t0 is scaled, rotated and translated by t1, and the scales multiply
+	const vector_t scale = vector_shuffle(t1.translation, VECTOR_MASK_WWWW);
+	const vector_t scaled = vector_mul(t0.translation, scale);
+	transform_t t;
+	t.rotation = quaternion_mul(t0.rotation, t1.rotation);
+	t.translation =
+	    transform_splice_w(vector_add(transform_rotate3(t1.rotation, scaled), t1.translation), scaled);
+	return t;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_INVERSE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_inverse(const transform_t t) {
+	const vector_t scale_inv = vector_div(vector_one(), vector_shuffle(t.translation, VECTOR_MASK_WWWW));
+	transform_t r;
+	r.rotation = quaternion_conjugate(t.rotation);
+	r.translation = transform_splice_w(
+	    vector_neg(vector_mul(transform_rotate3(r.rotation, t.translation), scale_inv)), scale_inv);
+	return r;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_APPLY_POINT
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_apply_point(const transform_t t, const vector_t point) {
+	const vector_t scale = vector_shuffle(t.translation, VECTOR_MASK_WWWW);
+	const vector_t r = vector_muladd(transform_rotate3(t.rotation, point), scale, t.translation);
+	return transform_splice_w(r, vector_one());
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_APPLY_VECTOR
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_apply_vector(const transform_t t, const vector_t v) {
+	const vector_t scale = vector_shuffle(t.translation, VECTOR_MASK_WWWW);
+	return transform_splice_w(vector_mul(transform_rotate3(t.rotation, v), scale), vector_zero());
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_LERP
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+transform_lerp(const transform_t t0, const transform_t t1, real factor) {
+	transform_t t;
+	t.rotation = quaternion_nlerp(t0.rotation, t1.rotation, factor);
+	t.translation = vector_lerp(t0.translation, t1.translation, factor);
+	return t;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_TRANSFORM_TO_MATRIX
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+transform_to_matrix(const transform_t t) {
+	// Rotation rows from diagonal terms d and the sums p and differences m of the off-diagonal
+	// products, with doubled quaternion products
+	//   [ d0 p1 m0 ]
+	//   [ m1 d1 p2 ]
+	//   [ p0 m2 d2 ]
+	const quaternion_t q = t.rotation;
+	const vector_t q2 = vector_add(q, q);
+	const vector_t sqr = vector_mul(q, q2);
+	const vector_t d = vector_sub(vector_sub(vector_one(), vector_shuffle(sqr, VECTOR_MASK_YXXW)),
+	                              vector_shuffle(sqr, VECTOR_MASK_ZZYW));
+	const vector_t a = vector_mul(vector_shuffle(q, VECTOR_MASK_XXYW), vector_shuffle(q2, VECTOR_MASK_ZYZW));
+	const vector_t b = vector_mul(vector_shuffle(q, VECTOR_MASK_WWWW), vector_shuffle(q2, VECTOR_MASK_YZXW));
+	const vector_t p = vector_add(a, b);
+	const vector_t m = vector_sub(a, b);
+	const vector_t zero = vector_zero();
+	const vector_t scale = vector_shuffle(t.translation, VECTOR_MASK_WWWW);
+
+	const vector_t d0p1 = vector_shuffle2(d, p, VECTOR_MASK_XXYY);
+	const vector_t m0 = vector_shuffle2(m, zero, VECTOR_MASK_XXXX);
+	const vector_t m1d1 = vector_shuffle2(m, d, VECTOR_MASK_YYYY);
+	const vector_t p2 = vector_shuffle2(p, zero, VECTOR_MASK_ZZXX);
+	const vector_t p0m2 = vector_shuffle2(p, m, VECTOR_MASK_XXZZ);
+	const vector_t d2 = vector_shuffle2(d, zero, VECTOR_MASK_ZZXX);
+
+	matrix_t mat;
+	mat.row[0] = vector_shuffle2(d0p1, m0, VECTOR_MASK_XZXZ);
+	mat.row[1] = vector_shuffle2(m1d1, p2, VECTOR_MASK_XZXZ);
+	mat.row[2] = vector_shuffle2(p0m2, d2, VECTOR_MASK_XZXZ);
+	mat.row[0] = vector_mul(mat.row[0], scale);
+	mat.row[1] = vector_mul(mat.row[1], scale);
+	mat.row[2] = vector_mul(mat.row[2], scale);
+	mat.row[3] = transform_splice_w(t.translation, vector_one());
+	return mat;
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_DECOMPOSE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL transform_t
+matrix_decompose(const matrix_t m) {
+	const vector_t x = vector_normalize3(m.row[0]);
+	const vector_t y = vector_normalize3(vector_sub(m.row[1], vector_mul(x, vector_dot3(m.row[1], x))));
+	const vector_t length =
+	    vector_add_triple(vector_length3(m.row[0]), vector_length3(m.row[1]), vector_length3(m.row[2]));
+	const real det = vector_x(vector_dot3(vector_cross3(m.row[0], m.row[1]), m.row[2]));
+	const real sign = (det < 0) ? REAL_C(-1.0) : REAL_C(1.0);
+
+	// A reflection is a rotation with negative scale, flipping the first two axes keeps the
+	// third one (their cross product) and makes the basis right handed
+	matrix_t rotation;
+	rotation.row[0] = vector_scale(x, sign);
+	rotation.row[1] = vector_scale(y, sign);
+	rotation.row[2] = vector_cross3(x, y);
+	rotation.row[3] = vector_origo();
+	return transform(quaternion_from_matrix(rotation), m.row[3], (vector_x(length) * sign) / REAL_C(3.0));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_MATRIX_DECOMPOSE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+matrix_decompose_array(transform_t* out, const matrix_t* in, size_t count) {
+	const vector_t one = vector_one();
+	const vector_t third = vector_uniform(REAL_C(1.0) / REAL_C(3.0));
+	const vector_soa_t zero = vector_soa_splat(vector_zero());
+	vector_t block[4][4];
+	quaternion_t rotation[4];
+	vector_t translation[4];
+	for (size_t i = 0; i < count; i += 4) {
+		for (size_t j = 0; j < 4; ++j) {
+			const matrix_t* m = (i + j < count) ? in + i + j : in + i;
+			block[0][j] = m->row[0];
+			block[1][j] = m->row[1];
+			block[2][j] = m->row[2];
+			block[3][j] = m->row[3];
+		}
+		const vector_soa_t row0 = vector_soa_load(block[0]);
+		const vector_soa_t row1 = vector_soa_load(block[1]);
+		const vector_soa_t row2 = vector_soa_load(block[2]);
+		const vector_soa_t row3 = vector_soa_load(block[3]);
+
+		const vector_t length0 = vector_sqrt(vector_soa_dot3(row0, row0));
+		const vector_t length1 = vector_sqrt(vector_soa_dot3(row1, row1));
+		const vector_t length2 = vector_sqrt(vector_soa_dot3(row2, row2));
+		const vector_soa_t x = vector_soa_scale(row0, vector_div(one, length0));
+		const vector_soa_t proj = vector_soa_sub(row1, vector_soa_scale(x, vector_soa_dot3(row1, x)));
+		const vector_soa_t y = vector_soa_scale(proj, vector_div(one, vector_sqrt(vector_soa_dot3(proj, proj))));
+		const vector_soa_t z = vector_soa_cross3(x, y);
+		const vector_t scale = vector_mul(vector_add(vector_add(length0, length1), length2), third);
+		const vectori_t reflect =
+		    vector_less(vector_soa_dot3(vector_soa_cross3(row0, row1), row2), vector_zero());
+
+		const vector_soa_t xr = vector_soa_select(reflect, vector_soa_sub(zero, x), x);
+		const vector_soa_t yr = vector_soa_select(reflect, vector_soa_sub(zero, y), y);
+		const vector_soa_t t = vector_soa_select(reflect, vector_soa(row3.x, row3.y, row3.z, vector_neg(scale)),
+		                                         vector_soa(row3.x, row3.y, row3.z, scale));
+		vector_soa_store(rotation, quaternion_from_matrix_soa(xr, yr, z));
+		vector_soa_store(translation, t);
+		for (size_t j = 0; (j < 4) && (i + j < count); ++j) {
+			out[i + j].rotation = rotation[j];
+			out[i + j].translation = translation[j];
+		}
+	}
+}
+
+#endif
+
+#undef VECTOR_HAVE_TRANSFORM_SPLICE_W
+#undef VECTOR_HAVE_TRANSFORM_ROTATE3
+#undef VECTOR_HAVE_TRANSFORM_IDENTITY
+#undef VECTOR_HAVE_TRANSFORM
+#undef VECTOR_HAVE_TRANSFORM_MUL
+#undef VECTOR_HAVE_TRANSFORM_INVERSE
+#undef VECTOR_HAVE_TRANSFORM_APPLY_POINT
+#undef VECTOR_HAVE_TRANSFORM_APPLY_VECTOR
+#undef VECTOR_HAVE_TRANSFORM_LERP
+#undef VECTOR_HAVE_TRANSFORM_TO_MATRIX
+#undef VECTOR_HAVE_MATRIX_DECOMPOSE
+#undef VECTOR_HAVE_MATRIX_DECOMPOSE_ARRAY
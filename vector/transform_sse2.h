@@ -0,0 +1,29 @@
+/* transform_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+#ifndef VECTOR_HAVE_TRANSFORM_SPLICE_W
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+transform_splice_w(const vector_t xyz, const vector_t w) {
+	const vector_t splice = _mm_shuffle_ps(xyz, w, VECTOR_MASK_ZZWW);
+	return _mm_shuffle_ps(xyz, splice, VECTOR_MASK_XYXW);
+}
+#define VECTOR_HAVE_TRANSFORM_SPLICE_W 1
+
+#endif
+
+#include <vector/transform_base.h>
@@ -47,6 +47,10 @@ typedef VECTOR_ALIGN float vector_arr_t[4];
 #include <pmmintrin.h>
 #endif
 
+#if VECTOR_IMPLEMENTATION_AVX2
+#include <immintrin.h>
+#endif
+
 #elif VECTOR_IMPLEMENTATION_NEON
 
 #include <arm_neon.h>
@@ -83,7 +87,42 @@ struct vectori_t {
 
 #endif
 
+//! Double precision vector, see vector4d.h. Components are x, y, z, w in order in memory and alignment
+//! is 32 bytes for all implementations. The x86 layout is the same for every instruction set tier so
+//! code compiled for different tiers can share data, the AVX2 functions load it as one 256-bit register
+#if VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+
+typedef struct vector4d_t vector4d_t;
+
+FOUNDATION_ALIGNED_STRUCT(vector4d_t, 32) {
+	__m128d xy;
+	__m128d zw;
+};
+
+#elif VECTOR_IMPLEMENTATION_NEON && defined(__aarch64__)
+
+typedef struct vector4d_t vector4d_t;
+
+FOUNDATION_ALIGNED_STRUCT(vector4d_t, 32) {
+	float64x2_t xy;
+	float64x2_t zw;
+};
+
+#else
+
+typedef struct vector4d_t vector4d_t;
+
+FOUNDATION_ALIGNED_STRUCT(vector4d_t, 32) {
+	float64_t x;
+	float64_t y;
+	float64_t z;
+	float64_t w;
+};
+
+#endif
+
 typedef union matrix_t matrix_t;
+typedef union matrix4d_t matrix4d_t;
 
 //! Row major matrix where matrix row elements reside next to each other in memory.
 union matrix_t {
@@ -103,13 +142,44 @@ union matrix_t {
 	vector_t row[4];
 };
 
+//! Double precision row major matrix, same layout as matrix_t
+union matrix4d_t {
+	//! Component access
+	VECTOR_ALIGNED_STRUCT(matrix4d_component_t) {
+		float64_t m00, m01, m02, m03;  // Row 0
+		float64_t m10, m11, m12, m13;  // Row 1
+		float64_t m20, m21, m22, m23;  // Row 2
+		float64_t m30, m31, m32, m33;  // Row 3
+	}
+	comp;
+	//! Array access, flat layout
+	VECTOR_ALIGN float64_t arr[16];
+	//! 2-dimensional row access, frow[row_index][column_index]
+	VECTOR_ALIGN float64_t frow[4][4];
+	//! Vector access, each row is one vector, row[row_index]
+	vector4d_t row[4];
+};
+
 typedef vector_t quaternion_t;
 typedef vector_t euler_angles_t;  // Order as uint32_t in w component
 
 typedef struct dual_quaternion_t dual_quaternion_t;
 typedef struct transform_t transform_t;
+typedef struct vector_soa_t vector_soa_t;
 typedef struct vector_config_t vector_config_t;
 
+typedef vector_t plane_t;   // Normal in xyz, distance in w, points p on the plane satisfy dot3(n, p) + w = 0
+typedef vector_t sphere_t;  // Center in xyz, radius in w
+
+typedef struct aabb_t aabb_t;
+typedef struct obb_t obb_t;
+typedef struct frustum_t frustum_t;
+typedef struct aabb_soa_t aabb_soa_t;
+typedef struct ray_soa_t ray_soa_t;
+typedef struct vector_view_t vector_view_t;
+typedef struct vector_arena_t vector_arena_t;
+typedef struct vector_hierarchy_t vector_hierarchy_t;
+
 VECTOR_ALIGNED_STRUCT(dual_quaternion_t) {
 	quaternion_t q[2];
 };
@@ -119,6 +189,48 @@ VECTOR_ALIGNED_STRUCT(transform_t) {
 	vector_t translation;  // Scale in w component
 };
 
+//! Four vectors in structure-of-arrays layout, each member holds one component of all four vectors
+VECTOR_ALIGNED_STRUCT(vector_soa_t) {
+	vector_t x;
+	vector_t y;
+	vector_t z;
+	vector_t w;
+};
+
+//! Axis aligned box given by minimum and maximum corners, w components unused
+VECTOR_ALIGNED_STRUCT(aabb_t) {
+	vector_t min;
+	vector_t max;
+};
+
+//! Oriented box, rotation is applied to the box axes before the translation to center
+VECTOR_ALIGNED_STRUCT(obb_t) {
+	vector_t center;
+	vector_t extent;  // Half size along each box axis
+	quaternion_t rotation;
+};
+
+//! Six planes with normals pointing inwards, in order left, right, bottom, top, near and far
+VECTOR_ALIGNED_STRUCT(frustum_t) {
+	plane_t plane[6];
+};
+
+//! Four axis aligned boxes in structure-of-arrays layout, lane i of each member holds one component
+//! of box i. Index 0 holds the minimum and index 1 the maximum corner component
+VECTOR_ALIGNED_STRUCT(aabb_soa_t) {
+	vector_t x[2];
+	vector_t y[2];
+	vector_t z[2];
+};
+
+//! Four rays in structure-of-arrays layout, w members unused. The inverse direction is kept for
+//! box tests and is set up by ray_soa and ray_soa_load
+VECTOR_ALIGNED_STRUCT(ray_soa_t) {
+	vector_soa_t origin;
+	vector_soa_t direction;
+	vector_soa_t inv_direction;
+};
+
 #define VECTOR_GETEULERORDER(i, p, r, f) ((((((i << 1) + p) << 1) + r) << 1) + f)
 
 #define VECTOR_EULER_STATICFRAME 0
@@ -171,9 +283,249 @@ typedef VECTOR_ALIGN float32_t float32_aligned128_t;
 
 FOUNDATION_STATIC_ASSERT(sizeof(vector_t) == sizeof(float32_t) * 4, "vector size");
 FOUNDATION_STATIC_ASSERT(sizeof(matrix_t) == sizeof(float32_t) * 16, "matrix size");
+FOUNDATION_STATIC_ASSERT(sizeof(vector4d_t) == sizeof(float64_t) * 4, "vector4d size");
+FOUNDATION_STATIC_ASSERT(sizeof(matrix4d_t) == sizeof(float64_t) * 16, "matrix4d size");
 FOUNDATION_STATIC_ASSERT(sizeof(transform_t) == sizeof(float32_t) * 8, "transform size");
+FOUNDATION_STATIC_ASSERT(sizeof(dual_quaternion_t) == sizeof(float32_t) * 8, "dual quaternion size");
 FOUNDATION_STATIC_ASSERT(sizeof(euler_angles_t) == sizeof(float32_t) * 4, "euler angles size");
+FOUNDATION_STATIC_ASSERT(sizeof(vector_soa_t) == sizeof(float32_t) * 16, "vector soa size");
+FOUNDATION_STATIC_ASSERT(sizeof(aabb_soa_t) == sizeof(float32_t) * 24, "aabb soa size");
+
+//! Instruction set tiers for the runtime selected batch functions, in increasing order
+typedef enum vector_isa_t {
+	//! Select the best instruction set supported by the CPU
+	VECTOR_ISA_AUTO = 0,
+	//! Implementation the library was compiled for
+	VECTOR_ISA_BASELINE,
+	VECTOR_ISA_SSE4,
+	VECTOR_ISA_AVX2,
+	VECTOR_ISA_AVX512
+} vector_isa_t;
 
 struct vector_config_t {
-	int unused;
+	//! Highest instruction set used for batch functions, VECTOR_ISA_AUTO (0) for no limit. The limit
+	//! only caps tiers above the one the library was compiled for (see vector_module_isa_compiled)
+	vector_isa_t isa_limit;
+	//! Number of worker threads for the parallel batch functions in addition to the calling
+	//! thread, 0 to run them on the calling thread only
+	unsigned int parallel_workers;
+	//! Approximate input bytes per parallel work chunk, 0 for the default of 64KiB
+	size_t parallel_chunk_size;
+	//! Initial capacity in bytes of the frame arena returned by vector_frame_arena, 0 for the
+	//! default of 256KiB
+	size_t arena_size;
+};
+
+//! Functions instrumented when the library is compiled with VECTOR_ENABLE_PROFILING, named
+//! after the function, see vector_profile_name
+typedef enum vector_profile_id_t {
+	VECTOR_PROFILE_VECTOR_BATCH_ROTATE = 0,
+	VECTOR_PROFILE_VECTOR_BATCH_ROTATE_UNALIGNED,
+	VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM,
+	VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM_UNALIGNED,
+	VECTOR_PROFILE_VECTOR_BATCH_ROTATE_STREAM,
+	VECTOR_PROFILE_VECTOR_BATCH_TRANSFORM_STREAM,
+	VECTOR_PROFILE_VECTOR_BATCH_HASH_CELLS,
+	VECTOR_PROFILE_MATRIX_BATCH_MUL,
+	VECTOR_PROFILE_MATRIX_BATCH_MUL_STREAM,
+	VECTOR_PROFILE_MATRIX_BATCH_MUL_CHAIN,
+	VECTOR_PROFILE_MATRIX_BATCH_MUL_CHAIN_RANGE,
+	VECTOR_PROFILE_MATRIX_BATCH_DECOMPOSE,
+	VECTOR_PROFILE_DUAL_QUATERNION_BATCH_SKIN,
+	VECTOR_PROFILE_DUAL_QUATERNION_BATCH_SKIN_STREAM,
+	VECTOR_PROFILE_QUATERNION_BATCH_SLERP,
+	VECTOR_PROFILE_QUATERNION_BATCH_NLERP,
+	VECTOR_PROFILE_QUATERNION_BATCH_ROTATE_PAIRS,
+	VECTOR_PROFILE_QUATERNION_BATCH_FROM_MATRIX,
+	VECTOR_PROFILE_FRUSTUM_BATCH_CULL_AABBS,
+	VECTOR_PROFILE_FRUSTUM_BATCH_CULL_SPHERES,
+	VECTOR_PROFILE_RAY_BATCH_INTERSECT_TRIANGLE,
+	VECTOR_PROFILE_SPLINE_BATCH_EVALUATE,
+	VECTOR_PROFILE_VECTOR_PARALLEL_ROTATE_ARRAY,
+	VECTOR_PROFILE_VECTOR_PARALLEL_TRANSFORM_ARRAY,
+	VECTOR_PROFILE_MATRIX_PARALLEL_MUL_ARRAY,
+	VECTOR_PROFILE_MATRIX_PARALLEL_MUL_CHAIN,
+	VECTOR_PROFILE_VECTOR_CONVERT_VIEW,
+	VECTOR_PROFILE_VECTOR_ROTATE_VIEW,
+	VECTOR_PROFILE_VECTOR_TRANSFORM_VIEW,
+	VECTOR_PROFILE_COUNT
+} vector_profile_id_t;
+
+typedef struct vector_profile_counter_t vector_profile_counter_t;
+typedef struct vector_statistics_t vector_statistics_t;
+
+struct vector_profile_counter_t {
+	//! Number of calls
+	uint64_t calls;
+	//! Number of elements processed over all calls, the count argument of the function
+	uint64_t elements;
+	//! Time spent in the function over all calls, in time_current ticks
+	uint64_t ticks;
+};
+
+struct vector_statistics_t {
+	//! Counters per function, indexed by vector_profile_id_t
+	vector_profile_counter_t counter[VECTOR_PROFILE_COUNT];
+	//! Number of threads which have called an instrumented function
+	unsigned int threads;
+};
+
+//! Function processing elements in range [begin, end) of a parallel loop
+typedef void (*vector_parallel_fn)(void* context, size_t begin, size_t end);
+
+//! Component storage types of vector views, normalized integer and half types as in pack.h
+typedef enum vector_view_type_t {
+	VECTOR_VIEW_FLOAT32 = 0,
+	VECTOR_VIEW_HALF,
+	VECTOR_VIEW_UNORM8,
+	VECTOR_VIEW_SNORM8,
+	VECTOR_VIEW_UNORM16,
+	VECTOR_VIEW_SNORM16
+} vector_view_type_t;
+
+//! Strided view of vectors in a buffer, element i has its components at data + i * stride bytes.
+//! Components not stored in the buffer read as the corresponding component of [0, 0, 0, 1]. Stride
+//! can be smaller than the element size, for example zero to broadcast one element, such views are
+//! read without the faster full vector loads
+struct vector_view_t {
+	void* data;
+	size_t stride;
+	unsigned int components;  // 1 to 4
+	vector_view_type_t type;
+};
+
+//! Linear allocator for batch arrays, see arena.h. Blocks are carved from one buffer and released
+//! all at once by vector_arena_reset
+struct vector_arena_t {
+	void* memory;
+	size_t capacity;
+	size_t used;
+	//! Blocks allocated from the memory system when the buffer is exhausted, linked through a
+	//! header and released at the next reset
+	void* overflow;
+	size_t overflow_size;
+	//! Highest number of bytes in use between two resets
+	size_t peak;
+};
+
+//! Node hierarchy with cached world matrices, see hierarchy.h. Nodes are stored in slots in
+//! depth-first order so every subtree is a contiguous range of slots
+struct vector_hierarchy_t {
+	//! Local and world matrix of each slot
+	matrix_t* local;
+	matrix_t* world;
+	//! Parent slot of each slot, negative for roots. Parents precede their children
+	int32_t* parent;
+	//! One past the last slot of the subtree rooted at each slot
+	uint32_t* subtree_end;
+	//! Slot of each node, nodes keep their index when slots are reordered
+	uint32_t* slot;
+	//! Parent node of each node, negative for roots
+	int32_t* parent_node;
+	//! Bit per slot, set when the local matrix changed since the last update
+	uint32_t* dirty;
+	size_t count;
+	size_t capacity;
+	//! Set when a reparent broke the depth-first order, slots are reordered at the next update
+	bool reorder;
+};
+
+//! Element types of binary container arrays, see blob.h. Quantized types use the storage formats
+//! of pack.h
+typedef enum vector_blob_type_t {
+	VECTOR_BLOB_VECTOR = 1,
+	VECTOR_BLOB_MATRIX,
+	VECTOR_BLOB_TRANSFORM,
+	VECTOR_BLOB_DUAL_QUATERNION,
+	VECTOR_BLOB_FLOAT32,
+	VECTOR_BLOB_UINT32,
+	//! Four half precision values per element
+	VECTOR_BLOB_HALF,
+	//! Four signed normalized 16-bit values per element
+	VECTOR_BLOB_SNORM16,
+	//! Packed signed normalized 10:10:10:2 value per element
+	VECTOR_BLOB_SNORM1010102,
+	//! Quaternion stored as smallest three components, three 16-bit values per element
+	VECTOR_BLOB_SMALLEST3,
+	VECTOR_BLOB_TYPE_COUNT
+} vector_blob_type_t;
+
+typedef struct vector_blob_header_t vector_blob_header_t;
+typedef struct vector_blob_array_t vector_blob_array_t;
+typedef struct vector_blob_source_t vector_blob_source_t;
+typedef struct vector_blob_t vector_blob_t;
+
+//! Header at the start of a binary container, followed by the array directory. Fixed size fields
+//! in the byte order of the writer
+struct vector_blob_header_t {
+	//! VECTOR_BLOB_MAGIC
+	uint32_t magic;
+	//! VECTOR_BLOB_BYTE_ORDER as stored by the writer, reads differently on a reader of the other
+	//! byte order
+	uint32_t byte_order;
+	uint16_t version;
+	//! Implementation of the writer, one of VECTOR_BLOB_IMPLEMENTATION_*. Informational only, the
+	//! layout of all element types is the same for all implementations
+	uint8_t implementation;
+	uint8_t reserved;
+	uint32_t array_count;
+	//! Total size of the container in bytes
+	uint64_t size;
+	uint64_t reserved_tail;
+};
+
+//! Directory entry of an array in a binary container
+struct vector_blob_array_t {
+	//! Identifier given by the writer, typically a hash of the array name
+	hash_t id;
+	uint32_t type;
+	uint32_t element_size;
+	//! Offset of the first element from the start of the container, aligned to VECTOR_BLOB_ALIGNMENT
+	uint64_t offset;
+	uint64_t count;
+};
+
+//! Array to write to a binary container, see vector_blob_write
+struct vector_blob_source_t {
+	hash_t id;
+	vector_blob_type_t type;
+	const void* data;
+	size_t count;
+};
+
+//! Binary container opened in place, see vector_blob_open. Refers to the buffer of the container
+//! which must stay valid and unmodified while the container is used
+struct vector_blob_t {
+	const void* data;
+	size_t size;
+	const vector_blob_header_t* header;
+	const vector_blob_array_t* array;
+	size_t array_count;
+};
+
+//! Interpolation between the keys of a spline, see spline.h
+typedef enum spline_type_t {
+	//! Cubic Hermite, control holds one tangent per key as the derivative of the value over time
+	SPLINE_HERMITE = 0,
+	//! Cubic Bezier, control holds two control points per key, the incoming and outgoing handle
+	SPLINE_BEZIER,
+	//! Uniform Catmull-Rom through the keys, no control array
+	SPLINE_CATMULL_ROM,
+	//! Spherical quadrangle interpolation of unit quaternions, control holds one inner quadrangle
+	//! point per key as computed by spline_squad_controls
+	SPLINE_SQUAD
+} spline_type_t;
+
+typedef struct spline_t spline_t;
+
+//! Keyframe track of vectors or quaternions, see spline.h. The arrays are referenced, not owned
+struct spline_t {
+	//! Key times in increasing order
+	const real* time;
+	const vector_t* value;
+	//! Tangents or control points as given by the type
+	const vector_t* control;
+	//! Number of keys, at least one
+	size_t count;
+	spline_type_t type;
 };
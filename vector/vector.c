@@ -15,15 +15,103 @@
  */
 
 #include <vector/vector.h>
+#include <vector/dispatch.h>
+#include <vector/internal.h>
+
+#include <math.h>
 
 static bool vector_initialized;
+static vector_isa_t vector_isa;
+
+static const string_const_t vector_profile_names[] = {
+	{STRING_CONST("vector_batch_rotate")},
+	{STRING_CONST("vector_batch_rotate_unaligned")},
+	{STRING_CONST("vector_batch_transform")},
+	{STRING_CONST("vector_batch_transform_unaligned")},
+	{STRING_CONST("vector_batch_rotate_stream")},
+	{STRING_CONST("vector_batch_transform_stream")},
+	{STRING_CONST("vector_batch_hash_cells")},
+	{STRING_CONST("matrix_batch_mul")},
+	{STRING_CONST("matrix_batch_mul_stream")},
+	{STRING_CONST("matrix_batch_mul_chain")},
+	{STRING_CONST("matrix_batch_mul_chain_range")},
+	{STRING_CONST("matrix_batch_decompose")},
+	{STRING_CONST("dual_quaternion_batch_skin")},
+	{STRING_CONST("dual_quaternion_batch_skin_stream")},
+	{STRING_CONST("quaternion_batch_slerp")},
+	{STRING_CONST("quaternion_batch_nlerp")},
+	{STRING_CONST("quaternion_batch_rotate_pairs")},
+	{STRING_CONST("quaternion_batch_from_matrix")},
+	{STRING_CONST("frustum_batch_cull_aabbs")},
+	{STRING_CONST("frustum_batch_cull_spheres")},
+	{STRING_CONST("ray_batch_intersect_triangle")},
+	{STRING_CONST("spline_batch_evaluate")},
+	{STRING_CONST("vector_parallel_rotate_array")},
+	{STRING_CONST("vector_parallel_transform_array")},
+	{STRING_CONST("matrix_parallel_mul_array")},
+	{STRING_CONST("matrix_parallel_mul_chain")},
+	{STRING_CONST("vector_convert_view")},
+	{STRING_CONST("vector_rotate_view")},
+	{STRING_CONST("vector_transform_view")}
+};
+
+FOUNDATION_STATIC_ASSERT(sizeof(vector_profile_names) / sizeof(vector_profile_names[0]) == VECTOR_PROFILE_COUNT,
+                         "profile names");
+
+#if VECTOR_ENABLE_PROFILING
+
+//! Threads with separate counters, any further threads share one block
+#define VECTOR_PROFILE_MAX_THREADS 64
+
+typedef struct vector_profile_block_t vector_profile_block_t;
+
+typedef struct {
+	atomic64_t calls;
+	atomic64_t elements;
+	atomic64_t ticks;
+} vector_profile_atomic_counter_t;
+
+FOUNDATION_ALIGNED_STRUCT(vector_profile_block_t, 64) {
+	vector_profile_atomic_counter_t counter[VECTOR_PROFILE_COUNT];
+};
+
+// Each thread updates its own cache line aligned block, so counting does not contend between
+// threads and blocks are only summed when statistics are read
+static vector_profile_block_t vector_profile_blocks[VECTOR_PROFILE_MAX_THREADS + 1];
+static atomic32_t vector_profile_threads;
+
+FOUNDATION_DECLARE_THREAD_LOCAL(vector_profile_block_t*, vector_profile_block, 0)
+
+void
+vector_profile_record(vector_profile_id_t id, size_t elements, tick_t start) {
+	const tick_t elapsed = time_elapsed_ticks(start);
+	vector_profile_block_t* block = get_thread_vector_profile_block();
+	if (!block) {
+		const int32_t index = atomic_incr32(&vector_profile_threads, memory_order_relaxed) - 1;
+		block = vector_profile_blocks + ((index < VECTOR_PROFILE_MAX_THREADS) ? index : VECTOR_PROFILE_MAX_THREADS);
+		set_thread_vector_profile_block(block);
+	}
+	vector_profile_atomic_counter_t* counter = block->counter + id;
+	atomic_add64(&counter->calls, 1, memory_order_relaxed);
+	atomic_add64(&counter->elements, (int64_t)elements, memory_order_relaxed);
+	atomic_add64(&counter->ticks, (int64_t)elapsed, memory_order_relaxed);
+}
+
+#endif
 
 int
 vector_module_initialize(const vector_config_t config) {
-	FOUNDATION_UNUSED(config);
 	if (vector_initialized)
 		return 0;
 
+	vector_isa = vector_dispatch_initialize(config);
+	if (vector_parallel_initialize(config) < 0)
+		return -1;
+	if (vector_frame_arena_initialize(config) < 0) {
+		vector_parallel_finalize();
+		return -1;
+	}
+
 	vector_initialized = true;
 
 	return 0;
@@ -31,6 +119,10 @@ vector_module_initialize(const vector_config_t config) {
 
 void
 vector_module_finalize(void) {
+	if (vector_initialized) {
+		vector_frame_arena_finalize();
+		vector_parallel_finalize();
+	}
 	vector_initialized = false;
 }
 
@@ -39,11 +131,143 @@ vector_module_is_initialized(void) {
 	return vector_initialized;
 }
 
+vector_isa_t
+vector_module_isa(void) {
+	return vector_isa;
+}
+
+vector_isa_t
+vector_module_isa_compiled(void) {
+	return vector_dispatch_compiled_isa();
+}
+
+void
+vector_module_statistics(vector_statistics_t* statistics) {
+	memset(statistics, 0, sizeof(vector_statistics_t));
+#if VECTOR_ENABLE_PROFILING
+	statistics->threads = (unsigned int)atomic_load32(&vector_profile_threads, memory_order_relaxed);
+	for (size_t iblock = 0; iblock <= VECTOR_PROFILE_MAX_THREADS; ++iblock) {
+		vector_profile_block_t* block = vector_profile_blocks + iblock;
+		for (size_t id = 0; id < VECTOR_PROFILE_COUNT; ++id) {
+			vector_profile_counter_t* counter = statistics->counter + id;
+			counter->calls += (uint64_t)atomic_load64(&block->counter[id].calls, memory_order_relaxed);
+			counter->elements += (uint64_t)atomic_load64(&block->counter[id].elements, memory_order_relaxed);
+			counter->ticks += (uint64_t)atomic_load64(&block->counter[id].ticks, memory_order_relaxed);
+		}
+	}
+#endif
+}
+
+void
+vector_module_statistics_reset(void) {
+#if VECTOR_ENABLE_PROFILING
+	// Threads keep their blocks, only the counts are cleared
+	for (size_t iblock = 0; iblock <= VECTOR_PROFILE_MAX_THREADS; ++iblock) {
+		vector_profile_block_t* block = vector_profile_blocks + iblock;
+		for (size_t id = 0; id < VECTOR_PROFILE_COUNT; ++id) {
+			atomic_store64(&block->counter[id].calls, 0, memory_order_relaxed);
+			atomic_store64(&block->counter[id].elements, 0, memory_order_relaxed);
+			atomic_store64(&block->counter[id].ticks, 0, memory_order_relaxed);
+		}
+	}
+#endif
+}
+
+string_const_t
+vector_profile_name(vector_profile_id_t id) {
+	if ((unsigned int)id >= VECTOR_PROFILE_COUNT)
+		return string_empty();
+	return vector_profile_names[id];
+}
+
+static const char vector_string_digits[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+//! Format component with six decimals, same output as printf with %.6f. The value scaled by 10^6
+//! is exact in double precision, so rounding it to an integer in the default round to nearest
+//! even mode gives the same digits as the exact decimal conversion. Values too large for the
+//! integer path and non-finite values are formatted by string_format. Sign and non-finite values
+//! are classified from the bits, the fast math build flags fold NaN checks and the sign of zero
+static size_t
+vector_string_format_component(char* out, float32_t value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	const double scaled = fabs((double)value * 1000000.0);
+	if (((bits & 0x7F800000U) == 0x7F800000U) || !(scaled < 1e18))
+		return string_format(out, 48, STRING_CONST("%.6f"), (double)value).length;
+
+	char* dest = out;
+	if (bits & 0x80000000U)
+		*dest++ = '-';
+
+	const uint64_t fixed = (uint64_t)nearbyint(scaled);
+	uint64_t integer = fixed / 1000000;
+	const unsigned int fraction = (unsigned int)(fixed % 1000000);
+
+	char digits[20];
+	char* first = digits + sizeof(digits);
+	while (integer >= 100) {
+		const unsigned int pair = (unsigned int)(integer % 100);
+		integer /= 100;
+		first -= 2;
+		memcpy(first, vector_string_digits + (pair * 2), 2);
+	}
+	if (integer >= 10) {
+		first -= 2;
+		memcpy(first, vector_string_digits + (integer * 2), 2);
+	} else {
+		*--first = (char)('0' + integer);
+	}
+	const size_t integer_length = (size_t)((digits + sizeof(digits)) - first);
+	memcpy(dest, first, integer_length);
+	dest += integer_length;
+
+	*dest++ = '.';
+	memcpy(dest, vector_string_digits + ((fraction / 10000) * 2), 2);
+	memcpy(dest + 2, vector_string_digits + (((fraction / 100) % 100) * 2), 2);
+	memcpy(dest + 4, vector_string_digits + ((fraction % 100) * 2), 2);
+	dest += 6;
+
+	return (size_t)(dest - out);
+}
+
+//! Format count components as "(c0, c1, ...)" into a buffer of at least
+//! VECTOR_STRING_MAXLENGTH bytes, returns the length
+static size_t
+vector_string_format(char* out, const float32_t* component, size_t count) {
+	char* dest = out;
+	*dest++ = '(';
+	for (size_t icomp = 0; icomp < count; ++icomp) {
+		if (icomp) {
+			*dest++ = ',';
+			*dest++ = ' ';
+		}
+		dest += vector_string_format_component(dest, component[icomp]);
+	}
+	*dest++ = ')';
+	return (size_t)(dest - out);
+}
+
+//! Copy formatted string to the buffer, truncating to the capacity
+static string_t
+vector_string_copy(char* buffer, size_t capacity, const char* str, size_t length) {
+	if (!capacity)
+		return (string_t){buffer, 0};
+	if (length >= capacity)
+		length = capacity - 1;
+	memcpy(buffer, str, length);
+	buffer[length] = 0;
+	return (string_t){buffer, length};
+}
+
 string_t
 string_from_vector(char* buffer, size_t capacity, const vector_t v) {
-	return string_format(buffer, capacity,
-	                     STRING_CONST("(%.6" PRIreal ", %.6" PRIreal ", %.6" PRIreal ", %.6" PRIreal ")"),
-	                     (double)vector_x(v), (double)vector_y(v), (double)vector_z(v), (double)vector_w(v));
+	float32_t component[4];
+	char str[VECTOR_STRING_MAXLENGTH];
+	memcpy(component, &v, sizeof(component));
+	return vector_string_copy(buffer, capacity, str, vector_string_format(str, component, 4));
 }
 
 string_const_t
@@ -51,3 +275,182 @@ string_from_vector_static(const vector_t v) {
 	string_t buffer = string_thread_buffer();
 	return string_to_const(string_from_vector(buffer.str, buffer.length, v));
 }
+
+string_t
+string_from_vector_array(char* buffer, size_t capacity, const vector_t* v, size_t count) {
+	char str[VECTOR_STRING_MAXLENGTH + 1];
+	size_t length = 0;
+	for (size_t ivec = 0; ivec < count; ++ivec) {
+		float32_t component[4];
+		memcpy(component, v + ivec, sizeof(component));
+		// Format in place while there is room for the longest vector, line break and terminator
+		const bool direct = (capacity - length >= VECTOR_STRING_MAXLENGTH + 2);
+		char* dest = direct ? buffer + length : str;
+		size_t element_length = 0;
+		if (ivec)
+			dest[element_length++] = '\n';
+		element_length += vector_string_format(dest + element_length, component, 4);
+		if (!direct) {
+			if (length + element_length >= capacity)
+				break;
+			memcpy(buffer + length, str, element_length);
+		}
+		length += element_length;
+	}
+	if (capacity)
+		buffer[length] = 0;
+	return (string_t){buffer, length};
+}
+
+string_t
+string_from_matrix(char* buffer, size_t capacity, const matrix_t m) {
+	char str[VECTOR_STRING_MAXLENGTH * 4 + 8];
+	char* dest = str;
+	*dest++ = '(';
+	for (unsigned int irow = 0; irow < 4; ++irow) {
+		if (irow) {
+			*dest++ = ',';
+			*dest++ = ' ';
+		}
+		dest += vector_string_format(dest, m.frow[irow], 4);
+	}
+	*dest++ = ')';
+	return vector_string_copy(buffer, capacity, str, (size_t)(dest - str));
+}
+
+static const double vector_string_power[23] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static bool
+vector_string_is_digit(char c) {
+	return (c >= '0') && (c <= '9');
+}
+
+static size_t
+vector_string_skip(const char* str, size_t length, size_t pos) {
+	while ((pos < length) &&
+	       ((str[pos] == ' ') || (str[pos] == '\t') || (str[pos] == '\n') || (str[pos] == '\r') || (str[pos] == ',')))
+		++pos;
+	return pos;
+}
+
+//! Parse number at the start of the string, returns the number of characters consumed or 0 if
+//! there is no number. Numbers with up to 19 significant digits and exponents within the range
+//! where powers of ten are exact in double precision are converted directly, numbers outside
+//! that range and infinity or NaN are converted by string_to_float32
+static size_t
+vector_string_parse_component(const char* str, size_t length, float32_t* value) {
+	size_t pos = 0;
+	const bool negative = (length && (str[0] == '-'));
+	if (length && ((str[0] == '-') || (str[0] == '+')))
+		++pos;
+
+	uint64_t mantissa = 0;
+	int significant = 0;
+	int exponent = 0;
+	bool exact = true;
+	const size_t digits_start = pos;
+	for (; (pos < length) && vector_string_is_digit(str[pos]); ++pos) {
+		if (significant < 19) {
+			mantissa = (mantissa * 10) + (uint64_t)(str[pos] - '0');
+			significant += (mantissa != 0);
+		} else {
+			exact = false;
+		}
+	}
+	size_t digits = pos - digits_start;
+	if ((pos < length) && (str[pos] == '.')) {
+		const size_t fraction_start = ++pos;
+		for (; (pos < length) && vector_string_is_digit(str[pos]); ++pos) {
+			if (significant < 19) {
+				mantissa = (mantissa * 10) + (uint64_t)(str[pos] - '0');
+				significant += (mantissa != 0);
+				--exponent;
+			}
+		}
+		digits += pos - fraction_start;
+	}
+	if (!digits) {
+		// Infinity and NaN
+		size_t end = pos;
+		while ((end < length) && (((str[end] | 0x20) >= 'a') && ((str[end] | 0x20) <= 'z')))
+			++end;
+		if (end == pos)
+			return 0;
+		*value = string_to_float32(str, end);
+		return end;
+	}
+	if ((pos + 1 < length) && ((str[pos] | 0x20) == 'e')) {
+		size_t exp_pos = pos + 1;
+		const bool exp_negative = (str[exp_pos] == '-');
+		if ((str[exp_pos] == '-') || (str[exp_pos] == '+'))
+			++exp_pos;
+		if ((exp_pos < length) && vector_string_is_digit(str[exp_pos])) {
+			int exp_value = 0;
+			for (; (exp_pos < length) && vector_string_is_digit(str[exp_pos]); ++exp_pos) {
+				if (exp_value < 10000)
+					exp_value = (exp_value * 10) + (str[exp_pos] - '0');
+			}
+			exponent += exp_negative ? -exp_value : exp_value;
+			pos = exp_pos;
+		}
+	}
+
+	if (!exact || (mantissa >= (1ULL << 53)) || (exponent < -22) || (exponent > 22)) {
+		*value = string_to_float32(str, pos);
+		return pos;
+	}
+	double result = (double)mantissa;
+	result = (exponent < 0) ? result / vector_string_power[-exponent] : result * vector_string_power[exponent];
+	*value = (float32_t)(negative ? -result : result);
+	return pos;
+}
+
+//! Parse up to four components, optionally in parentheses, into component. Returns position
+//! after the vector and stores the number of components parsed
+static size_t
+vector_string_parse(const char* str, size_t length, size_t pos, float32_t* component, size_t* count) {
+	*count = 0;
+	pos = vector_string_skip(str, length, pos);
+	const bool enclosed = (pos < length) && (str[pos] == '(');
+	if (enclosed)
+		++pos;
+	while (*count < 4) {
+		pos = vector_string_skip(str, length, pos);
+		const size_t consumed = vector_string_parse_component(str + pos, length - pos, component + *count);
+		if (!consumed)
+			break;
+		pos += consumed;
+		++(*count);
+	}
+	if (enclosed) {
+		pos = vector_string_skip(str, length, pos);
+		if ((pos < length) && (str[pos] == ')'))
+			++pos;
+	}
+	return pos;
+}
+
+vector_t
+vector_from_string(const char* str, size_t length) {
+	float32_t component[4] = {0, 0, 0, 1};
+	size_t count;
+	vector_string_parse(str, length, 0, component, &count);
+	return vector_unaligned(component);
+}
+
+size_t
+vector_array_from_string(vector_t* out, size_t capacity, const char* str, size_t length) {
+	size_t pos = 0;
+	size_t ivec = 0;
+	for (; ivec < capacity; ++ivec) {
+		float32_t component[4] = {0, 0, 0, 1};
+		size_t count;
+		pos = vector_string_parse(str, length, pos, component, &count);
+		if (!count)
+			break;
+		out[ivec] = vector_unaligned(component);
+	}
+	return ivec;
+}
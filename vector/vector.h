@@ -35,6 +35,30 @@ vector_module_is_initialized(void);
 VECTOR_API version_t
 vector_module_version(void);
 
+//! Instruction set used by the batch functions, selected from CPU features and config at module
+//! initialization. Returns the highest tier the library was compiled for if no better tier is available
+VECTOR_API vector_isa_t
+vector_module_isa(void);
+
+//! Instruction set the library was compiled for, the lowest tier that can be selected with
+//! vector_config_t::isa_limit
+VECTOR_API vector_isa_t
+vector_module_isa_compiled(void);
+
+//! Aggregate the profiling counters of all threads. Counters are only collected when the library
+//! is compiled with VECTOR_ENABLE_PROFILING, otherwise all counters are zero. Calls from the
+//! parallel functions are counted both for the parallel function and the batch function of each chunk
+VECTOR_API void
+vector_module_statistics(vector_statistics_t* statistics);
+
+//! Reset the profiling counters of all threads
+VECTOR_API void
+vector_module_statistics_reset(void);
+
+//! Name of the function a profiling counter refers to
+VECTOR_API string_const_t
+vector_profile_name(vector_profile_id_t id);
+
 //! Load unaligned
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector(const real x, const real y, const real z, const real w);
@@ -47,6 +71,23 @@ vector_unaligned(const float32_t* FOUNDATION_RESTRICT v);
 static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
 vector_aligned(const float32_aligned128_t* FOUNDATION_RESTRICT v);
 
+//! Load three packed components, unaligned. Reads exactly 12 bytes, w component is set to 1
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load3(const float32_t* FOUNDATION_RESTRICT v);
+
+//! Store xyz components as three packed components, unaligned. Writes exactly 12 bytes
+static FOUNDATION_FORCEINLINE void
+vector_store3(float32_t* FOUNDATION_RESTRICT out, const vector_t v);
+
+//! Store with a non-temporal hint bypassing the caches where supported, 16-byte aligned. Streaming
+//! stores are weakly ordered, call vector_stream_fence before the data is consumed by another thread
+static FOUNDATION_FORCEINLINE void
+vector_stream(vector_t* FOUNDATION_RESTRICT out, const vector_t v);
+
+//! Order previous streaming stores before any following stores
+static FOUNDATION_FORCEINLINE void
+vector_stream_fence(void);
+
 //! Load single uniform
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_uniform(const real v);
@@ -82,6 +123,14 @@ vector_normalize(const vector_t v);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_normalize3(const vector_t v);
 
+//! Normalize using reciprocal square root estimate, max relative error 2^-21 (about 5e-7) per component.
+//! Normalize3 variant preserves w component. Zero length input gives undefined result
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize_fast(const vector_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize3_fast(const vector_t v);
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_dot(const vector_t v0, const vector_t v1);
 
@@ -97,6 +146,10 @@ vector_mul(const vector_t v0, const vector_t v1);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_div(const vector_t v0, const vector_t v1);
 
+//! Reciprocal (1 / v) from estimate, max relative error 2^-21 (about 5e-7). Zero input gives undefined result
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_reciprocal_fast(const vector_t v);
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_add(const vector_t v0, const vector_t v1);
 
@@ -141,6 +194,7 @@ vector_reflect3(const vector_t v, const vector_t at);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length(const vector_t v);
 
+//! Length from reciprocal square root estimate, max relative error 2^-21 (about 5e-7). Exact zero for zero length
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length_fast(const vector_t v);
 
@@ -150,6 +204,7 @@ vector_length_sqr(const vector_t v);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length3(const vector_t v);
 
+//! Length of xyz components, see vector_length_fast
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length3_fast(const vector_t v);
 
@@ -159,6 +214,11 @@ vector_length3_sqr(const vector_t v);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_sqrt(const vector_t v);
 
+//! Reciprocal square root (1 / sqrt(v)) from estimate, max relative error 2^-21 (about 5e-7).
+//! Zero input gives undefined result
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_rsqrt_fast(const vector_t v);
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_min(const vector_t v0, const vector_t v1);
 
@@ -228,6 +288,86 @@ vectori_and(const vectori_t v0, const vectori_t v1);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
 vectori_or(const vectori_t v0, const vectori_t v1);
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_xor(const vectori_t v0, const vectori_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori(const int32_t x, const int32_t y, const int32_t z, const int32_t w);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_uniform(const int32_t v);
+
+//! Integer arithmetic wraps on overflow, multiplication keeps the low 32 bits of the product
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_add(const vectori_t v0, const vectori_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_sub(const vectori_t v0, const vectori_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_mul(const vectori_t v0, const vectori_t v1);
+
+//! Shift all components left by count bits, count must be in range [0, 31]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_left(const vectori_t v, const int count);
+
+//! Arithmetic (sign extending) shift of all components right by count bits, count must be in range [0, 31]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_right(const vectori_t v, const int count);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_min(const vectori_t v0, const vectori_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_max(const vectori_t v0, const vectori_t v1);
+
+//! Round components towards negative infinity. Components of magnitude 2^23 or greater are
+//! already integral and returned unchanged, as are infinities and NaNs
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_floor(const vector_t v);
+
+//! Round components towards positive infinity, see vector_floor
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_ceil(const vector_t v);
+
+//! Round components to nearest integer, ties to even, see vector_floor
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_round(const vector_t v);
+
+//! Convert to integer components, truncating towards zero like a C cast. Use vector_floor
+//! first for grid cell coordinates. Results for values outside the int32 range are undefined
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vector_to_vectori(const vector_t v);
+
+//! Convert integer components to floating point
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vectori_to_vector(const vectori_t v);
+
+//! Select components from v0 where the mask lane is set and from v1 elsewhere, without branches.
+//! Mask lanes must be all ones or all zeros, as returned by the comparison functions
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_select(const vectori_t mask, const vector_t v0, const vector_t v1);
+
+//! Sign bit of each mask lane as a bit, x in bit 0 to w in bit 3
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vectori_movemask(const vectori_t mask);
+
+//! Check if all lanes of a comparison mask are set
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_all(const vectori_t mask);
+
+//! Check if any lane of a comparison mask is set
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_any(const vectori_t mask);
+
+//! Clamp components to the range [lo, hi], lo must not be greater than hi
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_clamp(const vector_t v, const vector_t lo, const vector_t hi);
+
+//! Clamp components to the range [0, 1]
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_saturate(const vector_t v);
+
 //! Treat vectors as row vectors, which puts axes in rows in matrix
 //                 [ m00 m01 m02 --- ]
 // [ vx vy vz vw ] [ m10 m11 m12 --- ] = [ m00*vx + m10*vy + m20*vz, m01*vx ..., ..., vw ]
@@ -244,13 +384,113 @@ vector_rotate(const vector_t v, const matrix_t m);
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_transform(const vector_t v, const matrix_t m);
 
+//! Rotate array of vectors by matrix, see vector_rotate. Arrays must be 16-byte aligned. Output
+//! can be the same array as input for in-place rotation, but arrays must not partially overlap
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Rotate array of vectors by matrix, unaligned float arrays with four components per vector
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m);
+
+//! Transform array of vectors by matrix, see vector_transform. Arrays must be 16-byte aligned. Output
+//! can be the same array as input for in-place transformation, but arrays must not partially overlap
+static FOUNDATION_FORCEINLINE void
+vector_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Transform array of vectors by matrix, unaligned float arrays with four components per vector
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m);
+
+//! Rotate array of vectors by matrix like vector_rotate_array, but with streaming stores for outputs
+//! which are not read back soon, see vector_stream. Inputs are prefetched VECTOR_STREAM_PREFETCH_DISTANCE
+//! bytes ahead and a vector_stream_fence is issued before returning. Arrays must be 16-byte aligned,
+//! output can be the same array as input but arrays must not partially overlap
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Transform array of vectors by matrix with streaming stores, see vector_rotate_array_stream
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Load array of vectors from count packed three component floats, see vector_load3. Output array
+//! must be 16-byte aligned, input has no alignment requirement and exactly count * 12 bytes are read
+static FOUNDATION_FORCEINLINE void
+vector_load3_array(vector_t* out, const float32_t* in, size_t count);
+
+//! Store xyz components of array of vectors as count packed three component floats, see
+//! vector_store3. Input array must be 16-byte aligned, exactly count * 12 bytes of output are written
+static FOUNDATION_FORCEINLINE void
+vector_store3_array(float32_t* out, const vector_t* in, size_t count);
+
+//! Rotate array of vectors by matrix using the implementation selected at module initialization,
+//! see vector_rotate_array
+VECTOR_API void
+vector_batch_rotate(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Rotate unaligned array of vectors by matrix using the implementation selected at module
+//! initialization, see vector_rotate_array_unaligned
+VECTOR_API void
+vector_batch_rotate_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m);
+
+//! Transform array of vectors by matrix using the implementation selected at module initialization,
+//! see vector_transform_array
+VECTOR_API void
+vector_batch_transform(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Transform unaligned array of vectors by matrix using the implementation selected at module
+//! initialization, see vector_transform_array_unaligned
+VECTOR_API void
+vector_batch_transform_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m);
+
+//! Rotate array of vectors with streaming stores using the implementation selected at module
+//! initialization, see vector_rotate_array_stream
+VECTOR_API void
+vector_batch_rotate_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Transform array of vectors with streaming stores using the implementation selected at module
+//! initialization, see vector_transform_array_stream
+VECTOR_API void
+vector_batch_transform_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m);
+
+//! Max length of a vector formatted by string_from_vector, excluding the terminating zero
+#define VECTOR_STRING_MAXLENGTH 196
+
+//! Format vector as "(x, y, z, w)" with six decimals per component, same output as printf with
+//! %.6f but without parsing a format string. The output is truncated to fit the buffer
 VECTOR_API string_t
 string_from_vector(char* buffer, size_t capacity, const vector_t v);
 
 VECTOR_API string_const_t
 string_from_vector_static(const vector_t v);
 
-#if VECTOR_IMPLEMENTATION_SSE4
+//! Format array of vectors as in string_from_vector, one vector per line. Vectors which do not fit
+//! completely in the buffer are left out, at most VECTOR_STRING_MAXLENGTH + 1 bytes are needed per
+//! vector including the line break
+VECTOR_API string_t
+string_from_vector_array(char* buffer, size_t capacity, const vector_t* v, size_t count);
+
+//! Format matrix as "(row0, row1, row2, row3)" with each row as in string_from_vector. The output
+//! is truncated to fit the buffer
+VECTOR_API string_t
+string_from_matrix(char* buffer, size_t capacity, const matrix_t m);
+
+//! Parse vector of up to four components separated by commas or whitespace, optionally enclosed in
+//! parentheses, as written by string_from_vector. Components not given are set to the
+//! corresponding component of [0, 0, 0, 1]
+VECTOR_API vector_t
+vector_from_string(const char* str, size_t length);
+
+//! Parse vectors as written by string_from_vector_array, each vector written as in
+//! vector_from_string. Returns the number of vectors stored, at most capacity
+VECTOR_API size_t
+vector_array_from_string(vector_t* out, size_t capacity, const char* str, size_t length);
+
+#if VECTOR_IMPLEMENTATION_AVX512
+#include <vector/vector_avx512.h>
+#elif VECTOR_IMPLEMENTATION_AVX2
+#include <vector/vector_avx2.h>
+#elif VECTOR_IMPLEMENTATION_SSE4
 #include <vector/vector_sse4.h>
 #elif VECTOR_IMPLEMENTATION_SSE3
 #include <vector/vector_sse3.h>
@@ -262,6 +502,13 @@ string_from_vector_static(const vector_t v);
 #include <vector/vector_fallback.h>
 #endif
 
+#include <vector/transcendental.h>
 #include <vector/quaternion.h>
 #include <vector/matrix.h>
 #include <vector/euler.h>
+#include <vector/soa.h>
+#include <vector/view.h>
+#include <vector/parallel.h>
+#include <vector/arena.h>
+#include <vector/hierarchy.h>
+#include <vector/blob.h>
@@ -0,0 +1,192 @@
+/* vector4d.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file vector4d.h
+    Double precision vectors and matrices for large world coordinates. Functions follow the
+    single precision versions in vector.h and matrix.h. World space data is kept in double
+    precision and rebased to single precision relative to an origin, usually the camera
+    position, before rendering or further processing with the single precision functions */
+
+#include <vector/types.h>
+#include <vector/vector.h>
+#include <vector/matrix.h>
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d(const float64_t x, const float64_t y, const float64_t z, const float64_t w);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector4d_t
+vector4d_unaligned(const float64_t* FOUNDATION_RESTRICT v);
+
+//! Store vector in four doubles, no alignment requirements
+static FOUNDATION_FORCEINLINE void
+vector4d_store(float64_t* FOUNDATION_RESTRICT out, const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_uniform(const float64_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_zero(void);
+
+//! Widen single precision vector
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_from_vector(const vector_t v);
+
+//! Round to single precision vector
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_from_vector4d(const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_add(const vector4d_t v0, const vector4d_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sub(const vector4d_t v0, const vector4d_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_mul(const vector4d_t v0, const vector4d_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_div(const vector4d_t v0, const vector4d_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_neg(const vector4d_t v);
+
+//! Multiply v0 and v1 and add v2
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_muladd(const vector4d_t v0, const vector4d_t v1, const vector4d_t v2);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_scale(const vector4d_t v, const float64_t s);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_lerp(const vector4d_t from, const vector4d_t to, const float64_t factor);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_min(const vector4d_t v0, const vector4d_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_max(const vector4d_t v0, const vector4d_t v1);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sqrt(const vector4d_t v);
+
+//! Dot product in all components
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot(const vector4d_t v0, const vector4d_t v1);
+
+//! Dot product of xyz components in all components
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot3(const vector4d_t v0, const vector4d_t v1);
+
+//! Cross product of xyz components, w component is zero
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_cross3(const vector4d_t v0, const vector4d_t v1);
+
+//! Length of xyz components in all components
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_length3(const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_length3_sqr(const vector4d_t v);
+
+//! Normalize xyz components, w component is preserved
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_normalize3(const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_x(const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_y(const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_z(const vector4d_t v);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_w(const vector4d_t v);
+
+//! Rotate vector by matrix, w component is preserved, see vector_rotate
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_rotate(const vector4d_t v, const matrix4d_t m);
+
+//! Transform vector by matrix, see vector_transform
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_transform(const vector4d_t v, const matrix4d_t m);
+
+//! Subtract origin xyz components and round to single precision, w component is preserved. The
+//! subtraction is done in double precision so precision is only lost in the relative result
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector4d_rebase(const vector4d_t v, const vector4d_t origin);
+
+//! Rebase array of vectors relative to origin, see vector4d_rebase
+static FOUNDATION_FORCEINLINE void
+vector4d_rebase_array(vector_t* FOUNDATION_RESTRICT out, const vector4d_t* FOUNDATION_RESTRICT in, size_t count,
+                      const vector4d_t origin);
+
+//! Rebase array of points given as packed xyz doubles relative to origin, w component of
+//! output vectors is one
+static FOUNDATION_FORCEINLINE void
+vector4d_rebase_array_packed3(vector_t* FOUNDATION_RESTRICT out, const float64_t* FOUNDATION_RESTRICT in, size_t count,
+                              const vector4d_t origin);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_identity(void);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL matrix4d_t
+matrix4d_unaligned(const float64_t* FOUNDATION_RESTRICT m);
+
+//! Widen single precision matrix
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_from_matrix(const matrix_t m);
+
+//! Round to single precision matrix
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_from_matrix4d(const matrix4d_t m);
+
+//! Create translation matrix from xyz components of vector
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_translation(const vector4d_t translation);
+
+//! Get translation in xyz components, w component is m33
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+matrix4d_get_translation(const matrix4d_t m);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_transpose(const matrix4d_t m);
+
+//! Multiply matrices, see matrix_mul
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_mul(const matrix4d_t m0, const matrix4d_t m1);
+
+//! Round to single precision matrix with the translation relative to origin, see vector4d_rebase
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix4d_rebase(const matrix4d_t m, const vector4d_t origin);
+
+//! Rebase array of matrices relative to origin, see matrix4d_rebase
+static FOUNDATION_FORCEINLINE void
+matrix4d_rebase_array(matrix_t* FOUNDATION_RESTRICT out, const matrix4d_t* FOUNDATION_RESTRICT in, size_t count,
+                      const vector4d_t origin);
+
+#if VECTOR_IMPLEMENTATION_AVX2
+#include <vector/vector4d_avx2.h>
+#elif VECTOR_IMPLEMENTATION_SSE4 || VECTOR_IMPLEMENTATION_SSE3 || VECTOR_IMPLEMENTATION_SSE2
+#include <vector/vector4d_sse2.h>
+#elif VECTOR_IMPLEMENTATION_NEON && defined(__aarch64__)
+#include <vector/vector4d_neon.h>
+#else
+#include <vector/vector4d_fallback.h>
+#endif
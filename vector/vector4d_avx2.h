@@ -0,0 +1,206 @@
+/* vector4d_avx2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+// Vectors are stored as the xy and zw pair of the SSE implementations and loaded as one 256-bit
+// register in each function, lane permutes across the 128-bit halves use vpermpd
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL __m256d
+vector4d_load_m256d(const vector4d_t v) {
+	return _mm256_insertf128_pd(_mm256_castpd128_pd256(v.xy), v.zw, 1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_from_m256d(const __m256d v) {
+	vector4d_t r;
+	r.xy = _mm256_castpd256_pd128(v);
+	r.zw = _mm256_extractf128_pd(v, 1);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d(const float64_t x, const float64_t y, const float64_t z, const float64_t w) {
+	return vector4d_from_m256d(_mm256_setr_pd(x, y, z, w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector4d_t
+vector4d_unaligned(const float64_t* FOUNDATION_RESTRICT v) {
+	return vector4d_from_m256d(_mm256_loadu_pd(v));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector4d_store(float64_t* FOUNDATION_RESTRICT out, const vector4d_t v) {
+	_mm256_storeu_pd(out, vector4d_load_m256d(v));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_uniform(const float64_t v) {
+	return vector4d_from_m256d(_mm256_set1_pd(v));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_zero(void) {
+	return vector4d_from_m256d(_mm256_setzero_pd());
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_from_vector(const vector_t v) {
+	return vector4d_from_m256d(_mm256_cvtps_pd(v));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_from_vector4d(const vector4d_t v) {
+	return _mm256_cvtpd_ps(vector4d_load_m256d(v));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_add(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_from_m256d(_mm256_add_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sub(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_from_m256d(_mm256_sub_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_mul(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_from_m256d(_mm256_mul_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_div(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_from_m256d(_mm256_div_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_neg(const vector4d_t v) {
+	return vector4d_from_m256d(_mm256_sub_pd(_mm256_setzero_pd(), vector4d_load_m256d(v)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_muladd(const vector4d_t v0, const vector4d_t v1, const vector4d_t v2) {
+	return vector4d_from_m256d(
+	    _mm256_fmadd_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1), vector4d_load_m256d(v2)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_min(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_from_m256d(_mm256_min_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_max(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_from_m256d(_mm256_max_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sqrt(const vector4d_t v) {
+	return vector4d_from_m256d(_mm256_sqrt_pd(vector4d_load_m256d(v)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot(const vector4d_t v0, const vector4d_t v1) {
+	const __m256d prod = _mm256_mul_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1));
+	// Sum pairs within each half, then add the swapped halves
+	const __m256d pair = _mm256_hadd_pd(prod, prod);
+	return vector4d_from_m256d(_mm256_add_pd(pair, _mm256_permute2f128_pd(pair, pair, 0x01)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot3(const vector4d_t v0, const vector4d_t v1) {
+	const __m256d prod =
+	    _mm256_blend_pd(_mm256_mul_pd(vector4d_load_m256d(v0), vector4d_load_m256d(v1)), _mm256_setzero_pd(), 0x8);
+	const __m256d pair = _mm256_hadd_pd(prod, prod);
+	return vector4d_from_m256d(_mm256_add_pd(pair, _mm256_permute2f128_pd(pair, pair, 0x01)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_cross3(const vector4d_t v0, const vector4d_t v1) {
+	const __m256d a = vector4d_load_m256d(v0);
+	const __m256d b = vector4d_load_m256d(v1);
+	const __m256d ayzx = _mm256_permute4x64_pd(a, VECTOR_MASK_YZXW);
+	const __m256d byzx = _mm256_permute4x64_pd(b, VECTOR_MASK_YZXW);
+	const __m256d azxy = _mm256_permute4x64_pd(a, VECTOR_MASK_ZXYW);
+	const __m256d bzxy = _mm256_permute4x64_pd(b, VECTOR_MASK_ZXYW);
+	return vector4d_from_m256d(_mm256_sub_pd(_mm256_mul_pd(ayzx, bzxy), _mm256_mul_pd(azxy, byzx)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_x(const vector4d_t v) {
+	return _mm_cvtsd_f64(v.xy);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_y(const vector4d_t v) {
+	return _mm_cvtsd_f64(_mm_unpackhi_pd(v.xy, v.xy));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_z(const vector4d_t v) {
+	return _mm_cvtsd_f64(v.zw);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_w(const vector4d_t v) {
+	return _mm_cvtsd_f64(_mm_unpackhi_pd(v.zw, v.zw));
+}
+
+#ifndef VECTOR_HAVE_VECTOR4D_NORMALIZE3
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_normalize3(const vector4d_t v) {
+	const __m256d vd = vector4d_load_m256d(v);
+	const __m256d r = _mm256_div_pd(vd, vector4d_load_m256d(vector4d_length3(v)));
+	return vector4d_from_m256d(_mm256_blend_pd(r, vd, 0x8));
+}
+#define VECTOR_HAVE_VECTOR4D_NORMALIZE3 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_ROTATE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_rotate(const vector4d_t v, const matrix4d_t m) {
+	const __m256d vd = vector4d_load_m256d(v);
+	__m256d r = _mm256_mul_pd(vector4d_load_m256d(m.row[0]), _mm256_permute4x64_pd(vd, VECTOR_MASK_XXXX));
+	r = _mm256_fmadd_pd(vector4d_load_m256d(m.row[1]), _mm256_permute4x64_pd(vd, VECTOR_MASK_YYYY), r);
+	r = _mm256_fmadd_pd(vector4d_load_m256d(m.row[2]), _mm256_permute4x64_pd(vd, VECTOR_MASK_ZZZZ), r);
+	return vector4d_from_m256d(_mm256_blend_pd(r, vd, 0x8));
+}
+#define VECTOR_HAVE_VECTOR4D_ROTATE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_TRANSFORM
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_transform(const vector4d_t v, const matrix4d_t m) {
+	const __m256d vd = vector4d_load_m256d(v);
+	const __m256d lo =
+	    _mm256_fmadd_pd(vector4d_load_m256d(m.row[1]), _mm256_permute4x64_pd(vd, VECTOR_MASK_YYYY),
+	                    _mm256_mul_pd(vector4d_load_m256d(m.row[0]), _mm256_permute4x64_pd(vd, VECTOR_MASK_XXXX)));
+	const __m256d hi =
+	    _mm256_fmadd_pd(vector4d_load_m256d(m.row[3]), _mm256_permute4x64_pd(vd, VECTOR_MASK_WWWW),
+	                    _mm256_mul_pd(vector4d_load_m256d(m.row[2]), _mm256_permute4x64_pd(vd, VECTOR_MASK_ZZZZ)));
+	return vector4d_from_m256d(_mm256_add_pd(lo, hi));
+}
+#define VECTOR_HAVE_VECTOR4D_TRANSFORM 1
+
+#endif
+
+#include <vector/vector4d_base.h>
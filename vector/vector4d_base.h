@@ -0,0 +1,200 @@
+/* vector4d_base.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_scale(const vector4d_t v, const float64_t s) {
+	return vector4d_mul(v, vector4d_uniform(s));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_lerp(const vector4d_t from, const vector4d_t to, const float64_t factor) {
+	return vector4d_muladd(vector4d_sub(to, from), vector4d_uniform(factor), from);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_length3_sqr(const vector4d_t v) {
+	return vector4d_dot3(v, v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_length3(const vector4d_t v) {
+	return vector4d_sqrt(vector4d_dot3(v, v));
+}
+
+#ifndef VECTOR_HAVE_VECTOR4D_NORMALIZE3
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_normalize3(const vector4d_t v) {
+	const vector4d_t r = vector4d_div(v, vector4d_length3(v));
+	return vector4d(vector4d_x(r), vector4d_y(r), vector4d_z(r), vector4d_w(v));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_ROTATE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_rotate(const vector4d_t v, const matrix4d_t m) {
+	vector4d_t r = vector4d_mul(m.row[0], vector4d_uniform(vector4d_x(v)));
+	r = vector4d_muladd(m.row[1], vector4d_uniform(vector4d_y(v)), r);
+	r = vector4d_muladd(m.row[2], vector4d_uniform(vector4d_z(v)), r);
+	return vector4d(vector4d_x(r), vector4d_y(r), vector4d_z(r), vector4d_w(v));
+}
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_TRANSFORM
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_transform(const vector4d_t v, const matrix4d_t m) {
+	vector4d_t r = vector4d_mul(m.row[0], vector4d_uniform(vector4d_x(v)));
+	r = vector4d_muladd(m.row[1], vector4d_uniform(vector4d_y(v)), r);
+	r = vector4d_muladd(m.row[2], vector4d_uniform(vector4d_z(v)), r);
+	return vector4d_muladd(m.row[3], vector4d_uniform(vector4d_w(v)), r);
+}
+
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector4d_rebase(const vector4d_t v, const vector4d_t origin) {
+	// Origin w is replaced by zero so the w component passes through the subtraction
+	const vector4d_t offset = vector4d(vector4d_x(origin), vector4d_y(origin), vector4d_z(origin), 0);
+	return vector_from_vector4d(vector4d_sub(v, offset));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector4d_rebase_array(vector_t* FOUNDATION_RESTRICT out, const vector4d_t* FOUNDATION_RESTRICT in, size_t count,
+                      const vector4d_t origin) {
+	const vector4d_t offset = vector4d(vector4d_x(origin), vector4d_y(origin), vector4d_z(origin), 0);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		out[i] = vector_from_vector4d(vector4d_sub(in[i], offset));
+		out[i + 1] = vector_from_vector4d(vector4d_sub(in[i + 1], offset));
+		out[i + 2] = vector_from_vector4d(vector4d_sub(in[i + 2], offset));
+		out[i + 3] = vector_from_vector4d(vector4d_sub(in[i + 3], offset));
+	}
+	for (; i < count; ++i)
+		out[i] = vector_from_vector4d(vector4d_sub(in[i], offset));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector4d_rebase_array_packed3(vector_t* FOUNDATION_RESTRICT out, const float64_t* FOUNDATION_RESTRICT in, size_t count,
+                              const vector4d_t origin) {
+	// Origin w is set to minus one to get a w component of one from the zero loaded in w
+	const vector4d_t offset = vector4d(vector4d_x(origin), vector4d_y(origin), vector4d_z(origin), -1);
+	for (size_t i = 0; i < count; ++i, in += 3)
+		out[i] = vector_from_vector4d(vector4d_sub(vector4d(in[0], in[1], in[2], 0), offset));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_identity(void) {
+	matrix4d_t m;
+	m.row[0] = vector4d(1, 0, 0, 0);
+	m.row[1] = vector4d(0, 1, 0, 0);
+	m.row[2] = vector4d(0, 0, 1, 0);
+	m.row[3] = vector4d(0, 0, 0, 1);
+	return m;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL matrix4d_t
+matrix4d_unaligned(const float64_t* FOUNDATION_RESTRICT m) {
+	matrix4d_t r;
+	r.row[0] = vector4d_unaligned(m);
+	r.row[1] = vector4d_unaligned(m + 4);
+	r.row[2] = vector4d_unaligned(m + 8);
+	r.row[3] = vector4d_unaligned(m + 12);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_from_matrix(const matrix_t m) {
+	matrix4d_t r;
+	r.row[0] = vector4d_from_vector(m.row[0]);
+	r.row[1] = vector4d_from_vector(m.row[1]);
+	r.row[2] = vector4d_from_vector(m.row[2]);
+	r.row[3] = vector4d_from_vector(m.row[3]);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix_from_matrix4d(const matrix4d_t m) {
+	matrix_t r;
+	r.row[0] = vector_from_vector4d(m.row[0]);
+	r.row[1] = vector_from_vector4d(m.row[1]);
+	r.row[2] = vector_from_vector4d(m.row[2]);
+	r.row[3] = vector_from_vector4d(m.row[3]);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_translation(const vector4d_t translation) {
+	matrix4d_t m = matrix4d_identity();
+	m.row[3] = vector4d(vector4d_x(translation), vector4d_y(translation), vector4d_z(translation), 1);
+	return m;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+matrix4d_get_translation(const matrix4d_t m) {
+	return m.row[3];
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_transpose(const matrix4d_t m) {
+	matrix4d_t r;
+	for (int row = 0; row < 4; ++row) {
+		for (int col = 0; col < 4; ++col)
+			r.frow[row][col] = m.frow[col][row];
+	}
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix4d_t
+matrix4d_mul(const matrix4d_t m0, const matrix4d_t m1) {
+	matrix4d_t r;
+	r.row[0] = vector4d_transform(m0.row[0], m1);
+	r.row[1] = vector4d_transform(m0.row[1], m1);
+	r.row[2] = vector4d_transform(m0.row[2], m1);
+	r.row[3] = vector4d_transform(m0.row[3], m1);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL matrix_t
+matrix4d_rebase(const matrix4d_t m, const vector4d_t origin) {
+	matrix_t r;
+	r.row[0] = vector_from_vector4d(m.row[0]);
+	r.row[1] = vector_from_vector4d(m.row[1]);
+	r.row[2] = vector_from_vector4d(m.row[2]);
+	r.row[3] = vector4d_rebase(m.row[3], origin);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE void
+matrix4d_rebase_array(matrix_t* FOUNDATION_RESTRICT out, const matrix4d_t* FOUNDATION_RESTRICT in, size_t count,
+                      const vector4d_t origin) {
+	const vector4d_t offset = vector4d(vector4d_x(origin), vector4d_y(origin), vector4d_z(origin), 0);
+	for (size_t i = 0; i < count; ++i) {
+		out[i].row[0] = vector_from_vector4d(in[i].row[0]);
+		out[i].row[1] = vector_from_vector4d(in[i].row[1]);
+		out[i].row[2] = vector_from_vector4d(in[i].row[2]);
+		out[i].row[3] = vector_from_vector4d(vector4d_sub(in[i].row[3], offset));
+	}
+}
+
+#undef VECTOR_HAVE_VECTOR4D_NORMALIZE3
+#undef VECTOR_HAVE_VECTOR4D_ROTATE
+#undef VECTOR_HAVE_VECTOR4D_TRANSFORM
@@ -0,0 +1,140 @@
+/* vector4d_fallback.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d(const float64_t x, const float64_t y, const float64_t z, const float64_t w) {
+	const vector4d_t v = {x, y, z, w};
+	return v;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector4d_t
+vector4d_unaligned(const float64_t* FOUNDATION_RESTRICT v) {
+	return vector4d(v[0], v[1], v[2], v[3]);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector4d_store(float64_t* FOUNDATION_RESTRICT out, const vector4d_t v) {
+	out[0] = v.x;
+	out[1] = v.y;
+	out[2] = v.z;
+	out[3] = v.w;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_uniform(const float64_t v) {
+	return vector4d(v, v, v, v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_zero(void) {
+	return vector4d(0, 0, 0, 0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_from_vector(const vector_t v) {
+	return vector4d(vector_x(v), vector_y(v), vector_z(v), vector_w(v));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_from_vector4d(const vector4d_t v) {
+	return vector((real)v.x, (real)v.y, (real)v.z, (real)v.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_add(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d(v0.x + v1.x, v0.y + v1.y, v0.z + v1.z, v0.w + v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sub(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d(v0.x - v1.x, v0.y - v1.y, v0.z - v1.z, v0.w - v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_mul(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d(v0.x * v1.x, v0.y * v1.y, v0.z * v1.z, v0.w * v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_div(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d(v0.x / v1.x, v0.y / v1.y, v0.z / v1.z, v0.w / v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_neg(const vector4d_t v) {
+	return vector4d(-v.x, -v.y, -v.z, -v.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_muladd(const vector4d_t v0, const vector4d_t v1, const vector4d_t v2) {
+	return vector4d(v0.x * v1.x + v2.x, v0.y * v1.y + v2.y, v0.z * v1.z + v2.z, v0.w * v1.w + v2.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_min(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d((v0.x < v1.x) ? v0.x : v1.x, (v0.y < v1.y) ? v0.y : v1.y, (v0.z < v1.z) ? v0.z : v1.z,
+	                (v0.w < v1.w) ? v0.w : v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_max(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d((v0.x > v1.x) ? v0.x : v1.x, (v0.y > v1.y) ? v0.y : v1.y, (v0.z > v1.z) ? v0.z : v1.z,
+	                (v0.w > v1.w) ? v0.w : v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sqrt(const vector4d_t v) {
+	return vector4d(sqrt(v.x), sqrt(v.y), sqrt(v.z), sqrt(v.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_uniform(v0.x * v1.x + v0.y * v1.y + v0.z * v1.z + v0.w * v1.w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot3(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d_uniform(v0.x * v1.x + v0.y * v1.y + v0.z * v1.z);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_cross3(const vector4d_t v0, const vector4d_t v1) {
+	return vector4d(v0.y * v1.z - v0.z * v1.y, v0.z * v1.x - v0.x * v1.z, v0.x * v1.y - v0.y * v1.x, 0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_x(const vector4d_t v) {
+	return v.x;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_y(const vector4d_t v) {
+	return v.y;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_z(const vector4d_t v) {
+	return v.z;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_w(const vector4d_t v) {
+	return v.w;
+}
+
+#include <vector/vector4d_base.h>
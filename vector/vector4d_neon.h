@@ -0,0 +1,250 @@
+/* vector4d_neon.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+// Each vector is a pair of registers holding xy and zw components. Double precision vectors
+// require AArch64, 32-bit ARM uses the fallback implementation
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d(const float64_t x, const float64_t y, const float64_t z, const float64_t w) {
+	const float64_t data[4] = {x, y, z, w};
+	vector4d_t v;
+	v.xy = vld1q_f64(data);
+	v.zw = vld1q_f64(data + 2);
+	return v;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector4d_t
+vector4d_unaligned(const float64_t* FOUNDATION_RESTRICT v) {
+	vector4d_t r;
+	r.xy = vld1q_f64(v);
+	r.zw = vld1q_f64(v + 2);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE void
+vector4d_store(float64_t* FOUNDATION_RESTRICT out, const vector4d_t v) {
+	vst1q_f64(out, v.xy);
+	vst1q_f64(out + 2, v.zw);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_uniform(const float64_t v) {
+	vector4d_t r;
+	r.xy = vdupq_n_f64(v);
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_zero(void) {
+	return vector4d_uniform(0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_from_vector(const vector_t v) {
+	vector4d_t r;
+	r.xy = vcvt_f64_f32(vget_low_f32(v));
+	r.zw = vcvt_high_f64_f32(v);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_from_vector4d(const vector4d_t v) {
+	return vcvt_high_f32_f64(vcvt_f32_f64(v.xy), v.zw);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_add(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = vaddq_f64(v0.xy, v1.xy);
+	r.zw = vaddq_f64(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sub(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = vsubq_f64(v0.xy, v1.xy);
+	r.zw = vsubq_f64(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_mul(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = vmulq_f64(v0.xy, v1.xy);
+	r.zw = vmulq_f64(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_div(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = vdivq_f64(v0.xy, v1.xy);
+	r.zw = vdivq_f64(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_neg(const vector4d_t v) {
+	vector4d_t r;
+	r.xy = vnegq_f64(v.xy);
+	r.zw = vnegq_f64(v.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_muladd(const vector4d_t v0, const vector4d_t v1, const vector4d_t v2) {
+	vector4d_t r;
+	r.xy = vfmaq_f64(v2.xy, v0.xy, v1.xy);
+	r.zw = vfmaq_f64(v2.zw, v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_min(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = vminq_f64(v0.xy, v1.xy);
+	r.zw = vminq_f64(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_max(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = vmaxq_f64(v0.xy, v1.xy);
+	r.zw = vmaxq_f64(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sqrt(const vector4d_t v) {
+	vector4d_t r;
+	r.xy = vsqrtq_f64(v.xy);
+	r.zw = vsqrtq_f64(v.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot(const vector4d_t v0, const vector4d_t v1) {
+	const float64x2_t sum = vfmaq_f64(vmulq_f64(v0.xy, v1.xy), v0.zw, v1.zw);
+	vector4d_t r;
+	r.xy = vpaddq_f64(sum, sum);
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot3(const vector4d_t v0, const vector4d_t v1) {
+	const float64x2_t z = vcopyq_laneq_f64(vmulq_f64(v0.zw, v1.zw), 1, vdupq_n_f64(0), 0);
+	const float64x2_t sum = vfmaq_f64(z, v0.xy, v1.xy);
+	vector4d_t r;
+	r.xy = vpaddq_f64(sum, sum);
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_cross3(const vector4d_t v0, const vector4d_t v1) {
+	// yzxw and zxyw component orders, each from one permute per register
+	const float64x2_t v0yz = vextq_f64(v0.xy, v0.zw, 1);
+	const float64x2_t v0xw = vcopyq_laneq_f64(v0.xy, 1, v0.zw, 1);
+	const float64x2_t v0zx = vzip1q_f64(v0.zw, v0.xy);
+	const float64x2_t v0yw = vzip2q_f64(v0.xy, v0.zw);
+	const float64x2_t v1yz = vextq_f64(v1.xy, v1.zw, 1);
+	const float64x2_t v1xw = vcopyq_laneq_f64(v1.xy, 1, v1.zw, 1);
+	const float64x2_t v1zx = vzip1q_f64(v1.zw, v1.xy);
+	const float64x2_t v1yw = vzip2q_f64(v1.xy, v1.zw);
+	vector4d_t r;
+	r.xy = vsubq_f64(vmulq_f64(v0yz, v1zx), vmulq_f64(v0zx, v1yz));
+	r.zw = vsubq_f64(vmulq_f64(v0xw, v1yw), vmulq_f64(v0yw, v1xw));
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_x(const vector4d_t v) {
+	return vgetq_lane_f64(v.xy, 0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_y(const vector4d_t v) {
+	return vgetq_lane_f64(v.xy, 1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_z(const vector4d_t v) {
+	return vgetq_lane_f64(v.zw, 0);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_w(const vector4d_t v) {
+	return vgetq_lane_f64(v.zw, 1);
+}
+
+#ifndef VECTOR_HAVE_VECTOR4D_NORMALIZE3
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_normalize3(const vector4d_t v) {
+	const float64x2_t length = vsqrtq_f64(vector4d_dot3(v, v).xy);
+	vector4d_t r;
+	r.xy = vdivq_f64(v.xy, length);
+	r.zw = vcopyq_laneq_f64(vdivq_f64(v.zw, length), 1, v.zw, 1);
+	return r;
+}
+#define VECTOR_HAVE_VECTOR4D_NORMALIZE3 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_ROTATE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_rotate(const vector4d_t v, const matrix4d_t m) {
+	vector4d_t r;
+	r.xy = vmulq_laneq_f64(m.row[0].xy, v.xy, 0);
+	r.zw = vmulq_laneq_f64(m.row[0].zw, v.xy, 0);
+	r.xy = vfmaq_laneq_f64(r.xy, m.row[1].xy, v.xy, 1);
+	r.zw = vfmaq_laneq_f64(r.zw, m.row[1].zw, v.xy, 1);
+	r.xy = vfmaq_laneq_f64(r.xy, m.row[2].xy, v.zw, 0);
+	r.zw = vfmaq_laneq_f64(r.zw, m.row[2].zw, v.zw, 0);
+	r.zw = vcopyq_laneq_f64(r.zw, 1, v.zw, 1);
+	return r;
+}
+#define VECTOR_HAVE_VECTOR4D_ROTATE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_TRANSFORM
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_transform(const vector4d_t v, const matrix4d_t m) {
+	vector4d_t r;
+	r.xy = vmulq_laneq_f64(m.row[0].xy, v.xy, 0);
+	r.zw = vmulq_laneq_f64(m.row[0].zw, v.xy, 0);
+	r.xy = vfmaq_laneq_f64(r.xy, m.row[1].xy, v.xy, 1);
+	r.zw = vfmaq_laneq_f64(r.zw, m.row[1].zw, v.xy, 1);
+	r.xy = vfmaq_laneq_f64(r.xy, m.row[2].xy, v.zw, 0);
+	r.zw = vfmaq_laneq_f64(r.zw, m.row[2].zw, v.zw, 0);
+	r.xy = vfmaq_laneq_f64(r.xy, m.row[3].xy, v.zw, 1);
+	r.zw = vfmaq_laneq_f64(r.zw, m.row[3].zw, v.zw, 1);
+	return r;
+}
+#define VECTOR_HAVE_VECTOR4D_TRANSFORM 1
+
+#endif
+
+#include <vector/vector4d_base.h>
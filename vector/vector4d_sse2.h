@@ -0,0 +1,258 @@
+/* vector4d_sse2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+// Each vector is a pair of registers holding xy and zw components
+
+#if VECTOR_IMPLEMENTATION_SSE4 && FOUNDATION_ARCH_SSE4_FMA3
+#define VECTOR4D_MULADD_PD(v0, v1, v2) _mm_fmadd_pd(v0, v1, v2)
+#else
+#define VECTOR4D_MULADD_PD(v0, v1, v2) _mm_add_pd(_mm_mul_pd(v0, v1), v2)
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d(const float64_t x, const float64_t y, const float64_t z, const float64_t w) {
+	vector4d_t v;
+	v.xy = _mm_setr_pd(x, y);
+	v.zw = _mm_setr_pd(z, w);
+	return v;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector4d_t
+vector4d_unaligned(const float64_t* FOUNDATION_RESTRICT v) {
+	vector4d_t r;
+	r.xy = _mm_loadu_pd(v);
+	r.zw = _mm_loadu_pd(v + 2);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE void
+vector4d_store(float64_t* FOUNDATION_RESTRICT out, const vector4d_t v) {
+	_mm_storeu_pd(out, v.xy);
+	_mm_storeu_pd(out + 2, v.zw);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_uniform(const float64_t v) {
+	vector4d_t r;
+	r.xy = _mm_set1_pd(v);
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_zero(void) {
+	vector4d_t r;
+	r.xy = _mm_setzero_pd();
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_from_vector(const vector_t v) {
+	vector4d_t r;
+	r.xy = _mm_cvtps_pd(v);
+	r.zw = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_from_vector4d(const vector4d_t v) {
+	return _mm_movelh_ps(_mm_cvtpd_ps(v.xy), _mm_cvtpd_ps(v.zw));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_add(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = _mm_add_pd(v0.xy, v1.xy);
+	r.zw = _mm_add_pd(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sub(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = _mm_sub_pd(v0.xy, v1.xy);
+	r.zw = _mm_sub_pd(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_mul(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = _mm_mul_pd(v0.xy, v1.xy);
+	r.zw = _mm_mul_pd(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_div(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = _mm_div_pd(v0.xy, v1.xy);
+	r.zw = _mm_div_pd(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_neg(const vector4d_t v) {
+	vector4d_t r;
+	r.xy = _mm_sub_pd(_mm_setzero_pd(), v.xy);
+	r.zw = _mm_sub_pd(_mm_setzero_pd(), v.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_muladd(const vector4d_t v0, const vector4d_t v1, const vector4d_t v2) {
+	vector4d_t r;
+	r.xy = VECTOR4D_MULADD_PD(v0.xy, v1.xy, v2.xy);
+	r.zw = VECTOR4D_MULADD_PD(v0.zw, v1.zw, v2.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_min(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = _mm_min_pd(v0.xy, v1.xy);
+	r.zw = _mm_min_pd(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_max(const vector4d_t v0, const vector4d_t v1) {
+	vector4d_t r;
+	r.xy = _mm_max_pd(v0.xy, v1.xy);
+	r.zw = _mm_max_pd(v0.zw, v1.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_sqrt(const vector4d_t v) {
+	vector4d_t r;
+	r.xy = _mm_sqrt_pd(v.xy);
+	r.zw = _mm_sqrt_pd(v.zw);
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot(const vector4d_t v0, const vector4d_t v1) {
+	const __m128d sum = VECTOR4D_MULADD_PD(v0.zw, v1.zw, _mm_mul_pd(v0.xy, v1.xy));
+	vector4d_t r;
+	r.xy = _mm_add_pd(sum, _mm_shuffle_pd(sum, sum, 1));
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_dot3(const vector4d_t v0, const vector4d_t v1) {
+	const __m128d z = _mm_move_sd(_mm_setzero_pd(), _mm_mul_sd(v0.zw, v1.zw));
+	const __m128d sum = VECTOR4D_MULADD_PD(v0.xy, v1.xy, z);
+	vector4d_t r;
+	r.xy = _mm_add_pd(sum, _mm_shuffle_pd(sum, sum, 1));
+	r.zw = r.xy;
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_cross3(const vector4d_t v0, const vector4d_t v1) {
+	// yzxw and zxyw component orders, each from one shuffle per register
+	const __m128d v0yz = _mm_shuffle_pd(v0.xy, v0.zw, 1);
+	const __m128d v0xw = _mm_shuffle_pd(v0.xy, v0.zw, 2);
+	const __m128d v0zx = _mm_shuffle_pd(v0.zw, v0.xy, 0);
+	const __m128d v0yw = _mm_shuffle_pd(v0.xy, v0.zw, 3);
+	const __m128d v1yz = _mm_shuffle_pd(v1.xy, v1.zw, 1);
+	const __m128d v1xw = _mm_shuffle_pd(v1.xy, v1.zw, 2);
+	const __m128d v1zx = _mm_shuffle_pd(v1.zw, v1.xy, 0);
+	const __m128d v1yw = _mm_shuffle_pd(v1.xy, v1.zw, 3);
+	vector4d_t r;
+	r.xy = _mm_sub_pd(_mm_mul_pd(v0yz, v1zx), _mm_mul_pd(v0zx, v1yz));
+	r.zw = _mm_sub_pd(_mm_mul_pd(v0xw, v1yw), _mm_mul_pd(v0yw, v1xw));
+	return r;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_x(const vector4d_t v) {
+	return _mm_cvtsd_f64(v.xy);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_y(const vector4d_t v) {
+	return _mm_cvtsd_f64(_mm_unpackhi_pd(v.xy, v.xy));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_z(const vector4d_t v) {
+	return _mm_cvtsd_f64(v.zw);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL float64_t
+vector4d_w(const vector4d_t v) {
+	return _mm_cvtsd_f64(_mm_unpackhi_pd(v.zw, v.zw));
+}
+
+#ifndef VECTOR_HAVE_VECTOR4D_NORMALIZE3
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_normalize3(const vector4d_t v) {
+	const __m128d length = _mm_sqrt_pd(vector4d_dot3(v, v).xy);
+	vector4d_t r;
+	r.xy = _mm_div_pd(v.xy, length);
+	r.zw = _mm_move_sd(v.zw, _mm_div_sd(v.zw, length));
+	return r;
+}
+#define VECTOR_HAVE_VECTOR4D_NORMALIZE3 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_ROTATE
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_rotate(const vector4d_t v, const matrix4d_t m) {
+	const __m128d x = _mm_unpacklo_pd(v.xy, v.xy);
+	const __m128d y = _mm_unpackhi_pd(v.xy, v.xy);
+	const __m128d z = _mm_unpacklo_pd(v.zw, v.zw);
+	vector4d_t r;
+	r.xy = VECTOR4D_MULADD_PD(m.row[2].xy, z, VECTOR4D_MULADD_PD(m.row[1].xy, y, _mm_mul_pd(m.row[0].xy, x)));
+	r.zw = VECTOR4D_MULADD_PD(m.row[2].zw, z, VECTOR4D_MULADD_PD(m.row[1].zw, y, _mm_mul_pd(m.row[0].zw, x)));
+	r.zw = _mm_move_sd(v.zw, r.zw);
+	return r;
+}
+#define VECTOR_HAVE_VECTOR4D_ROTATE 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR4D_TRANSFORM
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector4d_t
+vector4d_transform(const vector4d_t v, const matrix4d_t m) {
+	const __m128d x = _mm_unpacklo_pd(v.xy, v.xy);
+	const __m128d y = _mm_unpackhi_pd(v.xy, v.xy);
+	const __m128d z = _mm_unpacklo_pd(v.zw, v.zw);
+	const __m128d w = _mm_unpackhi_pd(v.zw, v.zw);
+	vector4d_t r;
+	r.xy = VECTOR4D_MULADD_PD(m.row[1].xy, y, _mm_mul_pd(m.row[0].xy, x));
+	r.zw = VECTOR4D_MULADD_PD(m.row[1].zw, y, _mm_mul_pd(m.row[0].zw, x));
+	r.xy = VECTOR4D_MULADD_PD(m.row[3].xy, w, VECTOR4D_MULADD_PD(m.row[2].xy, z, r.xy));
+	r.zw = VECTOR4D_MULADD_PD(m.row[3].zw, w, VECTOR4D_MULADD_PD(m.row[2].zw, z, r.zw));
+	return r;
+}
+#define VECTOR_HAVE_VECTOR4D_TRANSFORM 1
+
+#endif
+
+#undef VECTOR4D_MULADD_PD
+
+#include <vector/vector4d_base.h>
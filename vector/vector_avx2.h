@@ -0,0 +1,133 @@
+/* vector_avx2.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+// Two vectors per 256-bit register, matrix rows are broadcast to both 128-bit lanes and the
+// in-lane permute splats each vector component within its own lane
+#define VECTOR_ROTATE_STEP_AVX2(t, v, r0, r1, r2)                       \
+	t = _mm256_mul_ps(r0, _mm256_permute_ps(v, VECTOR_MASK_XXXX));      \
+	t = _mm256_fmadd_ps(r1, _mm256_permute_ps(v, VECTOR_MASK_YYYY), t); \
+	t = _mm256_fmadd_ps(r2, _mm256_permute_ps(v, VECTOR_MASK_ZZZZ), t); \
+	t = _mm256_blend_ps(t, v, 0x88)
+
+#define VECTOR_TRANSFORM_STEP_AVX2(t, v, r0, r1, r2, r3)                \
+	t = _mm256_mul_ps(r0, _mm256_permute_ps(v, VECTOR_MASK_XXXX));      \
+	t = _mm256_fmadd_ps(r1, _mm256_permute_ps(v, VECTOR_MASK_YYYY), t); \
+	t = _mm256_fmadd_ps(r2, _mm256_permute_ps(v, VECTOR_MASK_ZZZZ), t); \
+	t = _mm256_fmadd_ps(r3, _mm256_permute_ps(v, VECTOR_MASK_WWWW), t)
+
+#ifndef VECTOR_HAVE_VECTOR_ROTATE_ARRAY_UNALIGNED
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const __m256 r0 = _mm256_broadcast_ps(&m.row[0]);
+	const __m256 r1 = _mm256_broadcast_ps(&m.row[1]);
+	const __m256 r2 = _mm256_broadcast_ps(&m.row[2]);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8, in += 32, out += 32) {
+		const __m256 v0 = _mm256_loadu_ps(in);
+		const __m256 v1 = _mm256_loadu_ps(in + 8);
+		const __m256 v2 = _mm256_loadu_ps(in + 16);
+		const __m256 v3 = _mm256_loadu_ps(in + 24);
+		__m256 t0, t1, t2, t3;
+		VECTOR_ROTATE_STEP_AVX2(t0, v0, r0, r1, r2);
+		VECTOR_ROTATE_STEP_AVX2(t1, v1, r0, r1, r2);
+		VECTOR_ROTATE_STEP_AVX2(t2, v2, r0, r1, r2);
+		VECTOR_ROTATE_STEP_AVX2(t3, v3, r0, r1, r2);
+		_mm256_storeu_ps(out, t0);
+		_mm256_storeu_ps(out + 8, t1);
+		_mm256_storeu_ps(out + 16, t2);
+		_mm256_storeu_ps(out + 24, t3);
+	}
+	for (; i + 2 <= count; i += 2, in += 8, out += 8) {
+		const __m256 v = _mm256_loadu_ps(in);
+		__m256 t;
+		VECTOR_ROTATE_STEP_AVX2(t, v, r0, r1, r2);
+		_mm256_storeu_ps(out, t);
+	}
+	if (i < count)
+		_mm_storeu_ps(out, vector_rotate(_mm_loadu_ps(in), m));
+}
+#define VECTOR_HAVE_VECTOR_ROTATE_ARRAY_UNALIGNED 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR_ROTATE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	// Vector arrays are only guaranteed 16-byte alignment, unaligned 256-bit access is used anyway
+	vector_rotate_array_unaligned((float32_t*)out, (const float32_t*)in, count, m);
+}
+#define VECTOR_HAVE_VECTOR_ROTATE_ARRAY 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY_UNALIGNED
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const __m256 r0 = _mm256_broadcast_ps(&m.row[0]);
+	const __m256 r1 = _mm256_broadcast_ps(&m.row[1]);
+	const __m256 r2 = _mm256_broadcast_ps(&m.row[2]);
+	const __m256 r3 = _mm256_broadcast_ps(&m.row[3]);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8, in += 32, out += 32) {
+		const __m256 v0 = _mm256_loadu_ps(in);
+		const __m256 v1 = _mm256_loadu_ps(in + 8);
+		const __m256 v2 = _mm256_loadu_ps(in + 16);
+		const __m256 v3 = _mm256_loadu_ps(in + 24);
+		__m256 t0, t1, t2, t3;
+		VECTOR_TRANSFORM_STEP_AVX2(t0, v0, r0, r1, r2, r3);
+		VECTOR_TRANSFORM_STEP_AVX2(t1, v1, r0, r1, r2, r3);
+		VECTOR_TRANSFORM_STEP_AVX2(t2, v2, r0, r1, r2, r3);
+		VECTOR_TRANSFORM_STEP_AVX2(t3, v3, r0, r1, r2, r3);
+		_mm256_storeu_ps(out, t0);
+		_mm256_storeu_ps(out + 8, t1);
+		_mm256_storeu_ps(out + 16, t2);
+		_mm256_storeu_ps(out + 24, t3);
+	}
+	for (; i + 2 <= count; i += 2, in += 8, out += 8) {
+		const __m256 v = _mm256_loadu_ps(in);
+		__m256 t;
+		VECTOR_TRANSFORM_STEP_AVX2(t, v, r0, r1, r2, r3);
+		_mm256_storeu_ps(out, t);
+	}
+	if (i < count)
+		_mm_storeu_ps(out, vector_transform(_mm_loadu_ps(in), m));
+}
+#define VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY_UNALIGNED 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	vector_transform_array_unaligned((float32_t*)out, (const float32_t*)in, count, m);
+}
+#define VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY 1
+
+#endif
+
+#undef VECTOR_ROTATE_STEP_AVX2
+#undef VECTOR_TRANSFORM_STEP_AVX2
+
+#include <vector/vector_sse4.h>
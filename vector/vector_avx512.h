@@ -0,0 +1,142 @@
+/* vector_avx512.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+
+// Four vectors per 512-bit register, same scheme as the AVX2 kernels with matrix rows broadcast
+// to all four 128-bit lanes. The tail of one to three vectors is handled with masked access
+#define VECTOR_ROTATE_STEP_AVX512(t, v, r0, r1, r2)                     \
+	t = _mm512_mul_ps(r0, _mm512_permute_ps(v, VECTOR_MASK_XXXX));      \
+	t = _mm512_fmadd_ps(r1, _mm512_permute_ps(v, VECTOR_MASK_YYYY), t); \
+	t = _mm512_fmadd_ps(r2, _mm512_permute_ps(v, VECTOR_MASK_ZZZZ), t); \
+	t = _mm512_mask_blend_ps(0x8888, t, v)
+
+#define VECTOR_TRANSFORM_STEP_AVX512(t, v, r0, r1, r2, r3)              \
+	t = _mm512_mul_ps(r0, _mm512_permute_ps(v, VECTOR_MASK_XXXX));      \
+	t = _mm512_fmadd_ps(r1, _mm512_permute_ps(v, VECTOR_MASK_YYYY), t); \
+	t = _mm512_fmadd_ps(r2, _mm512_permute_ps(v, VECTOR_MASK_ZZZZ), t); \
+	t = _mm512_fmadd_ps(r3, _mm512_permute_ps(v, VECTOR_MASK_WWWW), t)
+
+#ifndef VECTOR_HAVE_VECTOR_ROTATE_ARRAY_UNALIGNED
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const __m512 r0 = _mm512_broadcast_f32x4(m.row[0]);
+	const __m512 r1 = _mm512_broadcast_f32x4(m.row[1]);
+	const __m512 r2 = _mm512_broadcast_f32x4(m.row[2]);
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16, in += 64, out += 64) {
+		const __m512 v0 = _mm512_loadu_ps(in);
+		const __m512 v1 = _mm512_loadu_ps(in + 16);
+		const __m512 v2 = _mm512_loadu_ps(in + 32);
+		const __m512 v3 = _mm512_loadu_ps(in + 48);
+		__m512 t0, t1, t2, t3;
+		VECTOR_ROTATE_STEP_AVX512(t0, v0, r0, r1, r2);
+		VECTOR_ROTATE_STEP_AVX512(t1, v1, r0, r1, r2);
+		VECTOR_ROTATE_STEP_AVX512(t2, v2, r0, r1, r2);
+		VECTOR_ROTATE_STEP_AVX512(t3, v3, r0, r1, r2);
+		_mm512_storeu_ps(out, t0);
+		_mm512_storeu_ps(out + 16, t1);
+		_mm512_storeu_ps(out + 32, t2);
+		_mm512_storeu_ps(out + 48, t3);
+	}
+	for (; i + 4 <= count; i += 4, in += 16, out += 16) {
+		const __m512 v = _mm512_loadu_ps(in);
+		__m512 t;
+		VECTOR_ROTATE_STEP_AVX512(t, v, r0, r1, r2);
+		_mm512_storeu_ps(out, t);
+	}
+	if (i < count) {
+		const __mmask16 mask = (__mmask16)((1U << ((count - i) * 4)) - 1);
+		const __m512 v = _mm512_maskz_loadu_ps(mask, in);
+		__m512 t;
+		VECTOR_ROTATE_STEP_AVX512(t, v, r0, r1, r2);
+		_mm512_mask_storeu_ps(out, mask, t);
+	}
+}
+#define VECTOR_HAVE_VECTOR_ROTATE_ARRAY_UNALIGNED 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR_ROTATE_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	vector_rotate_array_unaligned((float32_t*)out, (const float32_t*)in, count, m);
+}
+#define VECTOR_HAVE_VECTOR_ROTATE_ARRAY 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY_UNALIGNED
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const __m512 r0 = _mm512_broadcast_f32x4(m.row[0]);
+	const __m512 r1 = _mm512_broadcast_f32x4(m.row[1]);
+	const __m512 r2 = _mm512_broadcast_f32x4(m.row[2]);
+	const __m512 r3 = _mm512_broadcast_f32x4(m.row[3]);
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16, in += 64, out += 64) {
+		const __m512 v0 = _mm512_loadu_ps(in);
+		const __m512 v1 = _mm512_loadu_ps(in + 16);
+		const __m512 v2 = _mm512_loadu_ps(in + 32);
+		const __m512 v3 = _mm512_loadu_ps(in + 48);
+		__m512 t0, t1, t2, t3;
+		VECTOR_TRANSFORM_STEP_AVX512(t0, v0, r0, r1, r2, r3);
+		VECTOR_TRANSFORM_STEP_AVX512(t1, v1, r0, r1, r2, r3);
+		VECTOR_TRANSFORM_STEP_AVX512(t2, v2, r0, r1, r2, r3);
+		VECTOR_TRANSFORM_STEP_AVX512(t3, v3, r0, r1, r2, r3);
+		_mm512_storeu_ps(out, t0);
+		_mm512_storeu_ps(out + 16, t1);
+		_mm512_storeu_ps(out + 32, t2);
+		_mm512_storeu_ps(out + 48, t3);
+	}
+	for (; i + 4 <= count; i += 4, in += 16, out += 16) {
+		const __m512 v = _mm512_loadu_ps(in);
+		__m512 t;
+		VECTOR_TRANSFORM_STEP_AVX512(t, v, r0, r1, r2, r3);
+		_mm512_storeu_ps(out, t);
+	}
+	if (i < count) {
+		const __mmask16 mask = (__mmask16)((1U << ((count - i) * 4)) - 1);
+		const __m512 v = _mm512_maskz_loadu_ps(mask, in);
+		__m512 t;
+		VECTOR_TRANSFORM_STEP_AVX512(t, v, r0, r1, r2, r3);
+		_mm512_mask_storeu_ps(out, mask, t);
+	}
+}
+#define VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY_UNALIGNED 1
+
+#endif
+
+#ifndef VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	vector_transform_array_unaligned((float32_t*)out, (const float32_t*)in, count, m);
+}
+#define VECTOR_HAVE_VECTOR_TRANSFORM_ARRAY 1
+
+#endif
+
+#undef VECTOR_ROTATE_STEP_AVX512
+#undef VECTOR_TRANSFORM_STEP_AVX512
+
+#include <vector/vector_avx2.h>
@@ -15,6 +15,8 @@
  *
  */
 
+#include <math.h>
+
 #if FOUNDATION_COMPILER_CLANG
 #pragma clang diagnostic push
 #if __has_warning("-Wfloat-equal")
@@ -38,6 +40,28 @@ vector_unaligned(const float32_t* FOUNDATION_RESTRICT v) {
 	return rv;
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load3(const float32_t* FOUNDATION_RESTRICT v) {
+	vector_t rv = {v[0], v[1], v[2], 1.0f};
+	return rv;
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_store3(float32_t* FOUNDATION_RESTRICT out, const vector_t v) {
+	out[0] = v.x;
+	out[1] = v.y;
+	out[2] = v.z;
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_stream(vector_t* FOUNDATION_RESTRICT out, const vector_t v) {
+	*out = v;
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_stream_fence(void) {
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_uniform(const real v) {
 	return (vector_t){v, v, v, v};
@@ -104,6 +128,16 @@ vector_normalize3(const vector_t v) {
 	return rv;
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize_fast(const vector_t v) {
+	return vector_normalize(v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize3_fast(const vector_t v) {
+	return vector_normalize3(v);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_dot(const vector_t v0, const vector_t v1) {
 	return vector_uniform(v0.x * v1.x + v0.y * v1.y + v0.z * v1.z + v0.w * v1.w);
@@ -129,6 +163,11 @@ vector_div(const vector_t v0, const vector_t v1) {
 	return (vector_t){v0.x / v1.x, v0.y / v1.y, v0.z / v1.z, v0.w / v1.w};
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_reciprocal_fast(const vector_t v) {
+	return (vector_t){1.0f / v.x, 1.0f / v.y, 1.0f / v.z, 1.0f / v.w};
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_add(const vector_t v0, const vector_t v1) {
 	return (vector_t){v0.x + v1.x, v0.y + v1.y, v0.z + v1.z, v0.w + v1.w};
@@ -245,6 +284,11 @@ vector_sqrt(const vector_t v) {
 	return vector(math_sqrt(v.x), math_sqrt(v.y), math_sqrt(v.z), math_sqrt(v.w));
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_rsqrt_fast(const vector_t v) {
+	return (vector_t){math_rsqrt(v.x), math_rsqrt(v.y), math_rsqrt(v.z), math_rsqrt(v.w)};
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_min(const vector_t v0, const vector_t v1) {
 	return (vector_t){(v0.x < v1.x) ? v0.x : v1.x, (v0.y < v1.y) ? v0.y : v1.y, (v0.z < v1.z) ? v0.z : v1.z,
@@ -364,6 +408,120 @@ vector_greater(const vector_t v0, const vector_t v1) {
 	return (vectori_t){v0.x > v1.x ? -1 : 0, v0.y > v1.y ? -1 : 0, v0.z > v1.z ? -1 : 0, v0.w > v1.w ? -1 : 0};
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	return (vector_t){mask.x ? v0.x : v1.x, mask.y ? v0.y : v1.y, mask.z ? v0.z : v1.z, mask.w ? v0.w : v1.w};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vectori_movemask(const vectori_t mask) {
+	return ((mask.x < 0) ? 1U : 0U) | ((mask.y < 0) ? 2U : 0U) | ((mask.z < 0) ? 4U : 0U) | ((mask.w < 0) ? 8U : 0U);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_all(const vectori_t mask) {
+	return mask.x && mask.y && mask.z && mask.w;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_any(const vectori_t mask) {
+	return mask.x || mask.y || mask.z || mask.w;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_clamp(const vector_t v, const vector_t lo, const vector_t hi) {
+	return vector_min(vector_max(v, lo), hi);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_saturate(const vector_t v) {
+	return vector_min(vector_max(v, vector_zero()), vector_one());
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_xor(const vectori_t v0, const vectori_t v1) {
+	return (vectori_t){v0.x ^ v1.x, v0.y ^ v1.y, v0.z ^ v1.z, v0.w ^ v1.w};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori(const int32_t x, const int32_t y, const int32_t z, const int32_t w) {
+	return (vectori_t){x, y, z, w};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_uniform(const int32_t v) {
+	return (vectori_t){v, v, v, v};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_add(const vectori_t v0, const vectori_t v1) {
+	return (vectori_t){(int32_t)((uint32_t)v0.x + (uint32_t)v1.x), (int32_t)((uint32_t)v0.y + (uint32_t)v1.y),
+	                   (int32_t)((uint32_t)v0.z + (uint32_t)v1.z), (int32_t)((uint32_t)v0.w + (uint32_t)v1.w)};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_sub(const vectori_t v0, const vectori_t v1) {
+	return (vectori_t){(int32_t)((uint32_t)v0.x - (uint32_t)v1.x), (int32_t)((uint32_t)v0.y - (uint32_t)v1.y),
+	                   (int32_t)((uint32_t)v0.z - (uint32_t)v1.z), (int32_t)((uint32_t)v0.w - (uint32_t)v1.w)};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_mul(const vectori_t v0, const vectori_t v1) {
+	return (vectori_t){(int32_t)((uint32_t)v0.x * (uint32_t)v1.x), (int32_t)((uint32_t)v0.y * (uint32_t)v1.y),
+	                   (int32_t)((uint32_t)v0.z * (uint32_t)v1.z), (int32_t)((uint32_t)v0.w * (uint32_t)v1.w)};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_left(const vectori_t v, const int count) {
+	return (vectori_t){(int32_t)((uint32_t)v.x << count), (int32_t)((uint32_t)v.y << count),
+	                   (int32_t)((uint32_t)v.z << count), (int32_t)((uint32_t)v.w << count)};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_right(const vectori_t v, const int count) {
+	return (vectori_t){v.x >> count, v.y >> count, v.z >> count, v.w >> count};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_min(const vectori_t v0, const vectori_t v1) {
+	return (vectori_t){v0.x < v1.x ? v0.x : v1.x, v0.y < v1.y ? v0.y : v1.y, v0.z < v1.z ? v0.z : v1.z,
+	                   v0.w < v1.w ? v0.w : v1.w};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_max(const vectori_t v0, const vectori_t v1) {
+	return (vectori_t){v0.x > v1.x ? v0.x : v1.x, v0.y > v1.y ? v0.y : v1.y, v0.z > v1.z ? v0.z : v1.z,
+	                   v0.w > v1.w ? v0.w : v1.w};
+}
+
+// The float functions are used instead of math_floor and math_ceil which convert through an int,
+// so large values, infinities and the sign of zero are kept
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_floor(const vector_t v) {
+	return vector(floorf(v.x), floorf(v.y), floorf(v.z), floorf(v.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_ceil(const vector_t v) {
+	return vector(ceilf(v.x), ceilf(v.y), ceilf(v.z), ceilf(v.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_round(const vector_t v) {
+	// Ties to even in the default rounding mode
+	return vector(nearbyintf(v.x), nearbyintf(v.y), nearbyintf(v.z), nearbyintf(v.w));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vector_to_vectori(const vector_t v) {
+	return (vectori_t){(int32_t)v.x, (int32_t)v.y, (int32_t)v.z, (int32_t)v.w};
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vectori_to_vector(const vectori_t v) {
+	return vector((real)v.x, (real)v.y, (real)v.z, (real)v.w);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_rotate(const vector_t v, const matrix_t m) {
 	return vector((m.frow[0][0] * v.x) + (m.frow[1][0] * v.y) + (m.frow[2][0] * v.z),
@@ -379,6 +537,62 @@ vector_transform(const vector_t v, const matrix_t m) {
 	              (m.frow[0][3] * v.x) + (m.frow[1][3] * v.y) + (m.frow[2][3] * v.z) + (m.frow[3][3] * v.w));
 }
 
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	for (size_t i = 0; i < count; ++i)
+		out[i] = vector_rotate(in[i], m);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	for (size_t i = 0; i < count; ++i, in += 4, out += 4) {
+		const vector_t vr = vector_rotate(vector_unaligned(in), m);
+		out[0] = vr.x;
+		out[1] = vr.y;
+		out[2] = vr.z;
+		out[3] = vr.w;
+	}
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	for (size_t i = 0; i < count; ++i)
+		out[i] = vector_transform(in[i], m);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	for (size_t i = 0; i < count; ++i, in += 4, out += 4) {
+		const vector_t vr = vector_transform(vector_unaligned(in), m);
+		out[0] = vr.x;
+		out[1] = vr.y;
+		out[2] = vr.z;
+		out[3] = vr.w;
+	}
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	vector_rotate_array(out, in, count, m);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	vector_transform_array(out, in, count, m);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_load3_array(vector_t* out, const float32_t* in, size_t count) {
+	for (size_t i = 0; i < count; ++i, in += 3)
+		out[i] = vector_load3(in);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_store3_array(float32_t* out, const vector_t* in, size_t count) {
+	for (size_t i = 0; i < count; ++i, out += 3)
+		vector_store3(out, in[i]);
+}
+
 #if FOUNDATION_COMPILER_CLANG
 #pragma clang diagnostic pop
 #endif
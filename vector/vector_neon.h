@@ -22,22 +22,17 @@
 #endif
 #endif
 
-// Index for shuffle must be constant integer - hide function with a define
+#include <vector/mask_neon.h>
+
+// Index for shuffle must be constant integer - hide function with a define, the mask folds to the
+// specialized sequence in mask_neon.h
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_shuffle(const vector_t v, const unsigned int mask) {
 	FOUNDATION_ASSERT_FAIL("Unreachable code");
 	FOUNDATION_UNUSED(mask);
 	return v;
 }
-#define vector_shuffle(v, mask)                                                 \
-	__extension__({                                                             \
-		float32x4_t ret;                                                        \
-		ret = vmovq_n_f32(vgetq_lane_f32((v), (mask)&0x3));                     \
-		ret = vsetq_lane_f32(vgetq_lane_f32((v), ((mask) >> 2) & 0x3), ret, 1); \
-		ret = vsetq_lane_f32(vgetq_lane_f32((v), ((mask) >> 4) & 0x3), ret, 2); \
-		ret = vsetq_lane_f32(vgetq_lane_f32((v), ((mask) >> 6) & 0x3), ret, 3); \
-		ret;                                                                    \
-	})
+#define vector_shuffle(v, mask) vector_shuffle_specialized((v), (mask))
 
 // Index for shuffle must be constant integer - hide function with a define
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
@@ -74,6 +69,38 @@ vector_unaligned(const float32_t* FOUNDATION_RESTRICT v) {
 	return vld1q_f32(v);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load3(const float32_t* FOUNDATION_RESTRICT v) {
+	return vcombine_f32(vld1_f32(v), vset_lane_f32(v[2], vdup_n_f32(1.0f), 0));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_store3(float32_t* FOUNDATION_RESTRICT out, const vector_t v) {
+	vst1_f32(out, vget_low_f32(v));
+	vst1q_lane_f32(out + 2, v, 2);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_stream(vector_t* FOUNDATION_RESTRICT out, const vector_t v) {
+#if FOUNDATION_ARCH_ARM_64 && (FOUNDATION_COMPILER_GCC || FOUNDATION_COMPILER_CLANG)
+	// Non-temporal pair store of the two halves, there is no intrinsic for it
+	__asm__ __volatile__("stnp %d1, %d2, [%0]" : : "r"(out), "w"(vget_low_f32(v)), "w"(vget_high_f32(v)) : "memory");
+#else
+	vst1q_f32((float32_t*)out, v);
+#endif
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_stream_fence(void) {
+#if FOUNDATION_ARCH_ARM && (FOUNDATION_COMPILER_GCC || FOUNDATION_COMPILER_CLANG)
+	__asm__ __volatile__("dmb ishst" : : : "memory");
+#elif FOUNDATION_ARCH_ARM_64 && FOUNDATION_COMPILER_MSVC
+	__dmb(_ARM64_BARRIER_ISHST);
+#elif FOUNDATION_ARCH_ARM && FOUNDATION_COMPILER_MSVC
+	__dmb(_ARM_BARRIER_ISHST);
+#endif
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_uniform(const real v) {
 	return vdupq_n_f32(v);
@@ -136,6 +163,19 @@ vector_normalize3(const vector_t v) {
 	return vector_shuffle2(norm, splice, VECTOR_MASK_XYXW);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize_fast(const vector_t v) {
+	return vector_mul(v, vector_rsqrt_fast(vector_dot(v, v)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize3_fast(const vector_t v) {
+	// Shuffle to preserve w component of input vector
+	const vector_t norm = vector_mul(v, vector_rsqrt_fast(vector_dot3(v, v)));
+	const vector_t splice = vector_shuffle2(norm, v, VECTOR_MASK_ZZWW);
+	return vector_shuffle2(norm, splice, VECTOR_MASK_XYXW);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_dot(const vector_t v0, const vector_t v1) {
 	const vector_t r = vector_mul(v0, v1);
@@ -177,6 +217,14 @@ vector_div(const vector_t v0, const vector_t v1) {
 	return vdivq_f32(v0, v1);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_reciprocal_fast(const vector_t v) {
+	// Estimate with 8 bits precision refined by two Newton-Raphson steps, r' = r * (2 - v * r)
+	vector_t r = vrecpeq_f32(v);
+	r = vmulq_f32(vrecpsq_f32(v, r), r);
+	return vmulq_f32(vrecpsq_f32(v, r), r);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_add(const vector_t v0, const vector_t v1) {
 	return vaddq_f32(v0, v1);
@@ -256,9 +304,21 @@ vector_length(const vector_t v) {
 	return vector_sqrt(vector_dot(v, v));
 }
 
+// Length from the squared length as sqr * rsqrt(sqr). Squared lengths below the smallest normal
+// float give zero instead of NaN or infinity, and infinite ones are passed through. Classified
+// from the bits, which is unaffected by the fast math build flags
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_length_from_sqr_fast(const vector_t sqr) {
+	const uint32x4_t bits = vreinterpretq_u32_f32(sqr);
+	const uint32x4_t normal = vcgeq_u32(bits, vdupq_n_u32(0x00800000));
+	const uint32x4_t infinite = vceqq_u32(bits, vdupq_n_u32(0x7F800000));
+	const uint32x4_t length = vandq_u32(vreinterpretq_u32_f32(vmulq_f32(sqr, vector_rsqrt_fast(sqr))), normal);
+	return vreinterpretq_f32_u32(vbslq_u32(infinite, bits, length));
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length_fast(const vector_t v) {
-	return vector_sqrt(vector_dot(v, v));
+	return vector_length_from_sqr_fast(vector_dot(v, v));
 }
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
@@ -273,7 +333,7 @@ vector_length3(const vector_t v) {
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length3_fast(const vector_t v) {
-	return vector_sqrt(vector_dot3(v, v));
+	return vector_length_from_sqr_fast(vector_dot3(v, v));
 }
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
@@ -286,6 +346,14 @@ vector_sqrt(const vector_t v) {
 	return vsqrtq_f32(v);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_rsqrt_fast(const vector_t v) {
+	// Estimate with 8 bits precision refined by two Newton-Raphson steps, r' = r * (3 - v * r * r) / 2
+	vector_t r = vrsqrteq_f32(v);
+	r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+	return vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_min(const vector_t v0, const vector_t v1) {
 	return vminq_f32(v0, v1);
@@ -403,6 +471,168 @@ vector_greater(const vector_t v0, const vector_t v1) {
 	return vcgtq_f32(v0, v1);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	return vbslq_f32(vreinterpretq_u32_s32(mask), v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vectori_movemask(const vectori_t mask) {
+	// Sign bit of each lane shifted down to bit 0 and then up to the bit of the lane
+	const int32_t FOUNDATION_ALIGN(16) shift[4] = {0, 1, 2, 3};
+	const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_s32(mask), 31), vld1q_s32(shift));
+#if defined(__aarch64__)
+	return vaddvq_u32(bits);
+#else
+	const uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+	return vget_lane_u32(vpadd_u32(sum, sum), 0);
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_all(const vectori_t mask) {
+#if defined(__aarch64__)
+	return vminvq_u32(vreinterpretq_u32_s32(mask)) != 0;
+#else
+	return vectori_movemask(mask) == 0xF;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_any(const vectori_t mask) {
+#if defined(__aarch64__)
+	return vmaxvq_u32(vreinterpretq_u32_s32(mask)) != 0;
+#else
+	return vectori_movemask(mask) != 0;
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_clamp(const vector_t v, const vector_t lo, const vector_t hi) {
+	return vminq_f32(vmaxq_f32(v, lo), hi);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_saturate(const vector_t v) {
+	return vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_xor(const vectori_t v0, const vectori_t v1) {
+	return veorq_s32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori(const int32_t x, const int32_t y, const int32_t z, const int32_t w) {
+	const int32_t VECTOR_ALIGN data[4] = {x, y, z, w};
+	return vld1q_s32(data);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_uniform(const int32_t v) {
+	return vdupq_n_s32(v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_add(const vectori_t v0, const vectori_t v1) {
+	return vaddq_s32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_sub(const vectori_t v0, const vectori_t v1) {
+	return vsubq_s32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_mul(const vectori_t v0, const vectori_t v1) {
+	return vmulq_s32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_left(const vectori_t v, const int count) {
+	return vshlq_s32(v, vdupq_n_s32(count));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_right(const vectori_t v, const int count) {
+	return vshlq_s32(v, vdupq_n_s32(-count));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_min(const vectori_t v0, const vectori_t v1) {
+	return vminq_s32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_max(const vectori_t v0, const vectori_t v1) {
+	return vmaxq_s32(v0, v1);
+}
+
+#if !defined(__aarch64__)
+
+//! Restore the sign of zero results and pass through components that are already integral
+//! (magnitude 2^23 or greater, infinity or NaN) after rounding through an integer conversion
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_round_fixup(const vector_t v, const vector_t rounded) {
+	const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000U));
+	const uint32x4_t small = vcaltq_f32(v, vdupq_n_f32(8388608.0f));
+	return vbslq_f32(small, vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(rounded), sign)), v);
+}
+
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_floor(const vector_t v) {
+#if defined(__aarch64__)
+	return vrndmq_f32(v);
+#else
+	const vector_t truncated = vcvtq_f32_s32(vcvtq_s32_f32(v));
+	const uint32x4_t adjust = vandq_u32(vcgtq_f32(truncated, v), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)));
+	return vector_round_fixup(v, vsubq_f32(truncated, vreinterpretq_f32_u32(adjust)));
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_ceil(const vector_t v) {
+#if defined(__aarch64__)
+	return vrndpq_f32(v);
+#else
+	const vector_t truncated = vcvtq_f32_s32(vcvtq_s32_f32(v));
+	const uint32x4_t adjust = vandq_u32(vcltq_f32(truncated, v), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)));
+	return vector_round_fixup(v, vaddq_f32(truncated, vreinterpretq_f32_u32(adjust)));
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_round(const vector_t v) {
+#if defined(__aarch64__)
+	return vrndnq_f32(v);
+#else
+	// Truncate v + 0.5 with the sign of v, then step back toward zero where that overshoots. The sum
+	// can round up for values just below a half, and ties are moved to the even neighbour
+	const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000U));
+	const vector_t half = vreinterpretq_f32_u32(vorrq_u32(sign, vdupq_n_u32(0x3F000000U)));
+	const vector_t one = vreinterpretq_f32_u32(vorrq_u32(sign, vdupq_n_u32(0x3F800000U)));
+	const int32x4_t truncated = vcvtq_s32_f32(vaddq_f32(v, half));
+	const vector_t rounded = vcvtq_f32_s32(truncated);
+	const vector_t diff = vabdq_f32(rounded, v);
+	const uint32x4_t odd = vtstq_s32(truncated, vdupq_n_s32(1));
+	const uint32x4_t back = vorrq_u32(vcgtq_f32(diff, vdupq_n_f32(0.5f)),
+	                                  vandq_u32(vceqq_f32(diff, vdupq_n_f32(0.5f)), odd));
+	return vector_round_fixup(v, vbslq_f32(back, vsubq_f32(rounded, one), rounded));
+#endif
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vector_to_vectori(const vector_t v) {
+	return vcvtq_s32_f32(v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vectori_to_vector(const vectori_t v) {
+	return vcvtq_f32_s32(v);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_rotate(const vector_t v, const matrix_t m) {
 	vector_t vr;
@@ -423,6 +653,214 @@ vector_transform(const vector_t v, const matrix_t m) {
 	return vector_muladd(m.row[3], vector_shuffle(v, VECTOR_MASK_WWWW), vr);
 }
 
+// Multiply matrix rows by vector lanes directly, avoiding the lane splat shuffles
+#if defined(__aarch64__)
+#define VECTOR_MULADD_LANE(acc, row, half, lane) vfmaq_lane_f32(acc, row, half, lane)
+#else
+#define VECTOR_MULADD_LANE(acc, row, half, lane) vmlaq_lane_f32(acc, row, half, lane)
+#endif
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_rotate_rows(const vector_t v, const vector_t r0, const vector_t r1, const vector_t r2) {
+	const float32x2_t xy = vget_low_f32(v);
+	const float32x2_t zw = vget_high_f32(v);
+	vector_t vr = vmulq_lane_f32(r0, xy, 0);
+	vr = VECTOR_MULADD_LANE(vr, r1, xy, 1);
+	vr = VECTOR_MULADD_LANE(vr, r2, zw, 0);
+	return vsetq_lane_f32(vgetq_lane_f32(v, 3), vr, 3);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_transform_rows(const vector_t v, const vector_t r0, const vector_t r1, const vector_t r2,
+                      const vector_t r3) {
+	const float32x2_t xy = vget_low_f32(v);
+	const float32x2_t zw = vget_high_f32(v);
+	vector_t vr = vmulq_lane_f32(r0, xy, 0);
+	vr = VECTOR_MULADD_LANE(vr, r1, xy, 1);
+	vr = VECTOR_MULADD_LANE(vr, r2, zw, 0);
+	return VECTOR_MULADD_LANE(vr, r3, zw, 1);
+}
+
+#undef VECTOR_MULADD_LANE
+
+// Process four vectors at a time to hide latency of the multiply-add chains, matrix rows
+// are kept in registers for the entire loop
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		out[i] = vector_rotate_rows(v0, r0, r1, r2);
+		out[i + 1] = vector_rotate_rows(v1, r0, r1, r2);
+		out[i + 2] = vector_rotate_rows(v2, r0, r1, r2);
+		out[i + 3] = vector_rotate_rows(v3, r0, r1, r2);
+	}
+	for (; i < count; ++i)
+		out[i] = vector_rotate_rows(in[i], r0, r1, r2);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 16, out += 16) {
+		const vector_t v0 = vld1q_f32(in);
+		const vector_t v1 = vld1q_f32(in + 4);
+		const vector_t v2 = vld1q_f32(in + 8);
+		const vector_t v3 = vld1q_f32(in + 12);
+		vst1q_f32(out, vector_rotate_rows(v0, r0, r1, r2));
+		vst1q_f32(out + 4, vector_rotate_rows(v1, r0, r1, r2));
+		vst1q_f32(out + 8, vector_rotate_rows(v2, r0, r1, r2));
+		vst1q_f32(out + 12, vector_rotate_rows(v3, r0, r1, r2));
+	}
+	for (; i < count; ++i, in += 4, out += 4)
+		vst1q_f32(out, vector_rotate_rows(vld1q_f32(in), r0, r1, r2));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	const vector_t r3 = m.row[3];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		out[i] = vector_transform_rows(v0, r0, r1, r2, r3);
+		out[i + 1] = vector_transform_rows(v1, r0, r1, r2, r3);
+		out[i + 2] = vector_transform_rows(v2, r0, r1, r2, r3);
+		out[i + 3] = vector_transform_rows(v3, r0, r1, r2, r3);
+	}
+	for (; i < count; ++i)
+		out[i] = vector_transform_rows(in[i], r0, r1, r2, r3);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	const vector_t r3 = m.row[3];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 16, out += 16) {
+		const vector_t v0 = vld1q_f32(in);
+		const vector_t v1 = vld1q_f32(in + 4);
+		const vector_t v2 = vld1q_f32(in + 8);
+		const vector_t v3 = vld1q_f32(in + 12);
+		vst1q_f32(out, vector_transform_rows(v0, r0, r1, r2, r3));
+		vst1q_f32(out + 4, vector_transform_rows(v1, r0, r1, r2, r3));
+		vst1q_f32(out + 8, vector_transform_rows(v2, r0, r1, r2, r3));
+		vst1q_f32(out + 12, vector_transform_rows(v3, r0, r1, r2, r3));
+	}
+	for (; i < count; ++i, in += 4, out += 4)
+		vst1q_f32(out, vector_transform_rows(vld1q_f32(in), r0, r1, r2, r3));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	// Prefetch stops before the end to keep the addresses within the input array
+	const size_t prefetch_count = VECTOR_STREAM_PREFETCH_DISTANCE / sizeof(vector_t);
+	const size_t prefetch_end = (count > prefetch_count) ? count - prefetch_count : 0;
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		if (i < prefetch_end)
+			VECTOR_PREFETCH(in + i + prefetch_count);
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		vector_stream(out + i, vector_rotate_rows(v0, r0, r1, r2));
+		vector_stream(out + i + 1, vector_rotate_rows(v1, r0, r1, r2));
+		vector_stream(out + i + 2, vector_rotate_rows(v2, r0, r1, r2));
+		vector_stream(out + i + 3, vector_rotate_rows(v3, r0, r1, r2));
+	}
+	for (; i < count; ++i)
+		vector_stream(out + i, vector_rotate_rows(in[i], r0, r1, r2));
+	vector_stream_fence();
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	const vector_t r3 = m.row[3];
+	// Prefetch stops before the end to keep the addresses within the input array
+	const size_t prefetch_count = VECTOR_STREAM_PREFETCH_DISTANCE / sizeof(vector_t);
+	const size_t prefetch_end = (count > prefetch_count) ? count - prefetch_count : 0;
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		if (i < prefetch_end)
+			VECTOR_PREFETCH(in + i + prefetch_count);
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		vector_stream(out + i, vector_transform_rows(v0, r0, r1, r2, r3));
+		vector_stream(out + i + 1, vector_transform_rows(v1, r0, r1, r2, r3));
+		vector_stream(out + i + 2, vector_transform_rows(v2, r0, r1, r2, r3));
+		vector_stream(out + i + 3, vector_transform_rows(v3, r0, r1, r2, r3));
+	}
+	for (; i < count; ++i)
+		vector_stream(out + i, vector_transform_rows(in[i], r0, r1, r2, r3));
+	vector_stream_fence();
+}
+
+//! Four packed vectors are deinterleaved into component registers by the three element structure
+//! load and interleaved again with w by the four element structure store, and vice versa
+static FOUNDATION_FORCEINLINE void
+vector_load3_array(vector_t* out, const float32_t* in, size_t count) {
+	size_t i = 0;
+	float32x4x4_t xyzw;
+	xyzw.val[3] = vdupq_n_f32(1.0f);
+	for (; i + 4 <= count; i += 4, in += 12, out += 4) {
+		const float32x4x3_t xyz = vld3q_f32(in);
+		xyzw.val[0] = xyz.val[0];
+		xyzw.val[1] = xyz.val[1];
+		xyzw.val[2] = xyz.val[2];
+		vst4q_f32((float32_t*)out, xyzw);
+	}
+	for (; i < count; ++i, in += 3)
+		*out++ = vector_load3(in);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_store3_array(float32_t* out, const vector_t* in, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 4, out += 12) {
+		const float32x4x4_t xyzw = vld4q_f32((const float32_t*)in);
+		float32x4x3_t xyz;
+		xyz.val[0] = xyzw.val[0];
+		xyz.val[1] = xyzw.val[1];
+		xyz.val[2] = xyzw.val[2];
+		vst3q_f32(out, xyz);
+	}
+	for (; i < count; ++i, out += 3)
+		vector_store3(out, *in++);
+}
+
 #if FOUNDATION_COMPILER_CLANG
 #pragma clang diagnostic pop
 #endif
@@ -53,6 +53,31 @@ vector_unaligned(const float32_t* v) {
 	return _mm_loadu_ps(v);
 }
 
+//! Three component load and store with scalar and 64-bit moves, so no bytes past the xyz
+//! components are accessed
+static FOUNDATION_FORCEINLINE FOUNDATION_PURECALL vector_t
+vector_load3(const float32_t* FOUNDATION_RESTRICT v) {
+	const vector_t xy = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)v));
+	const vector_t zw = _mm_unpacklo_ps(_mm_load_ss(v + 2), _mm_set_ss(1.0f));
+	return _mm_movelh_ps(xy, zw);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_store3(float32_t* FOUNDATION_RESTRICT out, const vector_t v) {
+	_mm_storel_epi64((__m128i*)out, _mm_castps_si128(v));
+	_mm_store_ss(out + 2, _mm_movehl_ps(v, v));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_stream(vector_t* FOUNDATION_RESTRICT out, const vector_t v) {
+	_mm_stream_ps((float*)out, v);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_stream_fence(void) {
+	_mm_sfence();
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_uniform(real v) {
 	return _mm_set_ps1(v);
@@ -115,6 +140,19 @@ vector_normalize3(const vector_t v) {
 	return _mm_shuffle_ps(norm, splice, VECTOR_MASK_XYXW);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize_fast(const vector_t v) {
+	return vector_mul(v, vector_rsqrt_fast(vector_dot(v, v)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_normalize3_fast(const vector_t v) {
+	// Shuffle to preserve w component of input vector
+	const vector_t norm = vector_mul(v, vector_rsqrt_fast(vector_dot3(v, v)));
+	const vector_t splice = _mm_shuffle_ps(norm, v, VECTOR_MASK_ZZWW);
+	return _mm_shuffle_ps(norm, splice, VECTOR_MASK_XYXW);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_dot(const vector_t v0, const vector_t v1) {
 	const vector_t r = _mm_mul_ps(v0, v1);
@@ -148,6 +186,13 @@ vector_div(const vector_t v0, const vector_t v1) {
 	return _mm_div_ps(v0, v1);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_reciprocal_fast(const vector_t v) {
+	// Estimate with 12 bits precision refined by one Newton-Raphson step, r' = r * (2 - v * r)
+	const vector_t r = _mm_rcp_ps(v);
+	return _mm_sub_ps(_mm_add_ps(r, r), _mm_mul_ps(_mm_mul_ps(v, r), r));
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_add(const vector_t v0, const vector_t v1) {
 	return _mm_add_ps(v0, v1);
@@ -224,10 +269,21 @@ vector_length(const vector_t v) {
 	return vector_shuffle(vsqrt, VECTOR_MASK_XXXX);
 }
 
+// Length from the squared length as sqr * rsqrt(sqr). Squared lengths below the smallest normal
+// float give zero instead of NaN or infinity, and infinite ones are passed through. Classified
+// from the bits, which is unaffected by the fast math build flags
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_length_from_sqr_fast(const vector_t sqr) {
+	const __m128i bits = _mm_castps_si128(sqr);
+	const vector_t tiny = _mm_castsi128_ps(_mm_cmplt_epi32(bits, _mm_set1_epi32(0x00800000)));
+	const vector_t infinite = _mm_castsi128_ps(_mm_cmpeq_epi32(bits, _mm_set1_epi32(0x7F800000)));
+	const vector_t length = _mm_andnot_ps(tiny, _mm_mul_ps(sqr, vector_rsqrt_fast(sqr)));
+	return _mm_or_ps(_mm_andnot_ps(infinite, length), _mm_and_ps(infinite, sqr));
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length_fast(const vector_t v) {
-	const vector_t vsqrt = _mm_sqrt_ss(vector_length_sqr(v));
-	return vector_shuffle(vsqrt, VECTOR_MASK_XXXX);
+	return vector_length_from_sqr_fast(vector_dot(v, v));
 }
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
@@ -243,8 +299,7 @@ vector_length3(const vector_t v) {
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_length3_fast(const vector_t v) {
-	const vector_t vsqrt = _mm_sqrt_ss(vector_length3_sqr(v));
-	return vector_shuffle(vsqrt, VECTOR_MASK_XXXX);
+	return vector_length_from_sqr_fast(vector_dot3(v, v));
 }
 
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
@@ -257,6 +312,14 @@ vector_sqrt(const vector_t v) {
 	return _mm_sqrt_ps(v);
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_rsqrt_fast(const vector_t v) {
+	// Estimate with 12 bits precision refined by one Newton-Raphson step, r' = 0.5 * r * (3 - v * r * r)
+	const vector_t r = _mm_rsqrt_ps(v);
+	const vector_t vrr = _mm_mul_ps(_mm_mul_ps(v, r), r);
+	return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), r), _mm_sub_ps(_mm_set1_ps(3.0f), vrr));
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_min(const vector_t v0, const vector_t v1) {
 	return _mm_min_ps(v0, v1);
@@ -376,6 +439,132 @@ vector_greater(const vector_t v0, const vector_t v1) {
 	return _mm_castps_si128(_mm_cmpgt_ps(v0, v1));
 }
 
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_select(const vectori_t mask, const vector_t v0, const vector_t v1) {
+	const vector_t m = _mm_castsi128_ps(mask);
+	return _mm_or_ps(_mm_and_ps(m, v0), _mm_andnot_ps(m, v1));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL unsigned int
+vectori_movemask(const vectori_t mask) {
+	return (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(mask));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_all(const vectori_t mask) {
+	return _mm_movemask_ps(_mm_castsi128_ps(mask)) == 0xF;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL bool
+vectori_any(const vectori_t mask) {
+	return _mm_movemask_ps(_mm_castsi128_ps(mask)) != 0;
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_clamp(const vector_t v, const vector_t lo, const vector_t hi) {
+	return _mm_min_ps(_mm_max_ps(v, lo), hi);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_saturate(const vector_t v) {
+	return _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_xor(const vectori_t v0, const vectori_t v1) {
+	return _mm_xor_si128(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori(const int32_t x, const int32_t y, const int32_t z, const int32_t w) {
+	return _mm_setr_epi32(x, y, z, w);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_uniform(const int32_t v) {
+	return _mm_set1_epi32(v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_add(const vectori_t v0, const vectori_t v1) {
+	return _mm_add_epi32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_sub(const vectori_t v0, const vectori_t v1) {
+	return _mm_sub_epi32(v0, v1);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_mul(const vectori_t v0, const vectori_t v1) {
+	// No 32-bit low multiply before SSE4, multiply even and odd lanes as 64-bit and interleave
+	const __m128i even = _mm_mul_epu32(v0, v1);
+	const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(v0, 32), _mm_srli_epi64(v1, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+	                          _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_left(const vectori_t v, const int count) {
+	return _mm_sll_epi32(v, _mm_cvtsi32_si128(count));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_shift_right(const vectori_t v, const int count) {
+	return _mm_sra_epi32(v, _mm_cvtsi32_si128(count));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_min(const vectori_t v0, const vectori_t v1) {
+	const __m128i greater = _mm_cmpgt_epi32(v0, v1);
+	return _mm_or_si128(_mm_and_si128(greater, v1), _mm_andnot_si128(greater, v0));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vectori_max(const vectori_t v0, const vectori_t v1) {
+	const __m128i greater = _mm_cmpgt_epi32(v0, v1);
+	return _mm_or_si128(_mm_and_si128(greater, v0), _mm_andnot_si128(greater, v1));
+}
+
+//! Restore the sign of zero results and pass through components that are already integral
+//! (magnitude 2^23 or greater, infinity or NaN) after rounding through an integer conversion
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_round_fixup(const vector_t v, const vector_t rounded) {
+	const vector_t sign = _mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000)));
+	const vector_t small = _mm_cmplt_ps(_mm_andnot_ps(sign, v), _mm_set1_ps(8388608.0f));
+	return _mm_or_ps(_mm_and_ps(small, _mm_or_ps(rounded, sign)), _mm_andnot_ps(small, v));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_floor(const vector_t v) {
+	const vector_t truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+	const vector_t adjust = _mm_and_ps(_mm_cmpgt_ps(truncated, v), _mm_set1_ps(1.0f));
+	return vector_round_fixup(v, _mm_sub_ps(truncated, adjust));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_ceil(const vector_t v) {
+	const vector_t truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+	const vector_t adjust = _mm_and_ps(_mm_cmplt_ps(truncated, v), _mm_set1_ps(1.0f));
+	return vector_round_fixup(v, _mm_add_ps(truncated, adjust));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vector_round(const vector_t v) {
+	// Conversion uses the current rounding mode, which is round to nearest even by default
+	return vector_round_fixup(v, _mm_cvtepi32_ps(_mm_cvtps_epi32(v)));
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vectori_t
+vector_to_vectori(const vector_t v) {
+	return _mm_cvttps_epi32(v);
+}
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
+vectori_to_vector(const vectori_t v) {
+	return _mm_cvtepi32_ps(v);
+}
+
 static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_t
 vector_rotate(const vector_t v, const matrix_t m) {
 	vector_t vr;
@@ -395,3 +584,242 @@ vector_transform(const vector_t v, const matrix_t m) {
 	vr = vector_muladd(m.row[2], vector_shuffle(v, VECTOR_MASK_ZZZZ), vr);
 	return vector_muladd(m.row[3], vector_shuffle(v, VECTOR_MASK_WWWW), vr);
 }
+
+// Rotate four vectors at a time to hide latency of the multiply-add chains, matrix rows
+// are kept in registers for the entire loop. Shuffle to preserve w component of input vectors
+#define VECTOR_ROTATE_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2)                   \
+	t0 = vector_mul(r0, vector_shuffle(v0, VECTOR_MASK_XXXX));                           \
+	t1 = vector_mul(r0, vector_shuffle(v1, VECTOR_MASK_XXXX));                           \
+	t2 = vector_mul(r0, vector_shuffle(v2, VECTOR_MASK_XXXX));                           \
+	t3 = vector_mul(r0, vector_shuffle(v3, VECTOR_MASK_XXXX));                           \
+	t0 = vector_muladd(r1, vector_shuffle(v0, VECTOR_MASK_YYYY), t0);                    \
+	t1 = vector_muladd(r1, vector_shuffle(v1, VECTOR_MASK_YYYY), t1);                    \
+	t2 = vector_muladd(r1, vector_shuffle(v2, VECTOR_MASK_YYYY), t2);                    \
+	t3 = vector_muladd(r1, vector_shuffle(v3, VECTOR_MASK_YYYY), t3);                    \
+	t0 = vector_muladd(r2, vector_shuffle(v0, VECTOR_MASK_ZZZZ), t0);                    \
+	t1 = vector_muladd(r2, vector_shuffle(v1, VECTOR_MASK_ZZZZ), t1);                    \
+	t2 = vector_muladd(r2, vector_shuffle(v2, VECTOR_MASK_ZZZZ), t2);                    \
+	t3 = vector_muladd(r2, vector_shuffle(v3, VECTOR_MASK_ZZZZ), t3);                    \
+	t0 = _mm_shuffle_ps(t0, _mm_shuffle_ps(t0, v0, VECTOR_MASK_ZZWW), VECTOR_MASK_XYXW); \
+	t1 = _mm_shuffle_ps(t1, _mm_shuffle_ps(t1, v1, VECTOR_MASK_ZZWW), VECTOR_MASK_XYXW); \
+	t2 = _mm_shuffle_ps(t2, _mm_shuffle_ps(t2, v2, VECTOR_MASK_ZZWW), VECTOR_MASK_XYXW); \
+	t3 = _mm_shuffle_ps(t3, _mm_shuffle_ps(t3, v3, VECTOR_MASK_ZZWW), VECTOR_MASK_XYXW)
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		vector_t t0, t1, t2, t3;
+		VECTOR_ROTATE_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2);
+		out[i] = t0;
+		out[i + 1] = t1;
+		out[i + 2] = t2;
+		out[i + 3] = t3;
+	}
+	for (; i < count; ++i)
+		out[i] = vector_rotate(in[i], m);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 16, out += 16) {
+		const vector_t v0 = _mm_loadu_ps(in);
+		const vector_t v1 = _mm_loadu_ps(in + 4);
+		const vector_t v2 = _mm_loadu_ps(in + 8);
+		const vector_t v3 = _mm_loadu_ps(in + 12);
+		vector_t t0, t1, t2, t3;
+		VECTOR_ROTATE_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2);
+		_mm_storeu_ps(out, t0);
+		_mm_storeu_ps(out + 4, t1);
+		_mm_storeu_ps(out + 8, t2);
+		_mm_storeu_ps(out + 12, t3);
+	}
+	for (; i < count; ++i, in += 4, out += 4)
+		_mm_storeu_ps(out, vector_rotate(_mm_loadu_ps(in), m));
+}
+
+// Four vectors fill one cache line of output with streaming stores, and one cache line of input
+// is prefetched per iteration
+static FOUNDATION_FORCEINLINE void
+vector_rotate_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	// Prefetch stops before the end to keep the addresses within the input array
+	const size_t prefetch_count = VECTOR_STREAM_PREFETCH_DISTANCE / sizeof(vector_t);
+	const size_t prefetch_end = (count > prefetch_count) ? count - prefetch_count : 0;
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		if (i < prefetch_end)
+			VECTOR_PREFETCH(in + i + prefetch_count);
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		vector_t t0, t1, t2, t3;
+		VECTOR_ROTATE_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2);
+		vector_stream(out + i, t0);
+		vector_stream(out + i + 1, t1);
+		vector_stream(out + i + 2, t2);
+		vector_stream(out + i + 3, t3);
+	}
+	for (; i < count; ++i)
+		vector_stream(out + i, vector_rotate(in[i], m));
+	vector_stream_fence();
+}
+
+#undef VECTOR_ROTATE_STEP
+
+// Transform four vectors at a time to hide latency of the multiply-add chains, matrix rows
+// are kept in registers for the entire loop
+#define VECTOR_TRANSFORM_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2, r3) \
+	t0 = vector_mul(r0, vector_shuffle(v0, VECTOR_MASK_XXXX));                \
+	t1 = vector_mul(r0, vector_shuffle(v1, VECTOR_MASK_XXXX));                \
+	t2 = vector_mul(r0, vector_shuffle(v2, VECTOR_MASK_XXXX));                \
+	t3 = vector_mul(r0, vector_shuffle(v3, VECTOR_MASK_XXXX));                \
+	t0 = vector_muladd(r1, vector_shuffle(v0, VECTOR_MASK_YYYY), t0);         \
+	t1 = vector_muladd(r1, vector_shuffle(v1, VECTOR_MASK_YYYY), t1);         \
+	t2 = vector_muladd(r1, vector_shuffle(v2, VECTOR_MASK_YYYY), t2);         \
+	t3 = vector_muladd(r1, vector_shuffle(v3, VECTOR_MASK_YYYY), t3);         \
+	t0 = vector_muladd(r2, vector_shuffle(v0, VECTOR_MASK_ZZZZ), t0);         \
+	t1 = vector_muladd(r2, vector_shuffle(v1, VECTOR_MASK_ZZZZ), t1);         \
+	t2 = vector_muladd(r2, vector_shuffle(v2, VECTOR_MASK_ZZZZ), t2);         \
+	t3 = vector_muladd(r2, vector_shuffle(v3, VECTOR_MASK_ZZZZ), t3);         \
+	t0 = vector_muladd(r3, vector_shuffle(v0, VECTOR_MASK_WWWW), t0);         \
+	t1 = vector_muladd(r3, vector_shuffle(v1, VECTOR_MASK_WWWW), t1);         \
+	t2 = vector_muladd(r3, vector_shuffle(v2, VECTOR_MASK_WWWW), t2);         \
+	t3 = vector_muladd(r3, vector_shuffle(v3, VECTOR_MASK_WWWW), t3)
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	const vector_t r3 = m.row[3];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		vector_t t0, t1, t2, t3;
+		VECTOR_TRANSFORM_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2, r3);
+		out[i] = t0;
+		out[i + 1] = t1;
+		out[i + 2] = t2;
+		out[i + 3] = t3;
+	}
+	for (; i < count; ++i)
+		out[i] = vector_transform(in[i], m);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_unaligned(float32_t* out, const float32_t* in, size_t count, const matrix_t m) {
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	const vector_t r3 = m.row[3];
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 16, out += 16) {
+		const vector_t v0 = _mm_loadu_ps(in);
+		const vector_t v1 = _mm_loadu_ps(in + 4);
+		const vector_t v2 = _mm_loadu_ps(in + 8);
+		const vector_t v3 = _mm_loadu_ps(in + 12);
+		vector_t t0, t1, t2, t3;
+		VECTOR_TRANSFORM_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2, r3);
+		_mm_storeu_ps(out, t0);
+		_mm_storeu_ps(out + 4, t1);
+		_mm_storeu_ps(out + 8, t2);
+		_mm_storeu_ps(out + 12, t3);
+	}
+	for (; i < count; ++i, in += 4, out += 4)
+		_mm_storeu_ps(out, vector_transform(_mm_loadu_ps(in), m));
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_transform_array_stream(vector_t* out, const vector_t* in, size_t count, const matrix_t m) {
+	FOUNDATION_ASSERT_ALIGNMENT(in, 16);
+	FOUNDATION_ASSERT_ALIGNMENT(out, 16);
+	const vector_t r0 = m.row[0];
+	const vector_t r1 = m.row[1];
+	const vector_t r2 = m.row[2];
+	const vector_t r3 = m.row[3];
+	// Prefetch stops before the end to keep the addresses within the input array
+	const size_t prefetch_count = VECTOR_STREAM_PREFETCH_DISTANCE / sizeof(vector_t);
+	const size_t prefetch_end = (count > prefetch_count) ? count - prefetch_count : 0;
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		if (i < prefetch_end)
+			VECTOR_PREFETCH(in + i + prefetch_count);
+		const vector_t v0 = in[i];
+		const vector_t v1 = in[i + 1];
+		const vector_t v2 = in[i + 2];
+		const vector_t v3 = in[i + 3];
+		vector_t t0, t1, t2, t3;
+		VECTOR_TRANSFORM_STEP(t0, t1, t2, t3, v0, v1, v2, v3, r0, r1, r2, r3);
+		vector_stream(out + i, t0);
+		vector_stream(out + i + 1, t1);
+		vector_stream(out + i + 2, t2);
+		vector_stream(out + i + 3, t3);
+	}
+	for (; i < count; ++i)
+		vector_stream(out + i, vector_transform(in[i], m));
+	vector_stream_fence();
+}
+
+//! Four packed vectors are loaded and stored as three registers, (x0 y0 z0 x1) (y1 z1 x2 y2) and
+//! (z2 x3 y3 z3), rearranged with shuffles. The remaining vectors use the scalar versions
+static FOUNDATION_FORCEINLINE void
+vector_load3_array(vector_t* out, const float32_t* in, size_t count) {
+	const vector_t one = _mm_set_ps1(1.0f);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 12, out += 4) {
+		const vector_t a = _mm_loadu_ps(in);
+		const vector_t b = _mm_loadu_ps(in + 4);
+		const vector_t c = _mm_loadu_ps(in + 8);
+		const vector_t z0 = _mm_shuffle_ps(a, one, VECTOR_MASK_ZZXX);
+		const vector_t x1y1 = _mm_shuffle_ps(a, b, VECTOR_MASK_WWXX);
+		const vector_t z1 = _mm_shuffle_ps(b, one, VECTOR_MASK_YYXX);
+		const vector_t z2 = _mm_shuffle_ps(c, one, VECTOR_MASK_XXXX);
+		const vector_t z3 = _mm_shuffle_ps(c, one, VECTOR_MASK_WWXX);
+		out[0] = _mm_shuffle_ps(a, z0, VECTOR_MASK_XYXZ);
+		out[1] = _mm_shuffle_ps(x1y1, z1, VECTOR_MASK_XZXZ);
+		out[2] = _mm_shuffle_ps(b, z2, VECTOR_MASK_ZWXZ);
+		out[3] = _mm_shuffle_ps(c, z3, VECTOR_MASK_YZXZ);
+	}
+	for (; i < count; ++i, in += 3)
+		*out++ = vector_load3(in);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_store3_array(float32_t* out, const vector_t* in, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4, in += 4, out += 12) {
+		const vector_t z0x1 = _mm_shuffle_ps(in[0], in[1], VECTOR_MASK_ZZXX);
+		const vector_t z2x3 = _mm_shuffle_ps(in[2], in[3], VECTOR_MASK_ZZXX);
+		_mm_storeu_ps(out, _mm_shuffle_ps(in[0], z0x1, VECTOR_MASK_XYXZ));
+		_mm_storeu_ps(out + 4, _mm_shuffle_ps(in[1], in[2], VECTOR_MASK_YZXY));
+		_mm_storeu_ps(out + 8, _mm_shuffle_ps(z2x3, in[3], VECTOR_MASK_XZYZ));
+	}
+	for (; i < count; ++i, out += 3)
+		vector_store3(out, *in++);
+}
+
+#undef VECTOR_TRANSFORM_STEP
@@ -0,0 +1,232 @@
+/* view.c  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data types and
+ * functions to write applications and games in a platform-independent fashion. The latest source code is
+ * always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any restrictions.
+ *
+ */
+
+#include <vector/vector.h>
+#include <vector/pack.h>
+#include <vector/bounds.h>
+#include <vector/internal.h>
+
+static const size_t vector_view_size[] = {sizeof(float32_t), sizeof(uint16_t), sizeof(uint8_t),
+                                          sizeof(int8_t),    sizeof(uint16_t), sizeof(int16_t)};
+
+// Components [0, 0, 0, 1] in each storage type, padded to 16 bytes for the partial element copy
+static const float32_t vector_view_origo_float32[4] = {0, 0, 0, 1};
+static const uint16_t vector_view_origo_half[8] = {0, 0, 0, 0x3C00};
+static const uint8_t vector_view_origo_unorm8[16] = {0, 0, 0, 0xFF};
+static const int8_t vector_view_origo_snorm8[16] = {0, 0, 0, 0x7F};
+static const uint16_t vector_view_origo_unorm16[8] = {0, 0, 0, 0xFFFF};
+static const int16_t vector_view_origo_snorm16[8] = {0, 0, 0, 0x7FFF};
+
+static const void* const vector_view_origo[] = {vector_view_origo_float32, vector_view_origo_half,
+                                                vector_view_origo_unorm8,  vector_view_origo_snorm8,
+                                                vector_view_origo_unorm16, vector_view_origo_snorm16};
+
+static FOUNDATION_FORCEINLINE vector_t
+vector_view_decode(const void* element, vector_view_type_t type) {
+	switch (type) {
+		case VECTOR_VIEW_HALF:
+			return vector_load_half(element);
+		case VECTOR_VIEW_UNORM8:
+			return vector_load_unorm8(element);
+		case VECTOR_VIEW_SNORM8:
+			return vector_load_snorm8(element);
+		case VECTOR_VIEW_UNORM16:
+			return vector_load_unorm16(element);
+		case VECTOR_VIEW_SNORM16:
+			return vector_load_snorm16(element);
+		case VECTOR_VIEW_FLOAT32:
+		default:
+			return vector_unaligned(element);
+	}
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_view_encode(void* element, vector_view_type_t type, const vector_t v) {
+	switch (type) {
+		case VECTOR_VIEW_HALF:
+			vector_store_half(element, v);
+			break;
+		case VECTOR_VIEW_UNORM8:
+			vector_store_unorm8(element, v);
+			break;
+		case VECTOR_VIEW_SNORM8:
+			vector_store_snorm8(element, v);
+			break;
+		case VECTOR_VIEW_UNORM16:
+			vector_store_unorm16(element, v);
+			break;
+		case VECTOR_VIEW_SNORM16:
+			vector_store_snorm16(element, v);
+			break;
+		case VECTOR_VIEW_FLOAT32:
+		default:
+			memcpy(element, &v, sizeof(vector_t));
+			break;
+	}
+}
+
+//! Read element, with overread set when four full components can be read from the element
+//! without passing the end of the buffer
+static FOUNDATION_FORCEINLINE vector_t
+vector_view_read(const vector_view_t* view, const void* element, bool overread) {
+	if (view->components >= 4)
+		return vector_view_decode(element, view->type);
+	if (overread) {
+		const vector_t v = vector_view_decode(element, view->type);
+		if (view->components == 3)
+			return transform_splice_w(v, vector_one());
+		if (view->components == 2)
+			return vector_shuffle2(v, vector_origo(), VECTOR_MASK_XYZW);
+		const vector_t xxzw = vector_shuffle2(v, vector_origo(), VECTOR_MASK_XXZW);
+		return vector_shuffle2(xxzw, xxzw, VECTOR_MASK_XZZW);
+	}
+	if ((view->type == VECTOR_VIEW_FLOAT32) && (view->components == 3))
+		return vector_load3(element);
+	uint8_t value[16];
+	memcpy(value, vector_view_origo[view->type], sizeof(value));
+	memcpy(value, element, vector_view_size[view->type] * view->components);
+	return vector_view_decode(value, view->type);
+}
+
+static FOUNDATION_FORCEINLINE void
+vector_view_write(const vector_view_t* view, void* element, const vector_t v) {
+	if (view->components >= 4) {
+		vector_view_encode(element, view->type, v);
+		return;
+	}
+	if ((view->type == VECTOR_VIEW_FLOAT32) && (view->components == 3)) {
+		vector_store3(element, v);
+		return;
+	}
+	uint8_t value[16];
+	vector_view_encode(value, view->type, v);
+	memcpy(element, value, vector_view_size[view->type] * view->components);
+}
+
+//! Number of leading elements that can be read with overread. With a stride of at least the element
+//! size the four components read from an element are within the components of the three following
+//! elements, so only the last three elements need a partial copy. Smaller strides, zero to broadcast
+//! one element or overlapping elements, use the partial copy for all elements
+static FOUNDATION_FORCEINLINE size_t
+vector_view_overread_count(const vector_view_t* view, size_t count) {
+	if (view->stride < vector_view_size[view->type] * view->components)
+		return 0;
+	return (count > 3) ? count - 3 : 0;
+}
+
+#define VECTOR_VIEW_LOOP_ELEMENTS(out, in, count, op)                          \
+	do {                                                                       \
+		const uint8_t* src = (const uint8_t*)(in)->data;                       \
+		uint8_t* dst = (uint8_t*)(out)->data;                                  \
+		const size_t overread = vector_view_overread_count(in, count);         \
+		size_t i = 0;                                                          \
+		for (; i < overread; ++i, src += (in)->stride, dst += (out)->stride)   \
+			vector_view_write(out, dst, op(vector_view_read(in, src, true)));  \
+		for (; i < count; ++i, src += (in)->stride, dst += (out)->stride)      \
+			vector_view_write(out, dst, op(vector_view_read(in, src, false))); \
+	} while (0)
+
+#define VECTOR_VIEW_LOOP_FLOAT32(out, in, count, op, in_components, out_components)                      \
+	do {                                                                                                 \
+		const vector_view_t in_view = vector_view(in->data, in->stride, in_components, VECTOR_VIEW_FLOAT32); \
+		const vector_view_t out_view =                                                                   \
+		    vector_view(out->data, out->stride, out_components, VECTOR_VIEW_FLOAT32);                    \
+		VECTOR_VIEW_LOOP_ELEMENTS(&out_view, &in_view, count, op);                                       \
+	} while (0)
+
+//! Loop over elements, with separate loops for the common float32 layouts with three or four
+//! components where the element format is known at compile time
+#define VECTOR_VIEW_LOOP(out, in, count, op)                                                           \
+	do {                                                                                               \
+		if ((in->type == VECTOR_VIEW_FLOAT32) && (out->type == VECTOR_VIEW_FLOAT32) &&                 \
+		    (in->components >= 3) && (out->components >= 3)) {                                        \
+			if (in->components == 3) {                                                                 \
+				if (out->components == 3)                                                              \
+					VECTOR_VIEW_LOOP_FLOAT32(out, in, count, op, 3, 3);                                \
+				else                                                                                   \
+					VECTOR_VIEW_LOOP_FLOAT32(out, in, count, op, 3, 4);                                \
+			} else {                                                                                   \
+				if (out->components == 3)                                                              \
+					VECTOR_VIEW_LOOP_FLOAT32(out, in, count, op, 4, 3);                                \
+				else                                                                                   \
+					VECTOR_VIEW_LOOP_FLOAT32(out, in, count, op, 4, 4);                                \
+			}                                                                                          \
+		} else {                                                                                       \
+			VECTOR_VIEW_LOOP_ELEMENTS(out, in, count, op);                                             \
+		}                                                                                              \
+	} while (0)
+
+vector_t
+vector_view_load(const vector_view_t* view, size_t index) {
+	return vector_view_read(view, (const uint8_t*)view->data + (index * view->stride), false);
+}
+
+void
+vector_view_store(const vector_view_t* view, size_t index, const vector_t v) {
+	vector_view_write(view, (uint8_t*)view->data + (index * view->stride), v);
+}
+
+void
+vector_convert_view(const vector_view_t* out, const vector_view_t* in, size_t count) {
+#define VECTOR_VIEW_IDENTITY(v) (v)
+	VECTOR_PROFILE_BEGIN();
+	VECTOR_VIEW_LOOP(out, in, count, VECTOR_VIEW_IDENTITY);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_CONVERT_VIEW, count);
+#undef VECTOR_VIEW_IDENTITY
+}
+
+void
+vector_rotate_view(const vector_view_t* out, const vector_view_t* in, size_t count, const matrix_t m) {
+#define VECTOR_VIEW_ROTATE(v) vector_rotate(v, m)
+	VECTOR_PROFILE_BEGIN();
+	VECTOR_VIEW_LOOP(out, in, count, VECTOR_VIEW_ROTATE);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_ROTATE_VIEW, count);
+#undef VECTOR_VIEW_ROTATE
+}
+
+void
+vector_transform_view(const vector_view_t* out, const vector_view_t* in, size_t count, const matrix_t m) {
+#define VECTOR_VIEW_TRANSFORM(v) vector_transform(v, m)
+	VECTOR_PROFILE_BEGIN();
+	VECTOR_VIEW_LOOP(out, in, count, VECTOR_VIEW_TRANSFORM);
+	VECTOR_PROFILE_END(VECTOR_PROFILE_VECTOR_TRANSFORM_VIEW, count);
+#undef VECTOR_VIEW_TRANSFORM
+}
+
+aabb_t
+aabb_from_view(const vector_view_t* view, size_t count) {
+	if ((view->type == VECTOR_VIEW_FLOAT32) && (view->components >= 3) && (view->stride >= 12))
+		return aabb_from_points(view->data, view->stride, count);
+	if (!count)
+		return aabb(vector_zero(), vector_zero());
+
+	const uint8_t* src = (const uint8_t*)view->data;
+	const size_t overread = vector_view_overread_count(view, count);
+	vector_t vmin = vector_view_read(view, src, overread > 0);
+	vector_t vmax = vmin;
+	size_t i = 1;
+	for (src += view->stride; i < overread; ++i, src += view->stride) {
+		const vector_t v = vector_view_read(view, src, true);
+		vmin = vector_min(vmin, v);
+		vmax = vector_max(vmax, v);
+	}
+	for (; i < count; ++i, src += view->stride) {
+		const vector_t v = vector_view_read(view, src, false);
+		vmin = vector_min(vmin, v);
+		vmax = vector_max(vmax, v);
+	}
+	return aabb(transform_splice_w(vmin, vector_zero()), transform_splice_w(vmax, vector_zero()));
+}
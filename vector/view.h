@@ -0,0 +1,61 @@
+/* view.h  -  Vector library  -  Public Domain  -  2013 Mattias Jansson
+ *
+ * This library provides a cross-platform vector math library in C11 providing basic support data
+ * types and functions to write applications and games in a platform-independent fashion. The latest
+ * source code is always available at
+ *
+ * https://github.com/mjansson/vector_lib
+ *
+ * This library is built on top of the foundation library available at
+ *
+ * https://github.com/mjansson/foundation_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without any
+ * restrictions.
+ *
+ */
+#pragma once
+
+/*! \file view.h
+    Strided views of vectors stored in place in interleaved buffers, for example vertex buffers
+    with position, normal and texture coordinates in each vertex. Batch functions read and write
+    through the views without intermediate copies. Input and output views may refer to the same
+    components of the same buffer. Buffers have no alignment requirements */
+
+#include <foundation/platform.h>
+#include <foundation/types.h>
+
+#include <vector/types.h>
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_view_t
+vector_view(void* data, size_t stride, unsigned int components, vector_view_type_t type);
+
+//! Load element at index, see vector_view_t for components not stored in the buffer
+VECTOR_API vector_t
+vector_view_load(const vector_view_t* view, size_t index);
+
+//! Store the first components of the vector to element at index
+VECTOR_API void
+vector_view_store(const vector_view_t* view, size_t index, const vector_t v);
+
+//! Convert count elements between views, packing or unpacking between storage types
+VECTOR_API void
+vector_convert_view(const vector_view_t* out, const vector_view_t* in, size_t count);
+
+//! Rotate count elements by matrix, see vector_rotate
+VECTOR_API void
+vector_rotate_view(const vector_view_t* out, const vector_view_t* in, size_t count, const matrix_t m);
+
+//! Transform count elements by matrix, see vector_transform. Elements with three or fewer
+//! components are transformed as points
+VECTOR_API void
+vector_transform_view(const vector_view_t* out, const vector_view_t* in, size_t count, const matrix_t m);
+
+//! Bounding box of the xyz components of count elements, see aabb_from_points
+VECTOR_API aabb_t
+aabb_from_view(const vector_view_t* view, size_t count);
+
+static FOUNDATION_FORCEINLINE FOUNDATION_CONSTCALL vector_view_t
+vector_view(void* data, size_t stride, unsigned int components, vector_view_type_t type) {
+	return (vector_view_t){data, stride, components, type};
+}